@@ -11,8 +11,8 @@
  * @file bed_mesh_geometry.h
  * @brief 3D geometry generation for bed mesh visualization
  *
- * Provides functions for generating 3D mesh quads from height data and
- * sorting them for proper depth ordering (painter's algorithm).
+ * Provides functions for generating 3D mesh quads from height data.
+ * Occlusion is resolved later by the rasterizer's depth buffer.
  *
  * All functions operate on an existing bed_mesh_renderer_t instance in
  * the helix::mesh namespace.
@@ -47,16 +47,15 @@ namespace mesh {
 void generate_mesh_quads(bed_mesh_renderer_t* renderer);
 
 /**
- * @brief Sort quads by average depth (painter's algorithm)
+ * @brief Recompute mesh quad colors in place after a color range change
  *
- * Sorts quads in descending depth order (furthest first) to ensure
- * correct occlusion when rendering without a Z-buffer.
+ * Leaves world positions and cached screen projections untouched, so the next
+ * frame only re-rasterizes the surface. Falls back to generate_mesh_quads() if
+ * the quads have not been generated yet.
  *
- * Uses quad.avg_depth which must be computed during projection.
- *
- * @param quads Vector of quads to sort (modified in-place)
+ * @param renderer Renderer instance with valid mesh data
  */
-void sort_quads_by_depth(std::vector<bed_mesh_quad_3d_t>& quads);
+void recolor_mesh_quads(bed_mesh_renderer_t* renderer);
 
 /**
  * @brief Interpolate coordinate from mesh index to printer coordinate
@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include "bed_mesh_rasterizer.h"
 #include "bed_mesh_renderer.h"
 
 #include <array>
+#include <cstdint>
 #include <vector>
 
 /**
@@ -23,7 +25,8 @@
  *
  * State transitions:
  * - UNINITIALIZED → MESH_LOADED: set_mesh_data() called
- * - MESH_LOADED → MESH_LOADED: set_z_scale() or set_color_range() invalidates quads
+ * - MESH_LOADED → MESH_LOADED: set_z_scale() regenerates quads; set_color_range() only
+ *   recolors them (cached projections stay valid)
  * - MESH_LOADED → READY_TO_RENDER: quads generated and projected
  * - READY_TO_RENDER → MESH_LOADED: view state changes (rotation, FOV)
  * - ANY → ERROR: validation failure in public API
@@ -41,6 +44,48 @@ enum class RendererState {
     ERROR            // Invalid state (e.g., set_mesh_data failed)
 };
 
+/**
+ * @brief Inputs a cached bed mesh frame was produced from
+ *
+ * The renderer keeps one key for its cached projections and one for the cached
+ * surface bitmap. A redraw whose inputs match skips that work: LVGL invalidations
+ * from overlays, labels or partial-redraw bands just blit the cached surface and
+ * redraw the decorations.
+ */
+struct bed_mesh_frame_key {
+    bool valid = false;
+    uint32_t geometry_revision = 0; // Quad world positions (see generate_mesh_quads)
+    uint32_t color_revision = 0;    // Quad colors only (see recolor_mesh_quads)
+    double angle_x = 0.0;
+    double angle_z = 0.0;
+    double z_scale = 0.0;
+    double fov_scale = 0.0;
+    int center_offset_x = 0;
+    int center_offset_y = 0;
+    int canvas_width = 0;
+    int canvas_height = 0;
+    int layer_offset_x = 0;
+    int layer_offset_y = 0;
+    bool is_dragging = false; // Solid vs. gradient fill
+
+    /// True if projected screen coordinates computed for @p other are valid for this key
+    bool same_projection(const bed_mesh_frame_key& other) const {
+        return valid && other.valid && geometry_revision == other.geometry_revision &&
+               angle_x == other.angle_x && angle_z == other.angle_z &&
+               z_scale == other.z_scale && fov_scale == other.fov_scale &&
+               center_offset_x == other.center_offset_x &&
+               center_offset_y == other.center_offset_y && canvas_width == other.canvas_width &&
+               canvas_height == other.canvas_height && layer_offset_x == other.layer_offset_x &&
+               layer_offset_y == other.layer_offset_y;
+    }
+
+    /// True if a surface rasterized for @p other can be reused for this key
+    bool same_surface(const bed_mesh_frame_key& other) const {
+        return same_projection(other) && color_revision == other.color_revision &&
+               is_dragging == other.is_dragging;
+    }
+};
+
 // Internal renderer state structure
 struct bed_mesh_renderer {
     // State machine
@@ -93,6 +138,19 @@ struct bed_mesh_renderer {
     std::vector<std::vector<int>> projected_screen_x; // [row][col] → screen X coordinate
     std::vector<std::vector<int>> projected_screen_y; // [row][col] → screen Y coordinate
 
+    // Mesh surface target: quads are rasterized here with a depth buffer, then drawn
+    // with a single lv_draw_image(). Recreated when the canvas size changes.
+    helix::mesh::MeshSpanRasterizer surface_rasterizer;
+    lv_draw_buf_t* surface_buf = nullptr;
+
+    // ===== Frame Cache =====
+    // Revisions are bumped by generate_mesh_quads() / recolor_mesh_quads(); the keys
+    // record what the cached projections and surface_buf were last built from.
+    uint32_t geometry_revision = 0;
+    uint32_t color_revision = 0;
+    bed_mesh_frame_key projection_key; // projected_screen_* and quad screen coords
+    bed_mesh_frame_key surface_key;    // surface_buf contents
+
     // ===== Adaptive Render Mode (Phase 4) =====
 
     // Render mode control
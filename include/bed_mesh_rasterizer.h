@@ -7,73 +7,97 @@
  * @file bed_mesh_rasterizer.h
  * @brief Triangle rasterization for bed mesh visualization
  *
- * Provides scanline-based triangle fill algorithms with support for:
- * - Solid color fills
- * - Per-vertex gradient interpolation
- * - Adaptive segment counts for performance optimization
+ * Scanline triangle fills written straight into an ARGB8888 pixel buffer:
+ * - Solid color or per-vertex gradient (Gouraud) fills
+ * - Fixed-point edge and attribute stepping, one pass per span
+ * - 16-bit depth buffer, so quads can be drawn in any order
  *
- * Uses LVGL's draw layer API for hardware-accelerated rendering.
+ * The renderer blits the finished buffer with one lv_draw_image() instead of
+ * issuing an LVGL rectangle per scanline (or several per scanline for gradients).
+ *
+ * @gotchas Pixels are LVGL ARGB8888 (B, G, R, A bytes in memory, not premultiplied).
+ *          Edges follow a top-left fill rule: a pixel on an edge shared by two
+ *          triangles is drawn by exactly one of them.
  */
 
 #include <lvgl/lvgl.h>
 
+#include <cstdint>
+#include <vector>
+
 namespace helix {
 namespace mesh {
 
 /// Default opacity for mesh triangle surfaces (100% - fully opaque)
 constexpr lv_opa_t MESH_TRIANGLE_OPACITY = LV_OPA_COVER;
 
-/// Minimum line width for gradient rasterization (use solid color below this)
-constexpr int GRADIENT_MIN_LINE_WIDTH = 3;
-
-// ========== Adaptive Gradient Rasterization Constants ==========
-// Line width thresholds for adaptive segment count
-constexpr int GRADIENT_THIN_LINE_THRESHOLD = 20;   // Lines < 20px use 2 segments
-constexpr int GRADIENT_MEDIUM_LINE_THRESHOLD = 50; // Lines 20-49px use 3 segments
-
-// Segment counts for different line widths
-constexpr int GRADIENT_THIN_SEGMENT_COUNT = 2;   // Thin lines: 2 segments (faster)
-constexpr int GRADIENT_MEDIUM_SEGMENT_COUNT = 3; // Medium lines: 3 segments (balanced)
-constexpr int GRADIENT_WIDE_SEGMENT_COUNT = 4;   // Wide lines: 4 segments (better quality)
-
-// Gradient sampling position within segment (0.0 = start, 0.5 = center, 1.0 = end)
-constexpr double GRADIENT_SEGMENT_SAMPLE_POSITION = 0.5;
+/// Depth buffer value nothing is behind (cleared to this every frame)
+constexpr uint16_t MESH_DEPTH_FAR = UINT16_MAX;
 
 /**
- * @brief Fill triangle with solid color using scanline rasterization
- *
- * Uses batched rectangle draws for performance (15-20% faster than pixel-by-pixel).
- * LVGL's layer system handles clipping automatically.
+ * @brief Depth-buffered triangle rasterizer for the mesh surface
  *
- * @param layer LVGL draw layer
- * @param x1, y1 First vertex coordinates
- * @param x2, y2 Second vertex coordinates
- * @param x3, y3 Third vertex coordinates
- * @param color Fill color
- * @param opacity Fill opacity (default: MESH_TRIANGLE_OPACITY)
+ * Opaque triangles test and write depth; translucent ones (the zero plane)
+ * test depth and blend without writing it, so draw them after the opaque
+ * ones. One rasterizer per target; not thread-safe.
  */
-void fill_triangle_solid(lv_layer_t* layer, int x1, int y1, int x2, int y2, int x3, int y3,
-                         lv_color_t color, lv_opa_t opacity = MESH_TRIANGLE_OPACITY);
+class MeshSpanRasterizer {
+  public:
+    /// Triangle corner: screen position, depth (0 = nearest) and color
+    struct Vertex {
+        int x;
+        int y;
+        uint16_t depth;
+        lv_color_t color;
+    };
 
-/**
- * @brief Fill triangle with per-vertex color gradient
- *
- * Uses adaptive segment count based on line width for optimal performance/quality:
- * - Thin lines (< 20px): 2 segments
- * - Medium lines (20-49px): 3 segments
- * - Wide lines (50+ px): 4 segments
- *
- * This reduces draw calls by 50-66% compared to fixed segment counts.
- *
- * @param layer LVGL draw layer
- * @param x1, y1, c1 First vertex position and color
- * @param x2, y2, c2 Second vertex position and color
- * @param x3, y3, c3 Third vertex position and color
- * @param opacity Fill opacity (default: MESH_TRIANGLE_OPACITY)
- */
-void fill_triangle_gradient(lv_layer_t* layer, int x1, int y1, lv_color_t c1, int x2, int y2,
-                            lv_color_t c2, int x3, int y3, lv_color_t c3,
-                            lv_opa_t opacity = MESH_TRIANGLE_OPACITY);
+    /**
+     * @brief Bind to a pixel buffer and clear the depth buffer
+     *
+     * The pixels are not cleared; the depth buffer is only reallocated when
+     * the size changes.
+     *
+     * @param pixels ARGB8888 buffer (must outlive the frame)
+     * @param width, height Buffer size in pixels
+     * @param stride Bytes per row (>= width * 4)
+     * @param origin_x, origin_y Screen position of the buffer's top-left pixel
+     */
+    void begin(uint8_t* pixels, int width, int height, int stride, int origin_x = 0,
+               int origin_y = 0);
+
+    /**
+     * @brief Fill a triangle with colors interpolated from its corners
+     * @param opacity LV_OPA_COVER writes depth; lower values blend over what is drawn
+     */
+    void fill_triangle_gradient(const Vertex& a, const Vertex& b, const Vertex& c,
+                                lv_opa_t opacity = MESH_TRIANGLE_OPACITY);
+
+    /**
+     * @brief Fill a triangle with one color (corner colors are ignored)
+     * @param opacity LV_OPA_COVER writes depth; lower values blend over what is drawn
+     */
+    void fill_triangle_solid(const Vertex& a, const Vertex& b, const Vertex& c, lv_color_t color,
+                             lv_opa_t opacity = MESH_TRIANGLE_OPACITY);
+
+    /// Pixels that passed the depth test since begin()
+    size_t pixels_drawn() const {
+        return pixels_drawn_;
+    }
+
+  private:
+    template <bool Gradient>
+    void fill_triangle(const Vertex& a, const Vertex& b, const Vertex& c, lv_color_t solid,
+                       lv_opa_t opacity);
+
+    uint8_t* pixels_ = nullptr;
+    int width_ = 0;
+    int height_ = 0;
+    int stride_ = 0;
+    int origin_x_ = 0;
+    int origin_y_ = 0;
+    std::vector<uint16_t> depth_;
+    size_t pixels_drawn_ = 0;
+};
 
 } // namespace mesh
 } // namespace helix
@@ -54,7 +54,7 @@ extern "C" {
  * - Accounts for overlay panel position on screen (e.g., panel at x=136)
  * - Calculated once on first render, stable across rotations
  * - Scanline triangle rasterization with gradient interpolation
- * - Painter's algorithm depth sorting
+ * - 16-bit depth buffer (no per-frame quad sorting)
  * - Scientific heat-map color mapping (purple → blue → cyan → yellow → red)
  *
  * Based on GuppyScreen's bed mesh visualization with adaptations for
@@ -62,7 +62,7 @@ extern "C" {
  * algorithm details.
  *
  * Performance target: 20×20 mesh at 30+ FPS on embedded hardware
- * Rendering complexity: O(n log n) for sorting + O(pixels) for rasterization
+ * Rendering complexity: O(n) projection + O(pixels) for rasterization
  */
 
 // Rendering configuration constants
@@ -87,8 +87,6 @@ extern "C" {
 #define BED_MESH_COLOR_COMPRESSION 0.8        // Color range compression (0.8 = 80% of data range)
 #define BED_MESH_Z_ORIGIN_VERTICAL_POS                                                             \
     0.5 // Canvas Y position for Z=0 plane (0=top, 0.5=center, 1=bottom)
-#define BED_MESH_GRADIENT_SEGMENTS 6       // Max gradient segments per scanline
-#define BED_MESH_GRADIENT_MIN_LINE_WIDTH 3 // Use solid color for lines narrower than this
 #define BED_MESH_GRID_MARGIN 25.0          // Grid margin in world units (extends past mesh edges)
 
 // FPS threshold for auto-degrading to 2D mode
@@ -110,7 +108,7 @@ typedef enum {
 struct bed_mesh_point_3d_t {
     double x, y, z;         // 3D world coordinates
     int screen_x, screen_y; // 2D screen coordinates after projection
-    double depth;           // Z-depth from camera (for sorting)
+    double depth;           // Z-depth from camera (larger = farther)
 };
 
 // 3D vertex with color information
@@ -126,9 +124,9 @@ struct bed_mesh_quad_3d_t {
     // Cached screen-space projections (computed once per frame, reused for rendering)
     int screen_x[4];  // Screen X coordinates for vertices[0..3]
     int screen_y[4];  // Screen Y coordinates for vertices[0..3]
-    double depths[4]; // Z-depths for vertices[0..3] (for sorting/debugging)
+    double depths[4]; // Z-depths for vertices[0..3] (for the depth buffer)
 
-    double avg_depth;        // Average depth for back-to-front sorting (computed from depths[])
+    double avg_depth;        // Average of depths[] (debugging)
     lv_color_t center_color; // Fallback solid color for fast rendering (drag mode)
     lv_opa_t opacity;        // Quad opacity (LV_OPA_COVER for mesh, lower for zero plane)
 };
@@ -299,8 +297,14 @@ void bed_mesh_renderer_auto_color_range(bed_mesh_renderer_t* renderer);
  * 2. Compute projection parameters (Z-scale, FOV-scale)
  * 3. Generate 3D quads from mesh data with colors
  * 4. Project quads to 2D screen space
- * 5. Sort quads by depth (painter's algorithm)
- * 6. Render quads (gradient or solid based on dragging state)
+ * 5. Rasterize quads into a depth-buffered surface image (gradient or solid
+ *    based on dragging state) and draw it with one lv_draw_image()
+ * 6. Draw decorations (grid lines, labels)
+ *
+ * Steps 4-5 are cached: a redraw with the same mesh data, view state, canvas
+ * size/position and fill mode reuses the projections and the surface bitmap and
+ * only redraws reference grids and decorations. A color range change keeps the
+ * projections and re-rasterizes the surface.
  *
  * @param renderer Renderer instance
  * @param layer LVGL draw layer (from DRAW_POST event callback)
@@ -73,6 +73,12 @@ class ColorSensorManager : public ISensorManager {
     /// @brief Update state from Moonraker TD-1 status JSON
     void update_from_status(const nlohmann::json& status) override;
 
+    /// @brief Update state from status objects routed by PrinterState
+    void update_from_objects(const StatusObjects& objects) override;
+
+    /// @brief Routing interest: TD-1 device IDs (td1_* or uppercase serials), not Klipper objects
+    [[nodiscard]] bool handles_status_object(const std::string& object) const override;
+
     /// @brief Inject mock sensor objects for testing UI
     void inject_mock_sensors(std::vector<std::string>& objects, nlohmann::json& config_keys,
                              nlohmann::json& moonraker_info) override;
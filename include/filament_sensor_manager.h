@@ -267,6 +267,12 @@ class FilamentSensorManager : public helix::sensors::ISensorManager {
      */
     void update_from_status(const nlohmann::json& status) override;
 
+    /// @brief Update state from status objects routed by PrinterState
+    void update_from_objects(const StatusObjects& objects) override;
+
+    /// @brief Routing interest: filament_switch_sensor and filament_motion_sensor objects
+    [[nodiscard]] bool handles_status_object(const std::string& object) const override;
+
     /// @brief Inject mock sensor objects for testing UI
     void inject_mock_sensors(std::vector<std::string>& objects, nlohmann::json& config_keys,
                              nlohmann::json& moonraker_info) override;
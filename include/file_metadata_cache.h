@@ -0,0 +1,242 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file file_metadata_cache.h
+ * @brief Persistent cache of Moonraker file metadata for the print file browser
+ *
+ * @pattern One JSON file of FileMetadata keyed by path + modified time; misses go
+ *          through a request queue with a concurrency cap, and concurrent
+ *          requests for the same file share one RPC
+ * @threading Safe to call from any thread; callbacks run on the caller's thread
+ *            for hits and on the fetcher's thread (usually the WebSocket thread)
+ *            for misses
+ * @gotchas Modified times are compared in whole seconds, matching
+ *          PrintFileData::modified_timestamp
+ *
+ * Cache format (JSON):
+ * {
+ *   "version": 1,
+ *   "entries": { "subdir/part.gcode": { "modified": 1700000000, "used": 42,
+ *                                       "metadata": { ... } } }
+ * }
+ */
+
+#pragma once
+
+#include "moonraker_types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hv/json.hpp"
+
+namespace helix {
+
+/**
+ * @brief Serialize FileMetadata to JSON
+ * @param metadata Metadata to serialize
+ * @return JSON object
+ */
+nlohmann::json file_metadata_to_json(const FileMetadata& metadata);
+
+/**
+ * @brief Deserialize FileMetadata from JSON
+ * @param json JSON object written by file_metadata_to_json()
+ * @return Deserialized metadata (missing fields keep their defaults)
+ */
+FileMetadata file_metadata_from_json(const nlohmann::json& json);
+
+/**
+ * @brief Remembers file metadata across directory visits and restarts
+ *
+ * Opening a folder used to cost one get_file_metadata RPC per visible file,
+ * every time. With this cache, unchanged files render straight from disk and
+ * only new or re-uploaded files reach Moonraker, a few at a time.
+ */
+class FileMetadataCache {
+  public:
+    using MetadataCallback = std::function<void(const FileMetadata&)>;
+    using FailureCallback = std::function<void(const std::string& error)>;
+
+    /**
+     * @brief Performs one metadata request for a queued miss
+     *
+     * Must call exactly one of the callbacks, from any thread.
+     */
+    using Fetcher = std::function<void(MetadataCallback on_success, FailureCallback on_error)>;
+
+    /// Default number of metadata requests in flight at once
+    static constexpr size_t DEFAULT_MAX_IN_FLIGHT = 4;
+
+    /// Default entry cap; least recently used entries beyond it are dropped
+    static constexpr size_t DEFAULT_MAX_ENTRIES = 5000;
+
+    /// Cache file name inside the cache directory
+    static constexpr const char* FILE_NAME = "file_metadata.json";
+
+    /// Cache format version
+    static constexpr int FORMAT_VERSION = 1;
+
+    /// Counters for logging and tests
+    struct Stats {
+        size_t hits = 0;      ///< Requests answered from the cache
+        size_t misses = 0;    ///< Requests that needed a fetch
+        size_t coalesced = 0; ///< Misses that joined an identical pending fetch
+        size_t fetches = 0;   ///< Fetches started
+        size_t failures = 0;  ///< Fetches that failed
+        size_t in_flight = 0; ///< Fetches currently running
+        size_t queued = 0;    ///< Fetches waiting for a slot
+        size_t entries = 0;   ///< Cached files
+    };
+
+    /**
+     * @brief Use the helix cache dir ("file_metadata") with default limits
+     */
+    FileMetadataCache();
+
+    /**
+     * @brief Use an explicit directory (tests, custom locations)
+     * @param directory Cache directory (created if missing; empty keeps the cache in memory)
+     * @param max_in_flight Concurrency cap for fetches (at least 1)
+     * @param max_entries Entry cap
+     */
+    explicit FileMetadataCache(std::string directory, size_t max_in_flight = DEFAULT_MAX_IN_FLIGHT,
+                               size_t max_entries = DEFAULT_MAX_ENTRIES);
+
+    ~FileMetadataCache();
+
+    FileMetadataCache(const FileMetadataCache&) = delete;
+    FileMetadataCache& operator=(const FileMetadataCache&) = delete;
+
+    /**
+     * @brief Look up cached metadata
+     * @param path File path relative to the gcodes root
+     * @param modified Modification time reported by list_files/get_directory
+     * @return Metadata if cached for exactly this modification time
+     */
+    std::optional<FileMetadata> lookup(const std::string& path, double modified);
+
+    /**
+     * @brief Cache metadata for a file, replacing any older entry
+     * @param path File path relative to the gcodes root
+     * @param modified Modification time the metadata belongs to
+     * @param metadata Metadata to cache
+     */
+    void store(const std::string& path, double modified, const FileMetadata& metadata);
+
+    /**
+     * @brief Get metadata from the cache, or queue a fetch on a miss
+     *
+     * Hits call @p on_success before returning. Misses are fetched with at most
+     * max_in_flight() requests running; identical pending misses share one fetch.
+     * Successful fetches are stored and the cache file is saved once the queue drains.
+     *
+     * @param path File path relative to the gcodes root
+     * @param modified Modification time from the directory listing
+     * @param fetcher Issues the RPC for this file on a miss
+     * @param on_success Receives the metadata
+     * @param on_error Receives the fetch error
+     * @return true if answered from the cache
+     */
+    bool request(const std::string& path, double modified, Fetcher fetcher,
+                 MetadataCallback on_success, FailureCallback on_error);
+
+    /**
+     * @brief Drop entries of a directory that no longer match its listing
+     *
+     * Entries for files that are gone or whose modification time changed are
+     * removed. Subdirectories are left alone.
+     *
+     * @param directory Directory path relative to the gcodes root (empty = root)
+     * @param listing Directory contents from get_directory/list_files
+     * @return Number of entries removed
+     */
+    size_t revalidate(const std::string& directory, const std::vector<FileInfo>& listing);
+
+    /**
+     * @brief Write the cache file if anything changed since the last save
+     * @return true if the file is up to date
+     */
+    bool flush();
+
+    /**
+     * @brief Remove all entries and the cache file
+     */
+    void clear();
+
+    /**
+     * @brief Get a snapshot of the counters
+     */
+    Stats stats() const;
+
+    /**
+     * @brief Get the concurrency cap
+     */
+    size_t max_in_flight() const {
+        return max_in_flight_;
+    }
+
+    /**
+     * @brief Get the cache file path
+     * @return Path, or empty if the cache is memory-only
+     */
+    const std::string& file_path() const {
+        return file_path_;
+    }
+
+  private:
+    struct Entry {
+        int64_t modified = 0;
+        uint64_t used = 0; ///< Access tick for LRU trimming
+        FileMetadata metadata;
+    };
+
+    struct Waiter {
+        MetadataCallback on_success;
+        FailureCallback on_error;
+    };
+
+    struct Pending {
+        int64_t modified = 0;
+        Fetcher fetcher;
+        std::vector<Waiter> waiters;
+        bool started = false;
+    };
+
+    void load_locked();
+    bool save_locked();
+    void trim_locked();
+    void pump();
+    void complete(const std::string& path, int64_t modified, const FileMetadata* metadata,
+                  const std::string& error);
+
+    std::string file_path_;
+    size_t max_in_flight_;
+    size_t max_entries_;
+
+    mutable std::mutex mutex_;
+    bool loaded_ = false;
+    bool dirty_ = false;
+    uint64_t tick_ = 0;
+    std::unordered_map<std::string, Entry> entries_;
+    std::unordered_map<std::string, Pending> pending_; ///< Keyed by path
+    std::deque<std::string> queue_;                    ///< Paths waiting for a slot
+    size_t in_flight_ = 0;
+    bool pumping_ = false; ///< A pump() loop is dispatching; synchronous completions defer to it
+    Stats stats_;
+};
+
+/**
+ * @brief Get the process-wide metadata cache
+ */
+FileMetadataCache& get_file_metadata_cache();
+
+} // namespace helix
@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace helix {
@@ -26,6 +29,13 @@ namespace gcode {
  */
 class GCodeDataSource {
   public:
+    /// How the caller is about to read the source (read-ahead hint)
+    enum class AccessPattern {
+        Normal,     ///< No particular pattern
+        Sequential, ///< Front to back, once (indexing, full parse)
+        Random,     ///< Scattered layer ranges (streaming)
+    };
+
     virtual ~GCodeDataSource() = default;
 
     /**
@@ -39,6 +49,32 @@ class GCodeDataSource {
      */
     virtual std::vector<char> read_range(uint64_t offset, uint32_t length) = 0;
 
+    /**
+     * @brief Get a zero-copy view of a byte range
+     *
+     * Only sources that keep their bytes addressable (memory-mapped files,
+     * memory buffers) support this; callers fall back to read_range() when
+     * the view is empty. Views stay valid for the lifetime of the source and
+     * may be used from any thread.
+     *
+     * @param offset Starting byte position
+     * @param length Number of bytes (clamped to end of source)
+     * @return View of the bytes, or empty if unsupported or out of range
+     */
+    virtual std::string_view view_range(uint64_t offset, uint32_t length) const {
+        (void)offset;
+        (void)length;
+        return {};
+    }
+
+    /**
+     * @brief Hint the upcoming access pattern (no-op unless the source can use it)
+     * @param pattern Expected access pattern
+     */
+    virtual void advise(AccessPattern pattern) {
+        (void)pattern;
+    }
+
     /**
      * @brief Get total size of the data source
      * @return Size in bytes, or 0 if unknown
@@ -99,6 +135,20 @@ class GCodeDataSource {
         return true;
     }
 
+    /**
+     * @brief Identity of the current file contents, for on-disk caches
+     *
+     * Changes whenever the file is replaced or modified (path + size +
+     * modification time for local files, Moonraker's `modified` timestamp for
+     * remote ones). Sources without a stable identity return empty, which
+     * disables caching for them.
+     *
+     * @return Cache key, or empty string if the source can't be cached
+     */
+    virtual std::string cache_key() const {
+        return "";
+    }
+
     /**
      * @brief Read a single line starting at offset
      *
@@ -120,21 +170,44 @@ class GCodeDataSource {
      * @return All bytes from source
      */
     std::vector<char> read_all();
+
+    /**
+     * @brief Visit the whole source in blocks that end on line boundaries
+     *
+     * Blocks are views from view_range() when available, otherwise copies
+     * from read_range(). A block is only longer than @p block_size when a
+     * single line is. Concatenated, the blocks are the whole source.
+     *
+     * @param block_size Target bytes per block
+     * @param visit Called for each block in order; return false to stop early
+     * @return false if a read failed
+     */
+    bool read_line_blocks(uint32_t block_size,
+                          const std::function<bool(std::string_view block)>& visit);
 };
 
 /**
  * @brief Data source for local files
  *
- * Uses standard file I/O with fseek/fread for efficient random access.
- * This is the most efficient source for local G-code files.
+ * Memory-maps the file read-only, so view_range() hands out zero-copy views
+ * and read_range() is a memcpy that is safe from any thread. When mmap is
+ * unavailable (some USB/FUSE mounts) it falls back to fseek/fread, which
+ * is not thread-safe; callers serialize those reads.
+ *
+ * Touching a mapped page past the end of a file that shrank raises SIGBUS.
+ * Replacing the file (write + rename) keeps the old inode and is harmless, but
+ * truncating it in place is not, so the mapping is re-checked with fstat()
+ * before use. Once the file is shorter than when it was opened, view_range()
+ * returns empty and read_range() uses pread(), which just comes up short.
  */
 class FileDataSource : public GCodeDataSource {
   public:
     /**
      * @brief Create data source from file path
      * @param filepath Path to local file
+     * @param use_mmap Try to memory-map the file (false forces the fread path)
      */
-    explicit FileDataSource(const std::string& filepath);
+    explicit FileDataSource(const std::string& filepath, bool use_mmap = true);
 
     ~FileDataSource() override;
 
@@ -147,11 +220,22 @@ class FileDataSource : public GCodeDataSource {
     FileDataSource& operator=(FileDataSource&& other) noexcept;
 
     std::vector<char> read_range(uint64_t offset, uint32_t length) override;
+    std::string_view view_range(uint64_t offset, uint32_t length) const override;
+    void advise(AccessPattern pattern) override;
     uint64_t file_size() const override;
     bool supports_range_requests() const override;
     std::string source_name() const override;
     bool is_valid() const override;
     std::string indexable_file_path() const override;
+    std::string cache_key() const override;
+
+    /**
+     * @brief Check whether the file is memory-mapped
+     * @return true if view_range() is available
+     */
+    bool is_memory_mapped() const {
+        return mapped_ != nullptr && !map_stale_.load(std::memory_order_relaxed);
+    }
 
     /**
      * @brief Get the file path
@@ -162,9 +246,14 @@ class FileDataSource : public GCodeDataSource {
     }
 
   private:
+    void unmap();
+    bool mapping_intact() const;
+
     std::string filepath_;
     FILE* file_{nullptr};
     uint64_t size_{0};
+    const char* mapped_{nullptr}; ///< Read-only mapping of the whole file, or null
+    mutable std::atomic<bool> map_stale_{false}; ///< File shrank; mapping is unsafe to touch
 };
 
 /**
@@ -194,12 +283,15 @@ class MoonrakerDataSource : public GCodeDataSource {
     MoonrakerDataSource& operator=(const MoonrakerDataSource&) = delete;
 
     std::vector<char> read_range(uint64_t offset, uint32_t length) override;
+    std::string_view view_range(uint64_t offset, uint32_t length) const override;
+    void advise(AccessPattern pattern) override;
     uint64_t file_size() const override;
     bool supports_range_requests() const override;
     std::string source_name() const override;
     bool is_valid() const override;
     std::string indexable_file_path() const override;
     bool ensure_indexable() override;
+    std::string cache_key() const override;
 
     /**
      * @brief Force download of entire file to temp storage
@@ -233,6 +325,17 @@ class MoonrakerDataSource : public GCodeDataSource {
         return temp_file_path_;
     }
 
+    /**
+     * @brief Read size and mtime from a /server/files/metadata response body
+     *
+     * @param body JSON response ({"result": {"size": ..., "modified": ...}})
+     * @param[out] size File size in bytes
+     * @param[out] modified File mtime (epoch seconds); left unchanged if absent
+     * @return false if the body is not JSON or has no positive size
+     */
+    static bool parse_metadata_response(const std::string& body, uint64_t& size,
+                                        double& modified);
+
   private:
     /**
      * @brief Test if server supports Range requests
@@ -257,6 +360,7 @@ class MoonrakerDataSource : public GCodeDataSource {
     std::string moonraker_url_;
     std::string gcode_path_;
     uint64_t size_{0};
+    double modified_{0.0}; ///< Moonraker's file mtime (epoch seconds), 0 if unknown
     bool range_support_probed_{false};
     bool range_support_{false};
     bool metadata_fetched_{false};
@@ -289,6 +393,7 @@ class MemoryDataSource : public GCodeDataSource {
     explicit MemoryDataSource(std::vector<char> data, std::string name = "memory");
 
     std::vector<char> read_range(uint64_t offset, uint32_t length) override;
+    std::string_view view_range(uint64_t offset, uint32_t length) const override;
     uint64_t file_size() const override;
     bool supports_range_requests() const override;
     std::string source_name() const override;
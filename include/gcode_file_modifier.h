@@ -8,7 +8,6 @@
 #include <filesystem>
 #include <functional>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace helix {
@@ -27,6 +26,16 @@ namespace gcode {
  */
 constexpr size_t MAX_BUFFERED_FILE_SIZE = 5 * 1024 * 1024;
 
+/**
+ * @brief Modifications up to this line take the header-only fast path
+ *
+ * GCodeOpsDetector only scans the preamble (500 lines by default), so the
+ * usual edits (commented-out BED_MESH_CALIBRATE, PRINT_START skip params) sit
+ * well inside this region. apply() then rewrites just those lines and copies
+ * the rest of the file in blocks instead of splitting every line.
+ */
+constexpr size_t HEADER_REGION_LINES = 1000;
+
 /**
  * @brief Type of modification to apply to G-code
  */
@@ -203,23 +212,20 @@ class GCodeFileModifier {
     /**
      * @brief Apply modifications using streaming (for large files)
      *
-     * This method processes the file line-by-line without loading it entirely
-     * into memory. Critical for embedded devices with limited RAM where G-code
-     * files can be 100MB+.
+     * This method processes the file block-by-block through a GCodeStreamModifier
+     * without loading it entirely into memory. Critical for embedded devices with
+     * limited RAM where G-code files can be 100MB+.
      *
-     * **Limitations of streaming mode:**
-     * - DELETE modifications skip lines (work correctly)
-     * - COMMENT_OUT modifications work on single lines
-     * - INJECT_BEFORE/AFTER work correctly
-     * - REPLACE works for single lines
-     * - Multi-line ranges (end_line_number > 0) are NOT supported and will
-     *   be handled as single-line operations with a warning
+     * Lines after the last modified line are not split at all: once the stream
+     * passes it, the rest of the file is copied in blocks. Ranges are supported
+     * for COMMENT_OUT, DELETE and REPLACE, and line endings are preserved.
      *
      * @param filepath Path to the source G-code file
      * @return ModificationResult with success status and modified file path
      *
      * @note This method is automatically called by apply() for files larger
-     *       than MAX_BUFFERED_FILE_SIZE.
+     *       than the StreamingPolicy threshold, and for any file whose
+     *       modifications all lie within HEADER_REGION_LINES.
      */
     [[nodiscard]] ModificationResult apply_streaming(const std::filesystem::path& filepath);
 
@@ -285,6 +291,13 @@ class GCodeFileModifier {
      */
     [[nodiscard]] static std::string generate_temp_path(const std::filesystem::path& original_path);
 
+    /**
+     * @brief Comment out a single line
+     *
+     * @return "; <line>", followed by "  ; [HelixScreen: <reason>]" if a reason is given
+     */
+    static std::string comment_out_line(const std::string& line, const std::string& reason);
+
     /**
      * @brief Clean up temp files created by this modifier
      *
@@ -310,20 +323,9 @@ class GCodeFileModifier {
                                    ModificationResult& result);
 
     /**
-     * @brief Comment out a single line
-     */
-    static std::string comment_out_line(const std::string& line, const std::string& reason);
-
-    /**
-     * @brief Build line-number-indexed lookup map for streaming mode
-     *
-     * Creates a map where keys are line numbers (1-indexed) and values are
-     * the modifications to apply. For COMMENT_OUT/DELETE with ranges, creates
-     * entries for each line in the range.
-     *
-     * @return Map of line_number -> Modification for O(1) lookup during streaming
+     * @brief Last line touched by any pending modification (0 if none)
      */
-    [[nodiscard]] std::unordered_map<size_t, Modification> build_streaming_lookup() const;
+    [[nodiscard]] size_t last_modified_line() const;
 
     /**
      * @brief Apply buffered mode (loads file into memory)
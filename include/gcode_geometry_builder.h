@@ -150,6 +150,77 @@ using NormalCache = std::unordered_map<glm::vec3, uint16_t, Vec3Hash, Vec3Equal>
 /// Type alias for color palette cache (O(1) lookup)
 using ColorCache = std::unordered_map<uint32_t, uint8_t>;
 
+struct RibbonGeometry;
+
+/**
+ * @brief Dequantized, palette-resolved vertex arrays for bulk submission
+ *
+ * Built once per RibbonGeometry so a frame hands TinyGL flat arrays through
+ * glDrawElements instead of resolving palettes, dequantizing and issuing
+ * glNormal/glColor/glVertex for every vertex every frame. Each strip becomes
+ * two indexed triangles wound exactly like the strip, so a layer's strips
+ * stay one contiguous index range.
+ */
+struct RibbonDrawArrays {
+    static constexpr size_t INDICES_PER_STRIP = 6;
+
+    std::vector<float> positions;  ///< XYZ per vertex
+    std::vector<float> normals;    ///< XYZ per vertex
+    std::vector<uint8_t> colors;   ///< RGBA per vertex (GL_UNSIGNED_BYTE)
+    std::vector<uint32_t> indices; ///< INDICES_PER_STRIP per strip, in strip order
+
+    /**
+     * @brief Per-vertex colors scaled by a dim factor (ghost layers)
+     *
+     * The scaled copy is kept until a different factor is requested.
+     *
+     * @param dim_factor Brightness multiplier (1.0 returns the base colors)
+     * @return RGBA array parallel to positions
+     */
+    const uint8_t* colors_for(float dim_factor);
+
+    /**
+     * @brief Memory held by the arrays in bytes
+     */
+    size_t memory_usage() const {
+        return positions.size() * sizeof(float) + normals.size() * sizeof(float) +
+               colors.size() + dimmed_colors_.size() + indices.size() * sizeof(uint32_t);
+    }
+
+    /**
+     * @brief Estimate memory_usage() for a geometry before building
+     * @param vertex_count Vertices in the geometry
+     * @param strip_count Strips in the geometry
+     * @return Bytes, including one dimmed color copy
+     */
+    static size_t estimate_bytes(size_t vertex_count, size_t strip_count) {
+        return vertex_count * (6 * sizeof(float) + 8) +
+               strip_count * INDICES_PER_STRIP * sizeof(uint32_t);
+    }
+
+  private:
+    std::vector<uint8_t> dimmed_colors_;
+    float dimmed_factor_{-1.0f};
+};
+
+/**
+ * @brief Build draw arrays for a geometry
+ * @param geometry Source geometry (palettes and quantization resolved here)
+ * @return Arrays ready for glVertexPointer/glNormalPointer/glColorPointer
+ */
+RibbonDrawArrays build_draw_arrays(const RibbonGeometry& geometry);
+
+/**
+ * @brief Append vertices and strips added to a geometry since its arrays were built
+ *
+ * For geometry that only grows (GeometryBuilder::append_layer()): existing
+ * vertices and palette entries never change, so only the tail is converted.
+ *
+ * @param arrays Arrays previously built for the geometry
+ * @param geometry Geometry the arrays were built from
+ */
+void extend_draw_arrays(RibbonDrawArrays& arrays, const RibbonGeometry& geometry);
+
 /**
  * @brief Complete ribbon geometry for rendering
  */
@@ -179,6 +250,10 @@ struct RibbonGeometry {
     size_t travel_triangle_count;    ///< Triangles for travel moves
     QuantizationParams quantization; ///< Quantization params for dequantization
     float layer_height_mm{0.2f};     ///< Layer height for Z-offset calculations during LOD
+    float lod_error_mm{0.0f};        ///< Largest deviation from the toolpath (0 = full detail)
+
+    /// Bulk-submission copy, built on first use by the TinyGL renderer (nullptr until then)
+    std::unique_ptr<RibbonDrawArrays> draw_arrays;
 
     /**
      * @brief Calculate total memory usage in bytes
@@ -221,6 +296,9 @@ struct SimplificationOptions {
     bool enable_merging = true; ///< Enable collinear segment merging
     float tolerance_mm = 0.15f; ///< Merge tolerance (0.01 - 1.0mm) - higher = more aggressive
     float min_segment_length_mm = 0.01f; ///< Minimum segment length to keep (filter micro-segments)
+    /// Layers drawn as one ribbon (LOD): only the top layer of each group is kept and its
+    /// ribbons are made this many layers tall, so thin perimeter walls merge without gaps
+    uint32_t layer_merge = 1;
 
     /**
      * @brief Validate and clamp tolerance to safe range
@@ -231,7 +309,10 @@ struct SimplificationOptions {
     void validate() {
         tolerance_mm = std::max(0.01f, std::min(5.0f, tolerance_mm));
         min_segment_length_mm = std::max(0.0001f, min_segment_length_mm);
+        layer_merge = std::max(1u, std::min(MAX_LAYER_MERGE, layer_merge));
     }
+
+    static constexpr uint32_t MAX_LAYER_MERGE = 16;
 };
 
 // ============================================================================
@@ -248,12 +329,40 @@ struct SimplificationOptions {
  * 4. Assign colors (Z-height gradient or custom)
  * 5. Compute surface normals (horizontal for flat ribbons)
  * 6. Index vertices (share vertices between adjacent segments)
+ *
+ * Steps 3-6 run on worker threads over contiguous chunks of the simplified
+ * segments, each with its own palettes. Chunks are merged in order with their
+ * palette indices remapped, so the result is identical to a single-threaded build.
+ *
+ * Streaming files are built the same way one layer at a time: begin_layers()
+ * fixes the coordinate space, build_layer() turns one layer into a chunk and
+ * append_layer() merges it into the displayed geometry.
  */
 class GeometryBuilder {
   public:
     // Default filament color (OrcaSlicer teal) - used when G-code doesn't specify color
     static constexpr const char* DEFAULT_FILAMENT_COLOR = "#26A69A";
 
+    /// Upper bound on build threads when set_worker_count(0) picks one per core
+    static constexpr size_t MAX_GEOMETRY_WORKERS = 4;
+
+    /// Coarse levels in the LOD pyramid (level 0 is the full-detail build)
+    static constexpr size_t LOD_LEVEL_COUNT = 3;
+
+    /**
+     * @brief Simplification settings for one level of the LOD pyramid
+     *
+     * Each level roughly halves the triangle count of the one before it:
+     * larger merge tolerances, longer minimum segments, and from level 2 on
+     * consecutive layers merged into taller ribbons.
+     *
+     * @param level 1..LOD_LEVEL_COUNT (coarser with each level)
+     */
+    static SimplificationOptions lod_level_options(size_t level);
+
+    /// Smallest chunk worth a thread (smaller files build on the calling thread)
+    static constexpr size_t MIN_SEGMENTS_PER_CHUNK = 2048;
+
     GeometryBuilder();
 
     /**
@@ -265,6 +374,58 @@ class GeometryBuilder {
      */
     RibbonGeometry build(const ParsedGCodeFile& gcode, const SimplificationOptions& options);
 
+    /// One layer's geometry from build_layer(), waiting for append_layer()
+    struct LayerGeometry {
+        size_t layer_index = 0;
+        RibbonGeometry geometry; ///< Own palettes; one strip range and bbox (for layer_index)
+
+        size_t memory_usage() const {
+            return geometry.memory_usage();
+        }
+    };
+
+    /**
+     * @brief Start building geometry one layer at a time
+     *
+     * Fixes quantization and highlighted objects for the whole file, so
+     * layers built later share one coordinate space.
+     *
+     * @param bounds Model bounds (coordinates outside are clamped)
+     * @param layer_count Total layers in the file
+     * @param object_names Table the segments' object ids refer to (nullptr = no highlighting)
+     * @return Empty geometry with per-layer tables sized, for append_layer()
+     */
+    RibbonGeometry begin_layers(const AABB& bounds, size_t layer_count,
+                                ObjectNameTable* object_names);
+
+    /**
+     * @brief Build ribbons for one layer after begin_layers()
+     *
+     * Layers must be built in file order: the previous layer's last segment
+     * leads in, so a connected first ribbon shares vertices as in build().
+     * Only touches the builder, so it can run on a worker thread while the
+     * geometry from begin_layers() is drawn.
+     *
+     * @param layer_index Layer the segments belong to
+     * @param segments Raw toolpath segments of the layer
+     * @param options Simplification configuration
+     * @return Layer geometry with its own palettes
+     */
+    LayerGeometry build_layer(size_t layer_index, const std::vector<ToolpathSegment>& segments,
+                              const SimplificationOptions& options);
+
+    /**
+     * @brief Append a built layer to the geometry from begin_layers()
+     *
+     * Palette indices are remapped into the target palettes and the layer's
+     * strips become one contiguous range. Existing vertices are untouched, so
+     * draw arrays can be brought up to date with extend_draw_arrays().
+     *
+     * @param geometry Geometry from begin_layers()
+     * @param layer Result of build_layer() (consumed)
+     */
+    static void append_layer(RibbonGeometry& geometry, LayerGeometry&& layer);
+
     /**
      * @brief Get statistics about last build operation
      */
@@ -371,7 +532,28 @@ class GeometryBuilder {
         tool_color_palette_ = palette;
     }
 
+    /**
+     * @brief Set the number of threads used to generate geometry
+     * @param count Threads including the caller (0 = one per core, up to MAX_GEOMETRY_WORKERS)
+     */
+    void set_worker_count(size_t count) {
+        worker_count_ = count;
+    }
+
   private:
+    struct GeometryChunk;
+
+    // Chunked generation: build_chunk() and copy_chunk() run on workers,
+    // merge_chunk_layout() on the caller in chunk order
+    void build_chunk(const std::vector<ToolpathSegment>& segments,
+                     const std::unordered_map<int, uint16_t>& z_to_layer_index, float max_z,
+                     GeometryChunk& chunk);
+    static void merge_chunk_layout(RibbonGeometry& geometry, GeometryChunk& chunk);
+    static void copy_chunk(RibbonGeometry& geometry, GeometryChunk& chunk);
+
+    // Quantization bounds: the model bounds grown by the widest tube
+    void set_quantization_bounds(const AABB& bounds);
+
     // Palette management
     uint16_t add_to_normal_palette(RibbonGeometry& geometry, const glm::vec3& normal);
     uint8_t add_to_color_palette(RibbonGeometry& geometry, uint32_t color_rgb);
@@ -431,12 +613,17 @@ class GeometryBuilder {
     uint8_t filament_b_ = 0x9A;        ///< Filament color blue component
     std::unordered_set<std::string>
         highlighted_objects_;                     ///< Object names to highlight (empty = none)
+    ObjectIdSet highlighted_ids_;                 ///< highlighted_objects_ resolved for current build
     bool debug_face_colors_ = false;              ///< Enable per-face debug coloring
     std::vector<std::string> tool_color_palette_; ///< Hex colors per tool (multi-color prints)
+    size_t worker_count_ = 0;                     ///< Build threads (0 = auto)
 
     // Build statistics
     BuildStats stats_;
     QuantizationParams quant_params_;
+
+    /// Last simplified segment of the previous build_layer() call
+    std::optional<ToolpathSegment> layer_tail_;
 };
 
 } // namespace gcode
@@ -0,0 +1,132 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_index_cache.h
+ * @brief On-disk cache of built GCodeLayerIndex files, keyed by source identity
+ *
+ * @pattern One small sidecar file per G-code file (hash of the source key), LRU-evicted by
+ *          file mtime once the directory exceeds its byte cap
+ * @threading Safe to call from any thread; load/store of the same key are atomic via rename
+ * @gotchas Keys come from GCodeDataSource::cache_key(); an empty key means "don't cache"
+ */
+
+#pragma once
+
+#include "gcode_layer_index.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief File name for a cached artifact of a source
+ * @param key Source identity (GCodeDataSource::cache_key())
+ * @param extension File extension including the dot
+ * @return 16 hex digits of the key hash plus @p extension
+ */
+std::string cache_file_name(const std::string& key, const char* extension);
+
+/**
+ * @brief Delete least recently used cache files until a directory fits its cap
+ *
+ * Only files with @p extension are counted. Recency is the file mtime; the
+ * most recent file is always kept, even if it alone exceeds the cap.
+ *
+ * @param directory Cache directory
+ * @param extension File extension including the dot
+ * @param max_bytes Total size cap
+ * @return Number of files deleted
+ */
+size_t evict_lru_cache_files(const std::string& directory, const char* extension,
+                             size_t max_bytes);
+
+/**
+ * @brief Persists layer indexes so reopening a file skips the full scan
+ *
+ * Reopening the print status panel during a long print reopens the same
+ * G-code; with this cache the index loads in O(layers) instead of rescanning
+ * the whole file.
+ */
+class GCodeIndexCache {
+  public:
+    /// Default directory size cap (an index is ~40 bytes per layer)
+    static constexpr size_t DEFAULT_MAX_BYTES = 2 * 1024 * 1024;
+
+    /// Cache file extension
+    static constexpr const char* FILE_EXTENSION = ".lidx";
+
+    /**
+     * @brief Use the helix cache dir ("gcode_index") with the default cap
+     */
+    GCodeIndexCache();
+
+    /**
+     * @brief Use an explicit directory (tests, custom locations)
+     * @param directory Cache directory (created if missing; empty disables caching)
+     * @param max_bytes Total size cap across all cache files
+     */
+    explicit GCodeIndexCache(std::string directory, size_t max_bytes = DEFAULT_MAX_BYTES);
+
+    /**
+     * @brief Load the cached index for a source
+     *
+     * On a hit the file is touched so it becomes most recently used.
+     *
+     * @param key Source identity (GCodeDataSource::cache_key())
+     * @param source_path Path the loaded index reports as its source
+     * @param index Index to fill (unchanged on miss)
+     * @param object_names Table to intern snapshot object names into
+     * @return true on hit
+     */
+    bool load(const std::string& key, const std::string& source_path, GCodeLayerIndex& index,
+              std::shared_ptr<ObjectNameTable> object_names) const;
+
+    /**
+     * @brief Save an index, then evict least recently used files over the cap
+     * @param key Source identity (GCodeDataSource::cache_key())
+     * @param index Built index
+     * @return true if written
+     */
+    bool store(const std::string& key, const GCodeLayerIndex& index);
+
+    /**
+     * @brief Delete all cache files in the directory
+     */
+    void clear();
+
+    /**
+     * @brief Cache file path for a key
+     * @param key Source identity
+     * @return Path inside the cache directory, or empty if caching is disabled
+     */
+    std::string path_for(const std::string& key) const;
+
+    /**
+     * @brief Check whether the cache has a usable directory
+     * @return true if load/store can succeed
+     */
+    bool is_enabled() const {
+        return !directory_.empty();
+    }
+
+    /**
+     * @brief Get the cache directory
+     * @return Directory path, or empty if disabled
+     */
+    const std::string& directory() const {
+        return directory_;
+    }
+
+  private:
+    std::string directory_;
+    size_t max_bytes_;
+    std::mutex evict_mutex_; ///< One eviction sweep at a time
+};
+
+} // namespace gcode
+} // namespace helix
@@ -7,13 +7,18 @@
 #include "memory_utils.h"
 
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace helix {
 namespace gcode {
@@ -29,6 +34,8 @@ class GCodeDataSource;
  * viewing large G-code files (10MB+) on memory-constrained devices.
  *
  * Thread-safe for concurrent access from UI and background loading threads.
+ * prefetch_async() loads nearby layers on a few background threads so the
+ * UI thread only waits for the layer it is about to draw.
  *
  * Usage:
  * @code
@@ -52,8 +59,14 @@ class GCodeLayerCache {
     /// Memory budget for well-equipped devices (32MB) - >512MB total RAM
     static constexpr size_t DEFAULT_BUDGET_GOOD = 32 * 1024 * 1024;
 
-    /// Approximate bytes per segment (for estimation)
-    static constexpr size_t BYTES_PER_SEGMENT = 80;
+    /// Bytes per segment (for estimation)
+    static constexpr size_t BYTES_PER_SEGMENT = sizeof(ToolpathSegment);
+
+    /// Background prefetch loads allowed to run at once (see set_prefetch_concurrency())
+    static constexpr size_t DEFAULT_PREFETCH_CONCURRENCY = 2;
+
+    /// Loads a layer's segments: (layer_index) -> vector<ToolpathSegment>
+    using LayerLoader = std::function<std::vector<ToolpathSegment>(size_t)>;
 
     /**
      * @brief Construct cache with memory budget
@@ -61,7 +74,8 @@ class GCodeLayerCache {
      */
     explicit GCodeLayerCache(size_t memory_budget_bytes = DEFAULT_BUDGET_NORMAL);
 
-    ~GCodeLayerCache() = default;
+    /// Cancels queued prefetches and joins the prefetch threads
+    ~GCodeLayerCache();
 
     // Non-copyable, non-moveable (mutex prevents move)
     GCodeLayerCache(const GCodeLayerCache&) = delete;
@@ -84,6 +98,28 @@ class GCodeLayerCache {
         bool load_failed{false}; ///< True if load attempted but failed
     };
 
+    /**
+     * @brief Background prefetch effectiveness
+     *
+     * Hits and misses only count requests for layers that were prefetched or
+     * queued for prefetch; layers never in a prefetch window are plain cache
+     * misses (see hit_stats()).
+     */
+    struct PrefetchStats {
+        size_t hits{0};      ///< get_or_load() served a prefetched layer
+        size_t misses{0};    ///< get_or_load() found the layer still queued or loading
+        size_t completed{0}; ///< Background loads cached
+        size_t cancelled{0}; ///< Queued loads dropped because the window moved
+        double avg_queue_latency_ms{0.0}; ///< Mean time from queueing to cached
+        double max_queue_latency_ms{0.0}; ///< Worst time from queueing to cached
+
+        /// Fraction of prefetch-window requests that were ready [0.0, 1.0]
+        float hit_rate() const {
+            size_t total = hits + misses;
+            return total == 0 ? 0.0f : static_cast<float>(hits) / static_cast<float>(total);
+        }
+    };
+
     /**
      * @brief Get layer data, loading from source if not cached
      *
@@ -122,6 +158,48 @@ class GCodeLayerCache {
     void prefetch(size_t center_layer, size_t radius,
                   std::function<std::vector<ToolpathSegment>(size_t)> loader, size_t max_layer);
 
+    /**
+     * @brief Queue layers around a center layer for background loading
+     *
+     * Returns immediately. The center layer loads first, then the nearest
+     * layers in the direction of motion (relative to the previous call's
+     * center), then the remaining layers of the window by distance. Queued
+     * layers that fall outside the new window are cancelled; loads already
+     * running finish and are cached. Cached layers in the window are touched
+     * so they stay ahead of eviction.
+     *
+     * @param center_layer Center layer index
+     * @param radius Number of layers on each side to prefetch
+     * @param loader Called on prefetch threads; must be thread-safe and remain
+     *        callable until cancel_prefetch() returns or the cache is destroyed
+     * @param max_layer Maximum valid layer index
+     */
+    void prefetch_async(size_t center_layer, size_t radius, LayerLoader loader, size_t max_layer);
+
+    /**
+     * @brief Drop queued prefetches and wait for running loads to finish
+     *
+     * Call before invalidating whatever the prefetch loader reads from.
+     */
+    void cancel_prefetch();
+
+    /**
+     * @brief Block until the prefetch queue is empty and no loads are running
+     */
+    void wait_for_prefetch();
+
+    /**
+     * @brief Limit how many prefetch loads run at once
+     * @param max_in_flight Concurrent loads (minimum 1)
+     */
+    void set_prefetch_concurrency(size_t max_in_flight);
+
+    /**
+     * @brief Get prefetch hit/miss and queue-latency counters
+     * @return Snapshot of the counters (reset by reset_stats())
+     */
+    PrefetchStats prefetch_stats() const;
+
     /**
      * @brief Insert pre-loaded layer data into cache
      *
@@ -180,7 +258,7 @@ class GCodeLayerCache {
     float hit_rate() const;
 
     /**
-     * @brief Reset hit/miss counters
+     * @brief Reset hit/miss and prefetch counters
      */
     void reset_stats();
 
@@ -266,8 +344,27 @@ class GCodeLayerCache {
     struct CacheEntry {
         std::shared_ptr<std::vector<ToolpathSegment>> segments;
         size_t memory_bytes{0}; ///< Estimated memory usage
+        bool prefetched{false}; ///< Loaded by prefetch and not requested yet
     };
 
+    /// Layer waiting in the prefetch queue
+    struct PrefetchRequest {
+        size_t layer_index;
+        std::chrono::steady_clock::time_point queued_at;
+    };
+
+    /**
+     * @brief Store loaded segments, evicting as needed (lock held)
+     * @return Cached entry, or nullptr if the layer alone exceeds the budget
+     */
+    CacheEntry* store(size_t layer_index, std::vector<ToolpathSegment>&& segments,
+                      bool prefetched);
+
+    /**
+     * @brief Prefetch thread body: take queued layers and load them
+     */
+    void prefetch_worker();
+
     /**
      * @brief Estimate memory usage for segment vector
      * @param segments Vector of segments
@@ -310,6 +407,20 @@ class GCodeLayerCache {
     // Thread safety
     mutable std::mutex mutex_;
 
+    // Background prefetch (all guarded by mutex_)
+    std::deque<PrefetchRequest> prefetch_queue_; ///< Front = highest priority
+    std::unordered_set<size_t> prefetch_in_flight_;
+    LayerLoader prefetch_loader_;
+    std::vector<std::thread> prefetch_threads_;
+    size_t prefetch_concurrency_{DEFAULT_PREFETCH_CONCURRENCY};
+    std::optional<size_t> prefetch_center_;  ///< Center of the previous prefetch_async() call
+    uint64_t generation_{0};                 ///< Bumped by clear(); stale loads are dropped
+    bool stopping_{false};
+    std::condition_variable prefetch_cv_;    ///< Wakes prefetch threads
+    std::condition_variable prefetch_done_cv_; ///< Signals finished loads / empty queue
+    PrefetchStats prefetch_stats_;
+    double prefetch_latency_total_ms_{0.0};
+
     // Adaptive memory management
     bool adaptive_enabled_{false};
     int adaptive_target_percent_{15};         ///< Target % of available RAM
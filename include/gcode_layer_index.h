@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include "gcode_parser.h"
+
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -54,7 +57,9 @@ struct LayerIndexStats {
  *
  * Provides random access to layers without loading the entire file.
  * Built with a single-pass scan of the file, recording byte offsets
- * for each layer boundary.
+ * for each layer boundary together with the parser state at that point
+ * (ParserStateSnapshot), so any layer can be parsed on its own - out of
+ * order or on a worker thread - with the same result as a full parse.
  *
  * Usage:
  * @code
@@ -67,7 +72,7 @@ struct LayerIndexStats {
  *   }
  * @endcode
  *
- * Memory usage: ~24 bytes × layer_count (e.g., 1000 layers = 24KB)
+ * Memory usage: ~48 bytes × layer_count (e.g., 1000 layers = 48KB)
  */
 class GCodeLayerIndex {
   public:
@@ -85,12 +90,58 @@ class GCodeLayerIndex {
      *
      * Single-pass scan that identifies layer boundaries by detecting
      * Z-axis changes or ;LAYER_CHANGE markers. Records byte offset,
-     * length, and line count for each layer.
+     * length, and line count for each layer. A GCodeStateTracker runs
+     * alongside to snapshot modal state at every layer start.
      *
      * @param filepath Path to G-code file
+     * @param object_names Table to intern object names into (nullptr = new table).
+     *        Parsers resuming from the snapshots must share this table.
      * @return true if successful, false on error
      */
-    bool build_from_file(const std::string& filepath);
+    bool build_from_file(const std::string& filepath,
+                         std::shared_ptr<ObjectNameTable> object_names = nullptr);
+
+    /**
+     * @brief Version of the save_to_cache_file() format; files of any other version are rejected
+     *
+     * Bump it whenever a cached index could differ from a fresh build_from_file()
+     * of the same file: a change to the file layout, to StreamingLayerEntry,
+     * LayerIndexStats or ParserStateSnapshot, or to how layers are detected or
+     * state is tracked (GCodeStateTracker). Stale files are then rebuilt on the
+     * next open instead of resuming layers from outdated snapshots.
+     *
+     * 1: initial format. 2: G92 applied to tracked position and E.
+     */
+    static constexpr uint32_t CACHE_FORMAT_VERSION = 2;
+
+    /**
+     * @brief Persist the built index to a binary file
+     *
+     * Stores entries, start snapshots (object names as strings) and stats.
+     * Written to a temp file and renamed, so readers never see partial data.
+     *
+     * @param path Destination file
+     * @param source_key Identity of the indexed source (path/size/mtime);
+     *        load_from_cache_file() only accepts a matching key
+     * @return true if written
+     */
+    bool save_to_cache_file(const std::string& path, const std::string& source_key) const;
+
+    /**
+     * @brief Load an index written by save_to_cache_file()
+     *
+     * O(layers): no G-code is read. Rejects files with a different version,
+     * key or a bad checksum, leaving this index unchanged.
+     *
+     * @param path Cache file
+     * @param source_key Expected source identity
+     * @param source_path Path reported by get_source_path() afterwards
+     * @param object_names Table to intern snapshot object names into (nullptr = new table)
+     * @return true if loaded
+     */
+    bool load_from_cache_file(const std::string& path, const std::string& source_key,
+                              const std::string& source_path,
+                              std::shared_ptr<ObjectNameTable> object_names = nullptr);
 
     /**
      * @brief Get entry for a specific layer
@@ -100,6 +151,16 @@ class GCodeLayerIndex {
      */
     StreamingLayerEntry get_entry(size_t layer_index) const;
 
+    /**
+     * @brief Get parser state at the start of a layer
+     *
+     * Pass to GCodeParser::restore_state() before parsing the layer's bytes.
+     *
+     * @param layer_index Zero-based layer index
+     * @return Snapshot, or default (start-of-file) state if out of range
+     */
+    ParserStateSnapshot get_start_state(size_t layer_index) const;
+
     /**
      * @brief Get total number of layers
      * @return Layer count
@@ -153,7 +214,8 @@ class GCodeLayerIndex {
      * @return Approximate bytes used
      */
     size_t memory_usage_bytes() const {
-        return sizeof(*this) + entries_.capacity() * sizeof(StreamingLayerEntry);
+        return sizeof(*this) + entries_.capacity() * sizeof(StreamingLayerEntry) +
+               start_states_.capacity() * sizeof(ParserStateSnapshot);
     }
 
     /**
@@ -162,8 +224,11 @@ class GCodeLayerIndex {
     void clear() {
         entries_.clear();
         entries_.shrink_to_fit();
+        start_states_.clear();
+        start_states_.shrink_to_fit();
         stats_ = LayerIndexStats{};
         source_path_.clear();
+        object_names_.reset();
     }
 
     /**
@@ -176,8 +241,10 @@ class GCodeLayerIndex {
 
   private:
     std::vector<StreamingLayerEntry> entries_;
+    std::vector<ParserStateSnapshot> start_states_; ///< Parallel to entries_
     LayerIndexStats stats_;
     std::string source_path_;
+    std::shared_ptr<ObjectNameTable> object_names_; ///< Resolves snapshot object ids
 };
 
 } // namespace gcode
@@ -6,16 +6,19 @@
 #include "gcode_parser.h"
 #include "gcode_projection.h"
 #include "gcode_streaming_controller.h"
+#include "toolpath_rasterizer.h"
 
 #include <lvgl/lvgl.h>
 
 #include <atomic>
+#include <functional>
 #include <glm/glm.hpp>
 #include <memory>
 #include <optional>
 #include <string>
 #include <thread>
 #include <unordered_set>
+#include <vector>
 
 namespace helix {
 namespace gcode {
@@ -386,12 +389,14 @@ class GCodeLayerRenderer {
     // =========================================================================
 
     /**
-     * @brief Render a single segment
-     * @param layer LVGL draw layer
-     * @param seg Toolpath segment to render
-     * @param ghost If true, render in ghost style (grey, for preview)
+     * @brief Rasterize one layer into the cache buffer (TOP_DOWN / ISOMETRIC views)
+     *
+     * Replaces the cache contents; the FRONT view rebuilds its cache afterwards.
+     *
+     * @param segments Segments of the current layer
+     * @return Number of segments drawn
      */
-    void render_segment(lv_layer_t* layer, const ToolpathSegment& seg, bool ghost = false);
+    size_t render_layer_direct(const std::vector<ToolpathSegment>& segments);
 
     /**
      * @brief Render L-shaped corner brackets around highlighted objects' bounding boxes
@@ -441,6 +446,32 @@ class GCodeLayerRenderer {
         return helix::gcode::project(params, x, y, z);
     }
 
+    /// Picks a segment's color (0xAARRGGBB) and width; returns false to skip it
+    using SegmentStyle =
+        std::function<bool(const ToolpathSegment& seg, uint32_t& color, int& width)>;
+
+    /**
+     * @brief Project segments to raster lines on raster_pool_, keeping draw order
+     *
+     * Work is split into fixed-size chunks whose results are concatenated in
+     * layer and segment order, so tiled drawing matches a serial pass.
+     *
+     * @param layers Segment lists in draw order
+     * @param transform Projection snapshot
+     * @param style Per-segment style (called from pool threads; must only read)
+     * @param[out] lines Receives the lines (appended)
+     */
+    void project_segments(const std::vector<const std::vector<ToolpathSegment>*>& layers,
+                          const TransformParams& transform, const SegmentStyle& style,
+                          std::vector<RasterLine>& lines);
+
+    /**
+     * @brief Project layers [from_layer, to_layer] from the active data source
+     * @see project_segments()
+     */
+    void project_layers(int from_layer, int to_layer, const TransformParams& transform,
+                        const SegmentStyle& style, std::vector<RasterLine>& lines);
+
     /**
      * @brief Check if a segment is a support structure
      * @param seg Segment to check
@@ -448,6 +479,29 @@ class GCodeLayerRenderer {
      */
     bool is_support_segment(const ToolpathSegment& seg) const;
 
+    /**
+     * @brief Name table for the active data source (full file or streaming)
+     * @return Table, or nullptr if no data source is set
+     */
+    std::shared_ptr<ObjectNameTable> object_names() const;
+
+    /**
+     * @brief Re-resolve excluded/highlighted names to per-object flags
+     *
+     * Called whenever the name sets or the data source change, so per-segment
+     * checks are one byte lookup instead of a string hash.
+     */
+    void resolve_object_ids();
+
+    /**
+     * @brief Get the ObjectStateFlags of an object
+     * @param id Object id of a segment
+     * @return OBJECT_EXCLUDED / OBJECT_HIGHLIGHTED bits (0 for unknown ids)
+     */
+    uint8_t object_flags(ObjectId id) const {
+        return id < object_flags_.size() ? object_flags_[id] : 0;
+    }
+
     /**
      * @brief Check if a segment should be rendered based on visibility settings
      * @param seg Segment to check
@@ -455,13 +509,6 @@ class GCodeLayerRenderer {
      */
     bool should_render_segment(const ToolpathSegment& seg) const;
 
-    /**
-     * @brief Get line color for a segment
-     * @param seg Segment to get color for
-     * @return LVGL color
-     */
-    lv_color_t get_segment_color(const ToolpathSegment& seg) const;
-
     // Data source (exactly one should be non-null)
     const ParsedGCodeFile* gcode_ = nullptr;
     GCodeStreamingController* streaming_controller_ = nullptr;
@@ -496,6 +543,8 @@ class GCodeLayerRenderer {
     // Object exclusion/highlight state
     std::unordered_set<std::string> excluded_objects_;
     std::unordered_set<std::string> highlighted_objects_;
+    std::vector<uint8_t> object_flags_; ///< ObjectStateFlags indexed by ObjectId
+    std::shared_ptr<ObjectNameTable> resolved_names_; ///< Table the flags were resolved against
 
     // Cached bounds
     float bounds_min_x_ = 0.0f;
@@ -519,7 +568,7 @@ class GCodeLayerRenderer {
     // Note: We only use draw buffers (no canvas widgets) to avoid clip area
     // contamination from overlays/toasts on lv_layer_top().
     lv_draw_buf_t* cache_buf_ = nullptr;
-    int cached_up_to_layer_ = -1; // Highest layer rendered in cache
+    int cached_up_to_layer_ = -1; // Highest layer rendered in cache (-1 = must clear first)
     int cached_width_ = 0;        // Dimensions cache was built for
     int cached_height_ = 0;
 
@@ -531,6 +580,14 @@ class GCodeLayerRenderer {
     bool ghost_mode_enabled_ = true; // Enable ghost mode by default
     int ghost_rendered_up_to_ = -1;  // Progress tracker for progressive ghost rendering
 
+    // Antialias TOP_DOWN/ISOMETRIC lines (config: /gcode_viewer/antialias)
+    bool antialias_ = false;
+
+    // Tiled rasterization threads, shared by the cache and ghost renders
+    // (config: /gcode_viewer/render_threads, 0 = one per core up to MAX_RASTER_WORKERS)
+    int render_threads_ = 0;
+    std::unique_ptr<RasterWorkerPool> raster_pool_;
+
     // Progressive rendering - render N layers per frame to avoid blocking UI
     // These are defaults; actual values come from config or adaptive adjustment
     static constexpr int DEFAULT_LAYERS_PER_FRAME = 15;
@@ -568,9 +625,11 @@ class GCodeLayerRenderer {
     void blit_cache(lv_layer_t* target);
     void destroy_cache();
 
-    // Ghost cache methods (LVGL-based, for main thread progressive rendering)
+    /// Rasterizer target over cache_buf_ (empty if there is no cache buffer)
+    RasterTarget cache_target() const;
+
+    // Ghost cache methods (ghost_buf_ is filled from the background thread's raw buffer)
     void ensure_ghost_cache(int width, int height);
-    void render_ghost_layers(int from_layer, int to_layer);
     void blit_ghost_cache(lv_layer_t* target);
     void destroy_ghost_cache();
 
@@ -578,7 +637,7 @@ class GCodeLayerRenderer {
     // Background Thread Ghost Rendering
     // =========================================================================
     // LVGL is not thread-safe, so background thread renders to a raw pixel
-    // buffer using software Bresenham line drawing, then copies to LVGL buffer
+    // buffer using ToolpathRasterizer, then copies to LVGL buffer
     // on main thread when complete.
 
     /// Raw pixel buffer for background thread rendering (ARGB8888)
@@ -593,6 +652,9 @@ class GCodeLayerRenderer {
     std::atomic<bool> ghost_thread_running_{false};
     std::atomic<bool> ghost_thread_ready_{false}; // True when raw buffer is complete
 
+    /// Layers projected and drawn per ghost batch (bounds line memory, cancel latency)
+    static constexpr int GHOST_BATCH_LAYERS = 16;
+
     /// Start background ghost rendering (called when new gcode loaded)
     void start_background_ghost_render();
 
@@ -604,19 +666,6 @@ class GCodeLayerRenderer {
 
     /// Copy completed raw buffer to LVGL ghost_buf_ (called on main thread)
     void copy_raw_to_ghost_buf();
-
-    /// Software Bresenham line drawing to raw ARGB8888 buffer (ghost)
-    void draw_line_bresenham(int x0, int y0, int x1, int y1, uint32_t color);
-
-    /// Blend a pixel with alpha into the ghost raw buffer
-    void blend_pixel(int x, int y, uint32_t color);
-
-    /// Software Bresenham line drawing to solid cache buffer
-    /// Used for solid layer rendering, bypassing LVGL draw API for AD5M compatibility
-    void draw_line_bresenham_solid(int x0, int y0, int x1, int y1, uint32_t color);
-
-    /// Blend a pixel directly into the solid LVGL cache buffer
-    void blend_pixel_solid(int x, int y, uint32_t color);
 };
 
 } // namespace gcode
@@ -0,0 +1,64 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_line_scanner.h
+ * @brief Bulk G-code line splitter with per-line candidate flags (SSE2/NEON/scalar)
+ *
+ * @pattern 16 bytes per step: compare against '\n' and a few interesting characters, then walk
+ *          the newline bits, so lines with no candidates never get a byte-by-byte pass
+ * @threading Stateless free functions, safe from any thread
+ * @gotchas Offsets are 32-bit: scan at most 4GB per call (index blocks are 1MB)
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/// Bits of ScannedLine::flags
+enum LineScanFlags : uint8_t {
+    LINE_HAS_Z = 1 << 0,          ///< Contains 'Z' or 'z' (possible Z parameter)
+    LINE_HAS_E = 1 << 1,          ///< Contains 'E' or 'e' (possible E parameter)
+    LINE_HAS_UNDERSCORE = 1 << 2, ///< Contains '_' (every LAYER_CHANGE-style marker does)
+};
+
+/// One line found by scan_lines()
+struct ScannedLine {
+    uint32_t offset; ///< Start of the line within the scanned text
+    uint32_t length; ///< Length without the '\n' ('\r' is kept)
+    uint8_t flags;   ///< LineScanFlags
+};
+
+/**
+ * @brief Split text into lines and flag candidate lines
+ *
+ * Uses SSE2 on x86-64 and NEON on ARM builds, scalar code elsewhere. A final
+ * line without '\n' is reported when the whole text was scanned.
+ *
+ * @param text Text to scan
+ * @param out Lines are appended here
+ * @param max_lines Stop after this many lines
+ * @return Bytes consumed (up to and including the last reported line's '\n');
+ *         pass the rest of @p text to continue
+ */
+size_t scan_lines(std::string_view text, std::vector<ScannedLine>& out, size_t max_lines);
+
+/**
+ * @brief Byte-at-a-time reference for scan_lines() (identical results)
+ */
+size_t scan_lines_scalar(std::string_view text, std::vector<ScannedLine>& out, size_t max_lines);
+
+/**
+ * @brief Name of the instruction set scan_lines() was built for
+ * @return "sse2", "neon" or "scalar"
+ */
+const char* line_scanner_isa();
+
+} // namespace gcode
+} // namespace helix
@@ -69,7 +69,7 @@ using ThumbnailCompleteCallback = std::function<void(std::unique_ptr<ObjectThumb
  * @brief Renders per-object toolpath thumbnails from parsed G-code
  *
  * Single-pass algorithm: iterates all segments once, dispatching each to the
- * correct object's pixel buffer based on segment.object_name. Runs in a
+ * correct object's pixel buffer based on segment.object_id. Runs in a
  * background thread with cancellation support.
  *
  * Usage:
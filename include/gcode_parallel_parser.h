@@ -0,0 +1,116 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_parallel_parser.h
+ * @brief Layer-parallel G-code decoding on a small worker pool
+ *
+ * @pattern Each chunk resumes from a ParserStateSnapshot, results merged in file order, so
+ *          output is identical to a sequential GCodeParser pass
+ * @threading Calls block; work runs on up to MAX_PARSE_WORKERS short-lived std::threads
+ * @gotchas All parsers of one file must share the ObjectNameTable the snapshots came from
+ */
+
+#pragma once
+
+#include "gcode_parser.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace helix {
+namespace gcode {
+
+class FileDataSource;
+
+/// Upper bound on parse workers (memory bandwidth, not cores, limits beyond this on ARM SBCs)
+constexpr size_t MAX_PARSE_WORKERS = 4;
+
+/// Block size handed to each worker by parse_gcode_file_parallel()
+constexpr size_t PARSE_CHUNK_BYTES = 128 * 1024;
+
+/// Blocks read ahead but not yet taken by a worker, per worker (bounds read-ahead memory)
+constexpr size_t PARSE_QUEUE_CHUNKS_PER_WORKER = 2;
+
+/// Reader/worker bookkeeping from one parse_gcode_file_parallel() call
+struct ParallelParseStats {
+    size_t chunks = 0;            ///< Blocks handed to workers
+    size_t max_queued_chunks = 0; ///< Most blocks read but not yet taken by a worker
+};
+
+/**
+ * @brief Number of parse workers for this machine
+ * @return Hardware concurrency clamped to [1, MAX_PARSE_WORKERS]
+ */
+size_t default_parse_worker_count();
+
+/**
+ * @brief Run tasks 0..task_count-1 on a small group of worker threads
+ *
+ * Tasks are handed out through an atomic counter, so uneven layers balance
+ * across workers. The calling thread is one of the workers; runs inline when
+ * only one worker is needed. Blocks until every task has finished.
+ *
+ * @param task_count Number of tasks
+ * @param worker_count Maximum threads to use (0 = default_parse_worker_count())
+ * @param task Called once per task with (task index, worker slot). Slots are
+ *        0..worker_count-1 and never run concurrently, so they can index
+ *        per-worker scratch state. Must not throw.
+ */
+void run_parse_workers(size_t task_count, size_t worker_count,
+                       const std::function<void(size_t task, size_t worker)>& task);
+
+/**
+ * @brief Feed a buffer of G-code text to a parser line by line
+ *
+ * Lines are passed as views into @p data (no per-line copy). A trailing line
+ * without newline is parsed too.
+ *
+ * @param parser Parser to feed
+ * @param data G-code text
+ * @param size Number of bytes in @p data
+ */
+void parse_gcode_buffer(GCodeParser& parser, const char* data, size_t size);
+
+/**
+ * @brief Parse a complete G-code file on several cores
+ *
+ * The calling thread reads the file in PARSE_CHUNK_BYTES blocks (zero-copy
+ * views when the file can be memory-mapped) and runs a GCodeStateTracker
+ * over them, snapshotting the parser state at each block start; comments also
+ * go to a metadata-only parser. Worker threads resume from those snapshots and
+ * decode the blocks concurrently while reading continues; results are merged
+ * in file order. Layers, segments, bounds, objects and metadata match a
+ * sequential GCodeParser run exactly. Falls back to a sequential parse when
+ * only one worker is available.
+ *
+ * The state pass is much cheaper than decoding, so the reader waits once
+ * PARSE_QUEUE_CHUNKS_PER_WORKER blocks per worker are queued. Without mmap
+ * every queued block is a copy, and the file would otherwise end up in RAM.
+ *
+ * @param filepath Path to G-code file
+ * @param out Parsed result (filename is set to @p filepath)
+ * @param worker_count Maximum threads (0 = default_parse_worker_count())
+ * @return false if the file could not be opened
+ */
+bool parse_gcode_file_parallel(const std::string& filepath, ParsedGCodeFile& out,
+                               size_t worker_count = 0);
+
+/**
+ * @brief Parse an already opened file on several cores
+ *
+ * Same as the path overload; lets callers pick the read path (e.g. a source
+ * opened without mmap) and observe the read-ahead.
+ *
+ * @param source Open file (filename of @p out is set to its path)
+ * @param out Parsed result
+ * @param worker_count Maximum threads (0 = default_parse_worker_count())
+ * @param stats Optional reader/worker bookkeeping (left untouched on the sequential path)
+ * @return false if the source is invalid or a read failed
+ */
+bool parse_gcode_file_parallel(FileDataSource& source, ParsedGCodeFile& out,
+                               size_t worker_count = 0, ParallelParseStats* stats = nullptr);
+
+} // namespace gcode
+} // namespace helix
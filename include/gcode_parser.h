@@ -6,17 +6,25 @@
  * @brief Streaming G-code parser extracting toolpath, layers, and metadata
  *
  * @pattern Line-by-line streaming (no full buffer); layer-indexed geometry
- * @threading Main thread only
- * @gotchas clear_segments() frees 40-160MB after geometry build; layer detection via Z changes
+ * @pattern string_view tokenizer: no heap allocation per movement line
+ * @threading One parser per thread; layers resume from ParserStateSnapshot on worker threads
+ * @gotchas clear_segments() frees 20-70MB after geometry build; layer detection via Z changes
+ * @gotchas Segments carry an ObjectId, resolve names via ParsedGCodeFile::object_names
  */
 
 #pragma once
 
 #include <glm/glm.hpp>
+#include <cstdint>
+#include <deque>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace helix {
@@ -65,24 +73,114 @@ struct AABB {
     }
 };
 
+/// Interned object name handle (index into ObjectNameTable)
+using ObjectId = uint16_t;
+
+/// ObjectId of segments outside any EXCLUDE_OBJECT block (name "")
+constexpr ObjectId NO_OBJECT_ID = 0;
+
+/**
+ * @brief Per-file string table for EXCLUDE_OBJECT names
+ *
+ * Segments reference their object by a 16-bit ObjectId instead of each carrying
+ * a std::string. Id 0 is reserved for "no object".
+ *
+ * Thread-safe: in streaming mode layers are parsed (and names interned) on
+ * cache loader threads while the UI resolves names. References returned by
+ * name() stay valid for the lifetime of the table.
+ */
+class ObjectNameTable {
+  public:
+    ObjectNameTable();
+
+    ObjectNameTable(const ObjectNameTable&) = delete;
+    ObjectNameTable& operator=(const ObjectNameTable&) = delete;
+
+    /**
+     * @brief Get the id for a name, adding it if not yet known
+     * @param name Object name (empty maps to NO_OBJECT_ID)
+     * @return Object id, or NO_OBJECT_ID if the table is full (65535 names)
+     */
+    ObjectId intern(std::string_view name);
+
+    /**
+     * @brief Look up a name without adding it
+     * @return Object id, or NO_OBJECT_ID if unknown
+     */
+    ObjectId find(std::string_view name) const;
+
+    /**
+     * @brief Resolve an id to its name
+     * @return Name, or empty string for NO_OBJECT_ID / unknown ids
+     */
+    const std::string& name(ObjectId id) const;
+
+    /// Number of ids in use (including NO_OBJECT_ID)
+    size_t size() const;
+
+  private:
+    mutable std::mutex mutex_;
+    std::deque<std::string> names_; ///< Indexed by ObjectId; deque keeps references stable
+    std::unordered_map<std::string_view, ObjectId> ids_; ///< Views into names_
+};
+
+/**
+ * @brief Membership bitmap over ObjectIds (excluded/highlighted objects)
+ *
+ * Built from object names once per selection change so per-segment checks
+ * are an index lookup instead of hashing the name. Names not seen yet are
+ * interned so layers parsed later (streaming mode) still match.
+ */
+class ObjectIdSet {
+  public:
+    /**
+     * @brief Rebuild from a set of names
+     * @param names Object names to include
+     * @param table Name table the segments were interned into
+     */
+    void assign(const std::unordered_set<std::string>& names, ObjectNameTable& table);
+
+    void clear() {
+        bits_.clear();
+    }
+
+    bool empty() const {
+        return bits_.empty();
+    }
+
+    bool contains(ObjectId id) const {
+        return id < bits_.size() && bits_[id] != 0;
+    }
+
+  private:
+    std::vector<uint8_t> bits_;
+};
+
 /**
  * @brief Single toolpath segment (line segment in 3D space)
  *
  * Represents movement from start to end point. Can be either:
  * - Extrusion move (is_extrusion=true): Plastic is deposited
  * - Travel move (is_extrusion=false): Nozzle moves without extruding
+ *
+ * Compact POD (36 bytes): the object is referenced by ObjectId and flags are
+ * packed into bit-fields, so millions of segments stay cache-friendly.
  */
 struct ToolpathSegment {
     glm::vec3 start{0.0f, 0.0f, 0.0f}; ///< Start point (X, Y, Z)
     glm::vec3 end{0.0f, 0.0f, 0.0f};   ///< End point (X, Y, Z)
-    bool is_extrusion{false};          ///< true if extruding, false if travel move
-    std::string object_name;           ///< Object name (from EXCLUDE_OBJECT_START) or
-                                       ///< empty
     float extrusion_amount{0.0f};      ///< E-axis delta (mm of filament)
     float width{0.0f};                 ///< Calculated extrusion width (mm) - 0 means use default
-    int tool_index{0};                 ///< Which tool/extruder printed this (0-indexed)
+    ObjectId object_id{NO_OBJECT_ID};  ///< Object (from EXCLUDE_OBJECT_START), see ObjectNameTable
+    uint8_t tool_index{0};             ///< Which tool/extruder printed this (0-indexed)
+    bool is_extrusion : 1;             ///< true if extruding, false if travel move
+    bool is_support : 1;               ///< Object name marks it as support material
+
+    ToolpathSegment() : is_extrusion(false), is_support(false) {}
 };
 
+static_assert(sizeof(ToolpathSegment) <= 36, "ToolpathSegment must stay compact");
+
 /**
  * @brief Single layer of toolpath (constant Z-height)
  *
@@ -123,6 +221,9 @@ struct ParsedGCodeFile {
     std::map<std::string, GCodeObject> objects; ///< Object metadata (name → object)
     AABB global_bounding_box;                   ///< Bounds of entire model
 
+    /// Interned object names referenced by ToolpathSegment::object_id
+    std::shared_ptr<ObjectNameTable> object_names = std::make_shared<ObjectNameTable>();
+
     // Statistics
     size_t total_segments{0};                 ///< Total segment count
     float estimated_print_time_minutes{0.0f}; ///< From metadata (if available)
@@ -158,6 +259,14 @@ struct ParsedGCodeFile {
         return (index < layers.size()) ? &layers[index] : nullptr;
     }
 
+    /**
+     * @brief Resolve a segment's object name
+     * @return Object name, or empty string if the segment has no object
+     */
+    const std::string& object_name(const ToolpathSegment& segment) const {
+        return object_names->name(segment.object_id);
+    }
+
     /**
      * @brief Find layer closest to Z height
      * @param z Z coordinate to search for
@@ -171,15 +280,14 @@ struct ParsedGCodeFile {
      * After geometry is built, the raw segment data is no longer needed.
      * This frees the segment vectors while preserving metadata (bounding box,
      * statistics, slicer info, etc.). Call this after geometry building to
-     * reduce memory usage by 40-160MB on large files.
+     * reduce memory usage by 20-70MB on large files.
      *
      * @return Bytes freed (approximate)
      */
     size_t clear_segments() {
         size_t freed = 0;
         for (auto& layer : layers) {
-            // Estimate ~80 bytes per segment
-            freed += layer.segments.size() * 80;
+            freed += layer.segments.capacity() * sizeof(ToolpathSegment);
             layer.segments.clear();
             layer.segments.shrink_to_fit();
         }
@@ -193,6 +301,56 @@ struct ParsedGCodeFile {
     }
 };
 
+/**
+ * @brief Scan a decimal number at the start of a G-code word
+ *
+ * Allocation-free replacement for std::stof() on the parser hot path.
+ * Accepts an optional sign, digits and a single decimal point ("-1.5", "+.25",
+ * "10."). No leading whitespace and no exponent, matching what slicers emit.
+ *
+ * @param begin First character of the number
+ * @param end One past the last readable character
+ * @param out_value Parsed value (untouched on failure)
+ * @return Number of characters consumed, or 0 if no digits were found
+ */
+size_t scan_gcode_float(const char* begin, const char* end, float& out_value);
+
+/**
+ * @brief Modal parser state captured at a layer boundary
+ *
+ * Everything GCodeParser needs to continue parsing from the middle of a file
+ * (position, E, positioning modes, tool, active object, layer tracking), so a
+ * layer's bytes can be parsed on their own - out of order or on another
+ * thread - and produce exactly the segments a front-to-back parse would.
+ * Recorded per layer by GCodeLayerIndex (24 bytes each).
+ */
+struct ParserStateSnapshot {
+    /// Bits for @ref flags
+    enum Flags : uint8_t {
+        ABSOLUTE_POSITIONING = 1 << 0, ///< G90 active (G91 otherwise)
+        ABSOLUTE_EXTRUSION = 1 << 1,   ///< M82 active (M83 otherwise)
+        IN_WIPE_TOWER = 1 << 2,        ///< Inside a WIPE_TOWER_START/END block
+        USE_LAYER_MARKERS = 1 << 3,    ///< ;LAYER_CHANGE markers drive layer detection
+        PENDING_LAYER_MARKER = 1 << 4, ///< Marker seen, layer not yet started
+        HAS_LAYER = 1 << 5,            ///< A layer is in progress (at layer_z)
+        MULTIPLE_LAYERS = 1 << 6,      ///< More than one layer was started before
+        HAS_SEGMENTS = 1 << 7,         ///< At least one segment was emitted before
+    };
+
+    glm::vec3 position{0.0f, 0.0f, 0.0f}; ///< Current XYZ position
+    float e{0.0f};                        ///< Current E position
+    float layer_z{0.0f};                  ///< Z of the layer in progress (see HAS_LAYER)
+    ObjectId object_id{NO_OBJECT_ID};     ///< Active EXCLUDE_OBJECT (interned)
+    uint8_t tool_index{0};                ///< Active tool (clamped like ToolpathSegment)
+    uint8_t flags{ABSOLUTE_POSITIONING | ABSOLUTE_EXTRUSION};
+
+    bool has(Flags flag) const {
+        return (flags & flag) != 0;
+    }
+};
+
+static_assert(sizeof(ParserStateSnapshot) <= 24, "ParserStateSnapshot is stored per layer");
+
 /**
  * @brief Streaming G-code parser
  *
@@ -213,6 +371,16 @@ struct ParsedGCodeFile {
 class GCodeParser {
   public:
     GCodeParser();
+
+    /**
+     * @brief Construct a parser that interns object names into a shared table
+     *
+     * Used by streaming mode so segments from separately parsed layers share
+     * one id space. The table is kept across reset()/finalize().
+     *
+     * @param object_names Shared name table (must not be null)
+     */
+    explicit GCodeParser(std::shared_ptr<ObjectNameTable> object_names);
     ~GCodeParser() = default;
 
     /**
@@ -221,8 +389,22 @@ class GCodeParser {
      *
      * Extracts movement commands, coordinate changes, and object metadata.
      * Automatically detects layer changes (Z-axis movement).
+     *
+     * The line is only borrowed for the duration of the call, so callers can
+     * pass views straight into a read buffer. G0/G1 lines are tokenized without
+     * any heap allocation.
      */
-    void parse_line(const std::string& line);
+    void parse_line(std::string_view line);
+
+    /// @copydoc parse_line(std::string_view)
+    void parse_line(const std::string& line) {
+        parse_line(std::string_view(line));
+    }
+
+    /// @copydoc parse_line(std::string_view)
+    void parse_line(const char* line) {
+        parse_line(std::string_view(line));
+    }
 
     /**
      * @brief Finalize parsing and return complete data structure
@@ -276,6 +458,57 @@ class GCodeParser {
         return tool_color_palette_;
     }
 
+    // Resumable parsing (layer-parallel decoding)
+
+    /**
+     * @brief Capture the modal state needed to resume parsing at the next line
+     * @return Snapshot to pass to restore_state() on another parser
+     */
+    ParserStateSnapshot snapshot_state() const;
+
+    /**
+     * @brief Resume from a snapshot taken over the same file
+     *
+     * Call on a fresh parser that shares the snapshot's ObjectNameTable. If a
+     * layer was in progress, a continuation layer at the snapshot's Z becomes
+     * layers[0] and collects segments up to the next layer change, exactly as
+     * a front-to-back parse would have appended them to that layer.
+     *
+     * @param state Snapshot from snapshot_state()
+     */
+    void restore_state(const ParserStateSnapshot& state);
+
+    /**
+     * @brief Declare objects defined before the resume point
+     *
+     * Object bounding boxes only grow for defined objects, so a parser resumed
+     * mid-file needs the EXCLUDE_OBJECT_DEFINEs it skipped. Declared objects
+     * carry only their name.
+     *
+     * @param ids Object ids in definition order (see defined_objects())
+     */
+    void declare_objects(const std::vector<ObjectId>& ids);
+
+    /**
+     * @brief Objects in EXCLUDE_OBJECT_DEFINE order (first definition of each name)
+     */
+    const std::vector<ObjectId>& defined_objects() const {
+        return defined_objects_;
+    }
+
+    /**
+     * @brief Track modal state and metadata only, without storing segments
+     *
+     * Used for the metadata pass of parse_gcode_file_parallel(). Only the layer
+     * in progress is kept, so memory stays constant regardless of file size.
+     * Snapshots for indexing come from the cheaper GCodeStateTracker.
+     *
+     * @param state_only true to skip segment/bounds accumulation
+     */
+    void set_state_only(bool state_only) {
+        state_only_ = state_only;
+    }
+
   private:
     // Parsing helpers
 
@@ -284,14 +517,22 @@ class GCodeParser {
      * @param line Trimmed G-code line
      * @return true if parsed successfully
      */
-    bool parse_movement_command(const std::string& line);
+    bool parse_movement_command(std::string_view line);
+
+    /**
+     * @brief Parse set position command (G92)
+     * @param line Trimmed G-code line
+     *
+     * Sets the given axes; without axis words every axis is zeroed (as Klipper does).
+     */
+    void parse_set_position_command(std::string_view line);
 
     /**
      * @brief Parse EXCLUDE_OBJECT_* command
      * @param line Trimmed G-code line
      * @return true if parsed successfully
      */
-    bool parse_exclude_object_command(const std::string& line);
+    bool parse_exclude_object_command(std::string_view line);
 
     /**
      * @brief Parse slicer metadata from comment line
@@ -303,7 +544,7 @@ class GCodeParser {
      * - "; estimated printing time (normal mode) = 29m 25s"
      * - "; printer_model = Flashforge Adventurer 5M Pro"
      */
-    void parse_metadata_comment(const std::string& line);
+    void parse_metadata_comment(std::string_view line);
 
     /**
      * @brief Parse extruder color palette from header metadata
@@ -312,7 +553,7 @@ class GCodeParser {
      * Extracts semicolon-separated hex color values for multi-color prints.
      * Format: "; extruder_colour = #ED1C24;#00C1AE;#F4E2C1;#000000"
      */
-    void parse_extruder_color_metadata(const std::string& line);
+    void parse_extruder_color_metadata(std::string_view line);
 
     /**
      * @brief Parse tool change command (T0, T1, T2, etc.)
@@ -320,7 +561,7 @@ class GCodeParser {
      *
      * Updates current_tool_index_ when tool change commands are encountered.
      */
-    void parse_tool_change_command(const std::string& line);
+    void parse_tool_change_command(std::string_view line);
 
     /**
      * @brief Parse wipe tower markers from comments
@@ -328,26 +569,17 @@ class GCodeParser {
      *
      * Detects WIPE_TOWER_START/END markers for optional wipe tower filtering.
      */
-    void parse_wipe_tower_marker(const std::string& comment);
-
-    /**
-     * @brief Extract parameter value from G-code line
-     * @param line G-code line
-     * @param param Parameter letter (e.g., 'X', 'Y', 'Z')
-     * @param out_value Output value
-     * @return true if parameter found
-     */
-    bool extract_param(const std::string& line, char param, float& out_value);
+    void parse_wipe_tower_marker(std::string_view comment);
 
     /**
      * @brief Extract string parameter value
      * @param line G-code line
      * @param param Parameter name (e.g., "NAME")
-     * @param out_value Output string
+     * @param out_value Output view into @p line
      * @return true if parameter found
      */
-    bool extract_string_param(const std::string& line, const std::string& param,
-                              std::string& out_value);
+    bool extract_string_param(std::string_view line, std::string_view param,
+                              std::string_view& out_value);
 
     /**
      * @brief Add toolpath segment to current layer
@@ -368,14 +600,16 @@ class GCodeParser {
     /**
      * @brief Trim whitespace and comments from line
      * @param line Raw line
-     * @return Trimmed line
+     * @return Trimmed view into @p line
      */
-    std::string trim_line(const std::string& line);
+    std::string_view trim_line(std::string_view line);
 
     // Parser state
     glm::vec3 current_position_{0.0f, 0.0f, 0.0f}; ///< Current XYZ position
     float current_e_{0.0f};                        ///< Current E (extruder) position
     std::string current_object_;         ///< Current object name (from EXCLUDE_OBJECT_START)
+    ObjectId current_object_id_{NO_OBJECT_ID}; ///< Interned id of current_object_
+    bool current_object_is_support_{false};    ///< current_object_ names support material
     bool is_absolute_positioning_{true}; ///< G90 (absolute) vs G91 (relative)
     bool is_absolute_extrusion_{true};   ///< M82 (absolute E) vs M83 (relative E)
 
@@ -385,10 +619,18 @@ class GCodeParser {
     bool in_wipe_tower_{false};                   ///< True when inside wipe tower section
 
     // Accumulated data
-    std::vector<Layer> layers_;                  ///< All parsed layers
+    std::shared_ptr<ObjectNameTable> object_names_; ///< Interned object names
+    bool shared_object_names_{false};               ///< Table supplied by caller (keep on reset)
+    std::vector<Layer> layers_;                     ///< All parsed layers
     std::map<std::string, GCodeObject> objects_; ///< Object metadata
+    std::vector<ObjectId> defined_objects_;      ///< Objects in definition order
     AABB global_bounds_;                         ///< Global bounding box
 
+    // Layer tracking that survives snapshot/restore (layers_ may start mid-file)
+    size_t layers_started_{0}; ///< Layers started so far (including before a restore)
+    bool has_segments_{false}; ///< Any segment emitted so far (including before a restore)
+    bool state_only_{false};   ///< Skip segment storage (see set_state_only())
+
     // Parsed metadata (transferred to ParsedGCodeFile on finalize())
     std::string metadata_slicer_name_;
     std::string metadata_filament_type_;
@@ -419,6 +661,62 @@ class GCodeParser {
         0}; ///< Count of segments with calculated width outside 0.1-2.0mm
 };
 
+/**
+ * @brief Modal state tracker for G-code that is only indexed, not parsed
+ *
+ * Follows exactly the state ParserStateSnapshot records - G90/G91, M82/M83,
+ * G92, XYZE, T, EXCLUDE_OBJECT, wipe tower and layer markers - and nothing
+ * else: no metadata comments, segments or object geometry. Layer indexing and
+ * the parallel parser's read-ahead run this on every line of the file.
+ *
+ * snapshot() equals GCodeParser::snapshot_state() after the same lines; both
+ * share the line classification and axis word scanning in gcode_parser.cpp,
+ * so keep them in step when either learns a new command.
+ */
+class GCodeStateTracker {
+  public:
+    /**
+     * @param object_names Table to intern EXCLUDE_OBJECT names into; parsers
+     *        resuming from the snapshots must share it
+     */
+    explicit GCodeStateTracker(std::shared_ptr<ObjectNameTable> object_names);
+
+    /**
+     * @brief Apply one line of G-code
+     * @param line Line without newline
+     */
+    void parse_line(std::string_view line);
+
+    /**
+     * @brief State to resume a GCodeParser from at this point
+     */
+    const ParserStateSnapshot& snapshot() const {
+        return state_;
+    }
+
+    /**
+     * @brief Objects in EXCLUDE_OBJECT_DEFINE order (for GCodeParser::declare_objects())
+     */
+    const std::vector<ObjectId>& defined_objects() const {
+        return defined_objects_;
+    }
+
+  private:
+    void parse_comment(std::string_view comment);
+    void parse_move(std::string_view line);
+    void parse_exclude_object(std::string_view line);
+    void start_layer(float z);
+
+    void set_flag(ParserStateSnapshot::Flags flag, bool on) {
+        state_.flags = static_cast<uint8_t>(on ? (state_.flags | flag) : (state_.flags & ~flag));
+    }
+
+    std::shared_ptr<ObjectNameTable> object_names_;
+    ParserStateSnapshot state_;
+    std::string current_object_; ///< Name behind state_.object_id (for EXCLUDE_OBJECT_END)
+    std::vector<ObjectId> defined_objects_;
+};
+
 // ============================================================================
 // Thumbnail Extraction (Standalone Functions)
 // ============================================================================
@@ -404,6 +404,8 @@ class GCodeRenderer {
     int viewport_width_{800};
     int viewport_height_{480};
     RenderOptions options_;
+    ObjectIdSet highlighted_ids_; ///< options_ highlight names resolved at render()
+    ObjectIdSet excluded_ids_;    ///< options_ excluded names resolved at render()
 
     // Colors (lazily loaded from theme on first render)
     lv_color_t color_extrusion_{};
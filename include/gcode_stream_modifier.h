@@ -0,0 +1,114 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_stream_modifier.h
+ * @brief Applies a Modification list to G-code as it streams past, chunk in / chunk out
+ *
+ * @pattern Push-style filter: feed() arbitrary byte chunks (download callback, file blocks),
+ *          modified bytes come out through a sink (upload body, output file). Once the last
+ *          modified line has been written the filter switches to passthrough and forwards
+ *          chunks untouched, so edits in the header cost a header-sized rewrite, not a
+ *          file-sized one.
+ * @threading Not thread-safe; one instance per stream, driven from one thread
+ * @gotchas Memory is bounded by OUTPUT_CHUNK_SIZE plus one partial line (at most
+ *          MAX_LINE_LENGTH); a longer line before the passthrough point fails the stream
+ */
+
+#pragma once
+
+#include "gcode_file_modifier.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/**
+ * @brief Streaming line editor for a fixed set of modifications
+ *
+ * Line numbers always refer to the original file, so modifications are
+ * independent of each other. Ranges are supported for COMMENT_OUT, DELETE and
+ * REPLACE (the replacement is written once, in place of the whole range). Line
+ * endings, including a missing final newline and CRLF, are preserved.
+ *
+ * @code
+ * GCodeStreamModifier stream(modifier.modifications());
+ * auto sink = [&](const char* data, size_t size) { return upload.send(data, size); };
+ * while (auto chunk = download.next()) {
+ *     if (!stream.feed(chunk.data(), chunk.size(), sink)) break;
+ * }
+ * stream.finish(sink);
+ * @endcode
+ */
+class GCodeStreamModifier {
+  public:
+    /// Receives output bytes; return false to abort the stream (e.g. upload failed)
+    using Sink = std::function<bool(const char* data, size_t size)>;
+
+    /// Output is batched into chunks of this size before reaching the sink
+    static constexpr size_t OUTPUT_CHUNK_SIZE = 64 * 1024;
+
+    /// Longest line accepted while modifications are still pending
+    static constexpr size_t MAX_LINE_LENGTH = 1024 * 1024;
+
+    explicit GCodeStreamModifier(std::vector<Modification> modifications);
+
+    /**
+     * @brief Process the next chunk of the original file
+     * @return false if the sink aborted or a line was too long (see result())
+     */
+    bool feed(const char* data, size_t size, const Sink& sink);
+
+    /**
+     * @brief Flush the final line and buffered output
+     * @return true if the whole stream was written; result().success is set accordingly
+     */
+    bool finish(const Sink& sink);
+
+    /// Statistics and error; modified_path is left empty
+    [[nodiscard]] const ModificationResult& result() const {
+        return result_;
+    }
+
+    /// Last original line that can change (0 = none); everything after it is copied as-is
+    [[nodiscard]] size_t passthrough_line() const {
+        return passthrough_line_;
+    }
+
+    /// True once the stream has gone past passthrough_line()
+    [[nodiscard]] bool in_passthrough() const {
+        return passthrough_;
+    }
+
+    /// Original lines split and inspected so far (stops growing in passthrough)
+    [[nodiscard]] size_t lines_processed() const {
+        return line_number_;
+    }
+
+  private:
+    void process_line(std::string_view line, std::string_view eol);
+    void put_line(std::string_view text, std::string_view separator, bool& wrote);
+    size_t put_lines(std::string_view gcode, std::string_view separator, bool& wrote);
+    bool flush(const Sink& sink);
+    bool fail(const std::string& message);
+
+    std::vector<Modification> modifications_; ///< Sorted by line_number (stable)
+    size_t next_mod_ = 0;                     ///< First modification not yet started
+    std::vector<const Modification*> active_; ///< Modifications covering the current line
+    size_t passthrough_line_ = 0;
+    bool passthrough_ = false;
+    bool failed_ = false;
+
+    size_t line_number_ = 0;
+    std::string carry_; ///< Partial line left over from the previous chunk
+    std::string out_;   ///< Pending output, flushed at OUTPUT_CHUNK_SIZE
+    ModificationResult result_;
+};
+
+} // namespace gcode
+} // namespace helix
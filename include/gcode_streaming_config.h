@@ -70,6 +70,17 @@ size_t calculate_streaming_threshold(size_t available_memory_kb, int threshold_p
  */
 bool should_use_gcode_streaming(size_t file_size_bytes);
 
+/**
+ * @brief Check whether streamed files get a binary toolpath cache
+ *
+ * Config file gcode_viewer.toolpath_cache (default true). When enabled, the
+ * first view of a streamed file writes pre-parsed layers to the helix cache
+ * dir so later layer loads skip G-code parsing.
+ *
+ * @return true if the toolpath cache should be used
+ */
+bool is_gcode_toolpath_cache_enabled();
+
 /**
  * @brief Get human-readable description of current streaming config
  *
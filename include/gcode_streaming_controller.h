@@ -4,10 +4,12 @@
 #pragma once
 
 #include "gcode_data_source.h"
+#include "gcode_index_cache.h"
 #include "gcode_layer_cache.h"
 #include "gcode_layer_index.h"
 #include "gcode_parser.h"
 #include "gcode_streaming_config.h"
+#include "gcode_toolpath_cache.h"
 
 #include <atomic>
 #include <chrono>
@@ -139,7 +141,7 @@ class BackgroundGhostBuilder {
  * @brief Orchestrates streaming G-code loading for memory-constrained devices
  *
  * The streaming controller provides on-demand layer loading by coordinating:
- * - GCodeLayerIndex: Maps layer numbers to file byte offsets (~24 bytes/layer)
+ * - GCodeLayerIndex: Maps layer numbers to file byte offsets + parser state (~48 bytes/layer)
  * - GCodeDataSource: Reads byte ranges from file or network
  * - GCodeLayerCache: LRU cache for parsed segment data
  * - GCodeParser: Converts raw G-code bytes to ToolpathSegments
@@ -161,7 +163,7 @@ class BackgroundGhostBuilder {
  *   }
  * @endcode
  *
- * Memory usage: Index (~24 bytes × layers) + Cache (configurable budget)
+ * Memory usage: Index (~48 bytes × layers) + Cache (configurable budget)
  */
 class GCodeStreamingController {
   public:
@@ -171,6 +173,9 @@ class GCodeStreamingController {
     /// Minimum cache budget (1MB)
     static constexpr size_t MIN_CACHE_BUDGET = 1 * 1024 * 1024;
 
+    /// Default size cap for the binary toolpath cache directory (64MB)
+    static constexpr size_t DEFAULT_TOOLPATH_CACHE_BYTES = 64 * 1024 * 1024;
+
     /**
      * @brief Construct controller with default settings
      *
@@ -284,15 +289,15 @@ class GCodeStreamingController {
      *         Data stays valid as long as the shared_ptr is held, even if the
      *         cache entry is evicted. This is critical for thread safety.
      *
-     * @note For background loading, use request_layer() + is_layer_ready()
+     * @note For background loading, use request_layer() + is_layer_cached()
      */
     std::shared_ptr<const std::vector<ToolpathSegment>> get_layer_segments(size_t layer_index);
 
     /**
      * @brief Request a layer to be loaded (non-blocking)
      *
-     * If layer is not cached, queues it for background loading.
-     * Check is_layer_ready() or get_layer_segments() later.
+     * If layer is not cached, queues it for background loading ahead of its
+     * neighbours. Check is_layer_cached() or get_layer_segments() later.
      *
      * @param layer_index Zero-based layer index
      */
@@ -308,15 +313,23 @@ class GCodeStreamingController {
     /**
      * @brief Prefetch layers around current view
      *
-     * Loads layers in range [center - radius, center + radius].
-     * Called automatically by get_layer_segments() but can be
-     * called explicitly for more control.
+     * Queues layers in range [center - radius, center + radius] for loading
+     * on background threads and returns immediately (see
+     * GCodeLayerCache::prefetch_async()). Called automatically by
+     * get_layer_segments() but can be called explicitly for more control.
+     * Layers still queued from an earlier center outside the new range are
+     * cancelled.
      *
      * @param center_layer Center layer index
      * @param radius Number of layers on each side (default: 3)
      */
     void prefetch_around(size_t center_layer, size_t radius = DEFAULT_PREFETCH_RADIUS);
 
+    /**
+     * @brief Block until queued prefetches have finished loading
+     */
+    void wait_for_prefetch();
+
     // =========================================================================
     // Layer Information
     // =========================================================================
@@ -341,6 +354,18 @@ class GCodeStreamingController {
      */
     int find_layer_at_z(float z) const;
 
+    /**
+     * @brief Estimate the model bounding box without loading every layer
+     *
+     * Z comes from the index. The index has no X/Y, so the first, middle and
+     * last layers are loaded (blocking if not cached) and their segments
+     * measured.
+     *
+     * @param[out] bounds Estimated bounds; X/Y are left untouched if no sampled layer has segments
+     * @return true if X/Y were found
+     */
+    bool sample_bounds(AABB& bounds);
+
     /**
      * @brief Get layer index statistics
      * @return Statistics from index building
@@ -363,6 +388,12 @@ class GCodeStreamingController {
      */
     float get_cache_hit_rate() const;
 
+    /**
+     * @brief Get background prefetch counters
+     * @return Prefetch hits/misses and queue latency
+     */
+    GCodeLayerCache::PrefetchStats get_prefetch_stats() const;
+
     /**
      * @brief Get current cache memory usage
      * @return Bytes used
@@ -399,6 +430,49 @@ class GCodeStreamingController {
      */
     void respond_to_memory_pressure();
 
+    /**
+     * @brief Set the on-disk layer index cache
+     *
+     * Off by default, so tests and tools never write to the helix cache dir;
+     * the G-code viewer passes a GCodeIndexCache there. Applies to the next
+     * open; pass nullptr to always rescan.
+     *
+     * @param cache Index cache shared with other controllers, or nullptr
+     */
+    void set_index_cache(std::shared_ptr<GCodeIndexCache> cache);
+
+    /**
+     * @brief Check whether the open file's index came from the disk cache
+     * @return true if the last open skipped the index scan
+     */
+    bool is_index_from_cache() const;
+
+    /**
+     * @brief Enable the binary toolpath cache (see gcode_toolpath_cache.h)
+     *
+     * The first time a file is viewed, a background thread parses every layer
+     * once and writes it in the compact binary format. Once that file exists
+     * (now or on a later open of the same file), cache misses decode a few KB
+     * of pre-parsed segments instead of re-parsing G-code. Applies to the
+     * next open; disabled by default.
+     *
+     * @param directory Cache directory (empty disables)
+     * @param max_bytes Directory size cap, least recently written files are evicted
+     */
+    void set_toolpath_cache_dir(const std::string& directory,
+                                size_t max_bytes = DEFAULT_TOOLPATH_CACHE_BYTES);
+
+    /**
+     * @brief Check whether layer loads are served from the binary toolpath cache
+     * @return true once the cache file for the open file is readable
+     */
+    bool is_toolpath_cache_ready() const;
+
+    /**
+     * @brief Block until a background toolpath cache write has finished
+     */
+    void wait_for_toolpath_cache();
+
     // =========================================================================
     // Metadata Access
     // =========================================================================
@@ -412,6 +486,16 @@ class GCodeStreamingController {
      */
     const GCodeHeaderMetadata* get_header_metadata() const;
 
+    /**
+     * @brief Get the object name table shared by all layers of this file
+     *
+     * Segments returned by get_layer_segments() carry ObjectIds from this
+     * table. A new table is created when the file is closed.
+     *
+     * @return Shared name table (never null)
+     */
+    std::shared_ptr<ObjectNameTable> get_object_names() const;
+
   private:
     /**
      * @brief Load a layer from source and parse to segments
@@ -420,12 +504,51 @@ class GCodeStreamingController {
      */
     std::vector<ToolpathSegment> load_layer(size_t layer_index);
 
+    /**
+     * @brief Parse a layer from the G-code source
+     * @param layer_index Layer to parse
+     * @param segments Parsed segments (appended)
+     * @return false if the layer's bytes could not be read
+     */
+    bool parse_layer(size_t layer_index, std::vector<ToolpathSegment>& segments);
+
     /**
      * @brief Build index from current data source
      * @return true if successful
      */
     bool build_index();
 
+    /**
+     * @brief Load the index from the disk cache, if the source has a cache key
+     * @return true on cache hit
+     */
+    bool load_cached_index();
+
+    /**
+     * @brief Open the binary toolpath cache, or start writing it in the background
+     *
+     * Called once the index is ready. No-op if disabled or the source has no cache key.
+     */
+    void start_toolpath_cache();
+
+    /**
+     * @brief Cancel a running toolpath cache write and drop the reader
+     */
+    void stop_toolpath_cache();
+
+    /**
+     * @brief Background thread body: parse all layers and write the cache file
+     * @param path Final cache file path
+     * @param key Source cache key
+     */
+    void write_toolpath_cache(const std::string& path, const std::string& key);
+
+    /**
+     * @brief Get the toolpath cache reader, if ready
+     * @return Reader, or nullptr
+     */
+    std::shared_ptr<const ToolpathCacheReader> toolpath_reader() const;
+
     /**
      * @brief Create loader function for cache
      * @return Loader lambda
@@ -434,8 +557,19 @@ class GCodeStreamingController {
 
     // Components (order matters for destruction)
     std::unique_ptr<GCodeDataSource> data_source_;
+    std::mutex source_mutex_; ///< Serializes read_range() fallback reads from parallel loaders
     GCodeLayerIndex index_;
     GCodeLayerCache cache_;
+    std::shared_ptr<GCodeIndexCache> index_cache_; ///< nullptr: always scan
+    std::atomic<bool> index_from_cache_{false};
+
+    // Binary toolpath cache
+    std::string toolpath_cache_dir_;
+    size_t toolpath_cache_max_bytes_{DEFAULT_TOOLPATH_CACHE_BYTES};
+    mutable std::mutex toolpath_mutex_; ///< Protects toolpath_reader_
+    std::shared_ptr<const ToolpathCacheReader> toolpath_reader_;
+    std::thread toolpath_writer_;
+    std::atomic<bool> toolpath_cancel_{false};
 
     // Async indexing
     std::future<bool> index_future_;
@@ -448,6 +582,7 @@ class GCodeStreamingController {
     mutable std::mutex metadata_mutex_;
     std::unique_ptr<GCodeHeaderMetadata> header_metadata_;
     bool metadata_extracted_{false};
+    std::shared_ptr<ObjectNameTable> object_names_ = std::make_shared<ObjectNameTable>();
 
     // State
     std::atomic<bool> is_open_{false};
@@ -13,14 +13,22 @@
 #include <lvgl/lvgl.h>
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <glm/glm.hpp>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 namespace helix {
 namespace gcode {
 
+class GCodeStreamingController;
+
 /**
  * @brief Ghost layer rendering mode for print progress visualization
  *
@@ -67,6 +75,66 @@ class GCodeTinyGLRenderer {
     void render(lv_layer_t* layer, const ParsedGCodeFile& gcode, const GCodeCamera& camera,
                 const lv_area_t* widget_coords);
 
+    /**
+     * @brief Render geometry streamed from the streaming controller
+     * @param layer LVGL draw layer (from draw event callback)
+     * @param camera Camera with view/projection matrices
+     * @param widget_coords Absolute screen coordinates of the widget
+     *
+     * Starts the layer builder on first use, then appends the layers built
+     * since the last frame before drawing. Keep calling while
+     * needs_more_frames() is true to show the model growing.
+     */
+    void render(lv_layer_t* layer, const GCodeCamera& camera, const lv_area_t* widget_coords);
+
+    /**
+     * @brief Stream geometry layer by layer from a streaming controller
+     * @param controller Indexed controller, or nullptr to stop streaming
+     *
+     * Instead of building from a complete ParsedGCodeFile, a background thread
+     * loads layers in order (through the controller's bounded layer cache),
+     * builds each layer's ribbons and queues them for the streaming render().
+     * Peak memory is the layer cache plus the geometry, which is capped by
+     * /gcode_viewer/streaming_geometry_budget_mb: past 3/4 of the budget the
+     * remaining layers are built with coarse simplification, and layers that
+     * would exceed it are left out.
+     *
+     * The controller must stay open until streaming is stopped (nullptr or
+     * destruction).
+     */
+    void set_streaming_controller(GCodeStreamingController* controller);
+
+    /**
+     * @brief Check if streamed layers are still being built or waiting to be drawn
+     * @return true while the streaming render() has more to show
+     */
+    bool needs_more_frames() const;
+
+    /**
+     * @brief Get streaming progress
+     * @return Fraction of layers built (1.0 when not streaming). Stays below
+     *         1.0 when the geometry budget cut streaming short.
+     */
+    float get_streaming_progress() const;
+
+    /**
+     * @brief Check if the geometry budget cut streaming short
+     * @return true when the top layers of the range are left out of the view
+     */
+    bool is_streaming_truncated() const {
+        return streaming_truncated_.load();
+    }
+
+    /// Layers of the streamed range built so far
+    size_t get_streamed_layer_count() const {
+        return streamed_layer_count_.load();
+    }
+
+    /// Layers in the streamed range
+    size_t get_streaming_total_layers() const {
+        return streaming_total_layers_;
+    }
+
     /**
      * @brief Set viewport size
      * @param width Viewport width in pixels
@@ -352,6 +420,48 @@ class GCodeTinyGLRenderer {
      */
     void build_geometry(const ParsedGCodeFile& gcode);
 
+    /**
+     * @brief Draw a frame (shared by both render() overloads)
+     * @param gcode Parsed file for object bounding boxes, or nullptr when streaming
+     */
+    void render_frame(lv_layer_t* layer, const ParsedGCodeFile* gcode, const GCodeCamera& camera,
+                      const lv_area_t* widget_coords);
+
+    /**
+     * @brief (Re)start the streaming layer builder from layer 0
+     */
+    void start_streaming();
+
+    /**
+     * @brief Cancel the streaming layer builder and wait for it
+     */
+    void stop_streaming();
+
+    /// Settings the streaming builder thread works from (copied when it starts)
+    struct StreamingJob {
+        GCodeStreamingController* controller{nullptr};
+        std::unique_ptr<GeometryBuilder> builder; ///< Copy of geometry_builder_'s settings
+        size_t layer_count{0};
+        size_t first_layer{0};
+        size_t end_layer{0}; ///< Exclusive
+        bool show_extrusions{true};
+        bool show_travels{false};
+        SimplificationOptions simplification;
+        size_t budget_bytes{0};
+    };
+
+    /**
+     * @brief Streaming builder thread: load, build and queue layers in order
+     * @param job Snapshot of the renderer settings
+     */
+    void streaming_worker(StreamingJob job);
+
+    /**
+     * @brief Append queued streamed layers to geometry_
+     * @return true if the geometry changed
+     */
+    bool append_streamed_layers();
+
   public:
     /**
      * @brief Set pre-built geometry (for async loading)
@@ -370,10 +480,21 @@ class GCodeTinyGLRenderer {
      *
      * Optional: If provided, this coarse geometry will be used during drag
      * interaction for better frame rates. If not provided, falls back to
-     * runtime layer skipping.
+     * runtime layer skipping. Replaces any LOD levels already set.
      */
     void set_prebuilt_coarse_geometry(std::unique_ptr<RibbonGeometry> geometry);
 
+    /**
+     * @brief Add one level of the LOD pyramid (for interaction)
+     * @param geometry Coarse geometry built with GeometryBuilder::lod_level_options()
+     *
+     * Levels may arrive in any order after set_prebuilt_geometry(); they are
+     * kept sorted by RibbonGeometry::lod_error_mm. During interaction each
+     * frame picks the coarsest level the render-time budget calls for, but no
+     * coarser than its projected error allows (see select_lod_level()).
+     */
+    void add_prebuilt_lod_level(std::unique_ptr<RibbonGeometry> geometry);
+
   private:
     /**
      * @brief Render geometry with TinyGL
@@ -407,6 +528,14 @@ class GCodeTinyGLRenderer {
      */
     void render_layer_range(int start_layer, int end_layer, float dim_factor);
 
+    /**
+     * @brief Get the geometry's packed vertex arrays, building them on first use
+     * @param geometry Geometry about to be drawn
+     * @return Arrays, or nullptr when they would exceed the memory budget
+     *         (render_layer_range() then falls back to immediate mode)
+     */
+    RibbonDrawArrays* ensure_draw_arrays(RibbonGeometry& geometry);
+
     // ==============================================
     // Frustum Culling
     // ==============================================
@@ -470,6 +599,21 @@ class GCodeTinyGLRenderer {
 
     /// Update adaptive optimization based on last render time
     void update_adaptive_optimization(float render_time_ms);
+
+    /// Coarsest LOD level the render-time budget allows (0 = full detail)
+    size_t lod_budget_level_{1};
+
+    /// Coarse levels may not deviate more than this on screen during interaction
+    static constexpr float kMaxLodErrorPixels = 4.0f;
+
+    /**
+     * @brief Pick the geometry level for this frame (0 = full, i = lod_levels_[i - 1])
+     *
+     * The render-time budget (lod_budget_level_) says how coarse we need to go;
+     * the level's lod_error_mm projected to screen pixels says how coarse we may
+     * go at the current zoom. Level 1 is always allowed during interaction.
+     */
+    size_t select_lod_level(const GCodeCamera& camera) const;
     bool smooth_shading_{false};  // Use flat shading to avoid triangle seam artifacts
     float extrusion_width_{0.5f}; // Wider for solid appearance
     SimplificationOptions simplification_;
@@ -499,16 +643,52 @@ class GCodeTinyGLRenderer {
     void* zbuffer_{nullptr};
     unsigned int* framebuffer_{nullptr};
 
-    // Geometry (full detail + coarse LOD for interaction)
+    // Geometry (full detail + LOD pyramid for interaction)
     std::unique_ptr<GeometryBuilder> geometry_builder_;
-    std::optional<RibbonGeometry> geometry_;        ///< Full detail geometry (for static view)
-    std::optional<RibbonGeometry> coarse_geometry_; ///< Coarse LOD (for interaction)
+    std::optional<RibbonGeometry> geometry_;   ///< Full detail geometry (for static view)
+    std::vector<RibbonGeometry> lod_levels_;   ///< Coarse LOD pyramid, finest first
+    size_t active_lod_level_{0};               ///< Level drawn last frame (0 = full detail)
     RibbonGeometry* active_geometry_{nullptr}; ///< Currently rendering geometry (set per-frame)
     std::string current_gcode_filename_;       // Track if we need to rebuild
 
     /// Use LOD geometry during interaction (Phase 6 optimization)
     bool use_lod_for_interaction_{true};
 
+    // Packed vertex arrays (config: /gcode_viewer/vertex_array_budget_mb, 0 = immediate mode)
+    static constexpr int DEFAULT_VERTEX_ARRAY_BUDGET_MB = 64;
+    static constexpr int CONSTRAINED_VERTEX_ARRAY_BUDGET_MB = 16;
+    size_t vertex_array_budget_bytes_{DEFAULT_VERTEX_ARRAY_BUDGET_MB * 1024 * 1024};
+    const RibbonGeometry* vertex_array_skipped_{nullptr}; ///< Over-budget geometry already logged
+
+    /// Upper bound for /gcode_viewer/raster_threads = 0 (auto)
+    static constexpr int MAX_AUTO_RASTER_THREADS = 4;
+
+    // ==============================================
+    // Streaming (layer-by-layer geometry)
+    // ==============================================
+
+    // Geometry cap (config: /gcode_viewer/streaming_geometry_budget_mb)
+    static constexpr int DEFAULT_STREAMING_GEOMETRY_BUDGET_MB = 48;
+    static constexpr int CONSTRAINED_STREAMING_GEOMETRY_BUDGET_MB = 12;
+    /// Built layers waiting for the UI thread; the builder pauses above this
+    static constexpr size_t MAX_PENDING_STREAMED_BYTES = 4 * 1024 * 1024;
+    /// Minimum time between appending streamed layers (each append re-renders)
+    static constexpr std::chrono::milliseconds STREAMING_REFRESH_INTERVAL{250};
+
+    GCodeStreamingController* streaming_controller_{nullptr};
+    std::thread streaming_thread_;
+    std::atomic<bool> streaming_cancel_{false};
+    std::atomic<bool> streaming_active_{false}; ///< Builder thread still producing layers
+    std::atomic<bool> streaming_truncated_{false}; ///< Budget reached before the last layer
+    std::atomic<size_t> streamed_layer_count_{0};
+    size_t streaming_total_layers_{0};
+    mutable std::mutex streaming_mutex_; ///< Protects streamed_base_ and streamed_pending_*
+    std::condition_variable streaming_cv_;
+    std::optional<RibbonGeometry> streamed_base_; ///< From begin_layers(), replaces geometry_
+    std::vector<GeometryBuilder::LayerGeometry> streamed_pending_;
+    size_t streamed_pending_bytes_{0};
+    std::chrono::steady_clock::time_point last_streamed_append_;
+
     // LVGL image buffer for display
     lv_draw_buf_t* draw_buf_{nullptr};
 
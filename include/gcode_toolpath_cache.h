@@ -0,0 +1,191 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file gcode_toolpath_cache.h
+ * @brief Compact on-disk format for pre-parsed toolpath layers
+ *
+ * @pattern One file per G-code source: layer blobs of delta-encoded, quantized segments followed
+ *          by a directory of per-layer offsets, so a layer load is one small contiguous read
+ * @threading Writer is single-threaded; Reader::read_layer() may be called from any thread
+ * @gotchas Object ids in a file are the writer's; the reader remaps them by name into the
+ *          caller's ObjectNameTable
+ */
+
+#pragma once
+
+#include "gcode_data_source.h"
+#include "gcode_parser.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/// Version of the toolpath cache format; files with another version are ignored.
+/// Bump it when the layout changes or GCodeParser would emit different segments
+/// for the same file (1: initial, 2: G92 support).
+constexpr uint32_t TOOLPATH_CACHE_VERSION = 2;
+
+/// Toolpath cache file extension
+constexpr const char* TOOLPATH_CACHE_EXTENSION = ".ltp";
+
+/// Position grid (1 micron; printers resolve ~10 microns)
+constexpr float TOOLPATH_POSITION_UNITS_PER_MM = 1000.0f;
+
+/// Extrusion grid (0.01 micron of filament)
+constexpr float TOOLPATH_EXTRUSION_UNITS_PER_MM = 100000.0f;
+
+/// Width grid (0.1 micron)
+constexpr float TOOLPATH_WIDTH_UNITS_PER_MM = 10000.0f;
+
+/**
+ * @brief Encode one layer's segments into a compact blob
+ *
+ * Positions are quantized to TOOLPATH_POSITION_UNITS_PER_MM and stored as
+ * zigzag varint deltas from the previous segment; a segment that starts where
+ * the previous one ended (the common case) stores only its end delta. Object,
+ * tool and width are only written when they change. Typical cost is 5-8 bytes
+ * per segment versus 36 in memory.
+ *
+ * @param segments Layer segments
+ * @param out Blob is appended here
+ */
+void encode_toolpath_layer(const std::vector<ToolpathSegment>& segments, std::vector<uint8_t>& out);
+
+/**
+ * @brief Decode a blob written by encode_toolpath_layer()
+ *
+ * @param data Blob bytes
+ * @param size Blob size
+ * @param object_remap Maps the blob's object ids to the caller's (empty = keep ids)
+ * @param out Decoded segments (replaced)
+ * @return false if the blob is malformed
+ */
+bool decode_toolpath_layer(const uint8_t* data, size_t size,
+                           const std::vector<ObjectId>& object_remap,
+                           std::vector<ToolpathSegment>& out);
+
+/**
+ * @brief Streams layers into a toolpath cache file
+ *
+ * Layers must be added in order 0..N-1. The file is written under a temp
+ * name and only renamed into place by finish(), so an interrupted write
+ * never leaves a file that a Reader would accept.
+ */
+class ToolpathCacheWriter {
+  public:
+    ToolpathCacheWriter() = default;
+    ~ToolpathCacheWriter();
+
+    ToolpathCacheWriter(const ToolpathCacheWriter&) = delete;
+    ToolpathCacheWriter& operator=(const ToolpathCacheWriter&) = delete;
+
+    /**
+     * @brief Start a new file
+     * @param path Final file path
+     * @param source_key Identity of the G-code source (GCodeDataSource::cache_key())
+     * @param object_names Table the segments' object ids refer to
+     * @return false if the temp file can't be created
+     */
+    bool open(const std::string& path, const std::string& source_key,
+              std::shared_ptr<ObjectNameTable> object_names);
+
+    /**
+     * @brief Append the next layer
+     * @param segments Segments of layer layer_count()
+     * @return false on write error (the writer is then aborted)
+     */
+    bool add_layer(const std::vector<ToolpathSegment>& segments);
+
+    /**
+     * @brief Write the directory and move the file into place
+     * @return true if the file is complete
+     */
+    bool finish();
+
+    /**
+     * @brief Discard the partial file
+     */
+    void abort();
+
+    /**
+     * @brief Number of layers written so far
+     * @return Layer count
+     */
+    size_t layer_count() const {
+        return layers_.size();
+    }
+
+  private:
+    struct LayerEntry {
+        uint64_t offset;
+        uint32_t size;
+        uint32_t checksum;
+    };
+
+    FILE* file_{nullptr};
+    std::string path_;
+    std::string tmp_path_;
+    std::string source_key_;
+    std::shared_ptr<ObjectNameTable> object_names_;
+    std::vector<LayerEntry> layers_;
+    std::vector<uint8_t> blob_; ///< Reused encode buffer
+    uint64_t offset_{0};
+    ObjectId max_object_id_{NO_OBJECT_ID};
+};
+
+/**
+ * @brief Random access to the layers of a toolpath cache file
+ *
+ * The file is memory-mapped when possible, so a layer load touches only the
+ * few KB of its blob.
+ */
+class ToolpathCacheReader {
+  public:
+    /**
+     * @brief Open a file written by ToolpathCacheWriter
+     * @param path Cache file
+     * @param source_key Expected source identity; other files are rejected
+     * @param object_names Table to remap object ids into
+     * @return false if missing, corrupt, another version or another source
+     */
+    bool open(const std::string& path, const std::string& source_key,
+              std::shared_ptr<ObjectNameTable> object_names);
+
+    /**
+     * @brief Number of layers in the file
+     * @return Layer count, 0 if not open
+     */
+    size_t layer_count() const {
+        return layers_.size();
+    }
+
+    /**
+     * @brief Decode one layer
+     * @param layer_index Zero-based layer index
+     * @param out Decoded segments (replaced)
+     * @return false if out of range or the blob fails its checksum
+     */
+    bool read_layer(size_t layer_index, std::vector<ToolpathSegment>& out) const;
+
+  private:
+    struct LayerEntry {
+        uint64_t offset;
+        uint32_t size;
+        uint32_t checksum;
+    };
+
+    std::unique_ptr<FileDataSource> source_;
+    std::vector<LayerEntry> layers_;
+    std::vector<ObjectId> object_remap_;
+    mutable std::mutex read_mutex_; ///< Serializes read_range() when not memory-mapped
+};
+
+} // namespace gcode
+} // namespace helix
@@ -114,7 +114,7 @@ bool is_gcode_3d_render_safe(size_t file_size_bytes);
  * 2D streaming mode uses layer-on-demand loading with LRU cache, so memory
  * requirements are much lower than 3D mode. File is streamed directly to disk
  * (no memory spike during download). Only needs RAM for:
- * - Layer index: ~24 bytes per layer (estimate 1 layer per 500 bytes of G-code)
+ * - Layer index: ~48 bytes per layer (estimate 1 layer per 500 bytes of G-code)
  * - LRU cache: 1MB fixed budget for parsed layer segments
  * - Ghost preview buffer: display_width * display_height * 4 bytes (ARGB8888)
  * - Safety margin: 3MB for other allocations
@@ -764,6 +764,44 @@ class MoonrakerAPI {
                                        ErrorCallback on_error,
                                        ProgressCallback on_progress = nullptr);
 
+    /// Writes transformed bytes to the upload body; returns false once the upload has failed
+    using ChunkSink = std::function<bool(const char* data, size_t size)>;
+
+    /**
+     * @brief Rewrites a byte stream chunk by chunk for transform_file()
+     *
+     * Called with each downloaded chunk in order, then once with (nullptr, 0) at
+     * the end of the stream to flush. Return false to abort the transfer.
+     */
+    using ChunkTransform =
+        std::function<bool(const char* data, size_t size, const ChunkSink& sink)>;
+
+    /**
+     * @brief Download a file, transform it, and upload the result in one pass
+     *
+     * Pipes the download straight into a chunked multipart upload, with
+     * @p transform in between: no local file and no full copy in memory. Memory
+     * use is whatever @p transform buffers plus one network read buffer.
+     * Used to apply G-code modifications (GCodeStreamModifier) without the
+     * download -> temp file -> modified temp file -> upload round trip.
+     *
+     * If anything fails the upload is left unterminated, so Moonraker discards it.
+     *
+     * Virtual to allow mocking in tests.
+     *
+     * @param root Root directory for both files ("gcodes")
+     * @param src_path Source file path relative to root
+     * @param dest_path Destination path relative to root (e.g., ".helix_temp/foo.gcode")
+     * @param transform Chunk transform (called from the HTTP thread)
+     * @param on_success Success callback
+     * @param on_error Error callback
+     * @param on_progress Optional download progress (called from HTTP thread)
+     */
+    virtual void transform_file(const std::string& root, const std::string& src_path,
+                                const std::string& dest_path, ChunkTransform transform,
+                                SuccessCallback on_success, ErrorCallback on_error,
+                                ProgressCallback on_progress = nullptr);
+
     /**
      * @brief Set the HTTP base URL for file transfers
      *
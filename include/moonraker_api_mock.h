@@ -192,6 +192,30 @@ class MoonrakerAPIMock : public MoonrakerAPI {
                                const std::string& filename, const std::string& content,
                                SuccessCallback on_success, ErrorCallback on_error) override;
 
+    /**
+     * @brief Mock piped transform (reads local test file, keeps the result in memory)
+     *
+     * Feeds assets/test_gcodes/{filename} through @p transform in small chunks
+     * and stores the output instead of uploading it; see last_transform_output().
+     *
+     * @param root Root directory (ignored in mock)
+     * @param src_path Source path - only the filename is used
+     * @param dest_path Destination path (logged only)
+     * @param transform Chunk transform
+     * @param on_success Success callback
+     * @param on_error Error callback (FILE_NOT_FOUND, or UNKNOWN if the transform fails)
+     * @param on_progress Optional progress callback
+     */
+    void transform_file(const std::string& root, const std::string& src_path,
+                        const std::string& dest_path, ChunkTransform transform,
+                        SuccessCallback on_success, ErrorCallback on_error,
+                        ProgressCallback on_progress = nullptr) override;
+
+    /// Output of the most recent transform_file() call
+    const std::string& last_transform_output() const {
+        return last_transform_output_;
+    }
+
     /**
      * @brief Mock thumbnail download (reads from local test assets)
      *
@@ -453,6 +477,8 @@ class MoonrakerAPIMock : public MoonrakerAPI {
     // Shared mock state for coordination with MoonrakerClientMock
     std::shared_ptr<MockPrinterState> mock_state_;
 
+    std::string last_transform_output_; ///< Captured by transform_file()
+
     // Mock power device states (for toggle testing)
     std::map<std::string, bool> mock_power_states_;
 
@@ -41,6 +41,7 @@
 #include "moonraker_error.h"
 #include "moonraker_events.h"
 #include "moonraker_request.h"
+#include "moonraker_types.h"
 #include "printer_detector.h" // For BuildVolume struct
 #include "printer_discovery.h"
 #include "spdlog/spdlog.h"
@@ -49,6 +50,7 @@
 #include <chrono>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -68,6 +70,38 @@ using SubscriptionId = uint64_t;
 /** @brief Invalid subscription ID constant */
 constexpr SubscriptionId INVALID_SUBSCRIPTION_ID = 0;
 
+/**
+ * @brief Parsed Moonraker message, shared read-only by every subscriber
+ *
+ * A notification is parsed once and handed to all callbacks (and any queue that
+ * needs to keep it) by reference count instead of by deep copy.
+ */
+using JsonMessage = std::shared_ptr<const json>;
+
+/** @brief Callback receiving a read-only view of a notification */
+using NotificationCallback = std::function<void(const json&)>;
+
+/** @brief Callback receiving shared ownership of a notification (for queueing) */
+using NotificationMessageCallback = std::function<void(const JsonMessage&)>;
+
+/**
+ * @brief Notification fan-out counters
+ *
+ * Every subscriber gets the same parsed message (a const view or the shared
+ * pointer), so payload_bytes is counted once per message however many
+ * deliveries it has. Copies a subscriber makes of its own accord are not seen here.
+ */
+struct NotificationStats {
+    uint64_t messages = 0;      ///< Notifications dispatched
+    uint64_t deliveries = 0;    ///< Callback invocations
+    uint64_t payload_bytes = 0; ///< Wire-size bytes of dispatched messages
+    double elapsed_sec = 0.0;   ///< Time since the counters were last reset
+
+    double payload_bytes_per_sec() const {
+        return elapsed_sec > 0.0 ? static_cast<double>(payload_bytes) / elapsed_sec : 0.0;
+    }
+};
+
 /**
  * @brief Unique identifier for JSON-RPC requests
  *
@@ -106,14 +140,8 @@ class MoonrakerClient : public hv::WebSocketClient {
     MoonrakerClient(const MoonrakerClient&) = delete;
     MoonrakerClient& operator=(const MoonrakerClient&) = delete;
 
-    /**
-     * @brief Entry from Moonraker gcode_store
-     */
-    struct GcodeStoreEntry {
-        std::string message; ///< G-code command or response text
-        double time = 0.0;   ///< Unix timestamp
-        std::string type;    ///< "command" or "response"
-    };
+    /// Entry from Moonraker gcode_store (see moonraker_types.h)
+    using GcodeStoreEntry = ::GcodeStoreEntry;
 
     /**
      * @brief Connect to Moonraker WebSocket server
@@ -175,10 +203,24 @@ class MoonrakerClient : public hv::WebSocketClient {
      * Invoked when Moonraker sends "notify_status_update" messages
      * (triggered by printer.objects.subscribe subscriptions).
      *
+     * The notification is shared by all subscribers; callbacks must copy whatever
+     * they need to keep beyond the call.
+     *
      * @param cb Callback function receiving parsed JSON notification
      * @return Subscription ID for later unsubscription (0 = invalid/failed)
      */
-    SubscriptionId register_notify_update(std::function<void(json)> cb);
+    SubscriptionId register_notify_update(NotificationCallback cb);
+
+    /**
+     * @brief Register callback that takes shared ownership of status notifications
+     *
+     * Same as register_notify_update(), for subscribers that queue notifications
+     * for later processing: holding the JsonMessage keeps it alive without a copy.
+     *
+     * @param cb Callback receiving the shared notification
+     * @return Subscription ID for unsubscribe_notify_update() (0 = invalid/failed)
+     */
+    SubscriptionId register_notify_message(NotificationMessageCallback cb);
 
     /**
      * @brief Unsubscribe from status update notifications
@@ -202,7 +244,7 @@ class MoonrakerClient : public hv::WebSocketClient {
      * @param cb Callback function receiving parsed JSON notification
      */
     void register_method_callback(const std::string& method, const std::string& handler_name,
-                                  std::function<void(json)> cb);
+                                  NotificationCallback cb);
 
     /**
      * @brief Unregister a method callback by handler name
@@ -216,6 +258,19 @@ class MoonrakerClient : public hv::WebSocketClient {
      */
     bool unregister_method_callback(const std::string& method, const std::string& handler_name);
 
+    /**
+     * @brief Snapshot of notification fan-out counters
+     *
+     * Thread-safe. Used to check fan-out volume against update rate (e.g. bytes
+     * dispatched per second at 10 Hz status updates).
+     */
+    NotificationStats get_notification_stats() const;
+
+    /**
+     * @brief Zero the fan-out counters and restart the elapsed-time clock
+     */
+    void reset_notification_stats();
+
     /**
      * @brief Send JSON-RPC request without parameters
      *
@@ -283,6 +338,32 @@ class MoonrakerClient : public hv::WebSocketClient {
      */
     bool cancel_request(RequestId id);
 
+    /**
+     * @brief Typed decoder for a raw response message
+     *
+     * Returns the call that delivers the decoded result, or nullptr to fall back
+     * to the request's json callback (malformed message, JSON-RPC error).
+     */
+    using StreamDecoder = PendingRequest::StreamDecoder;
+
+    /**
+     * @brief Attach a typed decoder to a pending request
+     *
+     * Responses of at least STREAM_DECODE_MIN_BYTES are handed to the decoder
+     * as raw text instead of being parsed into json for the success callback,
+     * so heavy results (history, file lists) never exist as a json DOM. Smaller
+     * responses, and responses that arrive before the decoder is attached, use
+     * the json callback as before.
+     *
+     * @param id Request ID returned by send_jsonrpc()
+     * @param decoder Decoder (see moonraker_stream_decoder.h)
+     * @return true if the request was still pending
+     */
+    bool set_stream_decoder(RequestId id, StreamDecoder decoder);
+
+    /// Responses smaller than this always go through the json DOM path
+    static constexpr size_t STREAM_DECODE_MIN_BYTES = 64 * 1024;
+
     /**
      * @brief Send G-code script command
      *
@@ -519,13 +600,22 @@ class MoonrakerClient : public hv::WebSocketClient {
     /**
      * @brief Process timeout checks for pending requests
      *
-     * Should be called periodically (e.g., from main loop) to check for timed out requests.
-     * Typically called every 1-5 seconds.
+     * The single expiry tick for request timeouts: call periodically from the main
+     * loop (typically every 1-5 seconds). Received messages do not check timeouts.
+     * Cost is proportional to the number of requests that are due.
      */
     void process_timeouts() {
         check_request_timeouts();
     }
 
+    /**
+     * @brief Number of requests awaiting a response
+     */
+    size_t pending_request_count() {
+        std::lock_guard<std::mutex> lock(requests_mutex_);
+        return pending_requests_.size();
+    }
+
     // ========== Simulation Methods (for testing) ==========
 
     /**
@@ -556,10 +646,29 @@ class MoonrakerClient : public hv::WebSocketClient {
      * notify_status_update notification format and dispatches to callbacks.
      * Used for both initial subscription state and incremental updates.
      *
-     * @param status Raw printer status object
+     * @param status Raw printer status object (copied into the notification)
      */
     void dispatch_status_update(const json& status);
 
+    /**
+     * @brief dispatch_status_update() that moves the status into the notification
+     */
+    void dispatch_status_update(json&& status);
+
+    /**
+     * @brief Fan a parsed notification out to its subscribers
+     *
+     * Status and file-list notifications go to every notify callback; any method
+     * gets its registered method callbacks. Callbacks run outside the lock, and an
+     * exception in one does not stop the others.
+     *
+     * @param method Notification method name
+     * @param message Parsed notification, shared by all callbacks
+     * @param wire_bytes Serialized size for the counters (0 = estimate from the JSON)
+     */
+    void dispatch_notification(const std::string& method, const JsonMessage& message,
+                               size_t wire_bytes = 0);
+
     /**
      * @brief Emit event to registered handler
      *
@@ -573,6 +682,17 @@ class MoonrakerClient : public hv::WebSocketClient {
     void emit_event(MoonrakerEventType type, const std::string& message, bool is_error = false,
                     const std::string& details = "");
 
+    /**
+     * @brief Deliver a response through its request's stream decoder
+     *
+     * Reads only the envelope to find the request; the request is claimed only
+     * once its decoder has succeeded, so a false return leaves it for the json path.
+     *
+     * @param msg Raw response message
+     * @return true if the response was consumed
+     */
+    bool try_stream_decode(const std::string& msg);
+
   private:
     /**
      * @brief Check for timed out requests and invoke error callbacks
@@ -629,17 +749,24 @@ class MoonrakerClient : public hv::WebSocketClient {
 
     // Notification callbacks (protected to allow mock to trigger notifications)
     // Map of subscription ID -> callback for O(1) unsubscription
-    std::map<SubscriptionId, std::function<void(json)>> notify_callbacks_;
+    std::map<SubscriptionId, NotificationMessageCallback> notify_callbacks_;
     std::atomic<SubscriptionId> next_subscription_id_{1}; // Start at 1 (0 = invalid)
     std::mutex callbacks_mutex_; // Protect notify_callbacks_ and method_callbacks_
 
     // Persistent method-specific callbacks (protected to allow mock to dispatch)
     // method_name : { handler_name : callback }
-    std::map<std::string, std::map<std::string, std::function<void(json)>>> method_callbacks_;
+    std::map<std::string, std::map<std::string, NotificationCallback>> method_callbacks_;
+
+    // Fan-out counters (see NotificationStats)
+    std::atomic<uint64_t> notify_messages_{0};
+    std::atomic<uint64_t> notify_deliveries_{0};
+    std::atomic<uint64_t> notify_payload_bytes_{0};
+    std::atomic<int64_t> notify_stats_start_ns_{
+        std::chrono::steady_clock::now().time_since_epoch().count()};
 
   private:
-    // Pending requests keyed by request ID
-    std::map<uint64_t, PendingRequest> pending_requests_;
+    // Pending requests keyed by request ID, with their deadlines
+    PendingRequestMap pending_requests_;
     std::mutex requests_mutex_; // Protect pending_requests_ map
 
     // Auto-incrementing JSON-RPC request ID
@@ -5,6 +5,7 @@
 
 #include "moonraker_client.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -136,6 +137,18 @@ class MoonrakerClientMock : public MoonrakerClient {
      */
     double get_simulation_speedup() const;
 
+    /**
+     * @brief Set the wall-clock interval between status notifications
+     *
+     * Defaults to SIMULATION_INTERVAL_MS. Takes effect when the simulation
+     * (re)starts, e.g. on connect(); used to drive 10 Hz update storms in tests.
+     *
+     * @param interval Time between simulation ticks (minimum 1 ms)
+     */
+    void set_status_update_interval(std::chrono::milliseconds interval) {
+        status_interval_ms_.store(std::max<int>(1, static_cast<int>(interval.count())));
+    }
+
     /**
      * @brief Get current print simulation phase
      * @return Current phase of the print simulation state machine
@@ -893,6 +906,7 @@ class MoonrakerClientMock : public MoonrakerClient {
     MockPrintMetadata print_metadata_;        // Current print job metadata
     mutable std::mutex metadata_mutex_;       // Protects print_metadata_
     std::atomic<double> speedup_factor_{1.0}; // Simulation speedup (1.0 = real-time)
+    std::atomic<int> status_interval_ms_{SIMULATION_INTERVAL_MS}; // Wall-clock tick interval
 
     // Print timing (wall-clock for internal tracking)
     std::optional<std::chrono::steady_clock::time_point> preheat_start_time_;
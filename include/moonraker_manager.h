@@ -97,6 +97,8 @@ class MoonrakerManager {
      *
      * Must be called from the main thread (LVGL thread).
      * Processes all queued Moonraker notifications and connection state changes.
+     * Consecutive notify_status_update deltas are merged first (see
+     * NotificationCoalescer), so a backlog costs one PrinterState pass per run.
      */
     void process_notifications();
 
@@ -127,6 +129,13 @@ class MoonrakerManager {
      */
     size_t pending_notification_count() const;
 
+    /**
+     * @brief PrinterState passes avoided so far by coalescing status deltas
+     */
+    size_t status_passes_saved() const {
+        return m_status_passes_saved;
+    }
+
     /**
      * @brief Initialize print start collector after connection
      *
@@ -193,10 +202,13 @@ class MoonrakerManager {
     std::unique_ptr<MoonrakerClient> m_client;
     std::unique_ptr<MoonrakerAPI> m_api;
 
-    // Thread-safe notification queue
-    std::queue<nlohmann::json> m_notification_queue;
+    // Thread-safe notification queue (messages shared with other subscribers, not copied)
+    std::queue<std::shared_ptr<const nlohmann::json>> m_notification_queue;
     mutable std::mutex m_notification_mutex;
 
+    // PrinterState passes avoided by coalescing queued status deltas (main thread only)
+    size_t m_status_passes_saved = 0;
+
     // Print start collector (monitors PRINT_START macro progress)
     std::shared_ptr<PrintStartCollector> m_print_start_collector;
     ObserverGuard m_print_start_observer;
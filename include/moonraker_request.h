@@ -5,9 +5,14 @@
 
 #include "moonraker_error.h"
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "hv/json.hpp"
 
@@ -19,6 +24,9 @@ using json = nlohmann::json;
  * Stores request metadata for timeout tracking and callback management.
  */
 struct PendingRequest {
+    /// Typed decoder for a raw response; returns the delivery call, or nullptr to decline
+    using StreamDecoder = std::function<std::function<void()>(const std::string&)>;
+
     uint64_t id;        ///< JSON-RPC request ID
     std::string method; ///< Method name for logging
     std::function<void(json)>
@@ -27,6 +35,7 @@ struct PendingRequest {
     std::chrono::steady_clock::time_point timestamp;           ///< When request was sent
     uint32_t timeout_ms;                                       ///< Timeout in milliseconds
     bool silent = false; ///< If true, suppress RPC_ERROR events (for internal probes)
+    StreamDecoder stream_decoder; ///< Optional typed decoder for large responses (bypasses json)
 
     /**
      * @brief Check if request has timed out
@@ -39,6 +48,13 @@ struct PendingRequest {
         return elapsed.count() > timeout_ms;
     }
 
+    /**
+     * @brief Time after which the request counts as timed out
+     */
+    std::chrono::steady_clock::time_point deadline() const {
+        return timestamp + std::chrono::milliseconds(timeout_ms);
+    }
+
     /**
      * @brief Get elapsed time since request was sent
      *
@@ -49,4 +65,105 @@ struct PendingRequest {
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - timestamp);
         return static_cast<uint32_t>(elapsed.count());
     }
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Pending requests by ID, with a deadline heap for timeout expiry
+ *
+ * Lookups by ID (response, cancel) go through an unordered_map. Deadlines sit
+ * in a min-heap, so an expiry tick only touches requests that are actually due
+ * instead of scanning everything in flight. Completed or cancelled requests
+ * leave their heap entry behind; it is skipped when it comes due, and the heap
+ * is rebuilt if such stale entries pile up.
+ *
+ * Not thread-safe; MoonrakerClient guards it with requests_mutex_. The one
+ * exception is stream_decoder_count(), which may be read without the lock.
+ */
+class PendingRequestMap {
+  public:
+    using Map = std::unordered_map<uint64_t, PendingRequest>;
+    using iterator = Map::iterator;
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Add a request keyed by its id
+     * @return false if a request with that id is already pending
+     */
+    bool insert(PendingRequest request);
+
+    iterator find(uint64_t id) {
+        return requests_.find(id);
+    }
+    iterator begin() {
+        return requests_.begin();
+    }
+    iterator end() {
+        return requests_.end();
+    }
+    [[nodiscard]] size_t size() const {
+        return requests_.size();
+    }
+    [[nodiscard]] bool empty() const {
+        return requests_.empty();
+    }
+
+    void erase(iterator it) {
+        forget_decoder(it->second);
+        requests_.erase(it);
+    }
+    size_t erase(uint64_t id) {
+        auto it = requests_.find(id);
+        if (it == requests_.end()) {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+    void clear();
+
+    /**
+     * @brief Attach a typed decoder to a pending request
+     * @return false if no request with that id is pending
+     */
+    bool set_stream_decoder(uint64_t id, PendingRequest::StreamDecoder decoder);
+
+    /**
+     * @brief Pending requests that have a stream decoder
+     *
+     * Safe to read without the lock, as a cheap "nothing to decode" check;
+     * callers still look the request up under the lock.
+     */
+    [[nodiscard]] size_t stream_decoder_count() const {
+        return decoder_count_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Remove and return every request whose deadline is before @p now
+     *
+     * Cost is proportional to the number of due heap entries, not to the number
+     * of requests in flight. Requests come back in deadline order.
+     */
+    std::vector<PendingRequest> take_expired(Clock::time_point now);
+
+    /// Heap entries, including stale ones (for tests and diagnostics)
+    [[nodiscard]] size_t deadline_count() const {
+        return deadlines_.size();
+    }
+
+  private:
+    struct Deadline {
+        Clock::time_point when;
+        uint64_t id;
+    };
+
+    void compact();
+    void forget_decoder(const PendingRequest& request) {
+        if (request.stream_decoder) {
+            decoder_count_.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    Map requests_;
+    std::vector<Deadline> deadlines_; ///< Min-heap on `when`
+    std::atomic<size_t> decoder_count_{0};
+};
@@ -0,0 +1,223 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "moonraker_types.h"
+#include "print_history_data.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "hv/json.hpp"
+
+/**
+ * @file moonraker_stream_decoder.h
+ * @brief SAX decoders that build typed results straight from a JSON-RPC message
+ *
+ * Heavy responses (server.history.list with hundreds of jobs, server.files.list
+ * on large libraries, server.gcode_store) used to be parsed into a full json DOM
+ * in the WebSocket handler and then copied into structs. The DOM costs several
+ * times the message size; on 47 MB devices a multi-megabyte history reply spikes
+ * memory. These decoders walk the raw message once with nlohmann's SAX parser and
+ * keep only the fields the structs need.
+ *
+ * MoonrakerClient runs them for large responses of requests that have a decoder
+ * attached (see MoonrakerClient::set_stream_decoder()); smaller responses and
+ * mock clients keep using the json success callback.
+ */
+
+namespace helix {
+
+/**
+ * @brief Base SAX handler with a path stack
+ *
+ * Derived decoders match the current location with at() and read scalars in
+ * on_scalar(). Levels count open containers from the root object (level 0).
+ * Key strings are reused between members, so walking a large message does not
+ * allocate per value.
+ */
+class JsonStreamDecoder {
+  public:
+    virtual ~JsonStreamDecoder() = default;
+
+    /**
+     * @brief Decode a complete JSON-RPC message
+     * @return false on malformed JSON or a JSON-RPC error response
+     */
+    bool decode(const std::string& message);
+
+    /// Top-level "error" member was present
+    [[nodiscard]] bool has_rpc_error() const {
+        return rpc_error_;
+    }
+
+    /// Parse error description (empty on success)
+    [[nodiscard]] const std::string& parse_error_message() const {
+        return parse_error_;
+    }
+
+    // SAX interface for nlohmann::json::sax_parse() - not for direct use
+    bool null();
+    bool boolean(bool value);
+    bool number_integer(nlohmann::json::number_integer_t value);
+    bool number_unsigned(nlohmann::json::number_unsigned_t value);
+    bool number_float(nlohmann::json::number_float_t value, const std::string& raw);
+    bool string(std::string& value);
+    bool binary(nlohmann::json::binary_t& value);
+    bool start_object(std::size_t elements);
+    bool key(std::string& key);
+    bool end_object();
+    bool start_array(std::size_t elements);
+    bool end_array();
+    bool parse_error(std::size_t position, const std::string& last_token,
+                     const nlohmann::json::exception& ex);
+
+  protected:
+    /// A scalar value; string points into the parser's buffer (valid during on_scalar())
+    struct Scalar {
+        enum class Kind { Null, Bool, Integer, Unsigned, Float, String } kind = Kind::Null;
+        bool boolean = false;
+        int64_t integer = 0;
+        uint64_t unsigned_integer = 0;
+        double floating = 0.0;
+        const std::string* string = nullptr;
+
+        [[nodiscard]] bool is_number() const {
+            return kind == Kind::Integer || kind == Kind::Unsigned || kind == Kind::Float;
+        }
+        [[nodiscard]] bool is_string() const {
+            return kind == Kind::String;
+        }
+        [[nodiscard]] double as_double() const;
+        [[nodiscard]] uint64_t as_uint64() const;
+    };
+
+    /// Called for every scalar; member() / at() describe where it sits
+    virtual void on_scalar(const Scalar& value) = 0;
+    /// Called before a container opens, with the same location a scalar there would have
+    virtual void on_begin(bool is_array) {
+        (void)is_array;
+    }
+    /// Called once after a successful parse of a non-error message
+    virtual void on_finish() {}
+
+    /// End the parse early; decode() then returns true without calling on_finish()
+    void stop() {
+        stopped_ = true;
+    }
+
+    /// Number of open containers (1 while directly inside the root object)
+    [[nodiscard]] size_t depth() const {
+        return depth_;
+    }
+
+    /// Key of the current member of the innermost object (empty inside arrays)
+    [[nodiscard]] const std::string& member() const;
+
+    /// True if the innermost open container is an array
+    [[nodiscard]] bool in_array() const {
+        return depth_ > 0 && stack_[depth_ - 1].is_array;
+    }
+
+    /// Element index being read in the array open at @p level (0 = root)
+    [[nodiscard]] size_t index_at(size_t level) const {
+        return level < depth_ ? stack_[level].index : 0;
+    }
+
+    /**
+     * @brief Match the path from the root to the innermost open container
+     *
+     * One entry per step: an object key, or "*" for any array element.
+     * Inside one job of {"result": {"jobs": [...]}}, at({"result", "jobs", "*"})
+     * is true and member() names the job field being read.
+     */
+    [[nodiscard]] bool at(std::initializer_list<const char*> path) const;
+
+  private:
+    struct Frame {
+        bool is_array = false;
+        std::string key;
+        size_t index = 0;
+    };
+
+    void open(bool is_array);
+    void value_done();
+
+    std::vector<Frame> stack_; ///< Frames are reused so key buffers keep their capacity
+    size_t depth_ = 0;
+    bool rpc_error_ = false;
+    bool stopped_ = false;
+    std::string parse_error_;
+};
+
+/**
+ * @brief Reads the JSON-RPC response id without building the message
+ *
+ * decode() stops as soon as the top-level "id" is seen; has_rpc_error() is
+ * only meaningful if "error" came before it.
+ */
+class JsonRpcEnvelope : public JsonStreamDecoder {
+  public:
+    bool has_id = false; ///< Top-level integer "id" found
+    uint64_t id = 0;
+
+    /**
+     * @brief Find the id, reading the message as little as possible
+     *
+     * Moonraker writes "id" as the last member, so a response ends in
+     * `"id": N}` and the id is read from those bytes without parsing the rest;
+     * the decoder that runs next is then the only pass over the payload. Other
+     * layouts fall back to decode(). The tail is not validated as JSON.
+     *
+     * @return false if the message is malformed before the id is reached
+     */
+    bool read(const std::string& message);
+
+  protected:
+    void on_scalar(const Scalar& value) override;
+
+  private:
+    bool read_trailing_id(const std::string& message);
+};
+
+/// server.history.list -> result.count, result.jobs[]
+class HistoryListDecoder : public JsonStreamDecoder {
+  public:
+    std::vector<PrintHistoryJob> jobs; ///< Display strings (duration_str etc.) are not set
+    uint64_t total_count = 0;
+
+  protected:
+    void on_scalar(const Scalar& value) override;
+    void on_begin(bool is_array) override;
+};
+
+/// server.files.list (result[]) and server.files.get_directory (result.dirs/files)
+class FileListDecoder : public JsonStreamDecoder {
+  public:
+    std::vector<FileInfo> files; ///< Directories first, then files (as the DOM parser does)
+
+  protected:
+    void on_scalar(const Scalar& value) override;
+    void on_begin(bool is_array) override;
+    void on_finish() override;
+
+  private:
+    std::vector<FileInfo> legacy_files_; ///< result.files[] until dirs are complete
+    bool item_has_path_ = false;
+};
+
+/// server.gcode_store -> result.gcode_store[]
+class GcodeStoreDecoder : public JsonStreamDecoder {
+  public:
+    std::vector<GcodeStoreEntry> entries;
+
+  protected:
+    void on_scalar(const Scalar& value) override;
+    void on_begin(bool is_array) override;
+};
+
+} // namespace helix
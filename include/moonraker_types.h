@@ -212,6 +212,19 @@ struct PowerDevice {
     bool locked_while_printing = false; ///< Cannot be toggled during prints
 };
 
+// ============================================================================
+// Console Types
+// ============================================================================
+
+/**
+ * @brief Entry from Moonraker gcode_store
+ */
+struct GcodeStoreEntry {
+    std::string message; ///< G-code command or response text
+    double time = 0.0;   ///< Unix timestamp
+    std::string type;    ///< "command" or "response"
+};
+
 // ============================================================================
 // Print Control Types
 // ============================================================================
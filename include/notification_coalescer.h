@@ -0,0 +1,65 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "hv/json.hpp"
+
+/**
+ * @file notification_coalescer.h
+ * @brief Merges queued status deltas before they reach PrinterState
+ *
+ * Moonraker's notify_status_update carries only the fields that changed. When the
+ * main thread falls behind (e.g. after a long render), MoonrakerManager's queue
+ * can hold dozens of deltas; applying each runs the full PrinterState fan-out.
+ * The coalescer folds consecutive deltas into one latest-state patch so the
+ * fan-out runs once per run of deltas instead of once per message.
+ */
+
+namespace helix {
+
+class NotificationCoalescer {
+  public:
+    using Message = std::shared_ptr<const nlohmann::json>;
+
+    /// Result of one coalesce() call
+    struct Stats {
+        size_t messages_in = 0;   ///< Queued messages before coalescing
+        size_t messages_out = 0;  ///< Messages left to apply
+        size_t status_in = 0;     ///< notify_status_update deltas before coalescing
+        size_t status_merged = 0; ///< Deltas folded into an earlier one (passes saved)
+    };
+
+    /**
+     * @brief Merge runs of consecutive notify_status_update deltas
+     *
+     * Anything else (other methods, connection state events) is kept in place and
+     * ends a run, so relative order between status and non-status messages is
+     * preserved. Within a run later values win per object and field; the merged
+     * message carries the last delta's eventtime. Single deltas pass through
+     * without a copy.
+     *
+     * @param queue Messages in arrival order
+     * @param[out] stats Optional counters for this call
+     * @return Messages to apply, in order
+     */
+    static std::vector<Message> coalesce(std::vector<Message> queue, Stats* stats = nullptr);
+
+    /**
+     * @brief Merge one status delta into an accumulated status
+     *
+     * Merges per object and field only: a field's value replaces the accumulated
+     * one whole, as Moonraker sends changed fields whole. Keys dropped from a
+     * dict-valued field (e.g. a deleted bed mesh profile) therefore stay dropped.
+     */
+    static void merge_status_delta(nlohmann::json& target, const nlohmann::json& delta);
+
+    /// True for a well-formed notify_status_update ({"method", "params": [status, ...]})
+    static bool is_status_update(const nlohmann::json& message);
+};
+
+} // namespace helix
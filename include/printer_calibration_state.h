@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 #pragma once
 
+#include "status_router.h"
 #include "subject_managed_panel.h"
 
 #include <lvgl.h>
@@ -67,6 +68,15 @@ class PrinterCalibrationState {
      */
     void update_from_status(const nlohmann::json& status);
 
+    /**
+     * @brief Update calibration state from the status objects routed to this component
+     * @param objects Objects from one delta accepted by handles_status_object()
+     */
+    void update_from_objects(const StatusObjects& objects);
+
+    /// Routing interest: true for manual_probe, toolhead, stepper_enable and firmware_retraction
+    bool handles_status_object(const std::string& object) const;
+
     // ========================================================================
     // Subject Accessors
     // ========================================================================
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 #pragma once
 
+#include "status_router.h"
 #include "subject_managed_panel.h"
 
 #include <lvgl.h>
@@ -87,6 +88,15 @@ class PrinterFanState {
      */
     void update_from_status(const nlohmann::json& status);
 
+    /**
+     * @brief Update fan state from the status objects routed to this component
+     * @param objects Objects from one delta accepted by handles_status_object()
+     */
+    void update_from_objects(const StatusObjects& objects);
+
+    /// Routing interest: true for fan and heater_fan/fan_generic/controller_fan objects
+    bool handles_status_object(const std::string& object) const;
+
     /**
      * @brief Reset state for testing - clears subjects and reinitializes
      */
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 #pragma once
 
+#include "status_router.h"
 #include "subject_managed_panel.h"
 
 #include <lvgl.h>
@@ -52,6 +53,15 @@ class PrinterPrintState {
      */
     void update_from_status(const nlohmann::json& status);
 
+    /**
+     * @brief Update print state from the status objects routed to this component
+     * @param objects Objects from one delta accepted by handles_status_object()
+     */
+    void update_from_objects(const StatusObjects& objects);
+
+    /// Routing interest: true for print_stats and virtual_sdcard
+    bool handles_status_object(const std::string& object) const;
+
     /**
      * @brief Reset state for testing - clears subjects and reinitializes
      */
@@ -22,6 +22,7 @@
 #include "printer_temperature_state.h"
 #include "printer_versions_state.h"
 #include "spdlog/spdlog.h"
+#include "status_router.h"
 #include "subject_managed_panel.h"
 
 #include <memory>
@@ -236,6 +237,7 @@ class PrinterState {
      * Updates subjects from a printer status object. Can be called directly
      * with subscription response data or extracted from notifications.
      * This is the core update logic used by both initial state and notifications.
+     * Each object is routed only to the components that handle it (StatusRouter).
      *
      * @param status Printer status object (e.g., from result.status or params[0])
      */
@@ -895,6 +897,7 @@ class PrinterState {
      */
     void set_tracked_led(const std::string& led_name) {
         led_state_component_.set_tracked_led(led_name);
+        rebuild_status_routes(); // LED routing interest follows the tracked name
     }
 
     /**
@@ -1474,6 +1477,21 @@ class PrinterState {
     /// Excluded objects state component (excluded_objects_version, excluded_objects set)
     helix::PrinterExcludedObjectsState excluded_objects_state_;
 
+    /// Routes status objects to the components above (and sensor managers) by object name
+    helix::StatusRouter status_router_;
+
+    /// Register component and sensor manager interest with status_router_ (constructor)
+    void init_status_routes();
+
+    /// Re-resolve routes after a component's routing interest changed
+    void rebuild_status_routes();
+
+    /// Apply an exclude_object status object (excluded, defined and current objects)
+    void update_exclude_object(const json& exclude_object);
+
+    /// Apply a webhooks status object (klippy state)
+    void update_webhooks(const json& webhooks);
+
     // Note: Print subjects are now managed by print_domain_ component
     // (print_progress_, print_filename_, print_state_, print_state_enum_,
     //  print_outcome_, print_active_, print_show_progress_, print_display_filename_,
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 #pragma once
 
+#include "status_router.h"
 #include "subject_managed_panel.h"
 
 #include <lvgl.h>
@@ -41,6 +42,15 @@ class PrinterTemperatureState {
      */
     void update_from_status(const nlohmann::json& status);
 
+    /**
+     * @brief Update temperatures from the status objects routed to this component
+     * @param objects Objects from one delta accepted by handles_status_object()
+     */
+    void update_from_objects(const StatusObjects& objects);
+
+    /// Routing interest: true for extruder, heater_bed and the chamber sensor
+    bool handles_status_object(const std::string& object) const;
+
     /**
      * @brief Reset state for testing - clears subjects and reinitializes
      */
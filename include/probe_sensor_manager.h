@@ -78,6 +78,12 @@ class ProbeSensorManager : public ISensorManager {
     /// @brief Update state from Moonraker status JSON
     void update_from_status(const nlohmann::json& status) override;
 
+    /// @brief Update state from status objects routed by PrinterState
+    void update_from_objects(const StatusObjects& objects) override;
+
+    /// @brief Routing interest: probe, bltouch, smart_effector and eddy current objects
+    [[nodiscard]] bool handles_status_object(const std::string& object) const override;
+
     /// @brief Inject mock sensor objects for testing UI
     void inject_mock_sensors(std::vector<std::string>& objects, nlohmann::json& config_keys,
                              nlohmann::json& moonraker_info) override;
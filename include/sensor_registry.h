@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "hv/json.hpp"
+#include "status_router.h"
 
 namespace helix::sensors {
 
@@ -66,6 +67,26 @@ class ISensorManager {
     /// @brief Update state from Moonraker status JSON
     virtual void update_from_status(const nlohmann::json& status) = 0;
 
+    /// @brief Update state from the status objects routed to this manager
+    /// @param objects Objects from one delta accepted by handles_status_object()
+    /// @note Default implementation copies the objects into a status and calls
+    ///       update_from_status(); managers on the hot path override this instead.
+    virtual void update_from_objects(const StatusObjects& objects) {
+        nlohmann::json status = nlohmann::json::object();
+        for (const auto& entry : objects) {
+            status[*entry.name] = *entry.value;
+        }
+        update_from_status(status);
+    }
+
+    /// @brief Routing interest: whether a Klipper status object may belong to this manager
+    /// @note Should not depend on discovery results, since routes are cached per object name.
+    ///       Default implementation accepts everything.
+    [[nodiscard]] virtual bool handles_status_object(const std::string& object) const {
+        (void)object;
+        return true;
+    }
+
     /// @brief Load configuration from JSON
     virtual void load_config(const nlohmann::json& config) = 0;
 
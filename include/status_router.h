@@ -0,0 +1,164 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hv/json.hpp"
+
+/**
+ * @file status_router.h
+ * @brief Routes notify_status_update objects to the handlers that declared interest
+ *
+ * A status delta is keyed by Klipper object name ("extruder", "print_stats",
+ * "temperature_sensor chamber", ...). Instead of handing the whole delta to every
+ * sub-state and sensor manager, each of which probes it with contains() for the
+ * objects it knows, the router keeps a table from object name to interested
+ * handlers. Per update it walks the delta's keys once and calls each handler
+ * only with the objects routed to it, already resolved.
+ *
+ * The table is built from printer.objects.list at discovery time; objects not in
+ * that list are resolved on first sight and cached.
+ */
+
+namespace helix {
+
+/**
+ * @brief Status objects from one delta, as seen by a single handler
+ *
+ * Non-owning: entries point into the status JSON being dispatched and are only
+ * valid for the duration of the handler call.
+ */
+class StatusObjects {
+  public:
+    struct Entry {
+        const std::string* name;
+        const nlohmann::json* value;
+    };
+
+    StatusObjects() = default;
+
+    /// View of every object in a status delta (for direct update_from_status() callers)
+    explicit StatusObjects(const nlohmann::json& status);
+
+    /// @return The object's JSON, or nullptr if it is not in this update
+    [[nodiscard]] const nlohmann::json* find(const std::string& name) const;
+
+    void add(const std::string& name, const nlohmann::json& value) {
+        entries_.push_back({&name, &value});
+    }
+    void clear() {
+        entries_.clear();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return entries_.empty();
+    }
+    [[nodiscard]] size_t size() const {
+        return entries_.size();
+    }
+    [[nodiscard]] std::vector<Entry>::const_iterator begin() const {
+        return entries_.begin();
+    }
+    [[nodiscard]] std::vector<Entry>::const_iterator end() const {
+        return entries_.end();
+    }
+
+  private:
+    std::vector<Entry> entries_;
+};
+
+/**
+ * @brief Object-name routing table for status deltas
+ *
+ * Not thread-safe; PrinterState owns one and uses it under its state mutex on
+ * the main thread.
+ */
+class StatusRouter {
+  public:
+    /// Returns true if the handler wants updates for this Klipper object
+    using Matcher = std::function<bool(const std::string& object)>;
+    /// Receives the handler's objects from one delta, in delta order
+    using Handler = std::function<void(const StatusObjects& objects)>;
+
+    /// Cumulative dispatch counters
+    struct Stats {
+        uint64_t updates = 0;       ///< dispatch() calls
+        uint64_t objects = 0;       ///< Objects seen across all deltas
+        uint64_t deliveries = 0;    ///< Object deliveries to handlers
+        uint64_t handler_calls = 0; ///< Handler invocations
+        uint64_t resolves = 0;      ///< Objects whose route was computed (table misses)
+    };
+
+    /**
+     * @brief Register a handler
+     *
+     * Handlers run in registration order within one dispatch(). Adding a handler
+     * drops the routes resolved so far.
+     *
+     * @param name Handler name for logging
+     * @param wants Interest declaration, evaluated once per object name
+     * @param handler Update function
+     */
+    void add_handler(std::string name, Matcher wants, Handler handler);
+
+    /**
+     * @brief Build the routing table for the printer's objects
+     *
+     * Called at discovery time with printer.objects.list. The list is kept so
+     * rebuild() can re-resolve it after a handler's interest changes.
+     */
+    void build(const std::vector<std::string>& objects);
+
+    /**
+     * @brief Re-resolve all routes
+     *
+     * Call when a handler's interest depends on state that changed (e.g. the
+     * tracked LED or the chamber sensor name).
+     */
+    void rebuild();
+
+    /// Route each object in @p status to its handlers and run them
+    void dispatch(const nlohmann::json& status);
+
+    /// @return Names of the handlers @p object is routed to, in call order
+    [[nodiscard]] std::vector<std::string> handlers_for(const std::string& object);
+
+    [[nodiscard]] size_t handler_count() const {
+        return handlers_.size();
+    }
+    [[nodiscard]] size_t route_count() const {
+        return routes_.size();
+    }
+
+    [[nodiscard]] const Stats& stats() const {
+        return stats_;
+    }
+    void reset_stats() {
+        stats_ = Stats{};
+    }
+
+  private:
+    struct Route {
+        std::string name;
+        Matcher wants;
+        Handler handler;
+    };
+
+    const std::vector<size_t>& resolve(const std::string& object);
+
+    std::vector<Route> handlers_;
+    std::vector<std::string> objects_;                            ///< From the last build()
+    std::unordered_map<std::string, std::vector<size_t>> routes_; ///< Object -> handler indices
+    std::vector<StatusObjects> pending_; ///< Per-handler scratch, reused across dispatches
+    std::vector<size_t> touched_;        ///< Handlers with pending objects this dispatch
+    Stats stats_;
+};
+
+} // namespace helix
@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <functional>
 #include <string>
+#include <vector>
 
 /**
  * @file thumbnail_cache.h
@@ -418,6 +419,18 @@ class ThumbnailCache {
      */
     void evict_if_needed();
 
+    /**
+     * @brief fetch_optimized() that also pre-scales companion sizes
+     *
+     * targets[0] is the requested size and the only one reported to callbacks.
+     * Further targets (e.g. Detail for a card) are produced from the same PNG
+     * decode so opening the detail view later is a cache hit.
+     */
+    void fetch_optimized_targets(MoonrakerAPI* api, const std::string& relative_path,
+                                 const std::vector<helix::ThumbnailTarget>& targets,
+                                 SuccessCallback on_success, ErrorCallback on_error,
+                                 time_t source_modified);
+
     /**
      * @brief Process PNG and invoke callback with result
      *
@@ -426,13 +439,13 @@ class ThumbnailCache {
      *
      * @param png_lvgl_path LVGL path to the cached PNG
      * @param source_path Original Moonraker relative path (for cache key)
-     * @param target Target dimensions for pre-scaling
-     * @param on_success Success callback
+     * @param targets Target dimensions for pre-scaling; companions already cached are skipped
+     * @param on_success Success callback (for targets[0])
      * @param on_error Error callback (not currently used - fallback to PNG instead)
      */
     void process_and_callback(const std::string& png_lvgl_path, const std::string& source_path,
-                              const helix::ThumbnailTarget& target, SuccessCallback on_success,
-                              ErrorCallback on_error);
+                              std::vector<helix::ThumbnailTarget> targets,
+                              SuccessCallback on_success, ErrorCallback on_error);
 };
 
 /**
@@ -9,6 +9,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 // Forward declarations
 class HThreadPool;
@@ -22,8 +23,9 @@ class HThreadPool;
  * when using inner_align="contain". On ARM devices without GPU (like AD5M),
  * this causes severe UI lag during scrolling.
  *
- * Solution: Pre-scale thumbnails once at download time, store as raw LVGL binary,
- * display at 1:1 with zero runtime scaling.
+ * Solution: Pre-scale thumbnails once at download time, store as raw LVGL binary
+ * in the display's native color format, display at 1:1 with zero runtime scaling
+ * or color conversion.
  *
  * @see docs/THUMBNAIL_OPTIMIZATION_PLAN.md for full architecture
  */
@@ -38,6 +40,11 @@ enum class ThumbnailSize {
     Detail ///< Larger detail/status view (200–400px depending on display)
 };
 
+/// LVGL 9 color format values used for thumbnail output (from lv_color.h)
+constexpr uint8_t THUMBNAIL_FORMAT_ARGB8888 = 0x10;
+constexpr uint8_t THUMBNAIL_FORMAT_RGB565 = 0x12;
+constexpr uint8_t THUMBNAIL_FORMAT_RGB565A8 = 0x14;
+
 /**
  * @brief Target dimensions and format for pre-scaled thumbnails
  *
@@ -49,14 +56,20 @@ struct ThumbnailTarget {
     int height = 160; ///< Target height in pixels
 
     /**
-     * @brief Color format for output — always ARGB8888
+     * @brief Color format for output
      *
-     * LVGL handles conversion to display format (e.g., RGB565) at render time.
+     * ARGB8888 (default) or RGB565 on 16-bit displays. RGB565 targets are written
+     * as RGB565A8 when the thumbnail has any translucent pixels, so LVGL never
+     * converts colors at draw time.
      */
-    uint8_t color_format = 0x10; // LV_COLOR_FORMAT_ARGB8888
+    uint8_t color_format = THUMBNAIL_FORMAT_ARGB8888;
+
+    /// Ordered (4x4 Bayer) dithering when quantizing to RGB565; ignored for ARGB8888
+    bool dither = false;
 
     bool operator==(const ThumbnailTarget& other) const {
-        return width == other.width && height == other.height && color_format == other.color_format;
+        return width == other.width && height == other.height &&
+               color_format == other.color_format && dither == other.dither;
     }
 };
 
@@ -69,6 +82,8 @@ struct ProcessResult {
     std::string error;       ///< Error message (empty on success)
     int output_width = 0;    ///< Actual output width (may differ due to aspect ratio)
     int output_height = 0;   ///< Actual output height
+    uint8_t output_format = 0; ///< LVGL color format written (RGB565 may become RGB565A8)
+    size_t output_bytes = 0;   ///< Pixel data size in the .bin (excluding header)
 };
 
 /**
@@ -131,6 +146,19 @@ class ThumbnailProcessor {
                        const ThumbnailTarget& target, ProcessSuccessCallback on_success,
                        ProcessErrorCallback on_error);
 
+    /**
+     * @brief Process PNG data asynchronously into several targets with one decode
+     *
+     * The PNG is decoded once and resized for each target (e.g. Card and Detail),
+     * so a companion size is ready before it is asked for. Callbacks report the
+     * first target only; the others are picked up later via get_if_processed().
+     *
+     * @param targets Targets to produce; targets[0] is the one reported
+     */
+    void process_async(const std::vector<uint8_t>& png_data, const std::string& source_path,
+                       const std::vector<ThumbnailTarget>& targets,
+                       ProcessSuccessCallback on_success, ProcessErrorCallback on_error);
+
     /**
      * @brief Process PNG data synchronously
      *
@@ -144,6 +172,15 @@ class ThumbnailProcessor {
     ProcessResult process_sync(const std::vector<uint8_t>& png_data, const std::string& source_path,
                                const ThumbnailTarget& target);
 
+    /**
+     * @brief Process PNG data synchronously into several targets with one decode
+     *
+     * @return One ProcessResult per target, in order
+     */
+    std::vector<ProcessResult> process_sync(const std::vector<uint8_t>& png_data,
+                                            const std::string& source_path,
+                                            const std::vector<ThumbnailTarget>& targets);
+
     /**
      * @brief Check if a pre-scaled version exists in cache
      *
@@ -165,7 +202,8 @@ class ThumbnailProcessor {
      * Card sizes:   SMALL (<=480px): 120x120, MEDIUM (<=800px): 160x160, LARGE (>800px): 220x220
      * Detail sizes: SMALL (<=480px): 200x200, MEDIUM (<=800px): 300x300, LARGE (>800px): 400x400
      *
-     * Always uses ARGB8888 — LVGL converts to display format at render time.
+     * Uses RGB565 when the display's color format is RGB565 (with dithering if
+     * `/display/thumbnail_dither` is set), otherwise ARGB8888.
      *
      * @param size Use case: Card (file list) or Detail (status/detail views)
      * @note MUST be called from main thread only (LVGL is not thread-safe).
@@ -179,7 +217,8 @@ class ThumbnailProcessor {
      * @brief Get thumbnail target for specific display dimensions
      *
      * Pure function version for testing. Uses the same breakpoint logic
-     * as get_target_for_display(). Always uses ARGB8888.
+     * as get_target_for_display(). Always uses ARGB8888; callers pick the
+     * display-native format separately.
      *
      * @param width Display width in pixels
      * @param height Display height in pixels
@@ -189,6 +228,28 @@ class ThumbnailProcessor {
     static ThumbnailTarget get_target_for_resolution(int width, int height,
                                                      ThumbnailSize size = ThumbnailSize::Card);
 
+    /**
+     * @brief Convert decoded RGBA8888 pixels to .bin pixel data
+     *
+     * ARGB8888 output is B,G,R,A per pixel. RGB565 output is little-endian
+     * 16-bit pixels; if any pixel is translucent the result is RGB565A8 (the
+     * RGB565 plane followed by an 8-bit alpha plane).
+     *
+     * @param rgba Pixels as R,G,B,A bytes, tightly packed
+     * @param width, height Image size in pixels
+     * @param target Requested color format and dithering
+     * @param[out] out_color_format Format actually produced
+     * @return Pixel data with stride get_stride(out_color_format, width)
+     */
+    static std::vector<uint8_t> convert_pixels(const uint8_t* rgba, int width, int height,
+                                               const ThumbnailTarget& target,
+                                               uint8_t& out_color_format);
+
+    /**
+     * @brief Row stride in bytes of an LVGL .bin image (RGB565 plane for RGB565A8)
+     */
+    static int get_stride(uint8_t color_format, int width);
+
     /**
      * @brief Get the cache directory path (thread-safe)
      * @return Path to thumbnail cache directory (e.g., /tmp/helix_thumbs)
@@ -243,7 +304,10 @@ class ThumbnailProcessor {
      * @brief Generate cache filename for a source/target combination
      *
      * Format: {hash}_{w}x{h}_{format}.bin
-     * Example: a1b2c3d4_160x160_ARGB8888.bin
+     * Example: a1b2c3d4_160x160_ARGB8888.bin, a1b2c3d4_160x160_RGB565D.bin (dithered)
+     *
+     * RGB565 and RGB565A8 share a name: whether alpha is needed is only known
+     * after decoding, and the .bin header records the actual format.
      */
     std::string generate_cache_filename(const std::string& source_path,
                                         const ThumbnailTarget& target) const;
@@ -251,16 +315,19 @@ class ThumbnailProcessor {
     /**
      * @brief Core processing implementation
      *
-     * 1. Decode PNG with stb_image
-     * 2. Calculate output dimensions (preserve aspect, cover target)
+     * 1. Decode PNG with stb_image (once for all targets)
+     * 2. Per target: calculate output dimensions (preserve aspect, cover target)
      * 3. Resize with stb_image_resize (high-quality Mitchell filter)
-     * 4. Convert to ARGB8888 if needed
+     * 4. Convert to the target color format (ARGB8888 or RGB565/RGB565A8)
      * 5. Write LVGL binary header + pixel data
      *
      * @param cache_dir Cache directory path (passed explicitly for thread safety)
+     * @return One ProcessResult per target, in order
      */
-    ProcessResult do_process(const std::vector<uint8_t>& png_data, const std::string& source_path,
-                             const ThumbnailTarget& target, const std::string& cache_dir);
+    std::vector<ProcessResult> do_process(const std::vector<uint8_t>& png_data,
+                                          const std::string& source_path,
+                                          const std::vector<ThumbnailTarget>& targets,
+                                          const std::string& cache_dir);
 
     /**
      * @brief Write LVGL binary file
@@ -0,0 +1,365 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file toolpath_rasterizer.h
+ * @brief Software line rasterizer that writes 2D toolpaths straight into ARGB8888 pixels
+ *
+ * @pattern Lines are clipped to the target once, then walked without per-pixel
+ *          bounds checks; aliased lines use Bresenham started at the clip boundary
+ *          of the unclipped line (shared by the solid cache, the background ghost
+ *          thread and the direct layer path), antialiased lines use a fixed-point
+ *          DDA with per-pixel coverage
+ * @threading No shared state; one rasterizer per thread and target. rasterize_tiled()
+ *            splits a target into row bands and draws them on a RasterWorkerPool
+ * @gotchas Pixels are LVGL ARGB8888 (B, G, R, A bytes in memory, not premultiplied).
+ *          Colors are passed as 0xAARRGGBB.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <climits>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+/// ARGB8888 pixel buffer a ToolpathRasterizer draws into (not owned)
+struct RasterTarget {
+    uint8_t* data = nullptr;
+    int width = 0;
+    int height = 0;
+    int stride = 0; ///< Bytes per row (>= width * 4, 4-byte aligned)
+};
+
+/**
+ * @brief Per-object state bits, resolved once per selection change
+ *
+ * Indexed by ObjectId so the per-segment check is one byte load.
+ */
+enum ObjectStateFlags : uint8_t {
+    OBJECT_EXCLUDED = 1u << 0,
+    OBJECT_HIGHLIGHTED = 1u << 1,
+};
+
+/**
+ * @brief Draws toolpath lines into a pixel buffer without going through LVGL
+ *
+ * Replaces one LVGL draw task per segment with a tight loop over the target
+ * pixels; a dense layer is a few hundred thousand short lines.
+ */
+class ToolpathRasterizer {
+  public:
+    ToolpathRasterizer() = default;
+
+    /**
+     * @brief Bind to a target buffer
+     * @param target Pixel buffer (must outlive the rasterizer)
+     */
+    explicit ToolpathRasterizer(const RasterTarget& target) : target_(target) {}
+
+    /**
+     * @brief Enable coverage-based antialiasing (default off)
+     *
+     * Aliased lines are bit-identical to plain Bresenham of the unclipped
+     * line, however they are clipped or tiled; antialiased lines look like
+     * LVGL's software line renderer.
+     */
+    void set_antialias(bool enable) {
+        antialias_ = enable;
+    }
+
+    bool antialias() const {
+        return antialias_;
+    }
+
+    const RasterTarget& target() const {
+        return target_;
+    }
+
+    /**
+     * @brief Restrict writes to rows [begin, end)
+     *
+     * Lines are still clipped against the whole target, so every pixel inside
+     * the band comes out exactly as it would without a band. Tiles drawn
+     * with disjoint bands therefore assemble into the untiled image.
+     */
+    void set_row_band(int begin, int end) {
+        band_begin_ = begin;
+        band_end_ = end;
+    }
+
+    /**
+     * @brief Clear the target to transparent
+     */
+    void clear();
+
+    /**
+     * @brief Draw a line between pixel centers
+     *
+     * Alpha below 255 is blended over existing pixels (source-over); opaque
+     * colors overwrite. Width is measured perpendicular to the line.
+     *
+     * @param x0 Start X in target pixels
+     * @param y0 Start Y in target pixels
+     * @param x1 End X in target pixels
+     * @param y1 End Y in target pixels
+     * @param color 0xAARRGGBB
+     * @param width Line width in pixels (values below 1 draw 1)
+     */
+    void draw_line(int x0, int y0, int x1, int y1, uint32_t color, int width = 1);
+
+    /**
+     * @brief Number of pixels written or blended since construction
+     */
+    size_t pixels_touched() const {
+        return pixels_touched_;
+    }
+
+  private:
+    void draw_aliased(int x0, int y0, int x1, int y1, uint32_t color, int width);
+    void draw_antialiased(int x0, int y0, int x1, int y1, uint32_t color, int width);
+
+    uint32_t* row(int y) const {
+        return reinterpret_cast<uint32_t*>(target_.data + static_cast<size_t>(y) * target_.stride);
+    }
+
+    int first_row() const {
+        return band_begin_ > 0 ? band_begin_ : 0;
+    }
+
+    int last_row() const {
+        return band_end_ < target_.height ? band_end_ - 1 : target_.height - 1;
+    }
+
+    RasterTarget target_;
+    bool antialias_ = false;
+    int band_begin_ = 0;
+    int band_end_ = INT_MAX;
+    size_t pixels_touched_ = 0;
+};
+
+/// A line already projected to target pixels, ready for rasterize_tiled()
+struct RasterLine {
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+    uint32_t color; ///< 0xAARRGGBB
+    int width;
+};
+
+/// Upper bound on raster threads (memory bandwidth, not cores, limits beyond this)
+constexpr size_t MAX_RASTER_WORKERS = 4;
+
+/**
+ * @brief Persistent threads for tiled rasterization
+ *
+ * Starting threads per frame costs more than drawing a small layer, so the
+ * renderer keeps one pool for its lifetime. The calling thread always works
+ * too; while another caller's job is running, run() executes inline instead
+ * of waiting, so the LVGL thread never blocks behind the ghost render.
+ */
+class RasterWorkerPool {
+  public:
+    /**
+     * @brief Start the pool
+     * @param worker_count Threads including the caller (0 = hardware concurrency,
+     *        clamped to MAX_RASTER_WORKERS)
+     */
+    explicit RasterWorkerPool(size_t worker_count = 0);
+    ~RasterWorkerPool();
+
+    RasterWorkerPool(const RasterWorkerPool&) = delete;
+    RasterWorkerPool& operator=(const RasterWorkerPool&) = delete;
+
+    /**
+     * @brief Threads that work on a job, including the caller
+     */
+    size_t worker_count() const {
+        return threads_.size() + 1;
+    }
+
+    /**
+     * @brief Run tasks 0..task_count-1 and wait for all of them
+     * @param task_count Number of tasks
+     * @param task Called once per task index, from any pool thread. Must not throw.
+     */
+    void run(size_t task_count, const std::function<void(size_t task)>& task);
+
+  private:
+    void worker_loop();
+    void work();
+
+    std::vector<std::thread> threads_;
+    std::mutex job_mutex_; ///< Held by the caller whose job owns the threads
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(size_t)>* task_ = nullptr;
+    size_t task_count_ = 0;
+    std::atomic<size_t> next_task_{0};
+    size_t active_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+};
+
+/**
+ * @brief Draw lines in order, split into horizontal tiles across a pool
+ *
+ * Each tile walks the whole list and draws the lines that reach its rows, so
+ * overlapping lines blend in the same order as a single-threaded pass and the
+ * result is bit-identical to drawing @p lines with one ToolpathRasterizer.
+ *
+ * @param target Pixel buffer
+ * @param lines Lines in draw order
+ * @param antialias Coverage antialiasing
+ * @param pool Worker pool (nullptr draws on the calling thread)
+ * @return Pixels written or blended
+ */
+size_t rasterize_tiled(const RasterTarget& target, const std::vector<RasterLine>& lines,
+                       bool antialias, RasterWorkerPool* pool);
+
+/**
+ * @brief Walk the pixels of a line with Bresenham's algorithm
+ *
+ * @param x0 Start X
+ * @param y0 Start Y
+ * @param x1 End X
+ * @param y1 End Y
+ * @param plot Called as plot(x, y) for each pixel, start and end included
+ */
+template <typename Plot> inline void bresenham_line(int x0, int y0, int x1, int y1, Plot&& plot) {
+    int dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int dy = -(y1 > y0 ? y1 - y0 : y0 - y1);
+    int sx = x0 < x1 ? 1 : -1;
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+
+    while (true) {
+        plot(x0, y0);
+
+        if (x0 == x1 && y0 == y1)
+            break;
+
+        int e2 = 2 * err;
+        if (e2 >= dy) {
+            if (x0 == x1)
+                break;
+            err += dy;
+            x0 += sx;
+        }
+        if (e2 <= dx) {
+            if (y0 == y1)
+                break;
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+/**
+ * @brief Walk the pixels of bresenham_line() that fall inside a rectangle
+ *
+ * Plots exactly the pixels bresenham_line(x0, y0, x1, y1) would, in the same
+ * order, limited to [min_x, max_x] x [min_y, max_y]. Step k along the major axis
+ * lands floor((2 * minor * k + major) / (2 * major)) steps along the minor axis,
+ * so the walk starts at the clip boundary without stepping through the pixels
+ * outside it.
+ *
+ * @param x0 Start X
+ * @param y0 Start Y
+ * @param x1 End X
+ * @param y1 End Y
+ * @param min_x First column plotted
+ * @param max_x Last column plotted
+ * @param min_y First row plotted
+ * @param max_y Last row plotted
+ * @param plot Called as plot(x, y) for each pixel inside the rectangle
+ */
+template <typename Plot>
+inline void bresenham_line_clipped(int x0, int y0, int x1, int y1, int min_x, int max_x, int min_y,
+                                   int max_y, Plot&& plot) {
+    if (min_x > max_x || min_y > max_y) {
+        return;
+    }
+    const int64_t dx = static_cast<int64_t>(x1) - x0;
+    const int64_t dy = static_cast<int64_t>(y1) - y0;
+    const bool x_major = (dx < 0 ? -dx : dx) >= (dy < 0 ? -dy : dy);
+
+    // Major axis a, minor axis b; offsets are counted in steps away from the start
+    const int64_t da = x_major ? dx : dy;
+    const int64_t db = x_major ? dy : dx;
+    const int64_t major = da < 0 ? -da : da;
+    const int64_t minor = db < 0 ? -db : db;
+    auto steps = [](int64_t start, int64_t delta, int64_t lo, int64_t hi, int64_t& first,
+                    int64_t& last) {
+        first = delta < 0 ? start - hi : lo - start;
+        last = delta < 0 ? start - lo : hi - start;
+    };
+    int64_t k_first, k_last, j_first, j_last;
+    steps(x_major ? x0 : y0, da, x_major ? min_x : min_y, x_major ? max_x : max_y, k_first,
+          k_last);
+    steps(x_major ? y0 : x0, db, x_major ? min_y : min_x, x_major ? max_y : max_x, j_first,
+          j_last);
+    k_first = k_first > 0 ? k_first : 0;
+    k_last = k_last < major ? k_last : major;
+    if (j_last < 0 || j_first > minor) {
+        return;
+    }
+    if (minor > 0) {
+        // Minor offset is monotonic in k, so its range maps to one range of k
+        if (j_first > 0) {
+            int64_t k = (2 * major * j_first - major + 2 * minor - 1) / (2 * minor);
+            k_first = k > k_first ? k : k_first;
+        }
+        int64_t k = (2 * major * (j_last + 1) - major - 1) / (2 * minor);
+        k_last = k < k_last ? k : k_last;
+    } else if (j_first > 0) {
+        return;
+    }
+    if (k_first > k_last) {
+        return;
+    }
+    if (major == 0) {
+        plot(x0, y0);
+        return;
+    }
+
+    const int step_a = da < 0 ? -1 : 1;
+    const int step_b = db < 0 ? -1 : 1;
+    const int ax = x_major ? step_a : 0;
+    const int ay = x_major ? 0 : step_a;
+    const int bx = x_major ? 0 : step_b;
+    const int by = x_major ? step_b : 0;
+
+    const int64_t num = 2 * minor * k_first + major;
+    const int64_t j = num / (2 * major);
+    int64_t rem = num % (2 * major);
+    int x = x0 + static_cast<int>(ax * k_first + bx * j);
+    int y = y0 + static_cast<int>(ay * k_first + by * j);
+    for (int64_t k = k_first;; ++k) {
+        plot(x, y);
+        if (k == k_last) {
+            break;
+        }
+        x += ax;
+        y += ay;
+        rem += 2 * minor;
+        if (rem >= 2 * major) {
+            rem -= 2 * major;
+            x += bx;
+            y += by;
+        }
+    }
+}
+
+} // namespace gcode
+} // namespace helix
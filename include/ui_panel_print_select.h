@@ -15,6 +15,7 @@
 #include "ui_print_select_usb_source.h"
 #include "ui_print_start_controller.h"
 
+#include "file_metadata_cache.h"
 #include "helix_plugin_installer.h"
 #include "print_file_data.h"
 #include "print_history_manager.h"
@@ -207,12 +208,21 @@ class PrintSelectPanel : public PanelBase {
      *
      * Only fetches metadata for files that haven't been fetched yet.
      * Called initially for visible items, then on scroll for newly visible items.
+     * Unchanged files are served from the persistent FileMetadataCache without an RPC.
      *
      * @param start Start index (inclusive)
      * @param end End index (exclusive)
      */
     void fetch_metadata_range(size_t start, size_t end);
 
+    /**
+     * @brief Build the cache fetcher for one file (metadata RPC with metascan fallback)
+     *
+     * @param file_path Path relative to the gcodes root
+     * @return Fetcher for FileMetadataCache::request()
+     */
+    helix::FileMetadataCache::Fetcher make_metadata_fetcher(const std::string& file_path);
+
     /**
      * @brief Process metadata result and update file list
      *
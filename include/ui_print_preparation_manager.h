@@ -545,11 +545,29 @@ class PrintPreparationManager {
                           NavigateToStatusCallback on_navigate_to_status);
 
     /**
-     * @brief Unified streaming modification and print flow
+     * @brief Piped modification and print flow (default)
+     *
+     * Streams the file from Moonraker through a GCodeStreamModifier straight
+     * into the upload of the modified copy (MoonrakerAPI::transform_file), so
+     * no local temp files are written. Only the lines up to the last
+     * modification are split and rewritten; the rest is forwarded as-is.
+     * Falls back to modify_and_print_streaming() if the piped transfer fails.
+     *
+     * Parameters as for modify_and_print_streaming().
+     */
+    void modify_and_print_piped(
+        const std::string& file_path, const std::string& display_filename,
+        const std::vector<gcode::OperationType>& ops_to_disable,
+        const std::vector<std::pair<std::string, std::string>>& macro_skip_params,
+        const std::vector<std::string>& mod_names, NavigateToStatusCallback on_navigate_to_status,
+        bool use_plugin);
+
+    /**
+     * @brief Temp-file modification and print flow (fallback)
      *
      * Downloads file to disk, applies streaming modification (file-to-file),
-     * then uploads from disk. This is the single path for all G-code modifications,
-     * avoiding memory spikes that cause TTC errors on constrained devices.
+     * then uploads from disk. Used when the piped flow fails, avoiding memory
+     * spikes that cause TTC errors on constrained devices.
      *
      * If use_plugin is true and helix_print plugin is available, the plugin's
      * path-based API is used after upload for symlink creation and history patching.
@@ -569,6 +587,26 @@ class PrintPreparationManager {
         const std::vector<std::string>& mod_names, NavigateToStatusCallback on_navigate_to_status,
         bool use_plugin);
 
+    /**
+     * @brief Start printing a modified copy that has been uploaded
+     *
+     * Shared tail of the piped and temp-file flows. Called from the HTTP thread;
+     * LVGL work is deferred to the main thread.
+     *
+     * @param file_path Full path to original file relative to gcodes root
+     * @param display_filename Filename for display purposes
+     * @param remote_temp_path Uploaded modified file relative to gcodes root
+     * @param mod_names Modification identifiers for tracking
+     * @param on_navigate_to_status Callback to navigate to print status panel
+     * @param use_plugin Whether to use helix_print plugin for print start
+     */
+    void start_uploaded_modified_print(const std::string& file_path,
+                                       const std::string& display_filename,
+                                       const std::string& remote_temp_path,
+                                       const std::vector<std::string>& mod_names,
+                                       NavigateToStatusCallback on_navigate_to_status,
+                                       bool use_plugin);
+
     /**
      * @brief Start print directly (no pre-print operations)
      */
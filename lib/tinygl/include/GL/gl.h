@@ -795,6 +795,10 @@ void glReadPixels(	GLint x,
 void glDrawArrays(	GLenum mode,
  					GLint first,
  					GLsizei count);
+void glDrawElements(	GLenum mode,
+ 					GLsizei count,
+ 					GLenum type,
+ 					const GLvoid * indices);
 
 void glSetEnableSpecular(GLint s);
 void glSetEnableDithering(GLint enable);  /* Enable/disable ordered dithering */
@@ -988,6 +992,10 @@ void glPixelZoom(GLfloat x, GLfloat y);
 
 /* PostProcessing pass implementation */
 void glPostProcess(GLuint (*postprocess)(GLint x, GLint y, GLuint pixel, GLushort z));
+
+/* Fill triangles on up to n threads in screen tiles (TGL_FEATURE_BINNED_RASTER).
+   0 or 1 rasterizes on the calling thread. The frame buffer is only complete after glFinish(). */
+void glSetRasterThreads(GLint threads);
 /* not implemented, just added to compile  */
   /*
 
@@ -273,6 +273,10 @@ typedef struct {
     GLint depth_test;
     GLint depth_write;
     GLubyte frame_buffer_allocated;
+    /* triangle fills only touch rows [band_y0, band_y1) (binned raster tiles) */
+    GLint band_y0, band_y1;
+    /* material for Phong fills; NULL uses the current GL material */
+    const void* shade_material;
 } ZBuffer;
 
 typedef struct {
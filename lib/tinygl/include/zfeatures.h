@@ -81,6 +81,14 @@ the maximum number of vertices in a polygon is defined in zgl.h
 
 #define TGL_FEATURE_MULTITHREADED_ZB_COPYBUFFER 0
 
+/*
+Binned triangle fills (glSetRasterThreads): triangles are queued into
+full-width screen tiles and the tiles are filled on a pthread pool.
+Requires pthreads; set to 0 for targets without them.
+*/
+#define TGL_FEATURE_BINNED_RASTER 1
+#define TGL_MAX_RASTER_THREADS 8
+
 /*
 !!!!!WARNING!!!!!
 TGL_FEATURE_ALIGNAS assumes that the implementation's malloc (AND REALLOC) are 16-byte aligned.
@@ -632,7 +632,10 @@ void glCallList(GLuint list) {
 
 	gl_add_op(p);
 }
-void glFlush(void) { /* nothing to do */
+void glFlush(void) {
+	GLContext* c = gl_get_context();
+	TGL_FLUSH_BINS(c);
+	(void)c;
 }
 
 void glHint(GLint target, GLint mode) {
@@ -307,20 +307,27 @@ void glBufferData(GLenum target, GLsizei size, const void* data,
 		memcpy(buf->data, data, size);
 }
 
-void glopArrayElement(GLParam* param) {
+/* Load the current color, normal and tex coord from array element idx */
+static void gl_array_attribs(GLContext* c, GLint idx) {
 	GLint i;
-	GLContext* c = gl_get_context();
 	GLint states = c->client_states;
-	GLint idx = param[1].i;
 
 	if (states & COLOR_ARRAY) {
 		GLParam p[5];
 		GLint size = c->color_array_size;
 		i = idx * (size + c->color_array_stride);
-		p[1].f = c->color_array[i];
-		p[2].f = c->color_array[i + 1];
-		p[3].f = c->color_array[i + 2];
-		p[4].f = (size > 3) ? c->color_array[i + 3] : 1.0f;
+		if (c->color_array_type == GL_UNSIGNED_BYTE) {
+			const GLubyte* rgba = (const GLubyte*)c->color_array;
+			p[1].f = rgba[i] * (1.0f / 255.0f);
+			p[2].f = rgba[i + 1] * (1.0f / 255.0f);
+			p[3].f = rgba[i + 2] * (1.0f / 255.0f);
+			p[4].f = (size > 3) ? rgba[i + 3] * (1.0f / 255.0f) : 1.0f;
+		} else {
+			p[1].f = c->color_array[i];
+			p[2].f = c->color_array[i + 1];
+			p[3].f = c->color_array[i + 2];
+			p[4].f = (size > 3) ? c->color_array[i + 3] : 1.0f;
+		}
 		glopColor(p);
 	}
 	if (states & NORMAL_ARRAY) {
@@ -338,18 +345,30 @@ void glopArrayElement(GLParam* param) {
 		c->current_tex_coord.Z = (size > 2) ? c->texcoord_array[i + 2] : 0.0f;
 		c->current_tex_coord.W = (size > 3) ? c->texcoord_array[i + 3] : 1.0f;
 	}
-	if (states & VERTEX_ARRAY) {
+}
+
+/* Read the position of array element idx into p[1..4] */
+static void gl_array_coord(GLContext* c, GLint idx, GLParam* p) {
+	GLint size = c->vertex_array_size;
+	GLint i = idx * (size + c->vertex_array_stride);
+	p[1].f = c->vertex_array[i];
+	p[2].f = c->vertex_array[i + 1];
+	p[3].f = (size > 2) ? c->vertex_array[i + 2] : 0.0f;
+	p[4].f = (size > 3) ? c->vertex_array[i + 3] : 1.0f;
+}
+
+/* Feed array element idx to the vertex pipeline (inside glBegin/glEnd) */
+static void gl_array_element(GLContext* c, GLint idx) {
+	gl_array_attribs(c, idx);
+	if (c->client_states & VERTEX_ARRAY) {
 		GLParam p[5];
-		GLint size = c->vertex_array_size;
-		i = idx * (size + c->vertex_array_stride);
-		p[1].f = c->vertex_array[i];
-		p[2].f = c->vertex_array[i + 1];
-		p[3].f = (size > 2) ? c->vertex_array[i + 2] : 0.0f;
-		p[4].f = (size > 3) ? c->vertex_array[i + 3] : 1.0f;
+		gl_array_coord(c, idx, p);
 		glopVertex(p);
 	}
 }
 
+void glopArrayElement(GLParam* param) { gl_array_element(gl_get_context(), param[1].i); }
+
 void glArrayElement(GLint i) {
 	GLParam p[2];
 #include "error_check_no_context.h"
@@ -358,16 +377,117 @@ void glArrayElement(GLint i) {
 	gl_add_op(p);
 }
 
+/*
+Bulk draws run as one op: the whole primitive goes through glopBegin, the
+vertex pipeline and glopEnd without queueing an op per vertex. Arrays are
+read when the op executes, as with glArrayElement.
+*/
+void glopDrawArrays(GLParam* p) {
+	GLint i, end;
+	GLParam begin[2];
+	GLContext* c = gl_get_context();
+
+	begin[1].i = p[1].i;
+	glopBegin(begin);
+	end = p[2].i + p[3].i;
+	for (i = p[2].i; i < end; i++)
+		gl_array_element(c, i);
+	glopEnd(NULL);
+}
+
 void glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	GLParam p[4];
+#include "error_check_no_context.h"
+	if (count <= 0)
+		return;
+	p[0].op = OP_DrawArrays;
+	p[1].i = mode;
+	p[2].i = first;
+	p[3].i = count;
+	gl_add_op(p);
+}
+
+static GLint gl_element_index(const void* indices, GLint type, GLint i) {
+	switch (type) {
+	case GL_UNSIGNED_INT:
+		return (GLint)((const GLuint*)indices)[i];
+	case GL_UNSIGNED_SHORT:
+		return ((const GLushort*)indices)[i];
+	default:
+		return ((const GLubyte*)indices)[i];
+	}
+}
+
+/*
+Indexed triangle lists keep a small direct-mapped cache of transformed and
+lit vertices, so an index shared by neighbouring triangles (ribbon strips
+split into triangle pairs, adjacent tube faces) is only processed once.
+Triangles are drawn from copies, since flat shading rewrites vertex colors.
+*/
+#define TGL_VERTEX_CACHE_SIZE 32 /* power of two */
+
+static void gl_draw_elements_cached(GLContext* c, GLint count, GLint type, const void* indices) {
+	GLVertex cache[TGL_VERTEX_CACHE_SIZE];
+	GLint cached_index[TGL_VERTEX_CACHE_SIZE];
+	GLParam coord[5];
+	GLint i, k;
+
+	for (k = 0; k < TGL_VERTEX_CACHE_SIZE; k++)
+		cached_index[k] = -1;
+
+	for (i = 0; i + 2 < count; i += 3) {
+		for (k = 0; k < 3; k++) {
+			GLint idx = gl_element_index(indices, type, i + k);
+			GLint slot = idx & (TGL_VERTEX_CACHE_SIZE - 1);
+			if (cached_index[slot] != idx) {
+				gl_array_attribs(c, idx);
+				gl_array_coord(c, idx, coord);
+				gl_vertex_setup(c, &cache[slot], coord[1].f, coord[2].f, coord[3].f, coord[4].f);
+				cached_index[slot] = idx;
+			}
+			c->vertex[k] = cache[slot];
+		}
+		gl_draw_triangle(&c->vertex[0], &c->vertex[1], &c->vertex[2]);
+	}
+}
+
+void glopDrawElements(GLParam* p) {
 	GLint i;
-	GLint end;
-	
+	GLint count = p[2].i;
+	GLParam begin[2];
+	GLContext* c = gl_get_context();
+
+	begin[1].i = p[1].i;
+	glopBegin(begin);
+	if (p[1].i == GL_TRIANGLES && (c->client_states & VERTEX_ARRAY)) {
+		gl_draw_elements_cached(c, count, p[3].i, p[4].p);
+	} else {
+		for (i = 0; i < count; i++)
+			gl_array_element(c, gl_element_index(p[4].p, p[3].i, i));
+	}
+	glopEnd(NULL);
+}
+
+void glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices) {
+	GLParam p[5];
+#define NEED_CONTEXT
 #include "error_check_no_context.h"
-	end = first + count;
-	glBegin(mode);
-	for (i = first; i < end; i++)
-		glArrayElement(i);
-	glEnd();
+#if TGL_FEATURE_ERROR_CHECK == 1
+	if (type != GL_UNSIGNED_INT && type != GL_UNSIGNED_SHORT && type != GL_UNSIGNED_BYTE)
+#define ERROR_FLAG GL_INVALID_ENUM
+#include "error_check.h"
+#else
+	if (type != GL_UNSIGNED_INT && type != GL_UNSIGNED_SHORT && type != GL_UNSIGNED_BYTE)
+		return;
+#endif
+	if (count <= 0 || indices == NULL)
+		return;
+	p[0].op = OP_DrawElements;
+	p[1].i = mode;
+	p[2].i = count;
+	p[3].i = type;
+	p[4].p = (void*)indices;
+	gl_add_op(p);
 }
 
 void glopEnableClientState(GLParam* p) { gl_get_context()->client_states |= p[1].i; }
@@ -456,23 +576,25 @@ void glopColorPointer(GLParam* p) {
 	c->color_array_size = p[1].i;
 	c->color_array_stride = p[2].i;
 	c->color_array = p[3].p;
+	c->color_array_type = p[4].i;
 }
 
 void glColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer) {
-	GLParam p[4];
+	GLParam p[5];
 #define NEED_CONTEXT
 #include "error_check_no_context.h"
 #if TGL_FEATURE_ERROR_CHECK == 1
-	if (type != GL_FLOAT)
+	if (type != GL_FLOAT && type != GL_UNSIGNED_BYTE)
 #define ERROR_FLAG GL_INVALID_ENUM
 #include "error_check.h"
 #else
-	/* assert(type == GL_FLOAT);*/
+	/* assert(type == GL_FLOAT || type == GL_UNSIGNED_BYTE);*/
 #endif
 		p[0].op = OP_ColorPointer;
 	p[1].i = size;
 	p[2].i = stride;
 	p[3].p = (void*)pointer;
+	p[4].i = type; /* stride still counts extra elements (bytes for GL_UNSIGNED_BYTE) */
 	gl_add_op(p);
 }
 
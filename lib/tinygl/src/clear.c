@@ -22,5 +22,6 @@ void glopClear(GLParam* p) {
 
 	/* TODO : correct value of Z */
 
+	TGL_FLUSH_BINS(c);
 	ZB_clear(c->zb, mask & GL_DEPTH_BUFFER_BIT, z, mask & GL_COLOR_BUFFER_BIT, r, g, b);
 }
@@ -140,6 +140,10 @@ const GLubyte* extensions_string =
 																						 "TGL_FEATURE_MULTITHREADED_ZB_COPYBUFFER "
 #endif
 
+#if TGL_FEATURE_BINNED_RASTER == 1
+																						 "TGL_FEATURE_BINNED_RASTER "
+#endif
+
 #else
 																						 "TGL_FEATURE_SINGLE_THREADED "
 #endif
@@ -358,6 +358,9 @@ void glClose(void) {
 
 	GLuint i;
 	GLContext* c = gl_get_context();
+#if TGL_FEATURE_BINNED_RASTER == 1
+	gl_bins_free(c);
+#endif
 	for (i = 0; i < 3; i++) {
 		gl_free(c->matrix_stack[i]);
 	}
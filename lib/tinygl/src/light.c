@@ -80,6 +80,7 @@ void glopLight(GLParam* p) {
 	GLint type = p[2].i;
 	V4 v;
 	GLLight* l;
+	TGL_FLUSH_BINS(c);
 	GLint i;
 
 	/* assert(light >= GL_LIGHT0 && light < GL_LIGHT0 + MAX_LIGHTS);*/
@@ -173,6 +174,7 @@ void glopLightModel(GLParam* p) {
 	GLint pname = p[1].i;
 	GLint* v = &p[2].i;
 	GLint i;
+	TGL_FLUSH_BINS(c);
 
 	switch (pname) {
 	case GL_LIGHT_MODEL_AMBIENT:
@@ -201,6 +203,7 @@ void glopLightModel(GLParam* p) {
 void gl_enable_disable_light(GLint light, GLint v) {
 	GLContext* c = gl_get_context();
 	GLLight* l = &c->lights[light];
+	TGL_FLUSH_BINS(c);
 	if (v && !l->enabled) {
 		l->enabled = 1;
 		l->next = c->first_light;
@@ -224,7 +227,11 @@ void glSetEnableSpecular(GLint s) {
 	p[0].op = OP_SetEnableSpecular;
 	gl_add_op(p);
 }
-void glopSetEnableSpecular(GLParam* p) { gl_get_context()->zEnableSpecular = p[1].i; }
+void glopSetEnableSpecular(GLParam* p) {
+	GLContext* c = gl_get_context();
+	TGL_FLUSH_BINS(c);
+	c->zEnableSpecular = p[1].i;
+}
 
 void glSetEnableDithering(GLint enable) {
 	GLParam p[2];
@@ -233,23 +240,27 @@ void glSetEnableDithering(GLint enable) {
 	p[0].op = OP_SetEnableDithering;
 	gl_add_op(p);
 }
-void glopSetEnableDithering(GLParam* p) { tgl_dithering_enabled = p[1].i; }
+void glopSetEnableDithering(GLParam* p) {
+	TGL_FLUSH_BINS(gl_get_context());
+	tgl_dithering_enabled = p[1].i;
+}
 
 /*
  * Per-pixel lighting for Phong shading
  * Simplified version that works with interpolated normals
  * For full quality, use gl_shade_vertex() at vertices (Gouraud)
  */
-void gl_shade_pixel(GLfloat* R_out, GLfloat* G_out, GLfloat* B_out, V3* normal) {
+void gl_shade_pixel(GLfloat* R_out, GLfloat* G_out, GLfloat* B_out, V3* normal, const void* material) {
 	GLContext* c = gl_get_context();
 	GLfloat R, G, B;
-	GLMaterial* m;
+	const GLMaterial* m;
 	GLLight* l;
 	V3 n, s, d;
 	GLfloat tmp, att, dot, dot_spec;
 	GLint twoside = c->light_model_two_side;
 
-	m = &c->materials[0];
+	/* binned fills pass the material captured when the triangle was queued */
+	m = material ? (const GLMaterial*)material : &c->materials[0];
 
 	/* Use provided normal (assumed to be normalized by caller) */
 	n.X = normal->X;
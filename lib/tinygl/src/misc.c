@@ -256,4 +256,8 @@ void glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format
 	/* TODO: implement read pixels.*/
 }
 
-void glFinish(void) { return; }
+void glFinish(void) {
+	GLContext* c = gl_get_context();
+	TGL_FLUSH_BINS(c);
+	(void)c;
+}
@@ -226,6 +226,7 @@ void glopCopyTexImage2D(GLParam* p) {
 		return;
 #endif
 	}
+	TGL_FLUSH_BINS(c);
 	im = &c->current_texture->images[level];
 	data = c->current_texture->images[level].pixmap;
 	im->xsize = TGL_FEATURE_TEXTURE_DIM;
@@ -203,31 +203,12 @@ static void gl_vertex_transform(GLVertex* v) {
 	v->clip_code = gl_clipcode(v->pc.X, v->pc.Y, v->pc.Z, v->pc.W);
 }
 
-void glopVertex(GLParam* p) {
-	GLVertex* v;
-	GLint n, i, cnt;
-	GLContext* c = gl_get_context();
-#if TGL_FEATURE_ERROR_CHECK == 1
-	if (c->in_begin == 0)
-#define ERROR_FLAG GL_INVALID_OPERATION
-#include "error_check.h"
-#else
-	
-#endif
-
-		n = c->vertex_n;
-	cnt = c->vertex_cnt;
-	cnt++;
-	c->vertex_cnt = cnt;
-
-	/* new vertex entry */
-	v = &c->vertex[n];
-	n++;
-
-	v->coord.X = p[1].f;
-	v->coord.Y = p[2].f;
-	v->coord.Z = p[3].f;
-	v->coord.W = p[4].f;
+/* Transform, light and viewport-map one vertex from the current attributes */
+void gl_vertex_setup(GLContext* c, GLVertex* v, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	v->coord.X = x;
+	v->coord.Y = y;
+	v->coord.Z = z;
+	v->coord.W = w;
 
 	gl_vertex_transform(v);
 
@@ -261,6 +242,31 @@ void glopVertex(GLParam* p) {
 
 	/* edge flag */
 	v->edge_flag = c->current_edge_flag;
+}
+
+void glopVertex(GLParam* p) {
+	GLVertex* v;
+	GLint n, i, cnt;
+	GLContext* c = gl_get_context();
+#if TGL_FEATURE_ERROR_CHECK == 1
+	if (c->in_begin == 0)
+#define ERROR_FLAG GL_INVALID_OPERATION
+#include "error_check.h"
+#else
+	
+#endif
+
+		n = c->vertex_n;
+	cnt = c->vertex_cnt;
+	cnt++;
+	c->vertex_cnt = cnt;
+
+	/* new vertex entry */
+	v = &c->vertex[n];
+	n++;
+
+	gl_vertex_setup(c, v, p[1].f, p[2].f, p[3].f, p[4].f);
+#include "error_check.h"
 
 	switch (c->begin_type) {
 	case GL_POINTS:
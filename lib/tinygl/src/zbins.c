@@ -0,0 +1,309 @@
+/*
+Binned, tile-parallel triangle fills.
+
+With glSetRasterThreads(n > 1), gl_draw_triangle_fill() no longer fills
+triangles as they arrive. Transform, lighting and clipping stay on the
+submitting thread; the screen-space triangle is queued and binned into
+full-width tiles of TGL_BIN_ROWS rows. When the queue fills up, or before
+anything else reads or writes the frame/z buffer, the tiles are filled by
+a pthread pool. Each tile is owned by exactly one thread for the whole
+batch, and fills its triangles in submission order with the unchanged
+ztriangle.h fills clipped to the tile rows, so the image is identical to
+direct rasterization.
+
+Only the untextured, unblended, unstippled fills are binned; anything else
+flushes the queue and draws directly.
+*/
+
+/* pthreads under -std=c99 */
+#define _POSIX_C_SOURCE 200112L
+
+#include "msghandling.h"
+#include "zgl.h"
+
+#if TGL_FEATURE_BINNED_RASTER == 1
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TGL_BIN_ROWS 32		 /* rows per screen tile */
+#define TGL_BIN_BATCH 4096	 /* triangles queued before the tiles are filled */
+
+enum { BIN_FILL_FLAT, BIN_FILL_SMOOTH, BIN_FILL_PHONG };
+
+typedef struct GLBinTriangle {
+	ZBufferPoint zp[3];
+	GLfloat normal[3][3]; /* Phong only */
+	GLint material;		  /* Phong only: index into GLRasterBins.materials */
+	GLubyte fill;
+	GLubyte depth_test;
+	GLubyte depth_write;
+} GLBinTriangle;
+
+typedef struct GLRasterBins {
+	ZBuffer* zb;
+	GLint nbins;
+
+	/* queued batch */
+	GLBinTriangle* tris;
+	GLint count;
+	GLMaterial* materials;
+	GLint material_count;
+	GLushort* bin_items; /* nbins lists of TGL_BIN_BATCH triangle indices */
+	GLint* bin_count;
+
+	/* pool: the flushing thread fills tiles too */
+	GLint nthreads;
+	pthread_t threads[TGL_MAX_RASTER_THREADS];
+	pthread_mutex_t lock;
+	pthread_cond_t work_cv;
+	pthread_cond_t done_cv;
+	GLuint generation;
+	GLint busy;
+	GLint next_bin;
+	GLint quit;
+} GLRasterBins;
+
+static void gl_bins_fill_tile(GLRasterBins* b, GLint bin) {
+	GLint i, n = b->bin_count[bin];
+	const GLushort* items = b->bin_items + (size_t)bin * TGL_BIN_BATCH;
+	ZBuffer zb = *b->zb; /* shares the buffers, clipped to this tile's rows */
+
+	zb.band_y0 = bin * TGL_BIN_ROWS;
+	zb.band_y1 = zb.band_y0 + TGL_BIN_ROWS;
+	if (zb.band_y1 > zb.ysize)
+		zb.band_y1 = zb.ysize;
+
+	for (i = 0; i < n; i++) {
+		const GLBinTriangle* t = &b->tris[items[i]];
+		ZBufferPoint p0 = t->zp[0], p1 = t->zp[1], p2 = t->zp[2];
+		zb.depth_test = t->depth_test;
+		zb.depth_write = t->depth_write;
+		switch (t->fill) {
+		case BIN_FILL_PHONG: {
+			GLfloat n0[3], n1[3], n2[3];
+			memcpy(n0, t->normal[0], sizeof(n0));
+			memcpy(n1, t->normal[1], sizeof(n1));
+			memcpy(n2, t->normal[2], sizeof(n2));
+			zb.shade_material = &b->materials[t->material];
+			ZB_fillTrianglePhong(&zb, &p0, &p1, &p2, n0, n1, n2);
+		} break;
+		case BIN_FILL_SMOOTH:
+			ZB_fillTriangleSmoothNOBLEND(&zb, &p0, &p1, &p2);
+			break;
+		default:
+			ZB_fillTriangleFlatNOBLEND(&zb, &p0, &p1, &p2);
+			break;
+		}
+	}
+}
+
+/* Claim and fill tiles until none are left in this batch */
+static void gl_bins_fill_claimed(GLRasterBins* b) {
+	for (;;) {
+		GLint bin;
+		pthread_mutex_lock(&b->lock);
+		bin = b->next_bin++;
+		pthread_mutex_unlock(&b->lock);
+		if (bin >= b->nbins)
+			return;
+		if (b->bin_count[bin] > 0)
+			gl_bins_fill_tile(b, bin);
+	}
+}
+
+static void* gl_bins_worker(void* arg) {
+	GLRasterBins* b = (GLRasterBins*)arg;
+	GLuint seen = 0;
+
+	pthread_mutex_lock(&b->lock);
+	for (;;) {
+		while (!b->quit && b->generation == seen)
+			pthread_cond_wait(&b->work_cv, &b->lock);
+		if (b->quit)
+			break;
+		seen = b->generation;
+		pthread_mutex_unlock(&b->lock);
+
+		gl_bins_fill_claimed(b);
+
+		pthread_mutex_lock(&b->lock);
+		if (--b->busy == 0)
+			pthread_cond_signal(&b->done_cv);
+	}
+	pthread_mutex_unlock(&b->lock);
+	return NULL;
+}
+
+void gl_bins_flush(GLContext* c) {
+	GLRasterBins* b = c->raster_bins;
+	if (b == NULL || b->count == 0)
+		return;
+
+	pthread_mutex_lock(&b->lock);
+	b->next_bin = 0;
+	b->busy = b->nthreads - 1;
+	b->generation++;
+	pthread_cond_broadcast(&b->work_cv);
+	pthread_mutex_unlock(&b->lock);
+
+	gl_bins_fill_claimed(b);
+
+	pthread_mutex_lock(&b->lock);
+	while (b->busy > 0)
+		pthread_cond_wait(&b->done_cv, &b->lock);
+	pthread_mutex_unlock(&b->lock);
+
+	memset(b->bin_count, 0, sizeof(GLint) * b->nbins);
+	b->count = 0;
+	b->material_count = 0;
+}
+
+/* Queue a screen-space triangle. Returns 0 if it must be drawn directly. */
+GLint gl_bins_add_triangle(GLContext* c, GLVertex* p0, GLVertex* p1, GLVertex* p2) {
+	GLRasterBins* b = c->raster_bins;
+	ZBuffer* zb = c->zb;
+	GLBinTriangle* t;
+	GLint fill, y_min, y_max, bin, last_bin;
+
+	/* ZB_resize() to a taller buffer leaves rows without a tile */
+	if (b == NULL || c->texture_2d_enabled || zb->enable_blend || zb != b->zb || zb->ysize > b->nbins * TGL_BIN_ROWS)
+		return 0;
+#if TGL_FEATURE_POLYGON_STIPPLE == 1
+	if (zb->dostipple)
+		return 0;
+#endif
+	if (c->current_shade_model == GL_PHONG) {
+#if TGL_FEATURE_SPECULAR_BUFFERS == 1
+		/* the specular buffer cache is updated while shading pixels */
+		if (c->zEnableSpecular)
+			return 0;
+#endif
+		fill = BIN_FILL_PHONG;
+	} else if (c->current_shade_model == GL_SMOOTH) {
+		fill = BIN_FILL_SMOOTH;
+	} else {
+		fill = BIN_FILL_FLAT;
+	}
+
+	y_min = p0->zp.y;
+	y_max = p0->zp.y;
+	if (p1->zp.y < y_min) y_min = p1->zp.y;
+	if (p1->zp.y > y_max) y_max = p1->zp.y;
+	if (p2->zp.y < y_min) y_min = p2->zp.y;
+	if (p2->zp.y > y_max) y_max = p2->zp.y;
+	if (y_min < 0)
+		y_min = 0;
+	if (y_max >= zb->ysize)
+		y_max = zb->ysize - 1;
+	if (y_min > y_max)
+		return 1; /* nothing on screen */
+
+	if (b->count == TGL_BIN_BATCH)
+		gl_bins_flush(c);
+
+	t = &b->tris[b->count];
+	t->zp[0] = p0->zp;
+	t->zp[1] = p1->zp;
+	t->zp[2] = p2->zp;
+	t->fill = (GLubyte)fill;
+	t->depth_test = (GLubyte)zb->depth_test;
+	t->depth_write = (GLubyte)zb->depth_write;
+	if (fill == BIN_FILL_PHONG) {
+		/* GL_COLOR_MATERIAL rewrites the material per vertex: keep the one in effect now */
+		if (b->material_count == 0 || memcmp(&b->materials[b->material_count - 1], &c->materials[0], sizeof(GLMaterial)) != 0)
+			b->materials[b->material_count++] = c->materials[0];
+		t->material = b->material_count - 1;
+		memcpy(t->normal[0], p0->normal.v, sizeof(t->normal[0]));
+		memcpy(t->normal[1], p1->normal.v, sizeof(t->normal[1]));
+		memcpy(t->normal[2], p2->normal.v, sizeof(t->normal[2]));
+	}
+
+	last_bin = y_max / TGL_BIN_ROWS;
+	for (bin = y_min / TGL_BIN_ROWS; bin <= last_bin; bin++)
+		b->bin_items[(size_t)bin * TGL_BIN_BATCH + b->bin_count[bin]++] = (GLushort)b->count;
+	b->count++;
+	return 1;
+}
+
+void gl_bins_free(GLContext* c) {
+	GLRasterBins* b = c->raster_bins;
+	GLint i;
+	if (b == NULL)
+		return;
+
+	gl_bins_flush(c);
+	pthread_mutex_lock(&b->lock);
+	b->quit = 1;
+	pthread_cond_broadcast(&b->work_cv);
+	pthread_mutex_unlock(&b->lock);
+	for (i = 0; i < b->nthreads - 1; i++)
+		pthread_join(b->threads[i], NULL);
+
+	pthread_mutex_destroy(&b->lock);
+	pthread_cond_destroy(&b->work_cv);
+	pthread_cond_destroy(&b->done_cv);
+	gl_free(b->tris);
+	gl_free(b->materials);
+	gl_free(b->bin_items);
+	gl_free(b->bin_count);
+	gl_free(b);
+	c->raster_bins = NULL;
+}
+
+static GLRasterBins* gl_bins_create(ZBuffer* zb, GLint threads) {
+	GLRasterBins* b = gl_zalloc(sizeof(GLRasterBins));
+	GLint i;
+	if (b == NULL)
+		return NULL;
+
+	b->zb = zb;
+	b->nbins = (zb->ysize + TGL_BIN_ROWS - 1) / TGL_BIN_ROWS;
+	b->tris = gl_malloc(sizeof(GLBinTriangle) * TGL_BIN_BATCH);
+	b->materials = gl_malloc(sizeof(GLMaterial) * TGL_BIN_BATCH);
+	b->bin_items = gl_malloc(sizeof(GLushort) * TGL_BIN_BATCH * b->nbins);
+	b->bin_count = gl_zalloc(sizeof(GLint) * b->nbins);
+	if (b->tris == NULL || b->materials == NULL || b->bin_items == NULL || b->bin_count == NULL) {
+		gl_free(b->tris);
+		gl_free(b->materials);
+		gl_free(b->bin_items);
+		gl_free(b->bin_count);
+		gl_free(b);
+		return NULL;
+	}
+
+	pthread_mutex_init(&b->lock, NULL);
+	pthread_cond_init(&b->work_cv, NULL);
+	pthread_cond_init(&b->done_cv, NULL);
+	b->nthreads = 1;
+	for (i = 0; i < threads - 1; i++) {
+		if (pthread_create(&b->threads[i], NULL, gl_bins_worker, b) != 0)
+			break;
+		b->nthreads++;
+	}
+	return b;
+}
+
+#endif /* TGL_FEATURE_BINNED_RASTER */
+
+/* 0 or 1 fills triangles directly on the calling thread. */
+void glSetRasterThreads(GLint threads) {
+	GLContext* c = gl_get_context();
+#include "error_check.h"
+#if TGL_FEATURE_BINNED_RASTER == 1
+	if (threads > TGL_MAX_RASTER_THREADS)
+		threads = TGL_MAX_RASTER_THREADS;
+	if (c->raster_bins != NULL && c->raster_bins->nthreads == threads && c->raster_bins->zb == c->zb &&
+		c->raster_bins->nbins * TGL_BIN_ROWS >= c->zb->ysize)
+		return;
+	gl_bins_free(c);
+	if (threads > 1) {
+		c->raster_bins = gl_bins_create(c->zb, threads);
+		if (c->raster_bins == NULL)
+			tgl_warning("glSetRasterThreads: out of memory, rasterizing directly\n");
+	}
+#else
+	(void)threads;
+#endif
+}
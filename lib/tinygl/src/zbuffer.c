@@ -57,6 +57,9 @@ ZBuffer* ZB_open(GLint xsize, GLint ysize, GLint mode,
 	}
 
 	zb->current_texture = NULL;
+	zb->band_y0 = 0;
+	zb->band_y1 = zb->ysize;
+	zb->shade_material = NULL;
 
 	return zb;
 error:
@@ -82,6 +85,8 @@ void ZB_resize(ZBuffer* zb, void* frame_buffer, GLint xsize, GLint ysize) {
 	zb->xsize = xsize;
 	zb->ysize = ysize;
 	zb->linesize = (xsize * PSZB);
+	zb->band_y0 = 0;
+	zb->band_y1 = ysize;
 
 	size = zb->xsize * zb->ysize * sizeof(GLushort);
 
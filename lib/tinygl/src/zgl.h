@@ -294,6 +294,7 @@ typedef struct GLContext {
 	GLint normal_array_stride;
 	GLint color_array_size;
 	GLint color_array_stride;
+	GLint color_array_type; /* GL_FLOAT or GL_UNSIGNED_BYTE */
 
 	GLint texcoord_array_size;
 	GLint texcoord_array_stride;
@@ -332,6 +333,8 @@ typedef struct GLContext {
 #if TGL_FEATURE_ERROR_CHECK == 1
 	GLenum error_flag;
 #endif
+	/* binned triangle fills, NULL when rasterizing directly (zbins.c) */
+	struct GLRasterBins* raster_bins;
 } GLContext;
 
 extern GLContext gl_ctx;
@@ -361,6 +364,21 @@ static void gl_add_op(GLParam* p) {
 	}
 }
 
+/* zbins.c */
+#if TGL_FEATURE_BINNED_RASTER == 1
+GLint gl_bins_add_triangle(GLContext* c, GLVertex* p0, GLVertex* p1, GLVertex* p2);
+void gl_bins_flush(GLContext* c);
+void gl_bins_free(GLContext* c);
+/* Finish queued fills before anything else touches the frame or z buffer */
+#define TGL_FLUSH_BINS(c)                                                                                                                                      \
+	do {                                                                                                                                                       \
+		if ((c)->raster_bins != NULL)                                                                                                                          \
+			gl_bins_flush(c);                                                                                                                                  \
+	} while (0)
+#else
+#define TGL_FLUSH_BINS(c) ((void)0)
+#endif
+
 /* select.c */
 void gl_add_select(GLuint zmin, GLuint zmax);
 void gl_add_feedback(GLfloat token, GLVertex* v1, GLVertex* v2, GLVertex* v3, GLfloat passthrough_token_value);
@@ -409,6 +427,7 @@ static GLfloat clampf(GLfloat a, GLfloat min, GLfloat max) {
 
 
 void gl_draw_triangle(GLVertex* p0, GLVertex* p1, GLVertex* p2);
+void gl_vertex_setup(GLContext* c, GLVertex* v, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
 void gl_draw_line(GLVertex* p0, GLVertex* p1);
 void gl_draw_point(GLVertex* p0);
 
@@ -426,7 +445,7 @@ void glopTranslate(GLParam *p);*/
 /* light.c */
 void gl_enable_disable_light(GLint light, GLint v);
 void gl_shade_vertex(GLVertex* v);
-void gl_shade_pixel(GLfloat* R_out, GLfloat* G_out, GLfloat* B_out, V3* normal);
+void gl_shade_pixel(GLfloat* R_out, GLfloat* G_out, GLfloat* B_out, V3* normal, const void* material);
 
 void glInitTextures(void);
 void glEndTextures(void);
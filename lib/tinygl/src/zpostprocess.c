@@ -5,6 +5,7 @@
 void glPostProcess(GLuint (*postprocess)(GLint x, GLint y, GLuint pixel, GLushort z)) {
 	GLint i, j;
 	GLContext* c = gl_get_context();
+	TGL_FLUSH_BINS(c);
 #ifdef _OPENMP
 #pragma omp parallel for collapse(2)
 #endif
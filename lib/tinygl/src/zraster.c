@@ -110,6 +110,7 @@ void glopDrawPixels(GLParam* p) {
 	PIXEL* d = p[3].p;
 	PIXEL* pbuf = zb->pbuf;
 	GLushort* zbuf = zb->zbuf;
+	TGL_FLUSH_BINS(c);
 
 	GLubyte zbdw = zb->depth_write;
 	GLubyte zbdt = zb->depth_test;
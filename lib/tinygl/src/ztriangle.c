@@ -5,7 +5,7 @@
 
 /* Phong shading support */
 #include "zmath.h"  /* For V3 type and gl_V3_Norm_Fast */
-extern void gl_shade_pixel(GLfloat* R_out, GLfloat* G_out, GLfloat* B_out, V3* normal);
+extern void gl_shade_pixel(GLfloat* R_out, GLfloat* G_out, GLfloat* B_out, V3* normal, const void* material);
 
 
 
@@ -275,6 +275,7 @@ void ZB_fillTrianglePhong(ZBuffer* zb, ZBufferPoint* p0, ZBufferPoint* p1, ZBuff
                           GLfloat* n0, GLfloat* n1, GLfloat* n2) {
 	GLubyte zbdw = zb->depth_write;
 	GLubyte zbdt = zb->depth_test;
+	const void* zbmat = zb->shade_material;
 	TGL_BLEND_VARS
 	TGL_STIPPLEVARS
 
@@ -305,7 +306,7 @@ void ZB_fillTrianglePhong(ZBuffer* zb, ZBufferPoint* p0, ZBufferPoint* p1, ZBuff
 			                                                                                                                                                   \
 			/* Calculate per-pixel lighting */                                                                                                                \
 			GLfloat R, G, B;                                                                                                                                   \
-			gl_shade_pixel(&R, &G, &B, &normal);                                                                                                               \
+			gl_shade_pixel(&R, &G, &B, &normal, zbmat);                                                                                                        \
 			                                                                                                                                                   \
 			/* Convert to integer color */                                                                                                                    \
 			GLint or1 = (GLint)(R * (GLfloat)COLOR_MULT_MASK);                                                                                                \
@@ -340,7 +341,7 @@ void ZB_fillTrianglePhong(ZBuffer* zb, ZBufferPoint* p0, ZBufferPoint* p1, ZBuff
 			                                                                                                                                                   \
 			/* Calculate per-pixel lighting */                                                                                                                \
 			GLfloat R, G, B;                                                                                                                                   \
-			gl_shade_pixel(&R, &G, &B, &normal);                                                                                                               \
+			gl_shade_pixel(&R, &G, &B, &normal, zbmat);                                                                                                        \
 			                                                                                                                                                   \
 			/* Convert to integer color */                                                                                                                    \
 			GLint or1 = (GLint)(R * (GLfloat)COLOR_MULT_MASK);                                                                                                \
@@ -75,6 +75,12 @@ Things to keep in mind:
 		p2 = t;
 	}
 
+	/* rows outside the band belong to another raster tile */
+	GLint band_y0 = zb->band_y0;
+	GLint band_y1 = zb->band_y1;
+	if (p2->y < band_y0 || p0->y >= band_y1)
+		return;
+
 	/* we compute dXdx and dXdy for all GLinterpolated values */
 	fdx1 = p1->x - p0->x; 
 	fdy1 = p1->y - p0->y; 
@@ -335,8 +341,9 @@ Things to keep in mind:
 		}						   /*End of lifetime for ZBufferpoints*/
 		/* we draw all the scan line of the part */
 
-		while (nb_lines > 0) {
+		while (nb_lines > 0 && dither_y < band_y1) {
 			nb_lines--;
+			if (dither_y >= band_y0)
 #ifndef DRAW_LINE
 			/* generic draw line */
 			{
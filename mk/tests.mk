@@ -654,7 +654,7 @@ test-tinygl-triangle: $(TEST_TINYGL_TRIANGLE_BIN)
 $(TEST_TINYGL_TRIANGLE_BIN): $(TEST_TINYGL_TRIANGLE_OBJ) $(TINYGL_LIB)
 	$(Q)mkdir -p $(BIN_DIR)
 	$(ECHO) "$(MAGENTA)[LD]$(RESET) test_tinygl_triangle"
-	$(Q)$(CXX) $(CXXFLAGS) $< -o $@ $(TINYGL_LIB) -lm
+	$(Q)$(CXX) $(CXXFLAGS) $< -o $@ $(TINYGL_LIB) -lm -lpthread
 	$(ECHO) "$(GREEN)✓ TinyGL triangle test binary ready$(RESET)"
 
 $(TEST_TINYGL_TRIANGLE_OBJ): $(SRC_DIR)/test_tinygl_triangle.cpp $(TINYGL_LIB)
@@ -4,15 +4,19 @@
 #include "ui_error_reporting.h"
 #include "ui_notification.h"
 
+#include "hv/HttpClient.h"
 #include "hv/hfile.h"
 #include "hv/hurl.h"
 #include "hv/requests.h"
 #include "memory_monitor.h"
 #include "moonraker_api.h"
 #include "moonraker_api_internal.h"
+#include "moonraker_stream_decoder.h"
 #include "spdlog/spdlog.h"
 
 #include <chrono>
+#include <cstdio>
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
@@ -20,6 +24,30 @@
 
 using namespace moonraker_internal;
 
+namespace {
+
+/**
+ * @brief Stream decoder for server.files.list / get_directory responses
+ *
+ * Large libraries build FileInfo entries straight from the message; same
+ * result as parse_file_list() without the json DOM.
+ */
+MoonrakerClient::StreamDecoder
+stream_decode_file_list(const MoonrakerAPI::FileListCallback& on_success) {
+    return [on_success](const std::string& message) -> std::function<void()> {
+        auto decoder = std::make_shared<helix::FileListDecoder>();
+        if (!decoder->decode(message)) {
+            return nullptr;
+        }
+        return [on_success, decoder]() {
+            spdlog::trace("[Moonraker API] Stream-decoded {} file entries", decoder->files.size());
+            on_success(decoder->files);
+        };
+    };
+}
+
+} // namespace
+
 // ============================================================================
 // File Management Operations
 // ============================================================================
@@ -46,7 +74,7 @@ void MoonrakerAPI::list_files(const std::string& root, const std::string& path,
 
     spdlog::debug("[Moonraker API] Listing files in {}/{}", root, path);
 
-    client_.send_jsonrpc(
+    RequestId id = client_.send_jsonrpc(
         "server.files.list", params,
         [this, on_success](json response) {
             try {
@@ -59,6 +87,7 @@ void MoonrakerAPI::list_files(const std::string& root, const std::string& path,
             }
         },
         on_error);
+    client_.set_stream_decoder(id, stream_decode_file_list(on_success));
 }
 
 void MoonrakerAPI::get_directory(const std::string& root, const std::string& path,
@@ -81,7 +110,7 @@ void MoonrakerAPI::get_directory(const std::string& root, const std::string& pat
 
     spdlog::debug("[Moonraker API] Getting directory contents: {}", full_path);
 
-    client_.send_jsonrpc(
+    RequestId id = client_.send_jsonrpc(
         "server.files.get_directory", params,
         [this, on_success](json response) {
             try {
@@ -94,6 +123,7 @@ void MoonrakerAPI::get_directory(const std::string& root, const std::string& pat
             }
         },
         on_error);
+    client_.set_stream_decoder(id, stream_decode_file_list(on_success));
 }
 
 void MoonrakerAPI::get_file_metadata(const std::string& filename, FileMetadataCallback on_success,
@@ -604,6 +634,157 @@ void MoonrakerAPI::upload_file_from_path(const std::string& root, const std::str
         });
 }
 
+void MoonrakerAPI::transform_file(const std::string& root, const std::string& src_path,
+                                  const std::string& dest_path, ChunkTransform transform,
+                                  SuccessCallback on_success, ErrorCallback on_error,
+                                  ProgressCallback on_progress) {
+    // Validate inputs
+    if (reject_invalid_path(src_path, "transform_file", on_error) ||
+        reject_invalid_path(dest_path, "transform_file", on_error))
+        return;
+
+    if (http_base_url_.empty()) {
+        spdlog::error(
+            "[Moonraker API] HTTP base URL not configured - call set_http_base_url first");
+        report_connection_error(on_error, "transform_file", "HTTP base URL not configured");
+        return;
+    }
+
+    std::string download_url =
+        http_base_url_ + "/server/files/" + root + "/" + HUrl::escape(src_path, "/.-_");
+    std::string upload_url = http_base_url_ + "/server/files/upload";
+
+    // Split dest_path into Moonraker's "path" form field and the file name
+    std::string filename = dest_path;
+    std::string directory;
+    size_t last_slash = dest_path.rfind('/');
+    if (last_slash != std::string::npos) {
+        filename = dest_path.substr(last_slash + 1);
+        directory = dest_path.substr(0, last_slash);
+    }
+
+    spdlog::info("[Moonraker API] Piped transform {}/{} -> {}/{}", root, src_path, root,
+                 dest_path);
+
+    launch_http_thread([download_url, upload_url, root, src_path, directory, filename, transform,
+                        on_success, on_error, on_progress]() {
+        // Upload side: multipart body sent with chunked transfer encoding, since the
+        // transformed size is only known at the end
+        const std::string boundary =
+            "----HelixScreenBoundary" +
+            std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+
+        auto upload_req = std::make_shared<HttpRequest>();
+        upload_req->method = HTTP_POST;
+        upload_req->url = upload_url;
+        upload_req->timeout = 3600;
+        upload_req->SetHeader("Content-Type", "multipart/form-data; boundary=" + boundary);
+        upload_req->SetHeader("Transfer-Encoding", "chunked");
+        upload_req->ParseUrl();
+
+        hv::HttpClient upload_client;
+        if (upload_client.connect(upload_req->host.c_str(), upload_req->port,
+                                  upload_req->IsHttps(), upload_req->connect_timeout) < 0 ||
+            upload_client.sendHeader(upload_req.get()) != 0) {
+            report_connection_error(on_error, "transform_file", "Failed to connect for upload");
+            return;
+        }
+
+        size_t bytes_uploaded = 0;
+        ChunkSink send_chunk = [&upload_client, &bytes_uploaded](const char* data, size_t size) {
+            if (size == 0) {
+                return true;
+            }
+            char head[24];
+            int head_len = std::snprintf(head, sizeof(head), "%zx\r\n", size);
+            bool ok = upload_client.sendData(head, head_len) == head_len &&
+                      upload_client.sendData(data, static_cast<int>(size)) ==
+                          static_cast<int>(size) &&
+                      upload_client.sendData("\r\n", 2) == 2;
+            bytes_uploaded += ok ? size : 0;
+            return ok;
+        };
+
+        std::string form = "--" + boundary +
+                           "\r\nContent-Disposition: form-data; name=\"root\"\r\n\r\n" + root +
+                           "\r\n";
+        if (!directory.empty()) {
+            form += "--" + boundary +
+                    "\r\nContent-Disposition: form-data; name=\"path\"\r\n\r\n" + directory +
+                    "\r\n";
+        }
+        form += "--" + boundary + "\r\nContent-Disposition: form-data; name=\"file\"; filename=\"" +
+                filename + "\"\r\nContent-Type: application/octet-stream\r\n\r\n";
+        bool upload_ok = send_chunk(form.data(), form.size());
+
+        // Download side: every body chunk goes through the transform into the upload
+        int download_status = 0;
+        size_t download_total = 0;
+        size_t download_received = 0;
+        bool transform_ok = true;
+        auto download_req = std::make_shared<HttpRequest>();
+        download_req->method = HTTP_GET;
+        download_req->url = download_url;
+        download_req->timeout = 3600;
+        download_req->http_cb = [&](HttpMessage* msg, http_parser_state state, const char* data,
+                                    size_t size) {
+            if (state == HP_HEADERS_COMPLETE) {
+                download_status = static_cast<HttpResponse*>(msg)->status_code;
+                download_total =
+                    static_cast<size_t>(std::atoll(msg->GetHeader("Content-Length").c_str()));
+            } else if (state == HP_BODY && data && size > 0) {
+                // Keep draining after a failure; there is no way to cancel mid-body
+                if (download_status != 200 || !upload_ok || !transform_ok) {
+                    return;
+                }
+                download_received += size;
+                transform_ok = transform(data, size, send_chunk);
+                upload_ok = upload_ok && transform_ok;
+                if (on_progress) {
+                    on_progress(download_received, download_total);
+                }
+            }
+        };
+        auto download_resp = requests::request(download_req);
+
+        if (!download_resp || download_status != 200) {
+            spdlog::error("[Moonraker API] Piped transform: download of {} failed (status {})",
+                          src_path, download_status);
+            handle_http_response(download_resp, "transform_file", on_error);
+            return;
+        }
+        if (!transform_ok || !transform(nullptr, 0, send_chunk)) {
+            report_error(on_error, MoonrakerErrorType::UNKNOWN, "transform_file",
+                         "Transform failed for " + src_path);
+            return;
+        }
+
+        std::string trailer = "\r\n--" + boundary + "--\r\n";
+        upload_ok = upload_ok && send_chunk(trailer.data(), trailer.size()) &&
+                    upload_client.sendData("0\r\n\r\n", 5) == 5;
+        if (!upload_ok) {
+            report_connection_error(on_error, "transform_file", "Upload connection lost");
+            return;
+        }
+
+        auto upload_resp = std::make_shared<HttpResponse>();
+        if (upload_client.recvResponse(upload_resp.get()) != 0) {
+            upload_resp.reset();
+        }
+        if (!handle_http_response(upload_resp, "transform_file", on_error, {200, 201})) {
+            return;
+        }
+
+        spdlog::info("[Moonraker API] Piped transform complete: {} -> {} ({} -> {} bytes)",
+                     src_path, filename, download_received, bytes_uploaded);
+        helix::MemoryMonitor::log_now("moonraker_transform_complete");
+
+        if (on_success) {
+            on_success();
+        }
+    });
+}
+
 // ============================================================================
 // Private Helper Methods
 // ============================================================================
@@ -9,6 +9,7 @@
 #include "hv/requests.h"
 #include "moonraker_api.h"
 #include "moonraker_api_internal.h"
+#include "moonraker_stream_decoder.h"
 #include "settings_manager.h"
 #include "spdlog/spdlog.h"
 
@@ -76,6 +77,15 @@ std::string format_history_filament(double mm) {
     return std::string(buf);
 }
 
+/**
+ * @brief Fill in the pre-formatted display strings of a parsed job
+ */
+void format_history_job(PrintHistoryJob& job) {
+    job.duration_str = format_history_duration(job.print_duration);
+    job.date_str = format_history_date(job.start_time);
+    job.filament_str = format_history_filament(job.filament_used);
+}
+
 /**
  * @brief Parse a single job from Moonraker history response
  */
@@ -118,11 +128,7 @@ PrintHistoryJob parse_history_job(const json& job_json) {
         job.size_bytes = json_number_or(meta, "size", static_cast<size_t>(0));
     }
 
-    // Pre-format display strings
-    job.duration_str = format_history_duration(job.print_duration);
-    job.date_str = format_history_date(job.start_time);
-    job.filament_str = format_history_filament(job.filament_used);
-
+    format_history_job(job);
     return job;
 }
 
@@ -145,7 +151,7 @@ void MoonrakerAPI::get_history_list(int limit, int start, double since, double b
     spdlog::debug("[Moonraker API] get_history_list(limit={}, start={}, since={}, before={})",
                   limit, start, since, before);
 
-    client_.send_jsonrpc(
+    RequestId id = client_.send_jsonrpc(
         "server.history.list", params,
         [on_success](json response) {
             std::vector<PrintHistoryJob> jobs;
@@ -173,6 +179,26 @@ void MoonrakerAPI::get_history_list(int limit, int start, double since, double b
             }
         },
         on_error);
+
+    // A few hundred jobs run to megabytes; build the jobs without the json DOM
+    client_.set_stream_decoder(
+        id, [on_success](const std::string& message) -> std::function<void()> {
+            auto decoder = std::make_shared<helix::HistoryListDecoder>();
+            if (!decoder->decode(message)) {
+                return nullptr;
+            }
+            return [on_success, decoder]() {
+                for (auto& job : decoder->jobs) {
+                    format_history_job(job);
+                }
+                spdlog::debug("[Moonraker API] get_history_list returned {} jobs (total: {}, "
+                              "stream-decoded)",
+                              decoder->jobs.size(), decoder->total_count);
+                if (on_success) {
+                    on_success(decoder->jobs, decoder->total_count);
+                }
+            };
+        });
 }
 
 void MoonrakerAPI::get_history_totals(HistoryTotalsCallback on_success, ErrorCallback on_error) {
@@ -264,6 +264,79 @@ void MoonrakerAPIMock::upload_file_with_name(const std::string& root, const std:
     }
 }
 
+void MoonrakerAPIMock::transform_file(const std::string& root, const std::string& src_path,
+                                      const std::string& dest_path, ChunkTransform transform,
+                                      SuccessCallback on_success, ErrorCallback on_error,
+                                      ProgressCallback on_progress) {
+    // Strip any leading directory components to get just the filename
+    std::string filename = src_path;
+    size_t last_slash = src_path.rfind('/');
+    if (last_slash != std::string::npos) {
+        filename = src_path.substr(last_slash + 1);
+    }
+
+    spdlog::debug("[MoonrakerAPIMock] transform_file: root='{}', src='{}' -> dest='{}'", root,
+                  src_path, dest_path);
+
+    std::string local_path = find_test_file(filename);
+    std::ifstream src(local_path, std::ios::binary);
+    if (local_path.empty() || !src) {
+        spdlog::warn("[MoonrakerAPIMock] File not found in test directories: {}", filename);
+        if (on_error) {
+            MoonrakerError err;
+            err.type = MoonrakerErrorType::FILE_NOT_FOUND;
+            err.message = "Mock file not found: " + filename;
+            err.method = "transform_file";
+            on_error(err);
+        }
+        return;
+    }
+
+    std::error_code ec;
+    size_t total = static_cast<size_t>(std::filesystem::file_size(local_path, ec));
+    last_transform_output_.clear();
+    ChunkSink sink = [this](const char* data, size_t size) {
+        last_transform_output_.append(data, size);
+        return true;
+    };
+
+    // Small odd-sized chunks so line splitting across chunk boundaries gets exercised
+    constexpr size_t MOCK_CHUNK_SIZE = 4093;
+    char buffer[MOCK_CHUNK_SIZE];
+    size_t received = 0;
+    bool ok = true;
+    while (ok && src) {
+        src.read(buffer, MOCK_CHUNK_SIZE);
+        auto count = static_cast<size_t>(src.gcount());
+        if (count > 0) {
+            received += count;
+            ok = transform(buffer, count, sink);
+            if (on_progress) {
+                on_progress(received, total);
+            }
+        }
+    }
+    ok = ok && transform(nullptr, 0, sink);
+
+    if (!ok) {
+        if (on_error) {
+            MoonrakerError err;
+            err.type = MoonrakerErrorType::UNKNOWN;
+            err.message = "Transform failed for " + filename;
+            err.method = "transform_file";
+            on_error(err);
+        }
+        return;
+    }
+
+    spdlog::info("[MoonrakerAPIMock] Mock transform_file: {} ({} bytes) -> {} ({} bytes)",
+                 filename, received, dest_path, last_transform_output_.size());
+
+    if (on_success) {
+        on_success();
+    }
+}
+
 void MoonrakerAPIMock::download_thumbnail(const std::string& thumbnail_path,
                                           const std::string& cache_path, StringCallback on_success,
                                           ErrorCallback on_error) {
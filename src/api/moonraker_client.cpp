@@ -19,6 +19,7 @@
 #include "abort_manager.h"
 #include "app_globals.h"
 #include "helix_version.h"
+#include "moonraker_stream_decoder.h"
 #include "printer_state.h"
 
 #include <algorithm> // For std::sort in MCU query handling
@@ -66,6 +67,34 @@ std::string annotate_gcode(const std::string& gcode) {
 
     return result;
 }
+
+// Approximate serialized size of a JSON value, for the fan-out counters.
+// Walks the tree without allocating (dump() would cost more than the copy it measures).
+size_t estimate_json_bytes(const json& value) {
+    switch (value.type()) {
+    case json::value_t::object: {
+        size_t bytes = 2;
+        for (auto it = value.begin(); it != value.end(); ++it) {
+            bytes += it.key().size() + 4 + estimate_json_bytes(it.value());
+        }
+        return bytes;
+    }
+    case json::value_t::array: {
+        size_t bytes = 2;
+        for (const auto& item : value) {
+            bytes += estimate_json_bytes(item) + 1;
+        }
+        return bytes;
+    }
+    case json::value_t::string:
+        return value.get_ref<const std::string&>().size() + 2;
+    case json::value_t::null:
+    case json::value_t::boolean:
+        return 5;
+    default:
+        return 8; // Numbers
+    }
+}
 } // namespace
 
 MoonrakerClient::MoonrakerClient(EventLoopPtr loop)
@@ -369,14 +398,16 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
                 return;
             }
 
-            // Check for timed out requests on each message (opportunistic cleanup)
-            check_request_timeouts();
-
             // DEBUG: Log large messages to help diagnose history issue
             if (msg.size() > 50000) {
                 spdlog::debug("[Moonraker Client] Received large message: {} bytes", msg.size());
             }
 
+            // Large responses with a typed decoder never become a json DOM
+            if (msg.size() >= STREAM_DECODE_MIN_BYTES && try_stream_decode(msg)) {
+                return;
+            }
+
             // Parse JSON message
             json j;
             try {
@@ -459,7 +490,13 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
                     }
                 } else if (success_cb) {
                     try {
-                        success_cb(j);
+                        // Responses carry no "method", so the branch below never reads j;
+                        // hand the DOM over instead of copying it into the by-value parameter
+                        if (j.contains("method")) {
+                            success_cb(j);
+                        } else {
+                            success_cb(std::move(j));
+                        }
                     } catch (const std::exception& e) {
                         LOG_ERROR_INTERNAL(
                             "[Moonraker Client] Success callback for '{}' threw exception: {}",
@@ -483,30 +520,6 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
 
                 std::string method = j["method"].get<std::string>();
 
-                // Copy callbacks to invoke (to avoid holding lock during callback execution)
-                std::vector<std::function<void(json)>> callbacks_to_invoke;
-
-                {
-                    std::lock_guard<std::mutex> lock(callbacks_mutex_);
-
-                    // Printer status updates (most common)
-                    if (method == "notify_status_update" || method == "notify_filelist_changed") {
-                        // Copy all notify callbacks from map
-                        callbacks_to_invoke.reserve(notify_callbacks_.size());
-                        for (const auto& [id, cb] : notify_callbacks_) {
-                            callbacks_to_invoke.push_back(cb);
-                        }
-                    }
-
-                    // Method-specific persistent callbacks
-                    auto method_it = method_callbacks_.find(method);
-                    if (method_it != method_callbacks_.end()) {
-                        for (auto& [handler_name, cb] : method_it->second) {
-                            callbacks_to_invoke.push_back(cb);
-                        }
-                    }
-                } // Release lock
-
                 // Parse bed mesh updates before invoking user callbacks
                 if (method == "notify_status_update" && j.contains("params") &&
                     j["params"].is_array() && !j["params"].empty()) {
@@ -516,18 +529,9 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
                     }
                 }
 
-                // Invoke callbacks outside lock to prevent deadlock
-                for (auto& cb : callbacks_to_invoke) {
-                    try {
-                        cb(j);
-                    } catch (const std::exception& e) {
-                        LOG_ERROR_INTERNAL("[Moonraker Client] Callback for {} threw exception: {}",
-                                           method, e.what());
-                    } catch (...) {
-                        LOG_ERROR_INTERNAL(
-                            "[Moonraker Client] Callback for {} threw unknown exception", method);
-                    }
-                }
+                // Parsed once, shared by every subscriber (j is not used past this point)
+                dispatch_notification(method, std::make_shared<const json>(std::move(j)),
+                                      msg.size());
 
                 // Klippy disconnected from Moonraker
                 if (method == "notify_klippy_disconnected") {
@@ -694,16 +698,26 @@ int MoonrakerClient::connect(const char* url, std::function<void()> on_connected
     return open(url, headers);
 }
 
-SubscriptionId MoonrakerClient::register_notify_update(std::function<void(json)> cb) {
+SubscriptionId MoonrakerClient::register_notify_update(NotificationCallback cb) {
     if (!cb) {
         spdlog::warn("[Moonraker Client] register_notify_update called with null callback");
         return INVALID_SUBSCRIPTION_ID;
     }
 
+    return register_notify_message(
+        [cb = std::move(cb)](const JsonMessage& message) { cb(*message); });
+}
+
+SubscriptionId MoonrakerClient::register_notify_message(NotificationMessageCallback cb) {
+    if (!cb) {
+        spdlog::warn("[Moonraker Client] register_notify_message called with null callback");
+        return INVALID_SUBSCRIPTION_ID;
+    }
+
     SubscriptionId id = next_subscription_id_.fetch_add(1);
     {
         std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        notify_callbacks_.emplace(id, cb);
+        notify_callbacks_.emplace(id, std::move(cb));
     }
     spdlog::trace("[Moonraker Client] Registered notify callback with ID {}", id);
     return id;
@@ -770,6 +784,12 @@ void MoonrakerClient::emit_event(MoonrakerEventType type, const std::string& mes
 }
 
 void MoonrakerClient::dispatch_status_update(const json& status) {
+    // Copying the borrowed status is the one deep copy on this path; callers that
+    // build the status themselves should move it into the rvalue overload.
+    dispatch_status_update(json(status));
+}
+
+void MoonrakerClient::dispatch_status_update(json&& status) {
     // Parse bed mesh data before dispatching (mirrors WebSocket handler behavior)
     // This ensures bed mesh is populated on initial subscription response,
     // not just on subsequent notify_status_update messages
@@ -791,42 +811,101 @@ void MoonrakerClient::dispatch_status_update(const json& status) {
     }
 
     // Wrap raw status into notify_status_update format
-    json notification = {
-        {"method", "notify_status_update"},
-        {"params", json::array({status, 0.0})} // [status, eventtime]
-    };
+    const bool has_print_stats = status.contains("print_stats");
+    auto notification = std::make_shared<json>(json::object());
+    json params = json::array();
+    params.push_back(std::move(status)); // [status, eventtime]
+    params.push_back(0.0);
+    (*notification)["method"] = "notify_status_update";
+    (*notification)["params"] = std::move(params);
+
+    dispatch_notification("notify_status_update", std::move(notification));
+
+    spdlog::trace("[Moonraker Client] Dispatched status update (has print_stats: {})",
+                  has_print_stats);
+}
 
-    // Dispatch to all registered callbacks
-    // Two-phase: copy under lock, invoke outside to avoid deadlock
-    std::vector<std::function<void(json)>> callbacks_copy;
+void MoonrakerClient::dispatch_notification(const std::string& method,
+                                            const JsonMessage& message, size_t wire_bytes) {
+    // Two-phase: copy callbacks under lock, invoke outside to avoid deadlock
+    std::vector<NotificationMessageCallback> notify_to_invoke;
+    std::vector<NotificationCallback> method_to_invoke;
     {
         std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        callbacks_copy.reserve(notify_callbacks_.size());
-        for (const auto& [id, cb] : notify_callbacks_) {
-            callbacks_copy.push_back(cb);
+
+        // Printer status updates (most common)
+        if (method == "notify_status_update" || method == "notify_filelist_changed") {
+            notify_to_invoke.reserve(notify_callbacks_.size());
+            for (const auto& [id, cb] : notify_callbacks_) {
+                notify_to_invoke.push_back(cb);
+            }
+        }
+
+        // Method-specific persistent callbacks
+        auto method_it = method_callbacks_.find(method);
+        if (method_it != method_callbacks_.end()) {
+            for (const auto& [handler_name, cb] : method_it->second) {
+                method_to_invoke.push_back(cb);
+            }
         }
     }
 
-    for (const auto& cb : callbacks_copy) {
-        if (cb) {
-            cb(notification);
+    notify_messages_.fetch_add(1, std::memory_order_relaxed);
+    notify_deliveries_.fetch_add(notify_to_invoke.size() + method_to_invoke.size(),
+                                 std::memory_order_relaxed);
+    notify_payload_bytes_.fetch_add(wire_bytes > 0 ? wire_bytes : estimate_json_bytes(*message),
+                                    std::memory_order_relaxed);
+
+    auto invoke = [&method](const auto& cb, const auto& arg) {
+        if (!cb) {
+            return;
         }
+        try {
+            cb(arg);
+        } catch (const std::exception& e) {
+            LOG_ERROR_INTERNAL("[Moonraker Client] Callback for {} threw exception: {}", method,
+                               e.what());
+        } catch (...) {
+            LOG_ERROR_INTERNAL("[Moonraker Client] Callback for {} threw unknown exception",
+                               method);
+        }
+    };
+    for (const auto& cb : notify_to_invoke) {
+        invoke(cb, message);
     }
+    for (const auto& cb : method_to_invoke) {
+        invoke(cb, *message);
+    }
+}
+
+NotificationStats MoonrakerClient::get_notification_stats() const {
+    NotificationStats stats;
+    stats.messages = notify_messages_.load(std::memory_order_relaxed);
+    stats.deliveries = notify_deliveries_.load(std::memory_order_relaxed);
+    stats.payload_bytes = notify_payload_bytes_.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::time_point(
+        std::chrono::steady_clock::duration(notify_stats_start_ns_.load()));
+    stats.elapsed_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
 
-    spdlog::trace(
-        "[Moonraker Client] Dispatched status update to {} callbacks (has print_stats: {})",
-        callbacks_copy.size(), status.contains("print_stats"));
+void MoonrakerClient::reset_notification_stats() {
+    notify_messages_.store(0);
+    notify_deliveries_.store(0);
+    notify_payload_bytes_.store(0);
+    notify_stats_start_ns_.store(std::chrono::steady_clock::now().time_since_epoch().count());
 }
 
 void MoonrakerClient::register_method_callback(const std::string& method,
                                                const std::string& handler_name,
-                                               std::function<void(json)> cb) {
+                                               NotificationCallback cb) {
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
     auto it = method_callbacks_.find(method);
     if (it == method_callbacks_.end()) {
         spdlog::debug("[Moonraker Client] Registering new method callback: {} (handler: {})",
                       method, handler_name);
-        std::map<std::string, std::function<void(json)>> handlers;
+        std::map<std::string, NotificationCallback> handlers;
         handlers.insert({handler_name, cb});
         method_callbacks_.insert({method, handlers});
     } else {
@@ -920,13 +999,11 @@ RequestId MoonrakerClient::send_jsonrpc(const std::string& method, const json& p
     // Register request
     {
         std::lock_guard<std::mutex> lock(requests_mutex_);
-        auto it = pending_requests_.find(id);
-        if (it != pending_requests_.end()) {
+        if (!pending_requests_.insert(std::move(request))) {
             LOG_ERROR_INTERNAL("[Moonraker Client] Request ID {} already has a registered callback",
                                id);
             return INVALID_REQUEST_ID;
         }
-        pending_requests_.insert({id, request});
         spdlog::trace("[Moonraker Client] Registered request {} for method {}, total pending: {}",
                       id, method, pending_requests_.size());
     }
@@ -995,6 +1072,67 @@ bool MoonrakerClient::cancel_request(RequestId id) {
     return false;
 }
 
+bool MoonrakerClient::set_stream_decoder(RequestId id, StreamDecoder decoder) {
+    std::lock_guard<std::mutex> lock(requests_mutex_);
+    // False if already answered (or mock client): the json callback handled it
+    return pending_requests_.set_stream_decoder(id, std::move(decoder));
+}
+
+bool MoonrakerClient::try_stream_decode(const std::string& msg) {
+    // Lock-free early out: usually no decoder is waiting for this message
+    if (pending_requests_.stream_decoder_count() == 0) {
+        return false;
+    }
+
+    // Moonraker sends "id" last, so this reads only the tail; notifications have none
+    helix::JsonRpcEnvelope envelope;
+    if (!envelope.read(msg) || !envelope.has_id) {
+        return false;
+    }
+    StreamDecoder decoder;
+    std::string method_name;
+    {
+        std::lock_guard<std::mutex> lock(requests_mutex_);
+        auto it = pending_requests_.find(envelope.id);
+        if (it == pending_requests_.end() || !it->second.stream_decoder) {
+            return false;
+        }
+        decoder = it->second.stream_decoder;
+        method_name = it->second.method;
+    }
+
+    // Decode outside the lock; the request stays pending until this succeeds
+    std::function<void()> deliver;
+    try {
+        deliver = decoder(msg);
+    } catch (const std::exception& e) {
+        LOG_ERROR_INTERNAL("[Moonraker Client] Stream decoder for '{}' threw exception: {}",
+                           method_name, e.what());
+    }
+    if (!deliver) {
+        spdlog::debug("[Moonraker Client] Stream decode of '{}' declined, using json path",
+                      method_name);
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(requests_mutex_);
+        if (pending_requests_.erase(envelope.id) == 0) {
+            return true; // Cancelled or timed out meanwhile
+        }
+    }
+    spdlog::trace("[Moonraker Client] Stream-decoded response for id={} ({}), {} bytes",
+                  envelope.id, method_name, msg.size());
+
+    try {
+        deliver();
+    } catch (const std::exception& e) {
+        LOG_ERROR_INTERNAL("[Moonraker Client] Success callback for '{}' threw exception: {}",
+                           method_name, e.what());
+    }
+    return true;
+}
+
 int MoonrakerClient::gcode_script(const std::string& gcode) {
     std::string annotated = annotate_gcode(gcode);
     json params = {{"script", annotated}};
@@ -1009,7 +1147,7 @@ void MoonrakerClient::get_gcode_store(
     std::function<void(const MoonrakerError&)> on_error) {
     json params = {{"count", count}};
 
-    send_jsonrpc(
+    RequestId id = send_jsonrpc(
         "server.gcode_store", params,
         [on_success](json response) {
             std::vector<GcodeStoreEntry> entries;
@@ -1033,6 +1171,19 @@ void MoonrakerClient::get_gcode_store(
             }
         },
         on_error);
+
+    // Large console histories skip the json DOM (see set_stream_decoder())
+    set_stream_decoder(id, [on_success](const std::string& message) -> std::function<void()> {
+        auto decoder = std::make_shared<helix::GcodeStoreDecoder>();
+        if (!decoder->decode(message)) {
+            return nullptr;
+        }
+        return [on_success, decoder]() {
+            if (on_success) {
+                on_success(decoder->entries);
+            }
+        };
+    });
 }
 
 void MoonrakerClient::discover_printer(std::function<void()> on_complete,
@@ -1496,7 +1647,7 @@ void MoonrakerClient::complete_discovery_subscription(std::function<void()> on_c
                 // Process initial state from subscription response
                 // Moonraker returns current values in result.status
                 if (sub_response["result"].contains("status")) {
-                    const auto& status = sub_response["result"]["status"];
+                    auto& status = sub_response["result"]["status"];
                     spdlog::info(
                         "[Moonraker Client] Processing initial printer state from subscription");
 
@@ -1508,7 +1659,8 @@ void MoonrakerClient::complete_discovery_subscription(std::function<void()> on_c
                         spdlog::warn("[Moonraker Client] INITIAL status has NO print_stats!");
                     }
 
-                    dispatch_status_update(status);
+                    // sub_response is our own copy; hand the status over without a copy
+                    dispatch_status_update(std::move(status));
                 }
             } else if (sub_response.contains("error")) {
                 spdlog::error("[Moonraker Client] Subscription failed: {}",
@@ -1674,61 +1826,40 @@ void MoonrakerClient::parse_bed_mesh(const json& bed_mesh) {
 }
 
 void MoonrakerClient::check_request_timeouts() {
-    // Two-phase pattern: collect callbacks under lock, invoke outside lock
+    // Two-phase pattern: take expired requests under lock, report them outside it
     // This prevents deadlock if callback tries to send new request
-    std::vector<std::function<void()>> timed_out_callbacks;
-
-    // Phase 1: Find timed out requests and copy callbacks (under lock)
+    std::vector<PendingRequest> expired;
     {
         std::lock_guard<std::mutex> lock(requests_mutex_);
-        std::vector<uint64_t> timed_out_ids;
+        if (pending_requests_.empty()) {
+            return;
+        }
+        expired = pending_requests_.take_expired(std::chrono::steady_clock::now());
+    } // Lock released here
 
-        for (auto& [id, request] : pending_requests_) {
-            if (request.is_timed_out()) {
-                spdlog::warn("[Moonraker Client] Request {} ({}) timed out after {}ms", id,
-                             request.method, request.get_elapsed_ms());
-
-                // Emit timeout event
-                std::string method_name = request.method;
-                uint32_t timeout = request.timeout_ms;
-                emit_event(
-                    MoonrakerEventType::REQUEST_TIMEOUT,
-                    fmt::format("Printer command '{}' timed out after {}ms", method_name, timeout),
-                    false, method_name);
-
-                // Capture callback in lambda if present
-                if (request.error_callback) {
-                    MoonrakerError error =
-                        MoonrakerError::timeout(request.method, request.timeout_ms);
-                    timed_out_callbacks.push_back([cb = request.error_callback, error,
-                                                   method_name]() {
-                        try {
-                            cb(error);
-                        } catch (const std::exception& e) {
-                            LOG_ERROR_INTERNAL("[Moonraker Client] Timeout error callback for {} "
-                                               "threw exception: {}",
-                                               method_name, e.what());
-                        } catch (...) {
-                            LOG_ERROR_INTERNAL("[Moonraker Client] Timeout error callback for {} "
-                                               "threw unknown exception",
-                                               method_name);
-                        }
-                    });
-                }
+    for (auto& request : expired) {
+        spdlog::warn("[Moonraker Client] Request {} ({}) timed out after {}ms", request.id,
+                     request.method, request.get_elapsed_ms());
 
-                timed_out_ids.push_back(id);
-            }
-        }
+        emit_event(MoonrakerEventType::REQUEST_TIMEOUT,
+                   fmt::format("Printer command '{}' timed out after {}ms", request.method,
+                               request.timeout_ms),
+                   false, request.method);
 
-        // Remove timed out requests while still holding lock
-        for (uint64_t id : timed_out_ids) {
-            pending_requests_.erase(id);
+        if (!request.error_callback) {
+            continue;
+        }
+        try {
+            request.error_callback(MoonrakerError::timeout(request.method, request.timeout_ms));
+        } catch (const std::exception& e) {
+            LOG_ERROR_INTERNAL("[Moonraker Client] Timeout error callback for {} "
+                               "threw exception: {}",
+                               request.method, e.what());
+        } catch (...) {
+            LOG_ERROR_INTERNAL("[Moonraker Client] Timeout error callback for {} "
+                               "threw unknown exception",
+                               request.method);
         }
-    } // Lock released here
-
-    // Phase 2: Invoke callbacks outside lock (safe - callbacks can call send_jsonrpc)
-    for (auto& callback : timed_out_callbacks) {
-        callback();
     }
 }
 
@@ -2512,18 +2512,14 @@ void MoonrakerClientMock::dispatch_historical_temperatures() {
     constexpr int HOLD_PHASE_SAMPLES = 120; // ~30 seconds hold at peak
     // Cooling phase = remaining samples (~70s, cools extruder ~20°C to ~40°C)
 
-    // Copy callbacks to avoid holding lock during dispatch
-    std::vector<std::function<void(json)>> callbacks_copy;
+    bool has_callbacks = false;
     {
         std::lock_guard<std::mutex> lock(callbacks_mutex_);
-        callbacks_copy.reserve(notify_callbacks_.size());
-        for (const auto& [id, cb] : notify_callbacks_) {
-            callbacks_copy.push_back(cb);
-        }
+        has_callbacks = !notify_callbacks_.empty();
     }
 
     // If no callbacks registered yet, skip (caller should register before connect)
-    if (callbacks_copy.empty()) {
+    if (!has_callbacks) {
         spdlog::warn(
             "[MoonrakerClientMock] No callbacks registered for historical temps - skipping");
         return;
@@ -2616,15 +2612,12 @@ void MoonrakerClientMock::dispatch_historical_temperatures() {
             }
         }
 
-        json notification = {{"method", "notify_status_update"},
-                             {"params", json::array({status_obj, timestamp_sec})}};
+        auto notification = std::make_shared<const json>(
+            json{{"method", "notify_status_update"},
+                 {"params", json::array({std::move(status_obj), timestamp_sec})}});
 
-        // Dispatch to all callbacks
-        for (const auto& cb : callbacks_copy) {
-            if (cb) {
-                cb(notification);
-            }
-        }
+        // Dispatch to all callbacks (shared, not copied per subscriber)
+        dispatch_notification("notify_status_update", notification);
     }
 
     // Store final historical values as current temps
@@ -2649,7 +2642,7 @@ void MoonrakerClientMock::set_bed_target(double target) {
 }
 
 void MoonrakerClientMock::dispatch_method_callback(const std::string& method, const json& msg) {
-    std::vector<std::function<void(json)>> callbacks_to_invoke;
+    std::vector<NotificationCallback> callbacks_to_invoke;
 
     {
         std::lock_guard<std::mutex> lock(callbacks_mutex_);
@@ -2702,7 +2695,8 @@ void MoonrakerClientMock::stop_temperature_simulation(bool during_destruction) {
 
 void MoonrakerClientMock::temperature_simulation_loop() {
     spdlog::debug("[MoonrakerClientMock] temperature_simulation_loop ENTERED");
-    const double base_dt = SIMULATION_INTERVAL_MS / 1000.0; // Base time step (0.5s)
+    const int interval_ms = status_interval_ms_.load();
+    const double base_dt = interval_ms / 1000.0; // Base time step (0.25s by default)
 
     while (simulation_running_.load()) {
         uint32_t tick = tick_count_.fetch_add(1);
@@ -3139,29 +3133,17 @@ void MoonrakerClientMock::temperature_simulation_loop() {
             }
         }
 
-        json notification = {{"method", "notify_status_update"},
-                             {"params", json::array({status_obj, tick * base_dt})}};
+        auto notification = std::make_shared<const json>(
+            json{{"method", "notify_status_update"},
+                 {"params", json::array({std::move(status_obj), tick * base_dt})}});
 
-        // Push notification through all registered callbacks
-        // Two-phase: copy under lock, invoke outside to avoid deadlock
-        std::vector<std::function<void(json)>> callbacks_copy;
-        {
-            std::lock_guard<std::mutex> lock(callbacks_mutex_);
-            callbacks_copy.reserve(notify_callbacks_.size());
-            for (const auto& [id, cb] : notify_callbacks_) {
-                callbacks_copy.push_back(cb);
-            }
-        }
-        for (const auto& cb : callbacks_copy) {
-            if (cb) {
-                cb(notification);
-            }
-        }
+        // Push notification through all registered callbacks, shared rather than copied
+        dispatch_notification("notify_status_update", notification);
 
         // Log every 40 ticks (~10 seconds) to confirm loop is running
         if (tick % 40 == 0) {
-            spdlog::trace("[MoonrakerClientMock] Simulation tick {} - callbacks={}", tick,
-                          callbacks_copy.size());
+            spdlog::trace("[MoonrakerClientMock] Simulation tick {} - {} B/s dispatched", tick,
+                          get_notification_stats().payload_bytes_per_sec());
         }
 
         // Sleep wall-clock interval with early-exit support for clean shutdown
@@ -3169,7 +3151,7 @@ void MoonrakerClientMock::temperature_simulation_loop() {
         // can wake the thread immediately instead of waiting for the full interval
         {
             std::unique_lock<std::mutex> lock(sim_mutex_);
-            sim_cv_.wait_for(lock, std::chrono::milliseconds(SIMULATION_INTERVAL_MS),
+            sim_cv_.wait_for(lock, std::chrono::milliseconds(interval_ms),
                              [this] { return !simulation_running_.load(); });
         }
     }
@@ -3278,7 +3260,7 @@ void MoonrakerClientMock::dispatch_gcode_response(const std::string& line) {
     json notification = {{"method", "notify_gcode_response"}, {"params", json::array({line})}};
 
     // Collect callbacks while holding lock, invoke outside
-    std::vector<std::function<void(json)>> callbacks_to_invoke;
+    std::vector<NotificationCallback> callbacks_to_invoke;
     {
         std::lock_guard<std::mutex> lock(callbacks_mutex_);
         auto method_it = method_callbacks_.find("notify_gcode_response");
@@ -0,0 +1,87 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "moonraker_request.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+// Heap entries beyond twice the live count (plus this slack) trigger a rebuild
+constexpr size_t STALE_DEADLINE_SLACK = 64;
+
+struct LaterDeadline {
+    template <typename D> bool operator()(const D& a, const D& b) const {
+        return a.when > b.when;
+    }
+};
+
+} // namespace
+
+bool PendingRequestMap::insert(PendingRequest request) {
+    uint64_t id = request.id;
+    Clock::time_point when = request.deadline();
+    bool has_decoder = static_cast<bool>(request.stream_decoder);
+    if (!requests_.emplace(id, std::move(request)).second) {
+        return false;
+    }
+    if (has_decoder) {
+        decoder_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    deadlines_.push_back({when, id});
+    std::push_heap(deadlines_.begin(), deadlines_.end(), LaterDeadline{});
+
+    // Fast responses leave their entries behind until the deadline passes
+    if (deadlines_.size() > 2 * requests_.size() + STALE_DEADLINE_SLACK) {
+        compact();
+    }
+    return true;
+}
+
+void PendingRequestMap::clear() {
+    requests_.clear();
+    deadlines_.clear();
+    decoder_count_.store(0, std::memory_order_relaxed);
+}
+
+bool PendingRequestMap::set_stream_decoder(uint64_t id, PendingRequest::StreamDecoder decoder) {
+    auto it = requests_.find(id);
+    if (it == requests_.end()) {
+        return false;
+    }
+    forget_decoder(it->second);
+    it->second.stream_decoder = std::move(decoder);
+    if (it->second.stream_decoder) {
+        decoder_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+std::vector<PendingRequest> PendingRequestMap::take_expired(Clock::time_point now) {
+    std::vector<PendingRequest> expired;
+    while (!deadlines_.empty() && deadlines_.front().when < now) {
+        std::pop_heap(deadlines_.begin(), deadlines_.end(), LaterDeadline{});
+        Deadline due = deadlines_.back();
+        deadlines_.pop_back();
+
+        auto it = requests_.find(due.id);
+        if (it == requests_.end() || it->second.deadline() != due.when) {
+            continue; // Already answered or cancelled
+        }
+        forget_decoder(it->second);
+        expired.push_back(std::move(it->second));
+        requests_.erase(it);
+    }
+    return expired;
+}
+
+void PendingRequestMap::compact() {
+    deadlines_.clear();
+    deadlines_.reserve(requests_.size());
+    for (const auto& [id, request] : requests_) {
+        deadlines_.push_back({request.deadline(), id});
+    }
+    std::make_heap(deadlines_.begin(), deadlines_.end(), LaterDeadline{});
+}
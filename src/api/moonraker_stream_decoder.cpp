@@ -0,0 +1,457 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "moonraker_stream_decoder.h"
+
+#include <cctype>
+#include <cstring>
+#include <iterator>
+#include <utility>
+
+namespace helix {
+
+// ============================================================================
+// JsonStreamDecoder
+// ============================================================================
+
+double JsonStreamDecoder::Scalar::as_double() const {
+    switch (kind) {
+    case Kind::Integer:
+        return static_cast<double>(integer);
+    case Kind::Unsigned:
+        return static_cast<double>(unsigned_integer);
+    case Kind::Float:
+        return floating;
+    default:
+        return 0.0;
+    }
+}
+
+uint64_t JsonStreamDecoder::Scalar::as_uint64() const {
+    switch (kind) {
+    case Kind::Integer:
+        return static_cast<uint64_t>(integer);
+    case Kind::Unsigned:
+        return unsigned_integer;
+    case Kind::Float:
+        return floating > 0.0 ? static_cast<uint64_t>(floating) : 0;
+    default:
+        return 0;
+    }
+}
+
+bool JsonStreamDecoder::decode(const std::string& message) {
+    depth_ = 0;
+    rpc_error_ = false;
+    stopped_ = false;
+    parse_error_.clear();
+
+    bool parsed = nlohmann::json::sax_parse(message, this);
+    if (stopped_) {
+        return true;
+    }
+    if (!parsed || rpc_error_) {
+        return false;
+    }
+    on_finish();
+    return true;
+}
+
+const std::string& JsonStreamDecoder::member() const {
+    static const std::string empty;
+    if (depth_ == 0 || stack_[depth_ - 1].is_array) {
+        return empty;
+    }
+    return stack_[depth_ - 1].key;
+}
+
+bool JsonStreamDecoder::at(std::initializer_list<const char*> path) const {
+    if (depth_ != path.size() + 1) {
+        return false;
+    }
+    size_t level = 0;
+    for (const char* step : path) {
+        const Frame& frame = stack_[level++];
+        if (frame.is_array ? std::strcmp(step, "*") != 0 : frame.key != step) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void JsonStreamDecoder::open(bool is_array) {
+    on_begin(is_array);
+    if (stack_.size() <= depth_) {
+        stack_.emplace_back();
+    }
+    Frame& frame = stack_[depth_++];
+    frame.is_array = is_array;
+    frame.key.clear();
+    frame.index = 0;
+}
+
+void JsonStreamDecoder::value_done() {
+    if (depth_ > 0 && stack_[depth_ - 1].is_array) {
+        stack_[depth_ - 1].index++;
+    }
+}
+
+bool JsonStreamDecoder::null() {
+    on_scalar(Scalar{});
+    value_done();
+    return !stopped_;
+}
+
+bool JsonStreamDecoder::boolean(bool value) {
+    Scalar scalar;
+    scalar.kind = Scalar::Kind::Bool;
+    scalar.boolean = value;
+    on_scalar(scalar);
+    value_done();
+    return !stopped_;
+}
+
+bool JsonStreamDecoder::number_integer(nlohmann::json::number_integer_t value) {
+    Scalar scalar;
+    scalar.kind = Scalar::Kind::Integer;
+    scalar.integer = value;
+    on_scalar(scalar);
+    value_done();
+    return !stopped_;
+}
+
+bool JsonStreamDecoder::number_unsigned(nlohmann::json::number_unsigned_t value) {
+    Scalar scalar;
+    scalar.kind = Scalar::Kind::Unsigned;
+    scalar.unsigned_integer = value;
+    on_scalar(scalar);
+    value_done();
+    return !stopped_;
+}
+
+bool JsonStreamDecoder::number_float(nlohmann::json::number_float_t value,
+                                     const std::string& /*raw*/) {
+    Scalar scalar;
+    scalar.kind = Scalar::Kind::Float;
+    scalar.floating = value;
+    on_scalar(scalar);
+    value_done();
+    return !stopped_;
+}
+
+bool JsonStreamDecoder::string(std::string& value) {
+    Scalar scalar;
+    scalar.kind = Scalar::Kind::String;
+    scalar.string = &value;
+    on_scalar(scalar);
+    value_done();
+    return !stopped_;
+}
+
+bool JsonStreamDecoder::binary(nlohmann::json::binary_t& /*value*/) {
+    // Not produced by the JSON text parser
+    value_done();
+    return !stopped_;
+}
+
+bool JsonStreamDecoder::start_object(std::size_t /*elements*/) {
+    open(false);
+    return !stopped_;
+}
+
+bool JsonStreamDecoder::key(std::string& key) {
+    if (depth_ == 0) {
+        return false;
+    }
+    stack_[depth_ - 1].key.assign(key); // Keeps the frame's buffer
+    if (depth_ == 1 && key == "error") {
+        rpc_error_ = true;
+    }
+    return true;
+}
+
+bool JsonStreamDecoder::end_object() {
+    depth_--;
+    value_done();
+    return !stopped_;
+}
+
+bool JsonStreamDecoder::start_array(std::size_t /*elements*/) {
+    open(true);
+    return !stopped_;
+}
+
+bool JsonStreamDecoder::end_array() {
+    depth_--;
+    value_done();
+    return !stopped_;
+}
+
+bool JsonStreamDecoder::parse_error(std::size_t /*position*/, const std::string& /*last_token*/,
+                                    const nlohmann::json::exception& ex) {
+    parse_error_ = ex.what();
+    return false;
+}
+
+// ============================================================================
+// JsonRpcEnvelope
+// ============================================================================
+
+bool JsonRpcEnvelope::read(const std::string& message) {
+    has_id = false;
+    id = 0;
+    if (read_trailing_id(message)) {
+        return true;
+    }
+    return decode(message);
+}
+
+bool JsonRpcEnvelope::read_trailing_id(const std::string& message) {
+    // Walks back over `, "id": 123 }`; anything else is left to decode()
+    size_t end = message.size();
+    auto skip_space = [&] {
+        while (end > 0 && std::isspace(static_cast<unsigned char>(message[end - 1]))) {
+            end--;
+        }
+    };
+    auto take = [&](char c) {
+        skip_space();
+        if (end == 0 || message[end - 1] != c) {
+            return false;
+        }
+        end--;
+        return true;
+    };
+
+    if (!take('}')) {
+        return false;
+    }
+    skip_space();
+    size_t digits_end = end;
+    while (end > 0 && std::isdigit(static_cast<unsigned char>(message[end - 1]))) {
+        end--;
+    }
+    size_t digits = digits_end - end;
+    if (digits == 0 || digits > 19) {
+        return false; // Not an unsigned integer that fits uint64_t
+    }
+    size_t digits_begin = end;
+
+    if (!take(':')) {
+        return false;
+    }
+    skip_space();
+    if (end < 4 || message.compare(end - 4, 4, "\"id\"") != 0) {
+        return false;
+    }
+    end -= 4;
+    // The quote must open a root member key, not end an escaped string
+    if (!take(',') && !take('{')) {
+        return false;
+    }
+
+    uint64_t value = 0;
+    for (size_t i = digits_begin; i < digits_end; ++i) {
+        value = value * 10 + static_cast<uint64_t>(message[i] - '0');
+    }
+    has_id = true;
+    id = value;
+    return true;
+}
+
+void JsonRpcEnvelope::on_scalar(const Scalar& value) {
+    if (depth() != 1 || member() != "id") {
+        return;
+    }
+    if (value.kind == Scalar::Kind::Integer || value.kind == Scalar::Kind::Unsigned) {
+        has_id = true;
+        id = value.as_uint64();
+    }
+    stop();
+}
+
+// ============================================================================
+// HistoryListDecoder
+// ============================================================================
+
+void HistoryListDecoder::on_begin(bool is_array) {
+    if (!is_array && in_array() && at({"result", "jobs"})) {
+        jobs.emplace_back();
+    }
+}
+
+void HistoryListDecoder::on_scalar(const Scalar& value) {
+    const std::string& name = member();
+
+    if (at({"result", "jobs", "*"})) {
+        PrintHistoryJob& job = jobs.back();
+        if (value.is_string()) {
+            if (name == "job_id") {
+                job.job_id = *value.string;
+            } else if (name == "filename") {
+                job.filename = *value.string;
+            } else if (name == "status") {
+                job.status = parse_job_status(*value.string);
+            }
+        } else if (value.is_number()) {
+            // end_time is null for in-progress jobs; non-numbers keep the default
+            if (name == "start_time") {
+                job.start_time = value.as_double();
+            } else if (name == "end_time") {
+                job.end_time = value.as_double();
+            } else if (name == "print_duration") {
+                job.print_duration = value.as_double();
+            } else if (name == "total_duration") {
+                job.total_duration = value.as_double();
+            } else if (name == "filament_used") {
+                job.filament_used = value.as_double();
+            }
+        } else if (value.kind == Scalar::Kind::Bool && name == "exists") {
+            job.exists = value.boolean;
+        }
+        return;
+    }
+
+    if (at({"result", "jobs", "*", "metadata"})) {
+        PrintHistoryJob& job = jobs.back();
+        if (value.is_string()) {
+            if (name == "filament_type") {
+                job.filament_type = *value.string;
+            } else if (name == "uuid") {
+                job.uuid = *value.string;
+            }
+        } else if (value.is_number()) {
+            if (name == "layer_count") {
+                job.layer_count = static_cast<uint32_t>(value.as_uint64());
+            } else if (name == "layer_height") {
+                job.layer_height = value.as_double();
+            } else if (name == "first_layer_extr_temp") {
+                job.nozzle_temp = value.as_double();
+            } else if (name == "first_layer_bed_temp") {
+                job.bed_temp = value.as_double();
+            } else if (name == "size") {
+                job.size_bytes = static_cast<size_t>(value.as_uint64());
+            }
+        }
+        return;
+    }
+
+    // First thumbnail only; levels: root, result, jobs, job, metadata, thumbnails
+    if (value.is_string() && name == "relative_path" &&
+        at({"result", "jobs", "*", "metadata", "thumbnails", "*"}) && index_at(5) == 0) {
+        jobs.back().thumbnail_path = *value.string;
+        return;
+    }
+
+    if (value.is_number() && name == "count" && at({"result"})) {
+        total_count = value.as_uint64();
+    }
+}
+
+// ============================================================================
+// FileListDecoder
+// ============================================================================
+
+void FileListDecoder::on_begin(bool is_array) {
+    if (is_array || !in_array()) {
+        return;
+    }
+    if (at({"result"})) {
+        // server.files.list: flat array of files
+        files.emplace_back();
+        item_has_path_ = false;
+    } else if (at({"result", "dirs"})) {
+        files.emplace_back();
+    } else if (at({"result", "files"})) {
+        legacy_files_.emplace_back();
+    }
+}
+
+void FileListDecoder::on_scalar(const Scalar& value) {
+    const std::string& name = member();
+
+    if (at({"result", "*"})) {
+        FileInfo& info = files.back();
+        if (name == "path" && value.is_string()) {
+            // filename is the last component of the path, and wins over "filename"
+            info.path = *value.string;
+            size_t last_slash = info.path.rfind('/');
+            info.filename =
+                (last_slash != std::string::npos) ? info.path.substr(last_slash + 1) : info.path;
+            item_has_path_ = true;
+        } else if (name == "filename" && value.is_string()) {
+            if (!item_has_path_) {
+                info.filename = *value.string;
+            }
+        } else if (name == "size" && value.is_number()) {
+            info.size = value.as_uint64();
+        } else if (name == "modified" && value.is_number()) {
+            info.modified = value.as_double();
+        } else if (name == "permissions" && value.is_string()) {
+            info.permissions = *value.string;
+        }
+        return;
+    }
+
+    if (at({"result", "dirs", "*"})) {
+        FileInfo& info = files.back();
+        if (name == "dirname" && value.is_string()) {
+            info.filename = *value.string;
+            info.is_dir = true;
+        } else if (name == "modified" && value.is_number()) {
+            info.modified = value.as_double();
+        } else if (name == "permissions" && value.is_string()) {
+            info.permissions = *value.string;
+        }
+        return;
+    }
+
+    if (at({"result", "files", "*"})) {
+        FileInfo& info = legacy_files_.back();
+        if (name == "filename" && value.is_string()) {
+            info.filename = *value.string;
+        } else if (name == "path" && value.is_string()) {
+            info.path = *value.string;
+        } else if (name == "size" && value.is_number()) {
+            info.size = value.as_uint64();
+        } else if (name == "modified" && value.is_number()) {
+            info.modified = value.as_double();
+        } else if (name == "permissions" && value.is_string()) {
+            info.permissions = *value.string;
+        }
+    }
+}
+
+void FileListDecoder::on_finish() {
+    files.insert(files.end(), std::make_move_iterator(legacy_files_.begin()),
+                 std::make_move_iterator(legacy_files_.end()));
+    legacy_files_.clear();
+}
+
+// ============================================================================
+// GcodeStoreDecoder
+// ============================================================================
+
+void GcodeStoreDecoder::on_begin(bool is_array) {
+    if (!is_array && in_array() && at({"result", "gcode_store"})) {
+        entries.emplace_back();
+        entries.back().type = "response";
+    }
+}
+
+void GcodeStoreDecoder::on_scalar(const Scalar& value) {
+    if (!at({"result", "gcode_store", "*"})) {
+        return;
+    }
+    const std::string& name = member();
+    GcodeStoreEntry& entry = entries.back();
+    if (name == "message" && value.is_string()) {
+        entry.message = *value.string;
+    } else if (name == "time" && value.is_number()) {
+        entry.time = value.as_double();
+    } else if (name == "type" && value.is_string()) {
+        entry.type = *value.string;
+    }
+}
+
+} // namespace helix
@@ -27,6 +27,7 @@
 #include "moonraker_api_mock.h"
 #include "moonraker_client.h"
 #include "moonraker_client_mock.h"
+#include "notification_coalescer.h"
 #include "print_completion.h"
 #include "print_start_collector.h"
 #include "print_start_profile.h"
@@ -39,6 +40,7 @@
 #include <spdlog/spdlog.h>
 
 #include <cstdlib>
+#include <vector>
 
 MoonrakerManager::MoonrakerManager() : m_startup_time(std::chrono::steady_clock::now()) {}
 
@@ -165,11 +167,38 @@ int MoonrakerManager::connect(const std::string& websocket_url, const std::strin
 }
 
 void MoonrakerManager::process_notifications() {
-    std::lock_guard<std::mutex> lock(m_notification_mutex);
+    // Take the whole backlog under the lock, then apply it without holding the lock
+    // so the WebSocket thread is never blocked behind PrinterState updates
+    std::vector<JsonMessage> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_notification_mutex);
+        pending.reserve(m_notification_queue.size());
+        while (!m_notification_queue.empty()) {
+            pending.push_back(std::move(m_notification_queue.front()));
+            m_notification_queue.pop();
+        }
+    }
+    if (pending.empty()) {
+        return;
+    }
 
-    while (!m_notification_queue.empty()) {
-        json notification = m_notification_queue.front();
-        m_notification_queue.pop();
+    // A backlog of status deltas (e.g. after a UI stall) becomes one PrinterState pass
+    auto coalesce_start = std::chrono::steady_clock::now();
+    helix::NotificationCoalescer::Stats stats;
+    pending = helix::NotificationCoalescer::coalesce(std::move(pending), &stats);
+    if (stats.status_merged > 0) {
+        auto coalesce_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                               std::chrono::steady_clock::now() - coalesce_start)
+                               .count();
+        m_status_passes_saved += stats.status_merged;
+        spdlog::debug("[MoonrakerManager] Coalesced {} status deltas into {} passes ({} us, "
+                      "{} passes saved total)",
+                      stats.status_in, stats.status_in - stats.status_merged, coalesce_us,
+                      m_status_passes_saved);
+    }
+
+    for (const JsonMessage& message : pending) {
+        const json& notification = *message;
 
         // Check for connection state change (queued from state_change_callback)
         if (notification.contains("_connection_state")) {
@@ -334,16 +363,18 @@ void MoonrakerManager::register_callbacks() {
             spdlog::trace("[MoonrakerManager] State change: {} -> {} (queueing)",
                           static_cast<int>(old_state), static_cast<int>(new_state));
 
+            auto state_change = std::make_shared<json>();
+            (*state_change)["_connection_state"] = true;
+            (*state_change)["old_state"] = static_cast<int>(old_state);
+            (*state_change)["new_state"] = static_cast<int>(new_state);
+
             std::lock_guard<std::mutex> lock(m_notification_mutex);
-            json state_change;
-            state_change["_connection_state"] = true;
-            state_change["old_state"] = static_cast<int>(old_state);
-            state_change["new_state"] = static_cast<int>(new_state);
-            m_notification_queue.push(state_change);
+            m_notification_queue.push(std::move(state_change));
         });
 
-    // Register notification callback to queue updates for main thread
-    m_client->register_notify_update([this, alive](json notification) {
+    // Register notification callback to queue updates for main thread.
+    // The queue holds a reference to the client's parsed message instead of a copy.
+    m_client->register_notify_message([this, alive](const JsonMessage& notification) {
         if (!alive->load())
             return;
 
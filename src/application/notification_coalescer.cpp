@@ -0,0 +1,106 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "notification_coalescer.h"
+
+#include <utility>
+
+using json = nlohmann::json;
+
+namespace helix {
+
+bool NotificationCoalescer::is_status_update(const json& message) {
+    if (!message.is_object()) {
+        return false;
+    }
+    auto method = message.find("method");
+    if (method == message.end() || !method->is_string() ||
+        method->get_ref<const std::string&>() != "notify_status_update") {
+        return false;
+    }
+    auto params = message.find("params");
+    return params != message.end() && params->is_array() && !params->empty() &&
+           (*params)[0].is_object();
+}
+
+void NotificationCoalescer::merge_status_delta(json& target, const json& delta) {
+    if (!target.is_object() || !delta.is_object()) {
+        target = delta;
+        return;
+    }
+    // Moonraker sends a changed field's value whole (e.g. bed_mesh.profiles), so
+    // merge only object -> field; deeper levels replace rather than merge
+    for (auto obj = delta.begin(); obj != delta.end(); ++obj) {
+        json& merged = target[obj.key()];
+        if (!merged.is_object() || !obj.value().is_object()) {
+            merged = obj.value();
+            continue;
+        }
+        for (auto field = obj.value().begin(); field != obj.value().end(); ++field) {
+            merged[field.key()] = field.value();
+        }
+    }
+}
+
+std::vector<NotificationCoalescer::Message>
+NotificationCoalescer::coalesce(std::vector<Message> queue, Stats* stats) {
+    Stats local;
+    local.messages_in = queue.size();
+
+    std::vector<Message> out;
+    out.reserve(queue.size());
+
+    // Current run of consecutive status deltas: the first message, plus an owned
+    // merged copy once a second delta arrives
+    Message run_first;
+    std::shared_ptr<json> run_merged;
+
+    auto flush_run = [&]() {
+        if (run_merged) {
+            out.push_back(std::move(run_merged));
+        } else if (run_first) {
+            out.push_back(std::move(run_first));
+        }
+        run_first.reset();
+        run_merged.reset();
+    };
+
+    for (auto& message : queue) {
+        if (!message || !is_status_update(*message)) {
+            flush_run();
+            out.push_back(std::move(message));
+            continue;
+        }
+
+        local.status_in++;
+        if (!run_first) {
+            run_first = std::move(message);
+            continue;
+        }
+
+        if (!run_merged) {
+            run_merged = std::make_shared<json>(*run_first);
+        }
+        const json& params = (*message)["params"];
+        json& merged_params = (*run_merged)["params"];
+        merge_status_delta(merged_params[0], params[0]);
+        if (params.size() > 1) {
+            // Latest eventtime
+            if (merged_params.size() > 1) {
+                merged_params[1] = params[1];
+            } else {
+                merged_params.push_back(params[1]);
+            }
+        }
+        local.status_merged++;
+    }
+    flush_run();
+
+    local.messages_out = out.size();
+    if (stats) {
+        *stats = local;
+    }
+    return out;
+}
+
+} // namespace helix
@@ -501,6 +501,16 @@ bool FilamentSensorManager::is_motion_active() const {
 // ============================================================================
 
 void FilamentSensorManager::update_from_status(const json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool FilamentSensorManager::handles_status_object(const std::string& object) const {
+    std::string sensor_name;
+    FilamentSensorType type{};
+    return parse_klipper_name(object, sensor_name, type);
+}
+
+void FilamentSensorManager::update_from_objects(const StatusObjects& objects) {
     // Suppress toast notifications for initial state at startup
     // (similar to USB manager - users don't need to be told filament is present)
     auto now = std::chrono::steady_clock::now();
@@ -534,12 +544,13 @@ void FilamentSensorManager::update_from_status(const json& status) {
 
             // Check if this sensor has an update
             // Moonraker sends updates with the full object name as key
-            if (!status.contains(key)) {
+            const auto* found = objects.find(key);
+            if (!found) {
                 // Also try without the prefix for older Moonraker versions
                 continue;
             }
 
-            const auto& sensor_data = status[key];
+            const auto& sensor_data = *found;
             auto& state = states_[sensor.klipper_name];
             FilamentSensorState old_state = state;
 
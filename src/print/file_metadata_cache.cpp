@@ -0,0 +1,464 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "file_metadata_cache.h"
+
+#include "app_globals.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace helix {
+
+namespace {
+
+// Listings report fractional seconds; PrintFileData keeps whole seconds
+int64_t modified_key(double modified) {
+    return static_cast<int64_t>(modified);
+}
+
+std::string parent_directory(const std::string& path) {
+    size_t slash = path.rfind('/');
+    return slash == std::string::npos ? std::string() : path.substr(0, slash);
+}
+
+template <typename T> T json_value(const nlohmann::json& json, const char* key, T fallback) {
+    auto it = json.find(key);
+    if (it == json.end() || it->is_null()) {
+        return fallback;
+    }
+    try {
+        return it->get<T>();
+    } catch (const nlohmann::json::exception&) {
+        return fallback;
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// JSON Serialization
+// ============================================================================
+
+nlohmann::json file_metadata_to_json(const FileMetadata& metadata) {
+    nlohmann::json thumbnails = nlohmann::json::array();
+    for (const auto& thumb : metadata.thumbnails) {
+        thumbnails.push_back({{"relative_path", thumb.relative_path},
+                              {"width", thumb.width},
+                              {"height", thumb.height}});
+    }
+
+    return {{"filename", metadata.filename},
+            {"size", metadata.size},
+            {"modified", metadata.modified},
+            {"slicer", metadata.slicer},
+            {"slicer_version", metadata.slicer_version},
+            {"print_start_time", metadata.print_start_time},
+            {"job_id", metadata.job_id},
+            {"layer_count", metadata.layer_count},
+            {"object_height", metadata.object_height},
+            {"estimated_time", metadata.estimated_time},
+            {"filament_total", metadata.filament_total},
+            {"filament_weight_total", metadata.filament_weight_total},
+            {"filament_type", metadata.filament_type},
+            {"filament_name", metadata.filament_name},
+            {"layer_height", metadata.layer_height},
+            {"first_layer_height", metadata.first_layer_height},
+            {"filament_colors", metadata.filament_colors},
+            {"first_layer_bed_temp", metadata.first_layer_bed_temp},
+            {"first_layer_extr_temp", metadata.first_layer_extr_temp},
+            {"gcode_start_byte", metadata.gcode_start_byte},
+            {"gcode_end_byte", metadata.gcode_end_byte},
+            {"uuid", metadata.uuid},
+            {"thumbnails", std::move(thumbnails)}};
+}
+
+FileMetadata file_metadata_from_json(const nlohmann::json& json) {
+    FileMetadata metadata;
+    if (!json.is_object()) {
+        return metadata;
+    }
+
+    metadata.filename = json_value<std::string>(json, "filename", "");
+    metadata.size = json_value<uint64_t>(json, "size", 0);
+    metadata.modified = json_value<double>(json, "modified", 0.0);
+    metadata.slicer = json_value<std::string>(json, "slicer", "");
+    metadata.slicer_version = json_value<std::string>(json, "slicer_version", "");
+    metadata.print_start_time = json_value<double>(json, "print_start_time", 0.0);
+    metadata.job_id = json_value<std::string>(json, "job_id", "");
+    metadata.layer_count = json_value<uint32_t>(json, "layer_count", 0);
+    metadata.object_height = json_value<double>(json, "object_height", 0.0);
+    metadata.estimated_time = json_value<double>(json, "estimated_time", 0.0);
+    metadata.filament_total = json_value<double>(json, "filament_total", 0.0);
+    metadata.filament_weight_total = json_value<double>(json, "filament_weight_total", 0.0);
+    metadata.filament_type = json_value<std::string>(json, "filament_type", "");
+    metadata.filament_name = json_value<std::string>(json, "filament_name", "");
+    metadata.layer_height = json_value<double>(json, "layer_height", 0.0);
+    metadata.first_layer_height = json_value<double>(json, "first_layer_height", 0.0);
+    metadata.filament_colors =
+        json_value<std::vector<std::string>>(json, "filament_colors", std::vector<std::string>{});
+    metadata.first_layer_bed_temp = json_value<double>(json, "first_layer_bed_temp", 0.0);
+    metadata.first_layer_extr_temp = json_value<double>(json, "first_layer_extr_temp", 0.0);
+    metadata.gcode_start_byte = json_value<uint64_t>(json, "gcode_start_byte", 0);
+    metadata.gcode_end_byte = json_value<uint64_t>(json, "gcode_end_byte", 0);
+    metadata.uuid = json_value<std::string>(json, "uuid", "");
+
+    auto thumbs = json.find("thumbnails");
+    if (thumbs != json.end() && thumbs->is_array()) {
+        for (const auto& thumb : *thumbs) {
+            ThumbnailInfo info;
+            info.relative_path = json_value<std::string>(thumb, "relative_path", "");
+            info.width = json_value<int>(thumb, "width", 0);
+            info.height = json_value<int>(thumb, "height", 0);
+            if (!info.relative_path.empty()) {
+                metadata.thumbnails.push_back(std::move(info));
+            }
+        }
+    }
+    return metadata;
+}
+
+// ============================================================================
+// FileMetadataCache
+// ============================================================================
+
+FileMetadataCache& get_file_metadata_cache() {
+    static FileMetadataCache instance;
+    return instance;
+}
+
+FileMetadataCache::FileMetadataCache() : FileMetadataCache(get_helix_cache_dir("file_metadata")) {}
+
+FileMetadataCache::FileMetadataCache(std::string directory, size_t max_in_flight,
+                                     size_t max_entries)
+    : max_in_flight_(std::max<size_t>(1, max_in_flight)), max_entries_(max_entries) {
+    if (directory.empty()) {
+        return;
+    }
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    if (!fs::is_directory(directory, ec)) {
+        spdlog::warn("[FileMetadataCache] Cannot use cache directory {}, keeping entries in memory",
+                     directory);
+        return;
+    }
+    file_path_ = (fs::path(directory) / FILE_NAME).string();
+}
+
+FileMetadataCache::~FileMetadataCache() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (dirty_) {
+        save_locked();
+    }
+}
+
+std::optional<FileMetadata> FileMetadataCache::lookup(const std::string& path, double modified) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    load_locked();
+    auto it = entries_.find(path);
+    if (it == entries_.end() || it->second.modified != modified_key(modified)) {
+        return std::nullopt;
+    }
+    it->second.used = ++tick_;
+    return it->second.metadata;
+}
+
+void FileMetadataCache::store(const std::string& path, double modified,
+                              const FileMetadata& metadata) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    load_locked();
+    Entry& entry = entries_[path];
+    entry.modified = modified_key(modified);
+    entry.used = ++tick_;
+    entry.metadata = metadata;
+    dirty_ = true;
+    trim_locked();
+}
+
+bool FileMetadataCache::request(const std::string& path, double modified, Fetcher fetcher,
+                                MetadataCallback on_success, FailureCallback on_error) {
+    int64_t key = modified_key(modified);
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        load_locked();
+
+        auto it = entries_.find(path);
+        if (it != entries_.end() && it->second.modified == key) {
+            it->second.used = ++tick_;
+            FileMetadata metadata = it->second.metadata;
+            stats_.hits++;
+            lock.unlock();
+            if (on_success) {
+                on_success(metadata);
+            }
+            return true;
+        }
+
+        stats_.misses++;
+        auto [pending, inserted] = pending_.try_emplace(path);
+        if (inserted) {
+            pending->second.modified = key;
+            pending->second.fetcher = std::move(fetcher);
+            queue_.push_back(path);
+        } else {
+            stats_.coalesced++;
+            if (!pending->second.started && pending->second.modified != key) {
+                // Re-uploaded while queued: fetch the new version instead
+                pending->second.modified = key;
+                pending->second.fetcher = std::move(fetcher);
+            }
+        }
+        pending->second.waiters.push_back({std::move(on_success), std::move(on_error)});
+    }
+    pump();
+    return false;
+}
+
+void FileMetadataCache::pump() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pumping_) {
+            return; // The running loop below will see the freed slot
+        }
+        pumping_ = true;
+    }
+
+    for (;;) {
+        std::string path;
+        int64_t modified = 0;
+        Fetcher fetcher;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (in_flight_ >= max_in_flight_ || queue_.empty()) {
+                pumping_ = false;
+                return;
+            }
+            path = std::move(queue_.front());
+            queue_.pop_front();
+            auto it = pending_.find(path);
+            if (it == pending_.end()) {
+                continue;
+            }
+            it->second.started = true;
+            modified = it->second.modified;
+            fetcher = std::move(it->second.fetcher);
+            in_flight_++;
+            stats_.fetches++;
+        }
+
+        // Never call out with the lock held: fetchers may complete synchronously
+        if (!fetcher) {
+            complete(path, modified, nullptr, "No fetcher");
+            continue;
+        }
+        fetcher(
+            [this, path, modified](const FileMetadata& metadata) {
+                complete(path, modified, &metadata, {});
+            },
+            [this, path, modified](const std::string& error) {
+                complete(path, modified, nullptr, error);
+            });
+    }
+}
+
+void FileMetadataCache::complete(const std::string& path, int64_t modified,
+                                 const FileMetadata* metadata, const std::string& error) {
+    std::vector<Waiter> waiters;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = pending_.find(path);
+        if (it != pending_.end()) {
+            waiters = std::move(it->second.waiters);
+            pending_.erase(it);
+        }
+        in_flight_--;
+
+        if (metadata) {
+            Entry& entry = entries_[path];
+            entry.modified = modified;
+            entry.used = ++tick_;
+            entry.metadata = *metadata;
+            dirty_ = true;
+            trim_locked();
+        } else {
+            stats_.failures++;
+        }
+
+        // Save once per burst rather than once per file
+        if (dirty_ && in_flight_ == 0 && queue_.empty()) {
+            save_locked();
+        }
+    }
+
+    for (auto& waiter : waiters) {
+        if (metadata && waiter.on_success) {
+            waiter.on_success(*metadata);
+        } else if (!metadata && waiter.on_error) {
+            waiter.on_error(error);
+        }
+    }
+
+    pump();
+}
+
+size_t FileMetadataCache::revalidate(const std::string& directory,
+                                     const std::vector<FileInfo>& listing) {
+    std::unordered_map<std::string, int64_t> current;
+    current.reserve(listing.size());
+    for (const auto& file : listing) {
+        if (file.is_dir) {
+            continue;
+        }
+        const std::string& name = file.path.empty() ? file.filename : file.path;
+        std::string path =
+            directory.empty() || !file.path.empty() ? name : directory + "/" + name;
+        current.emplace(std::move(path), modified_key(file.modified));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    load_locked();
+    size_t removed = 0;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (parent_directory(it->first) != directory) {
+            ++it;
+            continue;
+        }
+        auto listed = current.find(it->first);
+        if (listed == current.end() || listed->second != it->second.modified) {
+            it = entries_.erase(it);
+            removed++;
+        } else {
+            ++it;
+        }
+    }
+
+    if (removed > 0) {
+        spdlog::debug("[FileMetadataCache] Dropped {} stale entries in '{}'", removed, directory);
+        dirty_ = true;
+        if (in_flight_ == 0 && queue_.empty()) {
+            save_locked();
+        }
+    }
+    return removed;
+}
+
+bool FileMetadataCache::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !dirty_ || save_locked();
+}
+
+void FileMetadataCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    loaded_ = true;
+    dirty_ = false;
+    if (!file_path_.empty()) {
+        std::error_code ec;
+        fs::remove(file_path_, ec);
+    }
+}
+
+FileMetadataCache::Stats FileMetadataCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats = stats_;
+    stats.in_flight = in_flight_;
+    stats.queued = queue_.size();
+    stats.entries = entries_.size();
+    return stats;
+}
+
+void FileMetadataCache::load_locked() {
+    if (loaded_) {
+        return;
+    }
+    loaded_ = true;
+    if (file_path_.empty()) {
+        return;
+    }
+
+    std::ifstream in(file_path_);
+    if (!in) {
+        return;
+    }
+    try {
+        nlohmann::json root = nlohmann::json::parse(in);
+        if (json_value<int>(root, "version", 0) != FORMAT_VERSION) {
+            spdlog::info("[FileMetadataCache] Ignoring cache file with old format");
+            return;
+        }
+        const auto& entries = root.at("entries");
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            Entry entry;
+            entry.modified = json_value<int64_t>(*it, "modified", 0);
+            entry.used = json_value<uint64_t>(*it, "used", 0);
+            entry.metadata = file_metadata_from_json(it->value("metadata", nlohmann::json()));
+            tick_ = std::max(tick_, entry.used);
+            entries_[it.key()] = std::move(entry);
+        }
+        spdlog::debug("[FileMetadataCache] Loaded {} entries from {}", entries_.size(),
+                      file_path_);
+    } catch (const nlohmann::json::exception& e) {
+        spdlog::warn("[FileMetadataCache] Discarding unreadable cache file {}: {}", file_path_,
+                     e.what());
+        entries_.clear();
+    }
+}
+
+bool FileMetadataCache::save_locked() {
+    if (file_path_.empty()) {
+        dirty_ = false;
+        return true;
+    }
+
+    nlohmann::json entries = nlohmann::json::object();
+    for (const auto& [path, entry] : entries_) {
+        entries[path] = {{"modified", entry.modified},
+                         {"used", entry.used},
+                         {"metadata", file_metadata_to_json(entry.metadata)}};
+    }
+    nlohmann::json root = {{"version", FORMAT_VERSION}, {"entries", std::move(entries)}};
+
+    // Write-then-rename so a crash never leaves a truncated cache behind
+    std::string tmp_path = file_path_ + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::trunc);
+        out << root.dump();
+        if (!out) {
+            spdlog::warn("[FileMetadataCache] Failed to write {}", tmp_path);
+            return false;
+        }
+    }
+    std::error_code ec;
+    fs::rename(tmp_path, file_path_, ec);
+    if (ec) {
+        spdlog::warn("[FileMetadataCache] Failed to replace {}: {}", file_path_, ec.message());
+        fs::remove(tmp_path, ec);
+        return false;
+    }
+    dirty_ = false;
+    return true;
+}
+
+void FileMetadataCache::trim_locked() {
+    if (entries_.size() <= max_entries_) {
+        return;
+    }
+    std::vector<std::pair<uint64_t, std::string>> by_use;
+    by_use.reserve(entries_.size());
+    for (const auto& [path, entry] : entries_) {
+        by_use.emplace_back(entry.used, path);
+    }
+    size_t excess = entries_.size() - max_entries_;
+    std::nth_element(by_use.begin(), by_use.begin() + static_cast<ptrdiff_t>(excess),
+                     by_use.end());
+    for (size_t i = 0; i < excess; ++i) {
+        entries_.erase(by_use[i].second);
+    }
+}
+
+} // namespace helix
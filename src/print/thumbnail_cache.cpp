@@ -694,6 +694,15 @@ void ThumbnailCache::fetch_optimized(MoonrakerAPI* api, const std::string& relat
                                      const helix::ThumbnailTarget& target,
                                      SuccessCallback on_success, ErrorCallback on_error,
                                      time_t source_modified) {
+    fetch_optimized_targets(api, relative_path, {target}, std::move(on_success),
+                            std::move(on_error), source_modified);
+}
+
+void ThumbnailCache::fetch_optimized_targets(MoonrakerAPI* api, const std::string& relative_path,
+                                             const std::vector<helix::ThumbnailTarget>& targets,
+                                             SuccessCallback on_success, ErrorCallback on_error,
+                                             time_t source_modified) {
+    const helix::ThumbnailTarget& target = targets.front();
     if (relative_path.empty()) {
         if (on_error) {
             on_error("Empty thumbnail path");
@@ -716,7 +725,7 @@ void ThumbnailCache::fetch_optimized(MoonrakerAPI* api, const std::string& relat
     if (!cached_png.empty()) {
         // PNG exists and is fresh, queue for pre-scaling
         spdlog::trace("[ThumbnailCache] PNG cached, queuing pre-scale: {}", relative_path);
-        process_and_callback(cached_png, relative_path, target, on_success, on_error);
+        process_and_callback(cached_png, relative_path, targets, on_success, on_error);
         return;
     }
 
@@ -748,13 +757,13 @@ void ThumbnailCache::fetch_optimized(MoonrakerAPI* api, const std::string& relat
     api->download_thumbnail(
         relative_path, cache_path,
         // Success callback - PNG downloaded, now pre-scale it
-        [this, on_success, on_error, relative_path, target](const std::string& local_path) {
+        [this, on_success, on_error, relative_path, targets](const std::string& local_path) {
             spdlog::trace("[ThumbnailCache] Downloaded, now pre-scaling: {}", local_path);
             evict_if_needed();
 
             // Process the downloaded PNG
             std::string lvgl_path = to_lvgl_path(local_path);
-            process_and_callback(lvgl_path, relative_path, target, on_success, on_error);
+            process_and_callback(lvgl_path, relative_path, targets, on_success, on_error);
         },
         // Error callback - download failed
         [on_error, relative_path](const MoonrakerError& error) {
@@ -768,7 +777,7 @@ void ThumbnailCache::fetch_optimized(MoonrakerAPI* api, const std::string& relat
 
 void ThumbnailCache::process_and_callback(const std::string& png_lvgl_path,
                                           const std::string& source_path,
-                                          const helix::ThumbnailTarget& target,
+                                          std::vector<helix::ThumbnailTarget> targets,
                                           SuccessCallback on_success, ErrorCallback on_error) {
     // This function uses graceful fallback - on failure, it calls on_success with
     // the PNG path instead of calling on_error. The PNG still works, just slower.
@@ -804,9 +813,18 @@ void ThumbnailCache::process_and_callback(const std::string& png_lvgl_path,
     }
     file.close();
 
+    // Companion sizes share this decode unless an earlier pass already produced them
+    auto& processor = helix::ThumbnailProcessor::instance();
+    targets.erase(std::remove_if(targets.begin() + 1, targets.end(),
+                                 [&](const helix::ThumbnailTarget& companion) {
+                                     return !processor.get_if_processed(source_path, companion)
+                                                 .empty();
+                                 }),
+                  targets.end());
+
     // Queue for background processing
-    helix::ThumbnailProcessor::instance().process_async(
-        png_data, source_path, target,
+    processor.process_async(
+        png_data, source_path, targets,
         // Success - return optimized path
         [on_success](const std::string& lvbin_path) {
             spdlog::debug("[ThumbnailCache] Pre-scaling complete: {}", lvbin_path);
@@ -846,15 +864,18 @@ void ThumbnailCache::fetch_for_detail_view(MoonrakerAPI* api, const std::string&
         }
     };
 
-    helix::ThumbnailTarget target =
-        helix::ThumbnailProcessor::get_target_for_display(helix::ThumbnailSize::Detail);
+    // The card size rides along so the file list reuses this decode
+    std::vector<helix::ThumbnailTarget> targets = {
+        helix::ThumbnailProcessor::get_target_for_display(helix::ThumbnailSize::Detail),
+        helix::ThumbnailProcessor::get_target_for_display(helix::ThumbnailSize::Card)};
 
-    fetch_optimized(
-        api, relative_path, target, std::move(guarded_success),
+    fetch_optimized_targets(
+        api, relative_path, targets, std::move(guarded_success),
         on_error ? std::move(on_error) : [relative_path](const std::string& error) {
             spdlog::warn("[ThumbnailCache] Detail view fetch failed for {}: {}", relative_path,
                          error);
-        });
+        },
+        0);
 }
 
 void ThumbnailCache::fetch_for_card_view(MoonrakerAPI* api, const std::string& relative_path,
@@ -875,12 +896,16 @@ void ThumbnailCache::fetch_for_card_view(MoonrakerAPI* api, const std::string& r
         }
     };
 
-    helix::ThumbnailTarget target = helix::ThumbnailProcessor::get_target_for_display();
+    // The detail size rides along so opening the file is a cache hit
+    std::vector<helix::ThumbnailTarget> targets = {
+        helix::ThumbnailProcessor::get_target_for_display(helix::ThumbnailSize::Card),
+        helix::ThumbnailProcessor::get_target_for_display(helix::ThumbnailSize::Detail)};
 
-    fetch_optimized(api, relative_path, target, std::move(guarded_success),
-                    on_error ? std::move(on_error) : [relative_path](const std::string& error) {
-                        spdlog::warn("[ThumbnailCache] Card view fetch failed for {}: {}",
-                                     relative_path, error);
-                    },
-                    source_modified);
+    fetch_optimized_targets(
+        api, relative_path, targets, std::move(guarded_success),
+        on_error ? std::move(on_error) : [relative_path](const std::string& error) {
+            spdlog::warn("[ThumbnailCache] Card view fetch failed for {}: {}", relative_path,
+                         error);
+        },
+        source_modified);
 }
@@ -9,11 +9,13 @@
 
 #include "ui_update_queue.h"
 
+#include "config.h"
 #include "memory_monitor.h"
 
 #include <hv/hthreadpool.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
@@ -33,9 +35,6 @@ namespace helix {
 // This is just a fallback for early initialization before ThumbnailCache runs.
 static constexpr const char* DEFAULT_CACHE_DIR = "/tmp/helix_thumbs";
 
-// LVGL 9 color format constant (magic comes from lv_image_dsc.h)
-static constexpr uint8_t COLOR_FORMAT_ARGB8888 = 0x10;
-
 // Thread pool configuration
 static constexpr int MIN_WORKER_THREADS = 1;
 static constexpr int MAX_WORKER_THREADS = 2; // Don't starve UI thread on single-core
@@ -45,6 +44,21 @@ static constexpr size_t MAX_PNG_INPUT_SIZE = 10 * 1024 * 1024; // 10 MB compress
 static constexpr int MAX_SOURCE_DIMENSION = 4096;              // 4K max source
 static constexpr int MAX_OUTPUT_DIMENSION = 1024;              // 1K max output
 
+// 4x4 Bayer matrix (values 0..15) for ordered dithering to RGB565
+static constexpr uint8_t BAYER_4X4[4][4] = {
+    {0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+
+static const char* color_format_name(uint8_t color_format) {
+    switch (color_format) {
+    case THUMBNAIL_FORMAT_RGB565:
+        return "RGB565";
+    case THUMBNAIL_FORMAT_RGB565A8:
+        return "RGB565A8";
+    default:
+        return "ARGB8888";
+    }
+}
+
 // ============================================================================
 // Singleton
 // ============================================================================
@@ -98,6 +112,15 @@ void ThumbnailProcessor::process_async(const std::vector<uint8_t>& png_data,
                                        const ThumbnailTarget& target,
                                        ProcessSuccessCallback on_success,
                                        ProcessErrorCallback on_error) {
+    process_async(png_data, source_path, std::vector<ThumbnailTarget>{target},
+                  std::move(on_success), std::move(on_error));
+}
+
+void ThumbnailProcessor::process_async(const std::vector<uint8_t>& png_data,
+                                       const std::string& source_path,
+                                       const std::vector<ThumbnailTarget>& targets,
+                                       ProcessSuccessCallback on_success,
+                                       ProcessErrorCallback on_error) {
     // Copy cache_dir under lock to avoid race with set_cache_dir()
     std::string cache_dir_copy;
     {
@@ -117,12 +140,18 @@ void ThumbnailProcessor::process_async(const std::vector<uint8_t>& png_data,
 
     thread_pool_->commit(
         [this, png_copy = std::move(png_copy), source_copy = std::move(source_copy),
-         cache_dir_copy = std::move(cache_dir_copy), target, on_success, on_error]() {
-            ProcessResult result = do_process(png_copy, source_copy, target, cache_dir_copy);
+         cache_dir_copy = std::move(cache_dir_copy), targets, on_success, on_error]() {
+            std::vector<ProcessResult> results =
+                do_process(png_copy, source_copy, targets, cache_dir_copy);
+            ProcessResult result = results.empty() ? ProcessResult{} : results.front();
+            if (results.empty()) {
+                result.error = "No thumbnail targets";
+            }
 
             if (result.success) {
-                spdlog::debug("[ThumbnailProcessor] Processed {} -> {} ({}x{})", source_copy,
-                              result.output_path, result.output_width, result.output_height);
+                spdlog::debug("[ThumbnailProcessor] Processed {} -> {} ({}x{}, {} extra)",
+                              source_copy, result.output_path, result.output_width,
+                              result.output_height, results.size() - 1);
                 if (on_success) {
                     // CRITICAL: Defer callback to main UI thread to avoid LVGL threading issues.
                     // Without this, callbacks can trigger widget operations from worker thread,
@@ -162,7 +191,19 @@ ProcessResult ThumbnailProcessor::process_sync(const std::vector<uint8_t>& png_d
         std::lock_guard<std::mutex> lock(mutex_);
         cache_dir_copy = cache_dir_;
     }
-    return do_process(png_data, source_path, target, cache_dir_copy);
+    return do_process(png_data, source_path, {target}, cache_dir_copy).front();
+}
+
+std::vector<ProcessResult>
+ThumbnailProcessor::process_sync(const std::vector<uint8_t>& png_data,
+                                 const std::string& source_path,
+                                 const std::vector<ThumbnailTarget>& targets) {
+    std::string cache_dir_copy;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cache_dir_copy = cache_dir_;
+    }
+    return do_process(png_data, source_path, targets, cache_dir_copy);
 }
 
 std::string ThumbnailProcessor::get_if_processed(const std::string& source_path,
@@ -188,7 +229,7 @@ std::string ThumbnailProcessor::get_if_processed(const std::string& source_path,
 ThumbnailTarget ThumbnailProcessor::get_target_for_resolution(int width, int height,
                                                               ThumbnailSize size) {
     ThumbnailTarget target;
-    target.color_format = COLOR_FORMAT_ARGB8888;
+    target.color_format = THUMBNAIL_FORMAT_ARGB8888;
 
     // Defensive: treat invalid dimensions as smallest breakpoint
     if (width <= 0 || height <= 0) {
@@ -246,13 +287,86 @@ ThumbnailTarget ThumbnailProcessor::get_target_for_display(ThumbnailSize size) {
 
     ThumbnailTarget target = get_target_for_resolution(hor_res, ver_res, size);
 
+    // Match a 16-bit framebuffer so LVGL blits thumbnails without per-frame conversion
+    if (lv_display_get_color_format(display) == LV_COLOR_FORMAT_RGB565) {
+        target.color_format = THUMBNAIL_FORMAT_RGB565;
+        Config* config = Config::get_instance();
+        target.dither = config && config->get<bool>("/display/thumbnail_dither", false);
+    }
+
     const char* size_str = (size == ThumbnailSize::Detail) ? "detail" : "card";
-    spdlog::trace("[ThumbnailProcessor] Display {}x{} → target {}x{} ({}, ARGB8888)", hor_res,
-                  ver_res, target.width, target.height, size_str);
+    spdlog::trace("[ThumbnailProcessor] Display {}x{} → target {}x{} ({}, {}{})", hor_res,
+                  ver_res, target.width, target.height, size_str,
+                  color_format_name(target.color_format), target.dither ? ", dithered" : "");
 
     return target;
 }
 
+int ThumbnailProcessor::get_stride(uint8_t color_format, int width) {
+    // RGB565A8 stride describes the RGB565 plane; the A8 plane follows at width bytes/row
+    if (color_format == THUMBNAIL_FORMAT_RGB565 || color_format == THUMBNAIL_FORMAT_RGB565A8) {
+        return width * 2;
+    }
+    return width * 4;
+}
+
+std::vector<uint8_t> ThumbnailProcessor::convert_pixels(const uint8_t* rgba, int width,
+                                                        int height, const ThumbnailTarget& target,
+                                                        uint8_t& out_color_format) {
+    const size_t pixel_count = static_cast<size_t>(width) * height;
+
+    if (target.color_format != THUMBNAIL_FORMAT_RGB565 &&
+        target.color_format != THUMBNAIL_FORMAT_RGB565A8) {
+        // LV_COLOR_FORMAT_ARGB8888 on little-endian is stored as B,G,R,A in memory
+        // because when read as uint32_t, it's 0xAARRGGBB
+        std::vector<uint8_t> out(rgba, rgba + pixel_count * 4);
+        for (size_t i = 0; i < out.size(); i += 4) {
+            std::swap(out[i], out[i + 2]);
+        }
+        out_color_format = THUMBNAIL_FORMAT_ARGB8888;
+        return out;
+    }
+
+    // Only carry an alpha plane when the thumbnail actually needs one
+    bool has_alpha = false;
+    for (size_t i = 0; i < pixel_count && !has_alpha; ++i) {
+        has_alpha = rgba[i * 4 + 3] != 0xFF;
+    }
+    out_color_format = has_alpha ? THUMBNAIL_FORMAT_RGB565A8 : THUMBNAIL_FORMAT_RGB565;
+
+    std::vector<uint8_t> out(pixel_count * (has_alpha ? 3 : 2));
+    uint8_t* alpha_plane = out.data() + pixel_count * 2;
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const size_t i = static_cast<size_t>(y) * width + x;
+            const uint8_t* px = rgba + i * 4;
+            int r = px[0];
+            int g = px[1];
+            int b = px[2];
+
+            if (target.dither) {
+                // Offsets cover one quantization step (8 for 5-bit, 4 for 6-bit) from zero
+                // up: the shifts below truncate, so a tile averages back to the input
+                const int t = BAYER_4X4[y & 3][x & 3];
+                r = std::min(r + t / 2, 255);
+                g = std::min(g + t / 4, 255);
+                b = std::min(b + t / 2, 255);
+            }
+
+            const uint16_t rgb565 =
+                static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+            out[i * 2] = static_cast<uint8_t>(rgb565 & 0xFF);
+            out[i * 2 + 1] = static_cast<uint8_t>(rgb565 >> 8);
+            if (has_alpha) {
+                alpha_plane[i] = px[3];
+            }
+        }
+    }
+
+    return out;
+}
+
 void ThumbnailProcessor::set_cache_dir(const std::string& path) {
     std::lock_guard<std::mutex> lock(mutex_);
     if (cache_dir_ != path) {
@@ -306,8 +420,12 @@ std::string ThumbnailProcessor::generate_cache_filename(const std::string& sourc
     std::hash<std::string> hasher;
     size_t hash = hasher(source_path);
 
-    // Always ARGB8888 now
+    // RGB565 and RGB565A8 share a name; the .bin header records which one was written
     const char* format_str = "ARGB8888";
+    if (target.color_format == THUMBNAIL_FORMAT_RGB565 ||
+        target.color_format == THUMBNAIL_FORMAT_RGB565A8) {
+        format_str = target.dither ? "RGB565D" : "RGB565";
+    }
 
     // Generate filename: {hash}_{w}x{h}_{format}.bin
     // NOTE: Must use .bin extension for LVGL's bin decoder (lv_bin_decoder.c only accepts .bin)
@@ -318,26 +436,29 @@ std::string ThumbnailProcessor::generate_cache_filename(const std::string& sourc
     return filename;
 }
 
-ProcessResult ThumbnailProcessor::do_process(const std::vector<uint8_t>& png_data,
-                                             const std::string& source_path,
-                                             const ThumbnailTarget& target,
-                                             const std::string& cache_dir) {
-    ProcessResult result;
+std::vector<ProcessResult> ThumbnailProcessor::do_process(
+    const std::vector<uint8_t>& png_data, const std::string& source_path,
+    const std::vector<ThumbnailTarget>& targets, const std::string& cache_dir) {
+    std::vector<ProcessResult> results(targets.size());
+    auto fail_all = [&results](const std::string& error) {
+        for (auto& result : results) {
+            result.error = error;
+        }
+        return results;
+    };
 
     if (png_data.empty()) {
-        result.error = "Empty PNG data";
-        return result;
+        return fail_all("Empty PNG data");
     }
 
     // Safety check: reject excessively large PNG files
     if (png_data.size() > MAX_PNG_INPUT_SIZE) {
-        result.error = "PNG too large (" + std::to_string(png_data.size() / 1024 / 1024) +
-                       " MB, max " + std::to_string(MAX_PNG_INPUT_SIZE / 1024 / 1024) + " MB)";
-        return result;
+        return fail_all("PNG too large (" + std::to_string(png_data.size() / 1024 / 1024) +
+                        " MB, max " + std::to_string(MAX_PNG_INPUT_SIZE / 1024 / 1024) + " MB)");
     }
 
     // ========================================================================
-    // Step 1: Decode PNG with stb_image
+    // Step 1: Decode PNG with stb_image (once, shared by every target)
     // ========================================================================
     int src_width = 0, src_height = 0, src_channels = 0;
 
@@ -350,100 +471,102 @@ ProcessResult ThumbnailProcessor::do_process(const std::vector<uint8_t>& png_dat
     );
 
     if (!src_pixels) {
-        result.error = std::string("Failed to decode PNG: ") + stbi_failure_reason();
-        return result;
+        return fail_all(std::string("Failed to decode PNG: ") + stbi_failure_reason());
     }
 
     // Safety check: reject excessively large decoded images
     if (src_width > MAX_SOURCE_DIMENSION || src_height > MAX_SOURCE_DIMENSION) {
         stbi_image_free(src_pixels);
-        result.error = "Source image too large (" + std::to_string(src_width) + "x" +
-                       std::to_string(src_height) + ", max " +
-                       std::to_string(MAX_SOURCE_DIMENSION) + ")";
-        return result;
+        return fail_all("Source image too large (" + std::to_string(src_width) + "x" +
+                        std::to_string(src_height) + ", max " +
+                        std::to_string(MAX_SOURCE_DIMENSION) + ")");
     }
 
     spdlog::trace("[ThumbnailProcessor] Decoded {}x{} ({} channels)", src_width, src_height,
                   src_channels);
 
-    // ========================================================================
-    // Step 2: Calculate output dimensions (preserve aspect ratio, cover target)
-    // ========================================================================
-    // Scale to fit within the target area while maintaining aspect ratio.
-    // Using min() ensures the image never exceeds the target dimensions.
-
-    float scale_x = static_cast<float>(target.width) / src_width;
-    float scale_y = static_cast<float>(target.height) / src_height;
-    float scale = std::min(scale_x, scale_y);
-
-    int out_width = static_cast<int>(src_width * scale);
-    int out_height = static_cast<int>(src_height * scale);
-
-    // Ensure minimum dimensions
-    out_width = std::max(out_width, 1);
-    out_height = std::max(out_height, 1);
-
-    // Clamp output dimensions to prevent integer overflow in buffer allocation
-    out_width = std::min(out_width, MAX_OUTPUT_DIMENSION);
-    out_height = std::min(out_height, MAX_OUTPUT_DIMENSION);
-
-    spdlog::trace("[ThumbnailProcessor] Scaling {}x{} -> {}x{} (scale: {:.2f})", src_width,
-                  src_height, out_width, out_height, scale);
-
-    // ========================================================================
-    // Step 3: Resize with stb_image_resize (high-quality Mitchell filter)
-    // ========================================================================
-    std::vector<unsigned char> resized_pixels(out_width * out_height * 4);
-
-    int resize_result =
-        stbir_resize_uint8(src_pixels, src_width, src_height, 0,            // input
-                           resized_pixels.data(), out_width, out_height, 0, // output
-                           4                                                // RGBA channels
-        );
-
-    // Free source pixels - we're done with them
-    stbi_image_free(src_pixels);
-
-    if (!resize_result) {
-        result.error = "Failed to resize image";
-        return result;
-    }
-
-    // ========================================================================
-    // Step 4: Convert RGBA to ARGB8888 (LVGL's expected format)
-    // ========================================================================
-    // stb_image gives us RGBA (R,G,B,A order)
-    // LVGL ARGB8888 expects (B,G,R,A order) - actually BGRA in memory
-    //
-    // Wait, let's check the LVGL format more carefully...
-    // LV_COLOR_FORMAT_ARGB8888 on little-endian is stored as B,G,R,A in memory
-    // because when read as uint32_t, it's 0xAARRGGBB
-
-    for (size_t i = 0; i < resized_pixels.size(); i += 4) {
-        // Swap R and B channels: RGBA -> BGRA
-        std::swap(resized_pixels[i], resized_pixels[i + 2]);
-    }
+    for (size_t t = 0; t < targets.size(); ++t) {
+        const ThumbnailTarget& target = targets[t];
+        ProcessResult& result = results[t];
+
+        // ====================================================================
+        // Step 2: Calculate output dimensions (preserve aspect ratio, cover target)
+        // ====================================================================
+        // Scale to fit within the target area while maintaining aspect ratio.
+        // Using min() ensures the image never exceeds the target dimensions.
+
+        float scale_x = static_cast<float>(target.width) / src_width;
+        float scale_y = static_cast<float>(target.height) / src_height;
+        float scale = std::min(scale_x, scale_y);
+
+        int out_width = static_cast<int>(src_width * scale);
+        int out_height = static_cast<int>(src_height * scale);
+
+        // Ensure minimum dimensions
+        out_width = std::max(out_width, 1);
+        out_height = std::max(out_height, 1);
+
+        // Clamp output dimensions to prevent integer overflow in buffer allocation
+        out_width = std::min(out_width, MAX_OUTPUT_DIMENSION);
+        out_height = std::min(out_height, MAX_OUTPUT_DIMENSION);
+
+        spdlog::trace("[ThumbnailProcessor] Scaling {}x{} -> {}x{} (scale: {:.2f})", src_width,
+                      src_height, out_width, out_height, scale);
+
+        // ====================================================================
+        // Step 3: Resize with stb_image_resize (high-quality Mitchell filter)
+        // ====================================================================
+        std::vector<unsigned char> resized_pixels(static_cast<size_t>(out_width) * out_height *
+                                                  4);
+
+        int resize_result =
+            stbir_resize_uint8(src_pixels, src_width, src_height, 0,            // input
+                               resized_pixels.data(), out_width, out_height, 0, // output
+                               4                                                // RGBA channels
+            );
+
+        if (!resize_result) {
+            result.error = "Failed to resize image";
+            continue;
+        }
 
-    helix::MemoryMonitor::log_now("thumbnail_resize_done");
+        // ====================================================================
+        // Step 4: Convert RGBA to the display-native format
+        // ====================================================================
+        uint8_t out_format = THUMBNAIL_FORMAT_ARGB8888;
+        std::vector<uint8_t> pixel_data =
+            convert_pixels(resized_pixels.data(), out_width, out_height, target, out_format);
+
+        helix::MemoryMonitor::log_now("thumbnail_resize_done");
+
+        // ====================================================================
+        // Step 5: Write LVGL binary file
+        // ====================================================================
+        std::string filename = generate_cache_filename(source_path, target);
+        std::string output_path = cache_dir + "/" + filename;
+
+        if (!write_lvbin(output_path, out_width, out_height, out_format, pixel_data.data(),
+                         pixel_data.size())) {
+            result.error = "Failed to write .bin file";
+            continue;
+        }
 
-    // ========================================================================
-    // Step 5: Write LVGL binary file
-    // ========================================================================
-    std::string filename = generate_cache_filename(source_path, target);
-    std::string output_path = cache_dir + "/" + filename;
+        spdlog::debug("[ThumbnailProcessor] {}x{} {}: {} bytes (ARGB8888 would be {})", out_width,
+                      out_height, color_format_name(out_format), pixel_data.size(),
+                      static_cast<size_t>(out_width) * out_height * 4);
 
-    if (!write_lvbin(output_path, out_width, out_height, target.color_format, resized_pixels.data(),
-                     resized_pixels.size())) {
-        result.error = "Failed to write .bin file";
-        return result;
+        result.success = true;
+        result.output_path = "A:" + output_path;
+        result.output_width = out_width;
+        result.output_height = out_height;
+        result.output_format = out_format;
+        result.output_bytes = pixel_data.size();
     }
 
-    result.success = true;
-    result.output_path = "A:" + output_path;
-    result.output_width = out_width;
-    result.output_height = out_height;
+    // Free source pixels - every target has been resized from them
+    stbi_image_free(src_pixels);
 
-    return result;
+    return results;
 }
 
 bool ThumbnailProcessor::write_lvbin(const std::string& path, int width, int height,
@@ -465,9 +588,7 @@ bool ThumbnailProcessor::write_lvbin(const std::string& path, int width, int hei
     // This ensures correct byte layout regardless of compiler/platform,
     // as we're using the same struct LVGL uses to read the file.
 
-    // Always ARGB8888 (4 bytes per pixel) — kept generic for header correctness
-    int bytes_per_pixel = 4;
-    int stride = width * bytes_per_pixel;
+    int stride = get_stride(color_format, width);
 
     lv_image_header_t header = {};
     header.magic = LV_IMAGE_HEADER_MAGIC;
@@ -71,10 +71,19 @@ void PrinterCalibrationState::reset_for_testing() {
 }
 
 void PrinterCalibrationState::update_from_status(const nlohmann::json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool PrinterCalibrationState::handles_status_object(const std::string& object) const {
+    return object == "manual_probe" || object == "toolhead" || object == "stepper_enable" ||
+           object == "firmware_retraction";
+}
+
+void PrinterCalibrationState::update_from_objects(const StatusObjects& objects) {
     // Update manual probe state (for Z-offset calibration)
     // Klipper's manual_probe object is active during PROBE_CALIBRATE and Z_ENDSTOP_CALIBRATE
-    if (status.contains("manual_probe")) {
-        const auto& mp = status["manual_probe"];
+    if (const auto* found = objects.find("manual_probe")) {
+        const auto& mp = *found;
 
         if (mp.contains("is_active") && mp["is_active"].is_boolean()) {
             bool is_active = mp["is_active"].get<bool>();
@@ -100,8 +109,8 @@ void PrinterCalibrationState::update_from_status(const nlohmann::json& status) {
     // Update motor enabled state from toolhead.homed_axes (primary) and stepper_enable (fallback)
     // M84 clears homed_axes on all Klipper printers, making it the most reliable indicator.
     // stepper_enable.steppers is more precise but not reported by all firmware (e.g. AD5M).
-    if (status.contains("toolhead")) {
-        const auto& toolhead = status["toolhead"];
+    if (const auto* found = objects.find("toolhead")) {
+        const auto& toolhead = *found;
 
         if (toolhead.contains("homed_axes") && toolhead["homed_axes"].is_string()) {
             std::string axes = toolhead["homed_axes"].get<std::string>();
@@ -117,8 +126,8 @@ void PrinterCalibrationState::update_from_status(const nlohmann::json& status) {
     }
 
     // Fallback: stepper_enable.steppers (not reported by all firmware)
-    if (status.contains("stepper_enable")) {
-        const auto& se = status["stepper_enable"];
+    if (const auto* found = objects.find("stepper_enable")) {
+        const auto& se = *found;
 
         if (se.contains("steppers") && se["steppers"].is_object()) {
             bool any_enabled = false;
@@ -141,8 +150,8 @@ void PrinterCalibrationState::update_from_status(const nlohmann::json& status) {
     }
 
     // Parse firmware_retraction settings (G10/G11 retraction parameters)
-    if (status.contains("firmware_retraction")) {
-        const auto& fr = status["firmware_retraction"];
+    if (const auto* found = objects.find("firmware_retraction")) {
+        const auto& fr = *found;
 
         if (fr.contains("retract_length") && fr["retract_length"].is_number()) {
             // Store as centimillimeters (x100) to preserve 0.01mm precision
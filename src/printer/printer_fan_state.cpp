@@ -67,9 +67,18 @@ void PrinterFanState::deinit_subjects() {
 }
 
 void PrinterFanState::update_from_status(const nlohmann::json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool PrinterFanState::handles_status_object(const std::string& object) const {
+    return object == "fan" || object.rfind("heater_fan ", 0) == 0 ||
+           object.rfind("fan_generic ", 0) == 0 || object.rfind("controller_fan ", 0) == 0;
+}
+
+void PrinterFanState::update_from_objects(const StatusObjects& objects) {
     // Update main part-cooling fan speed
-    if (status.contains("fan")) {
-        const auto& fan = status["fan"];
+    if (const auto* found = objects.find("fan")) {
+        const auto& fan = *found;
         spdlog::trace("[PrinterFanState] Received fan status update: {}", fan.dump());
 
         if (fan.contains("speed") && fan["speed"].is_number()) {
@@ -85,7 +94,9 @@ void PrinterFanState::update_from_status(const nlohmann::json& status) {
 
     // Check for other fan types in the status update
     // Moonraker sends fan objects as top-level keys: "heater_fan hotend_fan", "fan_generic xyz"
-    for (const auto& [key, value] : status.items()) {
+    for (const auto& entry : objects) {
+        const std::string& key = *entry.name;
+        const auto& value = *entry.value;
         // Skip non-fan objects
         if (key.rfind("heater_fan ", 0) == 0 || key.rfind("fan_generic ", 0) == 0 ||
             key.rfind("controller_fan ", 0) == 0) {
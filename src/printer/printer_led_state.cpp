@@ -50,13 +50,22 @@ void PrinterLedState::deinit_subjects() {
 }
 
 void PrinterLedState::update_from_status(const nlohmann::json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool PrinterLedState::handles_status_object(const std::string& object) const {
+    return !tracked_led_name_.empty() && object == tracked_led_name_;
+}
+
+void PrinterLedState::update_from_objects(const StatusObjects& objects) {
     // Update LED state if we're tracking an LED
     // LED object names in Moonraker are like "neopixel chamber_light" or "led status_led"
-    if (tracked_led_name_.empty() || !status.contains(tracked_led_name_)) {
+    const auto* found = tracked_led_name_.empty() ? nullptr : objects.find(tracked_led_name_);
+    if (!found) {
         return;
     }
 
-    const auto& led = status[tracked_led_name_];
+    const auto& led = *found;
 
     if (!led.contains("color_data") || !led["color_data"].is_array() || led["color_data"].empty()) {
         return;
@@ -59,9 +59,17 @@ void PrinterMotionState::deinit_subjects() {
 }
 
 void PrinterMotionState::update_from_status(const nlohmann::json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool PrinterMotionState::handles_status_object(const std::string& object) const {
+    return object == "toolhead" || object == "gcode_move";
+}
+
+void PrinterMotionState::update_from_objects(const StatusObjects& objects) {
     // Update toolhead position
-    if (status.contains("toolhead")) {
-        const auto& toolhead = status["toolhead"];
+    if (const auto* found = objects.find("toolhead")) {
+        const auto& toolhead = *found;
 
         if (toolhead.contains("position") && toolhead["position"].is_array()) {
             const auto& pos = toolhead["position"];
@@ -83,8 +91,8 @@ void PrinterMotionState::update_from_status(const nlohmann::json& status) {
     }
 
     // Update gcode_move data (commanded position, speed/flow factors, z-offset)
-    if (status.contains("gcode_move")) {
-        const auto& gcode_move = status["gcode_move"];
+    if (const auto* found = objects.find("gcode_move")) {
+        const auto& gcode_move = *found;
 
         // Parse commanded position from gcode_move.gcode_position
         // Note: gcode_move.position is raw commanded, gcode_move.gcode_position is effective
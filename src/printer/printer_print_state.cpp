@@ -131,13 +131,21 @@ void PrinterPrintState::reset_for_new_print() {
 }
 
 void PrinterPrintState::update_from_status(const nlohmann::json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool PrinterPrintState::handles_status_object(const std::string& object) const {
+    return object == "print_stats" || object == "virtual_sdcard";
+}
+
+void PrinterPrintState::update_from_objects(const StatusObjects& objects) {
     // IMPORTANT: Process print_stats BEFORE virtual_sdcard.
     // The print_state_enum_ observer fires synchronously and reads print_progress_
     // for mid-print detection (should_start_print_collector). If virtual_sdcard is
     // processed first, progress is already non-zero when the observer fires, causing
     // false mid-print detection and preventing the print start collector from activating.
-    if (status.contains("print_stats")) {
-        const auto& stats = status["print_stats"];
+    if (const auto* found = objects.find("print_stats")) {
+        const auto& stats = *found;
 
         if (stats.contains("state")) {
             std::string state_str = stats["state"].get<std::string>();
@@ -276,8 +284,8 @@ void PrinterPrintState::update_from_status(const nlohmann::json& status) {
     }
 
     // Update print progress (virtual_sdcard) - processed AFTER print_stats
-    if (status.contains("virtual_sdcard")) {
-        const auto& sdcard = status["virtual_sdcard"];
+    if (const auto* found = objects.find("virtual_sdcard")) {
+        const auto& sdcard = *found;
 
         if (sdcard.contains("progress") && sdcard["progress"].is_number()) {
             int progress_pct = helix::units::json_to_percent(sdcard, "progress");
@@ -30,6 +30,7 @@
 #include "probe_sensor_manager.h"
 #include "runtime_config.h"
 #include "settings_manager.h"
+#include "status_router.h"
 #include "temperature_sensor_manager.h"
 #include "unit_conversions.h"
 #include "width_sensor_manager.h"
@@ -90,6 +91,17 @@ const char* print_job_state_to_string(PrintJobState state) {
 // PrinterState Implementation
 // ============================================================================
 
+namespace {
+
+/// Route a sensor manager singleton; instance() is looked up on use, not at registration
+template <typename Manager> void add_sensor_route(helix::StatusRouter& router, const char* name) {
+    router.add_handler(
+        name, [](const std::string& o) { return Manager::instance().handles_status_object(o); },
+        [](const helix::StatusObjects& o) { Manager::instance().update_from_objects(o); });
+}
+
+} // namespace
+
 PrinterState::PrinterState() {
     // Note: String buffer initialization is now handled by component classes:
     // - homed_axes_buf_ is now in motion_state_ component
@@ -99,6 +111,8 @@ PrinterState::PrinterState() {
 
     // Load user-configured capability overrides from helixconfig.json
     capability_overrides_.load_from_config();
+
+    init_status_routes();
 }
 
 PrinterState::~PrinterState() {}
@@ -316,118 +330,141 @@ void PrinterState::update_from_notification(const json& notification) {
     }
 }
 
-void PrinterState::update_from_status(const json& state) {
-    std::lock_guard<std::mutex> lock(state_mutex_);
-
-    // Debug: Check if we're in render phase (this should never be true)
-    LV_DEBUG_RENDER_STATE();
-
-    // Delegate temperature updates to temperature state component
-    temperature_state_.update_from_status(state);
+void PrinterState::init_status_routes() {
+    // Handlers run in registration order within one update, matching the order the
+    // components were updated in before routing (e.g. print_stats before sensors)
+    status_router_.add_handler(
+        "temperature",
+        [this](const std::string& o) { return temperature_state_.handles_status_object(o); },
+        [this](const helix::StatusObjects& o) { temperature_state_.update_from_objects(o); });
+    status_router_.add_handler(
+        "motion", [this](const std::string& o) { return motion_state_.handles_status_object(o); },
+        [this](const helix::StatusObjects& o) { motion_state_.update_from_objects(o); });
+    status_router_.add_handler(
+        "print", [this](const std::string& o) { return print_domain_.handles_status_object(o); },
+        [this](const helix::StatusObjects& o) { print_domain_.update_from_objects(o); });
 
-    // Delegate motion updates to motion state component
-    motion_state_.update_from_status(state);
+    // Extract kinematics type (determines if bed moves on Z or gantry moves)
+    // This is not part of motion_state_ as it affects printer_bed_moves_ subject
+    status_router_.add_handler(
+        "kinematics", [](const std::string& o) { return o == "toolhead"; },
+        [this](const helix::StatusObjects& o) {
+            const json* toolhead = o.find("toolhead");
+            if (toolhead && toolhead->contains("kinematics") &&
+                (*toolhead)["kinematics"].is_string()) {
+                set_kinematics((*toolhead)["kinematics"].get<std::string>());
+            }
+        });
 
-    // Delegate print updates to print state component
-    print_domain_.update_from_status(state);
+    status_router_.add_handler(
+        "fan", [this](const std::string& o) { return fan_state_.handles_status_object(o); },
+        [this](const helix::StatusObjects& o) { fan_state_.update_from_objects(o); });
+    status_router_.add_handler(
+        "led",
+        [this](const std::string& o) { return led_state_component_.handles_status_object(o); },
+        [this](const helix::StatusObjects& o) { led_state_component_.update_from_objects(o); });
+
+    // Exclude_object (mid-print object exclusion) and klippy state from webhooks
+    status_router_.add_handler(
+        "printer", [](const std::string& o) { return o == "exclude_object" || o == "webhooks"; },
+        [this](const helix::StatusObjects& o) {
+            if (const json* eo = o.find("exclude_object")) {
+                update_exclude_object(*eo);
+            }
+            if (const json* webhooks = o.find("webhooks")) {
+                update_webhooks(*webhooks);
+            }
+        });
 
-    // Note: Toolhead position, homed_axes, speed_factor, flow_factor, and gcode_z_offset
-    // are now updated by motion_state_.update_from_status() above
+    // Calibration updates (manual probe, motor state, firmware retraction)
+    status_router_.add_handler(
+        "calibration",
+        [this](const std::string& o) { return calibration_state_.handles_status_object(o); },
+        [this](const helix::StatusObjects& o) { calibration_state_.update_from_objects(o); });
 
-    // Extract kinematics type (determines if bed moves on Z or gantry moves)
-    // This is not part of motion_state_ as it affects printer_bed_moves_ subject
-    if (state.contains("toolhead")) {
-        const auto& toolhead = state["toolhead"];
-        if (toolhead.contains("kinematics") && toolhead["kinematics"].is_string()) {
-            std::string kin = toolhead["kinematics"].get<std::string>();
-            set_kinematics(kin);
-        }
-    }
+    // Sensor managers (FilamentSensorManager handles filament_switch_sensor and
+    // filament_motion_sensor)
+    add_sensor_route<helix::FilamentSensorManager>(status_router_, "filament_sensors");
+    add_sensor_route<helix::sensors::HumiditySensorManager>(status_router_, "humidity_sensors");
+    add_sensor_route<helix::sensors::WidthSensorManager>(status_router_, "width_sensors");
+    add_sensor_route<helix::sensors::ProbeSensorManager>(status_router_, "probe_sensors");
+    add_sensor_route<helix::sensors::AccelSensorManager>(status_router_, "accel_sensors");
+    add_sensor_route<helix::sensors::ColorSensorManager>(status_router_, "color_sensors");
+    add_sensor_route<helix::sensors::TemperatureSensorManager>(status_router_,
+                                                               "temperature_sensors");
+}
 
-    // Delegate fan state updates to fan component
-    fan_state_.update_from_status(state);
+void PrinterState::update_from_status(const json& state) {
+    std::lock_guard<std::mutex> lock(state_mutex_);
 
-    // Delegate LED state updates to LED component
-    led_state_component_.update_from_status(state);
+    // Debug: Check if we're in render phase (this should never be true)
+    LV_DEBUG_RENDER_STATE();
 
-    // Update exclude_object state (for mid-print object exclusion)
-    if (state.contains("exclude_object")) {
-        const auto& eo = state["exclude_object"];
+    // Each component only sees the objects it registered interest in (see init_status_routes)
+    status_router_.dispatch(state);
 
-        if (eo.contains("excluded_objects") && eo["excluded_objects"].is_array()) {
-            std::unordered_set<std::string> excluded;
-            for (const auto& obj : eo["excluded_objects"]) {
-                if (obj.is_string()) {
-                    excluded.insert(obj.get<std::string>());
-                }
-            }
-            // set_excluded_objects handles change detection and notification
-            // Note: We're inside state_mutex_ lock, but set_excluded_objects only modifies
-            // its own data and calls lv_subject_set_int which is safe
-            set_excluded_objects(excluded);
-        }
+    // Cache full state for complex queries
+    json_state_.merge_patch(state);
+}
 
-        // Parse defined objects list
-        if (eo.contains("objects") && eo["objects"].is_array()) {
-            std::vector<std::string> defined;
-            for (const auto& obj : eo["objects"]) {
-                if (obj.is_object() && obj.contains("name") && obj["name"].is_string()) {
-                    defined.push_back(obj["name"].get<std::string>());
-                }
+void PrinterState::update_exclude_object(const json& eo) {
+    if (eo.contains("excluded_objects") && eo["excluded_objects"].is_array()) {
+        std::unordered_set<std::string> excluded;
+        for (const auto& obj : eo["excluded_objects"]) {
+            if (obj.is_string()) {
+                excluded.insert(obj.get<std::string>());
             }
-            excluded_objects_state_.set_defined_objects(defined);
         }
+        // set_excluded_objects handles change detection and notification
+        // Note: We're inside state_mutex_ lock, but set_excluded_objects only modifies
+        // its own data and calls lv_subject_set_int which is safe
+        set_excluded_objects(excluded);
+    }
 
-        // Parse current object
-        if (eo.contains("current_object")) {
-            if (eo["current_object"].is_string()) {
-                excluded_objects_state_.set_current_object(eo["current_object"].get<std::string>());
-            } else if (eo["current_object"].is_null()) {
-                excluded_objects_state_.set_current_object("");
+    // Parse defined objects list
+    if (eo.contains("objects") && eo["objects"].is_array()) {
+        std::vector<std::string> defined;
+        for (const auto& obj : eo["objects"]) {
+            if (obj.is_object() && obj.contains("name") && obj["name"].is_string()) {
+                defined.push_back(obj["name"].get<std::string>());
             }
         }
+        excluded_objects_state_.set_defined_objects(defined);
     }
 
-    // Update klippy state from webhooks (for restart simulation)
-    if (state.contains("webhooks")) {
-        const auto& webhooks = state["webhooks"];
-        if (webhooks.contains("state") && webhooks["state"].is_string()) {
-            std::string klippy_state_str = webhooks["state"].get<std::string>();
-            KlippyState new_state = KlippyState::READY; // default
-
-            if (klippy_state_str == "ready") {
-                new_state = KlippyState::READY;
-            } else if (klippy_state_str == "startup") {
-                new_state = KlippyState::STARTUP;
-            } else if (klippy_state_str == "shutdown") {
-                new_state = KlippyState::SHUTDOWN;
-            } else if (klippy_state_str == "error") {
-                new_state = KlippyState::ERROR;
-            }
-
-            network_state_.set_klippy_state_internal(new_state);
-            spdlog::debug("[PrinterState] Klippy state from webhooks: {}", klippy_state_str);
+    // Parse current object
+    if (eo.contains("current_object")) {
+        if (eo["current_object"].is_string()) {
+            excluded_objects_state_.set_current_object(eo["current_object"].get<std::string>());
+        } else if (eo["current_object"].is_null()) {
+            excluded_objects_state_.set_current_object("");
         }
     }
+}
 
-    // Delegate calibration updates (manual probe, motor state, firmware retraction)
-    // to calibration_state_ component
-    calibration_state_.update_from_status(state);
+void PrinterState::update_webhooks(const json& webhooks) {
+    if (webhooks.contains("state") && webhooks["state"].is_string()) {
+        std::string klippy_state_str = webhooks["state"].get<std::string>();
+        KlippyState new_state = KlippyState::READY; // default
 
-    // Forward filament sensor updates to FilamentSensorManager
-    // The manager handles all sensor types: filament_switch_sensor and filament_motion_sensor
-    helix::FilamentSensorManager::instance().update_from_status(state);
+        if (klippy_state_str == "ready") {
+            new_state = KlippyState::READY;
+        } else if (klippy_state_str == "startup") {
+            new_state = KlippyState::STARTUP;
+        } else if (klippy_state_str == "shutdown") {
+            new_state = KlippyState::SHUTDOWN;
+        } else if (klippy_state_str == "error") {
+            new_state = KlippyState::ERROR;
+        }
 
-    // Forward updates to all other sensor managers
-    helix::sensors::HumiditySensorManager::instance().update_from_status(state);
-    helix::sensors::WidthSensorManager::instance().update_from_status(state);
-    helix::sensors::ProbeSensorManager::instance().update_from_status(state);
-    helix::sensors::AccelSensorManager::instance().update_from_status(state);
-    helix::sensors::ColorSensorManager::instance().update_from_status(state);
-    helix::sensors::TemperatureSensorManager::instance().update_from_status(state);
+        network_state_.set_klippy_state_internal(new_state);
+        spdlog::debug("[PrinterState] Klippy state from webhooks: {}", klippy_state_str);
+    }
+}
 
-    // Cache full state for complex queries
-    json_state_.merge_patch(state);
+void PrinterState::rebuild_status_routes() {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    status_router_.rebuild();
 }
 
 json& PrinterState::get_json_state() {
@@ -506,6 +543,12 @@ void PrinterState::set_hardware_internal(const helix::PrinterDiscovery& hardware
     // Tell temperature state which sensor to use for chamber temperature
     temperature_state_.set_chamber_sensor_name(hardware.chamber_sensor_name());
 
+    // Route status objects by name from now on (chamber sensor interest is set above)
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        status_router_.build(hardware.printer_objects());
+    }
+
     // Update composite subjects for G-code modification options
     // (visibility depends on both plugin status and capability)
     update_gcode_modification_visibility();
@@ -61,9 +61,18 @@ void PrinterTemperatureState::register_xml_subjects() {
 }
 
 void PrinterTemperatureState::update_from_status(const nlohmann::json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool PrinterTemperatureState::handles_status_object(const std::string& object) const {
+    return object == "extruder" || object == "heater_bed" ||
+           (!chamber_sensor_name_.empty() && object == chamber_sensor_name_);
+}
+
+void PrinterTemperatureState::update_from_objects(const StatusObjects& objects) {
     // Update extruder temperature (stored as centidegrees for 0.1C resolution)
-    if (status.contains("extruder")) {
-        const auto& extruder = status["extruder"];
+    if (const auto* found = objects.find("extruder")) {
+        const auto& extruder = *found;
 
         if (extruder.contains("temperature") && extruder["temperature"].is_number()) {
             int temp_centi = helix::units::json_to_centidegrees(extruder, "temperature");
@@ -78,8 +87,8 @@ void PrinterTemperatureState::update_from_status(const nlohmann::json& status) {
     }
 
     // Update bed temperature (stored as centidegrees for 0.1C resolution)
-    if (status.contains("heater_bed")) {
-        const auto& bed = status["heater_bed"];
+    if (const auto* found = objects.find("heater_bed")) {
+        const auto& bed = *found;
 
         if (bed.contains("temperature") && bed["temperature"].is_number()) {
             int temp_centi = helix::units::json_to_centidegrees(bed, "temperature");
@@ -98,8 +107,10 @@ void PrinterTemperatureState::update_from_status(const nlohmann::json& status) {
     }
 
     // Update chamber temperature (if configured)
-    if (!chamber_sensor_name_.empty() && status.contains(chamber_sensor_name_)) {
-        const auto& chamber = status[chamber_sensor_name_];
+    const auto* chamber_found =
+        chamber_sensor_name_.empty() ? nullptr : objects.find(chamber_sensor_name_);
+    if (chamber_found) {
+        const auto& chamber = *chamber_found;
 
         if (chamber.contains("temperature") && chamber["temperature"].is_number()) {
             int temp_centi = helix::units::json_to_centidegrees(chamber, "temperature");
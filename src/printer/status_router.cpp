@@ -0,0 +1,127 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "status_router.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+using json = nlohmann::json;
+
+namespace helix {
+
+// ============================================================================
+// StatusObjects
+// ============================================================================
+
+StatusObjects::StatusObjects(const json& status) {
+    if (!status.is_object()) {
+        return;
+    }
+    entries_.reserve(status.size());
+    for (auto it = status.begin(); it != status.end(); ++it) {
+        entries_.push_back({&it.key(), &it.value()});
+    }
+}
+
+const json* StatusObjects::find(const std::string& name) const {
+    // Handlers see a handful of objects per update; a linear scan beats hashing
+    for (const auto& entry : entries_) {
+        if (*entry.name == name) {
+            return entry.value;
+        }
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// StatusRouter
+// ============================================================================
+
+void StatusRouter::add_handler(std::string name, Matcher wants, Handler handler) {
+    handlers_.push_back({std::move(name), std::move(wants), std::move(handler)});
+    pending_.resize(handlers_.size());
+    routes_.clear();
+}
+
+void StatusRouter::build(const std::vector<std::string>& objects) {
+    objects_ = objects;
+    rebuild();
+    spdlog::debug("[StatusRouter] Routed {} objects to {} handlers", routes_.size(),
+                  handlers_.size());
+}
+
+void StatusRouter::rebuild() {
+    routes_.clear();
+    routes_.reserve(objects_.size());
+    for (const auto& object : objects_) {
+        resolve(object);
+    }
+}
+
+const std::vector<size_t>& StatusRouter::resolve(const std::string& object) {
+    auto it = routes_.find(object);
+    if (it != routes_.end()) {
+        return it->second;
+    }
+
+    std::vector<size_t> route;
+    for (size_t i = 0; i < handlers_.size(); ++i) {
+        if (handlers_[i].wants(object)) {
+            route.push_back(i);
+        }
+    }
+    stats_.resolves++;
+    if (route.empty()) {
+        spdlog::trace("[StatusRouter] No handler for '{}'", object);
+    }
+    return routes_.emplace(object, std::move(route)).first->second;
+}
+
+void StatusRouter::dispatch(const json& status) {
+    if (!status.is_object()) {
+        return;
+    }
+    stats_.updates++;
+
+    for (auto it = status.begin(); it != status.end(); ++it) {
+        stats_.objects++;
+        for (size_t index : resolve(it.key())) {
+            if (pending_[index].empty()) {
+                touched_.push_back(index);
+            }
+            pending_[index].add(it.key(), it.value());
+            stats_.deliveries++;
+        }
+    }
+
+    // Registration order, independent of which object arrived first
+    std::sort(touched_.begin(), touched_.end());
+    for (size_t index : touched_) {
+        stats_.handler_calls++;
+        try {
+            handlers_[index].handler(pending_[index]);
+        } catch (const std::exception& e) {
+            spdlog::error("[StatusRouter] Handler '{}' threw: {}", handlers_[index].name,
+                          e.what());
+        } catch (...) {
+            spdlog::error("[StatusRouter] Handler '{}' threw unknown exception",
+                          handlers_[index].name);
+        }
+        pending_[index].clear();
+    }
+    touched_.clear();
+}
+
+std::vector<std::string> StatusRouter::handlers_for(const std::string& object) {
+    std::vector<std::string> names;
+    for (size_t index : resolve(object)) {
+        names.push_back(handlers_[index].name);
+    }
+    return names;
+}
+
+} // namespace helix
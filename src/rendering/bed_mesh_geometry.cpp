@@ -16,12 +16,44 @@
 namespace helix {
 namespace mesh {
 
+/**
+ * @brief Set a mesh quad's per-vertex height colors and its averaged center color
+ *
+ * Vertex mapping matches generate_mesh_quads(): [0]=mesh[row+1][col],
+ * [1]=mesh[row+1][col+1], [2]=mesh[row][col], [3]=mesh[row][col+1].
+ */
+static void assign_quad_colors(const bed_mesh_renderer_t* renderer, bed_mesh_quad_3d_t& quad,
+                               int row, int col) {
+    const int vertex_rows[4] = {row + 1, row + 1, row, row};
+    const int vertex_cols[4] = {col, col + 1, col, col + 1};
+    for (int i = 0; i < 4; i++) {
+        double z = renderer->mesh[static_cast<size_t>(vertex_rows[i])]
+                                 [static_cast<size_t>(vertex_cols[i])];
+        quad.vertices[i].color =
+            bed_mesh_gradient_height_to_color(z, renderer->color_min_z, renderer->color_max_z);
+    }
+
+    // Compute center color for fast rendering
+    bed_mesh_rgb_t avg_color = {
+        static_cast<uint8_t>((quad.vertices[0].color.red + quad.vertices[1].color.red +
+                              quad.vertices[2].color.red + quad.vertices[3].color.red) /
+                             4),
+        static_cast<uint8_t>((quad.vertices[0].color.green + quad.vertices[1].color.green +
+                              quad.vertices[2].color.green + quad.vertices[3].color.green) /
+                             4),
+        static_cast<uint8_t>((quad.vertices[0].color.blue + quad.vertices[1].color.blue +
+                              quad.vertices[2].color.blue + quad.vertices[3].color.blue) /
+                             4)};
+    quad.center_color = lv_color_make(avg_color.r, avg_color.g, avg_color.b);
+}
+
 void generate_mesh_quads(bed_mesh_renderer_t* renderer) {
     if (!renderer || !renderer->has_mesh_data) {
         return;
     }
 
     renderer->quads.clear();
+    renderer->geometry_revision++; // Invalidates cached projections and surface
 
     // Pre-allocate capacity to avoid reallocations during generation
     // Number of quads = (rows-1) × (cols-1)
@@ -106,49 +138,26 @@ void generate_mesh_quads(bed_mesh_renderer_t* renderer) {
             quad.vertices[0].z = helix::mesh::mesh_z_to_world_z(
                 renderer->mesh[static_cast<size_t>(row + 1)][static_cast<size_t>(col)],
                 renderer->cached_z_center, renderer->view_state.z_scale);
-            quad.vertices[0].color = bed_mesh_gradient_height_to_color(
-                renderer->mesh[static_cast<size_t>(row + 1)][static_cast<size_t>(col)],
-                renderer->color_min_z, renderer->color_max_z);
 
             quad.vertices[1].x = base_x_1;
             quad.vertices[1].y = base_y_1;
             quad.vertices[1].z = helix::mesh::mesh_z_to_world_z(
                 renderer->mesh[static_cast<size_t>(row + 1)][static_cast<size_t>(col + 1)],
                 renderer->cached_z_center, renderer->view_state.z_scale);
-            quad.vertices[1].color = bed_mesh_gradient_height_to_color(
-                renderer->mesh[static_cast<size_t>(row + 1)][static_cast<size_t>(col + 1)],
-                renderer->color_min_z, renderer->color_max_z);
 
             quad.vertices[2].x = base_x_0;
             quad.vertices[2].y = base_y_0;
             quad.vertices[2].z = helix::mesh::mesh_z_to_world_z(
                 renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col)],
                 renderer->cached_z_center, renderer->view_state.z_scale);
-            quad.vertices[2].color = bed_mesh_gradient_height_to_color(
-                renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col)],
-                renderer->color_min_z, renderer->color_max_z);
 
             quad.vertices[3].x = base_x_1;
             quad.vertices[3].y = base_y_0;
             quad.vertices[3].z = helix::mesh::mesh_z_to_world_z(
                 renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col + 1)],
                 renderer->cached_z_center, renderer->view_state.z_scale);
-            quad.vertices[3].color = bed_mesh_gradient_height_to_color(
-                renderer->mesh[static_cast<size_t>(row)][static_cast<size_t>(col + 1)],
-                renderer->color_min_z, renderer->color_max_z);
-
-            // Compute center color for fast rendering
-            bed_mesh_rgb_t avg_color = {
-                static_cast<uint8_t>((quad.vertices[0].color.red + quad.vertices[1].color.red +
-                                      quad.vertices[2].color.red + quad.vertices[3].color.red) /
-                                     4),
-                static_cast<uint8_t>((quad.vertices[0].color.green + quad.vertices[1].color.green +
-                                      quad.vertices[2].color.green + quad.vertices[3].color.green) /
-                                     4),
-                static_cast<uint8_t>((quad.vertices[0].color.blue + quad.vertices[1].color.blue +
-                                      quad.vertices[2].color.blue + quad.vertices[3].color.blue) /
-                                     4)};
-            quad.center_color = lv_color_make(avg_color.r, avg_color.g, avg_color.b);
+
+            assign_quad_colors(renderer, quad, row, col);
 
             quad.avg_depth = 0.0;        // Will be computed during projection
             quad.opacity = LV_OPA_COVER; // Mesh quads are fully opaque
@@ -287,12 +296,26 @@ void generate_mesh_quads(bed_mesh_renderer_t* renderer) {
         renderer->rows, renderer->cols);
 }
 
-void sort_quads_by_depth(std::vector<bed_mesh_quad_3d_t>& quads) {
-    std::sort(quads.begin(), quads.end(),
-              [](const bed_mesh_quad_3d_t& a, const bed_mesh_quad_3d_t& b) {
-                  // Descending order: furthest (largest depth) first
-                  return a.avg_depth > b.avg_depth;
-              });
+void recolor_mesh_quads(bed_mesh_renderer_t* renderer) {
+    if (!renderer || !renderer->has_mesh_data) {
+        return;
+    }
+
+    // Mesh quads come first, row-major; zero plane quads after them keep their color
+    size_t quad_cols = static_cast<size_t>(renderer->cols - 1);
+    size_t mesh_quad_count = static_cast<size_t>(renderer->rows - 1) * quad_cols;
+    if (renderer->quads.size() < mesh_quad_count) {
+        generate_mesh_quads(renderer);
+        return;
+    }
+
+    for (size_t i = 0; i < mesh_quad_count; i++) {
+        assign_quad_colors(renderer, renderer->quads[i], static_cast<int>(i / quad_cols),
+                           static_cast<int>(i % quad_cols));
+    }
+    renderer->color_revision++; // Invalidates the cached surface only
+
+    spdlog::trace("[Bed Mesh Geometry] Recolored {} mesh quads", mesh_quad_count);
 }
 
 } // namespace mesh
@@ -5,17 +5,16 @@
  * @file bed_mesh_rasterizer.cpp
  * @brief Triangle rasterization implementation for bed mesh visualization
  *
- * Implements scanline-based triangle filling with:
- * - Solid color fills using batched rectangle draws
- * - Gradient fills with adaptive segment counts
- * - Per-vertex color interpolation
+ * Implements scanline triangle filling straight into pixel memory with:
+ * - 16.16 fixed-point edge positions, evaluated per row from the edge's top vertex
+ * - Plane-equation attribute gradients (depth, R, G, B), stepped once per pixel
+ * - A 16-bit depth test instead of painter's-algorithm sorting
  */
 
 #include "bed_mesh_rasterizer.h"
 
-#include "bed_mesh_gradient.h"
-
 #include <algorithm>
+#include <utility>
 
 namespace {
 
@@ -23,83 +22,81 @@ namespace {
 // Internal Helper Functions
 // ============================================================================
 
+/// Fractional bits for edge X positions and interpolated attributes
+constexpr int FIXED_SHIFT = 16;
+constexpr int64_t FIXED_ONE = int64_t{1} << FIXED_SHIFT;
+
+/// Smallest integer >= a 16.16 fixed-point value
+inline int fixed_ceil(int64_t value) {
+    return static_cast<int>((value + FIXED_ONE - 1) >> FIXED_SHIFT);
+}
+
 /**
- * Sort three vertices by Y coordinate using bubble sort
- * Optimized for the common case of 3 elements
+ * Edge from its top vertex to its bottom vertex
  *
- * @tparam T Type of x coordinate (allows int or struct)
+ * X at a row is computed from the top vertex rather than accumulated, so two
+ * triangles sharing the edge get bit-identical positions and the top-left rule
+ * hands each pixel to exactly one of them.
  */
-template <typename T> inline void sort_by_y(int& y1, T& x1, int& y2, T& x2, int& y3, T& x3) {
-    if (y1 > y2) {
-        std::swap(y1, y2);
-        std::swap(x1, x2);
-    }
-    if (y2 > y3) {
-        std::swap(y2, y3);
-        std::swap(x2, x3);
+struct Edge {
+    int x_top;
+    int y_top;
+    int64_t step; ///< 16.16 X change per row
+
+    Edge(int x0, int y0, int x1, int y1) : x_top(x0), y_top(y0) {
+        step = y1 != y0 ? (static_cast<int64_t>(x1 - x0) * FIXED_ONE) / (y1 - y0) : 0;
     }
-    if (y1 > y2) {
-        std::swap(y1, y2);
-        std::swap(x1, x2);
+
+    int64_t x_at(int y) const {
+        return static_cast<int64_t>(x_top) * FIXED_ONE + (y - y_top) * step;
     }
-}
+};
 
 /**
- * Compute scanline X coordinates for triangle edges at given Y
- * Uses linear interpolation along triangle edges
+ * Constant screen-space gradient of one attribute over a triangle
  *
- * @param y Current scanline Y coordinate
- * @param y1, x1 Top vertex (after Y-sorting)
- * @param y2, x2 Middle vertex
- * @param y3, x3 Bottom vertex
- * @param out_x_left Output: left edge X coordinate
- * @param out_x_right Output: right edge X coordinate
+ * value(x, y) = a0 + (x - x0) * dx + (y - y0) * dy, all in 16.16 fixed point.
  */
-inline void compute_scanline_x(int y, int y1, int x1, int y2, int x2, int y3, int x3,
-                               int* out_x_left, int* out_x_right) {
-    // Long edge: y1 -> y3
-    double t_long = (y - y1) / static_cast<double>(y3 - y1);
-    int x_long = x1 + static_cast<int>(t_long * (x3 - x1));
-
-    // Short edge: split at y2
-    int x_short;
-    if (y < y2) {
-        // Upper half: y1 -> y2
-        if (y2 == y1) {
-            x_short = x1;
-        } else {
-            double t = (y - y1) / static_cast<double>(y2 - y1);
-            x_short = x1 + static_cast<int>(t * (x2 - x1));
-        }
-    } else {
-        // Lower half: y2 -> y3
-        if (y3 == y2) {
-            x_short = x2;
-        } else {
-            double t = (y - y2) / static_cast<double>(y3 - y2);
-            x_short = x2 + static_cast<int>(t * (x3 - x2));
-        }
+struct AttributePlane {
+    int64_t origin;
+    int64_t dx;
+    int64_t dy;
+
+    AttributePlane(int a0, int a1, int a2, int64_t ex1, int64_t ey1, int64_t ex2, int64_t ey2,
+                   int64_t area2) {
+        int64_t da1 = a1 - a0;
+        int64_t da2 = a2 - a0;
+        origin = static_cast<int64_t>(a0) * FIXED_ONE;
+        dx = ((da1 * ey2 - da2 * ey1) * FIXED_ONE) / area2;
+        dy = ((da2 * ex1 - da1 * ex2) * FIXED_ONE) / area2;
+    }
+
+    int64_t at(int64_t rel_x, int64_t rel_y) const {
+        return origin + rel_x * dx + rel_y * dy;
     }
+};
 
-    // Ensure correct ordering
-    *out_x_left = std::min(x_long, x_short);
-    *out_x_right = std::max(x_long, x_short);
+inline uint8_t fixed_to_channel(int64_t value) {
+    return static_cast<uint8_t>(std::clamp<int64_t>(value >> FIXED_SHIFT, 0, 255));
 }
 
-/**
- * Interpolate position and color along a triangle edge
- * Handles divide-by-zero case when edge vertices have same Y coordinate
- */
-inline void interpolate_edge(int y, int y0, int x0, const bed_mesh_rgb_t& c0, int y1, int x1,
-                             const bed_mesh_rgb_t& c1, int* x_out, bed_mesh_rgb_t* c_out) {
-    if (y1 == y0) {
-        *x_out = x0;
-        *c_out = c0;
-    } else {
-        double t = (y - y0) / static_cast<double>(y1 - y0);
-        *x_out = x0 + static_cast<int>(t * (x1 - x0));
-        *c_out = bed_mesh_gradient_lerp_color(c0, c1, t);
+/// Non-premultiplied "over" blend of a translucent color onto an ARGB8888 pixel
+inline void blend_pixel(uint8_t* px, uint8_t r, uint8_t g, uint8_t b, uint32_t opa) {
+    uint32_t dst_a = px[3];
+    if (dst_a == 0) {
+        px[0] = b;
+        px[1] = g;
+        px[2] = r;
+        px[3] = static_cast<uint8_t>(opa);
+        return;
     }
+    // Weight of the destination after the source covers opa/255 of it
+    uint32_t dst_w = dst_a * (255 - opa) / 255;
+    uint32_t out_a = opa + dst_w;
+    px[0] = static_cast<uint8_t>((b * opa + px[0] * dst_w) / out_a);
+    px[1] = static_cast<uint8_t>((g * opa + px[1] * dst_w) / out_a);
+    px[2] = static_cast<uint8_t>((r * opa + px[2] * dst_w) / out_a);
+    px[3] = static_cast<uint8_t>(out_a);
 }
 
 } // anonymous namespace
@@ -107,53 +104,42 @@ inline void interpolate_edge(int y, int y0, int x0, const bed_mesh_rgb_t& c0, in
 namespace helix {
 namespace mesh {
 
-void fill_triangle_solid(lv_layer_t* layer, int x1, int y1, int x2, int y2, int x3, int y3,
-                         lv_color_t color, lv_opa_t opacity) {
-    // Sort vertices by Y coordinate
-    sort_by_y(y1, x1, y2, x2, y3, x3);
+void MeshSpanRasterizer::begin(uint8_t* pixels, int width, int height, int stride, int origin_x,
+                               int origin_y) {
+    pixels_ = pixels;
+    width_ = std::max(0, width);
+    height_ = std::max(0, height);
+    stride_ = stride;
+    origin_x_ = origin_x;
+    origin_y_ = origin_y;
+    pixels_drawn_ = 0;
+
+    depth_.assign(static_cast<size_t>(width_) * static_cast<size_t>(height_), MESH_DEPTH_FAR);
+}
 
-    // Skip degenerate triangles
-    if (y1 == y3)
-        return;
+void MeshSpanRasterizer::fill_triangle_gradient(const Vertex& a, const Vertex& b, const Vertex& c,
+                                                lv_opa_t opacity) {
+    fill_triangle<true>(a, b, c, a.color, opacity);
+}
 
-    // Note: LVGL's layer system handles clipping automatically
-
-    // Prepare draw descriptor for horizontal spans
-    lv_draw_rect_dsc_t dsc;
-    lv_draw_rect_dsc_init(&dsc);
-    dsc.bg_color = color;
-    dsc.bg_opa = opacity;
-    dsc.border_width = 0;
-
-    // Scanline fill with batched rect draws (15-20% faster than pixel-by-pixel)
-    for (int y = y1; y <= y3; y++) {
-        // Compute left/right edges
-        int x_left, x_right;
-        compute_scanline_x(y, y1, x1, y2, x2, y3, x3, &x_left, &x_right);
-
-        // Draw horizontal span as single rectangle
-        if (x_left <= x_right) {
-            lv_area_t rect_area;
-            rect_area.x1 = x_left;
-            rect_area.y1 = y;
-            rect_area.x2 = x_right;
-            rect_area.y2 = y;
-            lv_draw_rect(layer, &dsc, &rect_area);
-        }
-    }
+void MeshSpanRasterizer::fill_triangle_solid(const Vertex& a, const Vertex& b, const Vertex& c,
+                                             lv_color_t color, lv_opa_t opacity) {
+    fill_triangle<false>(a, b, c, color, opacity);
 }
 
-void fill_triangle_gradient(lv_layer_t* layer, int x1, int y1, lv_color_t c1, int x2, int y2,
-                            lv_color_t c2, int x3, int y3, lv_color_t c3, lv_opa_t opacity) {
-    // Sort vertices by Y coordinate, keeping colors aligned
-    struct Vertex {
-        int x, y;
-        bed_mesh_rgb_t color;
-    };
-    Vertex v[3] = {{x1, y1, {c1.red, c1.green, c1.blue}},
-                   {x2, y2, {c2.red, c2.green, c2.blue}},
-                   {x3, y3, {c3.red, c3.green, c3.blue}}};
+template <bool Gradient>
+void MeshSpanRasterizer::fill_triangle(const Vertex& a, const Vertex& b, const Vertex& c,
+                                       lv_color_t solid, lv_opa_t opacity) {
+    if (!pixels_ || opacity == LV_OPA_TRANSP) {
+        return;
+    }
 
+    // Buffer coordinates, sorted top to bottom
+    Vertex v[3] = {a, b, c};
+    for (auto& vertex : v) {
+        vertex.x -= origin_x_;
+        vertex.y -= origin_y_;
+    }
     if (v[0].y > v[1].y)
         std::swap(v[0], v[1]);
     if (v[1].y > v[2].y)
@@ -161,92 +147,90 @@ void fill_triangle_gradient(lv_layer_t* layer, int x1, int y1, lv_color_t c1, in
     if (v[0].y > v[1].y)
         std::swap(v[0], v[1]);
 
-    // Skip degenerate triangles
-    if (v[0].y == v[2].y)
+    const int64_t ex1 = v[1].x - v[0].x;
+    const int64_t ey1 = v[1].y - v[0].y;
+    const int64_t ex2 = v[2].x - v[0].x;
+    const int64_t ey2 = v[2].y - v[0].y;
+    const int64_t area2 = ex1 * ey2 - ex2 * ey1;
+
+    // Skip degenerate triangles and ones entirely off the buffer
+    if (area2 == 0 || v[2].y <= 0 || v[0].y >= height_) {
         return;
+    }
+    int min_x = std::min({v[0].x, v[1].x, v[2].x});
+    int max_x = std::max({v[0].x, v[1].x, v[2].x});
+    if (max_x <= 0 || min_x >= width_) {
+        return;
+    }
 
-    // Note: LVGL's layer system handles clipping automatically
-
-    // Prepare draw descriptor for gradient segments
-    lv_draw_rect_dsc_t dsc;
-    lv_draw_rect_dsc_init(&dsc);
-    dsc.bg_opa = opacity;
-    dsc.border_width = 0;
-
-    // Scanline fill with color interpolation and batched rect draws
-    for (int y = v[0].y; y <= v[2].y; y++) {
-        // Interpolate along long edge (v0 -> v2)
-        double t_long = (y - v[0].y) / static_cast<double>(v[2].y - v[0].y);
-        int x_long = v[0].x + static_cast<int>(t_long * (v[2].x - v[0].x));
-        bed_mesh_rgb_t c_long = bed_mesh_gradient_lerp_color(v[0].color, v[2].color, t_long);
-
-        // Interpolate along short edge (upper half: v0->v1, lower half: v1->v2)
-        int x_short;
-        bed_mesh_rgb_t c_short;
-        if (y < v[1].y) {
-            interpolate_edge(y, v[0].y, v[0].x, v[0].color, v[1].y, v[1].x, v[1].color, &x_short,
-                             &c_short);
-        } else {
-            interpolate_edge(y, v[1].y, v[1].x, v[1].color, v[2].y, v[2].x, v[2].color, &x_short,
-                             &c_short);
+    const AttributePlane depth(v[0].depth, v[1].depth, v[2].depth, ex1, ey1, ex2, ey2, area2);
+    const AttributePlane red(v[0].color.red, v[1].color.red, v[2].color.red, ex1, ey1, ex2, ey2,
+                             area2);
+    const AttributePlane green(v[0].color.green, v[1].color.green, v[2].color.green, ex1, ey1,
+                               ex2, ey2, area2);
+    const AttributePlane blue(v[0].color.blue, v[1].color.blue, v[2].color.blue, ex1, ey1, ex2,
+                              ey2, area2);
+
+    const Edge long_edge(v[0].x, v[0].y, v[2].x, v[2].y);
+    const Edge upper_edge(v[0].x, v[0].y, v[1].x, v[1].y);
+    const Edge lower_edge(v[1].x, v[1].y, v[2].x, v[2].y);
+
+    const bool opaque = opacity >= LV_OPA_COVER;
+    const uint32_t opa = opacity;
+
+    // Top-left rule: rows y0 <= y < y2, columns ceil(left) <= x < ceil(right)
+    const int y_begin = std::max(v[0].y, 0);
+    const int y_end = std::min(v[2].y, height_);
+    for (int y = y_begin; y < y_end; ++y) {
+        int64_t x_long = long_edge.x_at(y);
+        int64_t x_short = y < v[1].y ? upper_edge.x_at(y) : lower_edge.x_at(y);
+
+        int x_begin = fixed_ceil(std::min(x_long, x_short));
+        int x_end = fixed_ceil(std::max(x_long, x_short));
+        x_begin = std::max(x_begin, 0);
+        x_end = std::min(x_end, width_);
+        if (x_begin >= x_end) {
+            continue;
         }
 
-        // Ensure left/right ordering
-        int x_left = std::min(x_long, x_short);
-        int x_right = std::max(x_long, x_short);
-        bed_mesh_rgb_t c_left = (x_long < x_short) ? c_long : c_short;
-        bed_mesh_rgb_t c_right = (x_long < x_short) ? c_short : c_long;
-
-        int line_width = x_right - x_left + 1;
-        if (line_width <= 0)
-            continue;
+        const int64_t rel_x = x_begin - v[0].x;
+        const int64_t rel_y = y - v[0].y;
+        int64_t d = depth.at(rel_x, rel_y);
+        int64_t r = 0, g = 0, bl = 0;
+        if constexpr (Gradient) {
+            r = red.at(rel_x, rel_y);
+            g = green.at(rel_x, rel_y);
+            bl = blue.at(rel_x, rel_y);
+        }
 
-        // Performance: use solid color for thin lines
-        if (line_width < GRADIENT_MIN_LINE_WIDTH) {
-            bed_mesh_rgb_t avg = bed_mesh_gradient_lerp_color(c_left, c_right, 0.5);
-            lv_color_t avg_color = lv_color_make(avg.r, avg.g, avg.b);
-            dsc.bg_color = avg_color;
-
-            lv_area_t rect_area;
-            rect_area.x1 = x_left;
-            rect_area.y1 = y;
-            rect_area.x2 = x_right;
-            rect_area.y2 = y;
-            lv_draw_rect(layer, &dsc, &rect_area);
-        } else {
-            // ========== Adaptive Gradient Rasterization ==========
-            // Use adaptive segment count based on line width for quality/performance balance
-            int segment_count;
-            if (line_width < GRADIENT_THIN_LINE_THRESHOLD) {
-                segment_count = GRADIENT_THIN_SEGMENT_COUNT;
-            } else if (line_width < GRADIENT_MEDIUM_LINE_THRESHOLD) {
-                segment_count = GRADIENT_MEDIUM_SEGMENT_COUNT;
-            } else {
-                segment_count = GRADIENT_WIDE_SEGMENT_COUNT;
+        uint16_t* depth_row = depth_.data() + static_cast<size_t>(y) * width_;
+        uint8_t* px = pixels_ + static_cast<size_t>(y) * stride_ + static_cast<size_t>(x_begin) * 4;
+        for (int x = x_begin; x < x_end; ++x, px += 4) {
+            uint16_t z = static_cast<uint16_t>(
+                std::clamp<int64_t>(d >> FIXED_SHIFT, 0, MESH_DEPTH_FAR - 1));
+            if (z < depth_row[x]) {
+                uint8_t cr = solid.red, cg = solid.green, cb = solid.blue;
+                if constexpr (Gradient) {
+                    cr = fixed_to_channel(r);
+                    cg = fixed_to_channel(g);
+                    cb = fixed_to_channel(bl);
+                }
+                if (opaque) {
+                    depth_row[x] = z;
+                    px[0] = cb;
+                    px[1] = cg;
+                    px[2] = cr;
+                    px[3] = 0xFF;
+                } else {
+                    blend_pixel(px, cr, cg, cb, opa);
+                }
+                ++pixels_drawn_;
             }
-
-            for (int segment_index = 0; segment_index < segment_count; segment_index++) {
-                // Compute segment horizontal span
-                int seg_x_start = x_left + (segment_index * line_width) / segment_count;
-                int seg_x_end = x_left + ((segment_index + 1) * line_width) / segment_count - 1;
-                if (seg_x_start > seg_x_end)
-                    continue;
-
-                // Sample color at segment center for better color distribution
-                double interpolation_factor =
-                    (segment_index + GRADIENT_SEGMENT_SAMPLE_POSITION) / segment_count;
-                bed_mesh_rgb_t seg_color =
-                    bed_mesh_gradient_lerp_color(c_left, c_right, interpolation_factor);
-                lv_color_t color = lv_color_make(seg_color.r, seg_color.g, seg_color.b);
-                dsc.bg_color = color;
-
-                // Draw segment as horizontal rectangle
-                lv_area_t rect_area;
-                rect_area.x1 = seg_x_start;
-                rect_area.y1 = y;
-                rect_area.x2 = seg_x_end;
-                rect_area.y2 = y;
-                lv_draw_rect(layer, &dsc, &rect_area);
+            d += depth.dx;
+            if constexpr (Gradient) {
+                r += red.dx;
+                g += green.dx;
+                bl += blue.dx;
             }
         }
     }
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cfloat>
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
@@ -60,11 +61,19 @@ static void compute_centering_offset(int mesh_min_x, int mesh_max_x, int mesh_mi
 static void calibrate_fov_scale(bed_mesh_renderer_t* renderer, int canvas_width, int canvas_height);
 static void compute_initial_centering(bed_mesh_renderer_t* renderer, int canvas_width,
                                       int canvas_height, int layer_offset_x, int layer_offset_y);
-static void render_quad(lv_layer_t* layer, const bed_mesh_quad_3d_t& quad, bool use_gradient);
-static void prepare_render_frame(bed_mesh_renderer_t* renderer, int canvas_width, int canvas_height,
+static lv_draw_buf_t* ensure_surface_buffer(bed_mesh_renderer_t* renderer, int canvas_width,
+                                            int canvas_height);
+static void render_quad(helix::mesh::MeshSpanRasterizer& raster, const bed_mesh_quad_3d_t& quad,
+                        double min_depth, double depth_scale, bool use_gradient);
+static bed_mesh_frame_key make_frame_key(const bed_mesh_renderer_t* renderer, int canvas_width,
+                                         int canvas_height, int layer_offset_x,
+                                         int layer_offset_y);
+static bool prepare_render_frame(bed_mesh_renderer_t* renderer, int canvas_width, int canvas_height,
                                  int layer_offset_x, int layer_offset_y);
-static void render_mesh_surface(lv_layer_t* layer, bed_mesh_renderer_t* renderer, int canvas_width,
-                                int canvas_height);
+static bool render_mesh_surface(lv_layer_t* layer, bed_mesh_renderer_t* renderer, int canvas_width,
+                                int canvas_height, bool projection_cached);
+static void blit_surface(lv_layer_t* layer, const bed_mesh_renderer_t* renderer, int canvas_width,
+                         int canvas_height);
 static void render_decorations(lv_layer_t* layer, bed_mesh_renderer_t* renderer, int canvas_width,
                                int canvas_height);
 
@@ -154,6 +163,9 @@ void bed_mesh_renderer_destroy(bed_mesh_renderer_t* renderer) {
     }
 
     spdlog::debug("[Bed Mesh Renderer] Destroying bed mesh renderer");
+    if (renderer->surface_buf && lv_is_initialized()) {
+        lv_draw_buf_destroy(renderer->surface_buf);
+    }
     delete renderer;
 }
 
@@ -382,15 +394,11 @@ void bed_mesh_renderer_set_color_range(bed_mesh_renderer_t* renderer, double min
     spdlog::debug("[Bed Mesh Renderer] Manual color range set: min={:.3f}, max={:.3f}", min_z,
                   max_z);
 
-    // Color range affects quad vertex colors - regenerate if changed
+    // Color range affects quad vertex colors only - recolor in place so cached
+    // projections stay valid and only the surface is re-rasterized
     if (changed && renderer->has_mesh_data) {
-        helix::mesh::generate_mesh_quads(renderer);
-        spdlog::debug("[Bed Mesh Renderer] Regenerated quads due to color range change");
-
-        // State transition: READY_TO_RENDER → MESH_LOADED (quads regenerated, projections invalid)
-        if (renderer->state == RendererState::READY_TO_RENDER) {
-            renderer->state = RendererState::MESH_LOADED;
-        }
+        helix::mesh::recolor_mesh_quads(renderer);
+        spdlog::debug("[Bed Mesh Renderer] Recolored quads due to color range change");
     }
 }
 
@@ -411,16 +419,10 @@ void bed_mesh_renderer_auto_color_range(bed_mesh_renderer_t* renderer) {
         renderer->color_min_z = renderer->mesh_min_z;
         renderer->color_max_z = renderer->mesh_max_z;
 
-        // Regenerate quads if color range changed
+        // Recolor quads if color range changed (projections stay valid)
         if (changed) {
-            helix::mesh::generate_mesh_quads(renderer);
-            spdlog::debug("[Bed Mesh Renderer] Regenerated quads due to auto color range change");
-
-            // State transition: READY_TO_RENDER → MESH_LOADED (quads regenerated, projections
-            // invalid)
-            if (renderer->state == RendererState::READY_TO_RENDER) {
-                renderer->state = RendererState::MESH_LOADED;
-            }
+            helix::mesh::recolor_mesh_quads(renderer);
+            spdlog::debug("[Bed Mesh Renderer] Recolored quads due to auto color range change");
         }
     }
 
@@ -523,7 +525,8 @@ bool bed_mesh_renderer_render(bed_mesh_renderer_t* renderer, lv_layer_t* layer,
         // Full 3D perspective rendering
 
         // Phase 1: Prepare rendering frame (projection parameters, view state)
-        prepare_render_frame(renderer, canvas_width, canvas_height, layer_offset_x, layer_offset_y);
+        bool projection_cached = prepare_render_frame(renderer, canvas_width, canvas_height,
+                                                      layer_offset_x, layer_offset_y);
         auto t_prepare = std::chrono::high_resolution_clock::now();
 
         // Phase 2: Render reference grids FIRST (behind mesh)
@@ -531,8 +534,10 @@ bool bed_mesh_renderer_render(bed_mesh_renderer_t* renderer, lv_layer_t* layer,
         helix::mesh::render_reference_grids(layer, renderer, canvas_width, canvas_height);
 
         // Phase 3: Render mesh surface (quads with gradient/solid colors)
-        // Mesh is drawn on top, naturally occluding parts of the reference grids
-        render_mesh_surface(layer, renderer, canvas_width, canvas_height);
+        // Mesh is drawn on top, naturally occluding parts of the reference grids.
+        // Reuses the cached surface bitmap when nothing affecting it changed.
+        bool surface_cached = render_mesh_surface(layer, renderer, canvas_width, canvas_height,
+                                                  projection_cached);
         auto t_surface = std::chrono::high_resolution_clock::now();
 
         // Phase 4: Render overlay decorations (on top of mesh)
@@ -548,8 +553,11 @@ bool bed_mesh_renderer_render(bed_mesh_renderer_t* renderer, lv_layer_t* layer,
         auto ms_total =
             std::chrono::duration<double, std::milli>(t_decorations - t_frame_start).count();
 
-        // Record frame time for FPS tracking
-        record_frame_time(renderer, static_cast<float>(ms_total));
+        // Record frame time for FPS tracking. Cached frames say nothing about how fast
+        // this hardware rasterizes, so they must not keep 3D mode alive on slow devices.
+        if (!surface_cached) {
+            record_frame_time(renderer, static_cast<float>(ms_total));
+        }
 
         spdlog::trace("[Bed Mesh Renderer] [PERF] Total: {:.2f}ms | Prepare: {:.2f}ms ({:.0f}%) | "
                       "Surface: {:.2f}ms ({:.0f}%) | "
@@ -723,7 +731,7 @@ static void project_and_cache_vertices(bed_mesh_renderer_t* renderer, int canvas
  *
  * Computes screen coordinates and depths for all vertices of all quads in a single pass.
  * This eliminates redundant projections - previously each quad was projected 3 times:
- * once for depth sorting, once for bounds tracking, and once during rendering.
+ * once for depth, once for bounds tracking, and once during rendering.
  *
  * Must be called whenever view state changes (rotation, FOV, centering offset).
  *
@@ -733,7 +741,7 @@ static void project_and_cache_vertices(bed_mesh_renderer_t* renderer, int canvas
  *
  * Side effects:
  * - Updates quad.screen_x[], quad.screen_y[], quad.depths[] for all quads
- * - Updates quad.avg_depth for depth sorting
+ * - Updates quad.avg_depth (debugging)
  */
 static void project_and_cache_quads(bed_mesh_renderer_t* renderer, int canvas_width,
                                     int canvas_height) {
@@ -992,14 +1000,16 @@ static void compute_initial_centering(bed_mesh_renderer_t* renderer, int canvas_
  * - Trig cache update (avoids recomputing sin/cos for every vertex)
  * - FOV scaling on first render (prevents grow/shrink during rotation)
  * - Centering offset on first render (keeps mesh centered during rotation)
+ * - Vertex projection, skipped when the cached projection key still matches
  *
  * @param renderer Renderer instance
  * @param canvas_width Canvas width in pixels
  * @param canvas_height Canvas height in pixels
  * @param layer_offset_x Layer's screen position X (from clip area)
  * @param layer_offset_y Layer's screen position Y (from clip area)
+ * @return true if cached projections (grid vertices and quads) were reused
  */
-static void prepare_render_frame(bed_mesh_renderer_t* renderer, int canvas_width, int canvas_height,
+static bool prepare_render_frame(bed_mesh_renderer_t* renderer, int canvas_width, int canvas_height,
                                  int layer_offset_x, int layer_offset_y) {
     // Compute dynamic Z scale if needed
     double z_range = renderer->mesh_max_z - renderer->mesh_min_z;
@@ -1030,6 +1040,16 @@ static void prepare_render_frame(bed_mesh_renderer_t* renderer, int canvas_width
     // Update cached trigonometric values (avoids recomputing sin/cos for every vertex)
     update_trig_cache(&renderer->view_state);
 
+    // Nothing that affects projection changed since the last frame: keep cached
+    // screen coordinates (redraws for overlays, labels, partial-redraw bands)
+    bool calibrated = renderer->view_state.fov_scale != INITIAL_FOV_SCALE &&
+                      renderer->initial_centering_computed;
+    if (calibrated && make_frame_key(renderer, canvas_width, canvas_height, layer_offset_x,
+                                     layer_offset_y)
+                          .same_projection(renderer->projection_key)) {
+        return true;
+    }
+
     // Compute FOV scale ONCE on first render (when fov_scale is still at default)
     // This prevents grow/shrink effect when rotating - scale stays constant
     if (renderer->view_state.fov_scale == INITIAL_FOV_SCALE) {
@@ -1059,22 +1079,67 @@ static void prepare_render_frame(bed_mesh_renderer_t* renderer, int canvas_width
     // Re-project grid vertices with final view state (fov_scale, centering, AND layer offset)
     // This ensures grid lines and quads are projected with identical view parameters
     project_and_cache_vertices(renderer, canvas_width, canvas_height);
+
+    // Quads are projected from this same view state by render_mesh_surface()
+    renderer->projection_key =
+        make_frame_key(renderer, canvas_width, canvas_height, layer_offset_x, layer_offset_y);
+    return false;
+}
+
+/**
+ * @brief Snapshot the inputs that determine projected coordinates and the surface bitmap
+ */
+static bed_mesh_frame_key make_frame_key(const bed_mesh_renderer_t* renderer, int canvas_width,
+                                         int canvas_height, int layer_offset_x,
+                                         int layer_offset_y) {
+    const bed_mesh_view_state_t& view = renderer->view_state;
+    bed_mesh_frame_key key;
+    key.valid = true;
+    key.geometry_revision = renderer->geometry_revision;
+    key.color_revision = renderer->color_revision;
+    key.angle_x = view.angle_x;
+    key.angle_z = view.angle_z;
+    key.z_scale = view.z_scale;
+    key.fov_scale = view.fov_scale;
+    key.center_offset_x = view.center_offset_x;
+    key.center_offset_y = view.center_offset_y;
+    key.canvas_width = canvas_width;
+    key.canvas_height = canvas_height;
+    key.layer_offset_x = layer_offset_x;
+    key.layer_offset_y = layer_offset_y;
+    key.is_dragging = view.is_dragging;
+    return key;
 }
 
 /**
  * @brief Render mesh surface as colored quads
  *
- * Projects all quad vertices, sorts by depth (painter's algorithm), and renders
- * each quad as two triangles. Uses gradient interpolation when static, solid
- * colors when dragging for performance.
+ * Projects all quad vertices and rasterizes each quad as two triangles into a
+ * depth-buffered ARGB8888 image, which is then drawn with a single
+ * lv_draw_image(). Uses gradient interpolation when static, solid colors when
+ * dragging for performance.
+ *
+ * If the surface key (projection, colors, fill mode) matches the cached bitmap,
+ * it is drawn again without projecting or rasterizing anything.
  *
  * @param layer LVGL draw layer
  * @param renderer Renderer with prepared view state
  * @param canvas_width Actual canvas width (NOT clip_area width, to avoid partial render bugs)
  * @param canvas_height Actual canvas height (NOT clip_area height)
+ * @param projection_cached true if quad screen coordinates are still valid
+ * @return true if the cached surface bitmap was reused
  */
-static void render_mesh_surface(lv_layer_t* layer, bed_mesh_renderer_t* renderer, int canvas_width,
-                                int canvas_height) {
+static bool render_mesh_surface(lv_layer_t* layer, bed_mesh_renderer_t* renderer, int canvas_width,
+                                int canvas_height, bool projection_cached) {
+    bed_mesh_frame_key key =
+        make_frame_key(renderer, canvas_width, canvas_height, renderer->view_state.layer_offset_x,
+                       renderer->view_state.layer_offset_y);
+    if (renderer->surface_buf && key.same_surface(renderer->surface_key)) {
+        blit_surface(layer, renderer, canvas_width, canvas_height);
+        spdlog::trace("[Bed Mesh Renderer] [CACHE] Reused surface bitmap");
+        return true;
+    }
+
     // PERF: Track rendering pipeline timings
     auto t_start = std::chrono::high_resolution_clock::now();
 
@@ -1084,63 +1149,82 @@ static void render_mesh_surface(lv_layer_t* layer, bed_mesh_renderer_t* renderer
 
     // Project all quad vertices once and cache screen coordinates + depths
     // This replaces 3 separate projection passes (depth calc, bounds tracking, rendering)
-    project_and_cache_quads(renderer, canvas_width, canvas_height);
+    if (!projection_cached) {
+        project_and_cache_quads(renderer, canvas_width, canvas_height);
+    }
     auto t_project = std::chrono::high_resolution_clock::now();
 
-    // Sort quads by depth using cached avg_depth (painter's algorithm - furthest first)
-    helix::mesh::sort_quads_by_depth(renderer->quads);
-    auto t_sort = std::chrono::high_resolution_clock::now();
-
-    spdlog::trace("[Bed Mesh Renderer] Rendering {} quads with {} mode", renderer->quads.size(),
-                  renderer->view_state.is_dragging ? "solid" : "gradient");
-
-    // DEBUG: Track overall gradient quad bounds using cached coordinates
-    int quad_min_x = INT_MAX, quad_max_x = INT_MIN;
-    int quad_min_y = INT_MAX, quad_max_y = INT_MIN;
+    // Map camera depths onto the 16-bit depth buffer range for this frame
+    double min_depth = DBL_MAX, max_depth = -DBL_MAX;
     for (const auto& quad : renderer->quads) {
         for (int i = 0; i < 4; i++) {
-            quad_min_x = std::min(quad_min_x, quad.screen_x[i]);
-            quad_max_x = std::max(quad_max_x, quad.screen_x[i]);
-            quad_min_y = std::min(quad_min_y, quad.screen_y[i]);
-            quad_max_y = std::max(quad_max_y, quad.screen_y[i]);
+            min_depth = std::min(min_depth, quad.depths[i]);
+            max_depth = std::max(max_depth, quad.depths[i]);
         }
     }
-    spdlog::trace("[Bed Mesh Renderer] [GRADIENT_OVERALL] All quads bounds: x=[{},{}] y=[{},{}] "
-                  "quads={} canvas={}x{}",
-                  quad_min_x, quad_max_x, quad_min_y, quad_max_y, renderer->quads.size(),
-                  canvas_width, canvas_height);
+    double depth_scale = max_depth > min_depth
+                             ? (helix::mesh::MESH_DEPTH_FAR - 1) / (max_depth - min_depth)
+                             : 0.0;
 
-    // DEBUG: Log first quad vertex positions using cached coordinates
-    if (!renderer->quads.empty()) {
-        const auto& first_quad = renderer->quads[0];
-        spdlog::trace("[Bed Mesh Renderer] [FIRST_QUAD] Vertices (world -> cached screen):");
-        for (int i = 0; i < 4; i++) {
-            spdlog::trace(
-                "[Bed Mesh Renderer]   v{}: world=({:.2f},{:.2f},{:.2f}) -> screen=({},{})", i,
-                first_quad.vertices[i].x, first_quad.vertices[i].y, first_quad.vertices[i].z,
-                first_quad.screen_x[i], first_quad.screen_y[i]);
-        }
+    lv_draw_buf_t* buf = ensure_surface_buffer(renderer, canvas_width, canvas_height);
+    if (!buf) {
+        renderer->surface_key = bed_mesh_frame_key{};
+        return false;
     }
+    lv_draw_buf_clear(buf, nullptr);
 
-    // Render quads using cached screen coordinates
+    auto& raster = renderer->surface_rasterizer;
+    raster.begin(buf->data, canvas_width, canvas_height, static_cast<int>(buf->header.stride),
+                 renderer->view_state.layer_offset_x, renderer->view_state.layer_offset_y);
+    auto t_clear = std::chrono::high_resolution_clock::now();
+
+    spdlog::trace("[Bed Mesh Renderer] Rendering {} quads with {} mode", renderer->quads.size(),
+                  renderer->view_state.is_dragging ? "solid" : "gradient");
+
+    // The depth buffer resolves occlusion, so quads need no sorting. Translucent quads
+    // (zero plane) blend without writing depth and must come after every opaque quad.
     bool use_gradient = !renderer->view_state.is_dragging;
     for (const auto& quad : renderer->quads) {
-        render_quad(layer, quad, use_gradient);
+        if (quad.opacity == LV_OPA_COVER) {
+            render_quad(raster, quad, min_depth, depth_scale, use_gradient);
+        }
     }
+    for (const auto& quad : renderer->quads) {
+        if (quad.opacity != LV_OPA_COVER) {
+            render_quad(raster, quad, min_depth, depth_scale, false);
+        }
+    }
+
+    renderer->surface_key = key;
+    blit_surface(layer, renderer, canvas_width, canvas_height);
     auto t_rasterize = std::chrono::high_resolution_clock::now();
 
     // PERF: Log performance breakdown (use -vvv to see)
     auto ms_project = std::chrono::duration<double, std::milli>(t_project - t_start).count();
-    auto ms_sort = std::chrono::duration<double, std::milli>(t_sort - t_project).count();
-    auto ms_rasterize = std::chrono::duration<double, std::milli>(t_rasterize - t_sort).count();
-
-    spdlog::trace("[Bed Mesh Renderer] [PERF] Surface render: Proj: {:.2f}ms ({:.0f}%) | Sort: "
-                  "{:.2f}ms ({:.0f}%) | "
-                  "Raster: {:.2f}ms ({:.0f}%) | Mode: {}",
-                  ms_project, 100.0 * ms_project / (ms_project + ms_sort + ms_rasterize), ms_sort,
-                  100.0 * ms_sort / (ms_project + ms_sort + ms_rasterize), ms_rasterize,
-                  100.0 * ms_rasterize / (ms_project + ms_sort + ms_rasterize),
+    auto ms_clear = std::chrono::duration<double, std::milli>(t_clear - t_project).count();
+    auto ms_rasterize = std::chrono::duration<double, std::milli>(t_rasterize - t_clear).count();
+
+    spdlog::trace("[Bed Mesh Renderer] [PERF] Surface render: Proj: {:.2f}ms | Clear: {:.2f}ms | "
+                  "Raster: {:.2f}ms ({} px) | Mode: {}",
+                  ms_project, ms_clear, ms_rasterize, raster.pixels_drawn(),
                   renderer->view_state.is_dragging ? "solid" : "gradient");
+    return false;
+}
+
+/**
+ * @brief Draw the surface bitmap at the widget position
+ *
+ * One image draw for the whole surface instead of LVGL primitives per scanline.
+ */
+static void blit_surface(lv_layer_t* layer, const bed_mesh_renderer_t* renderer, int canvas_width,
+                         int canvas_height) {
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = renderer->surface_buf;
+    lv_area_t coords = {renderer->view_state.layer_offset_x, renderer->view_state.layer_offset_y,
+                        renderer->view_state.layer_offset_x + canvas_width - 1,
+                        renderer->view_state.layer_offset_y + canvas_height - 1};
+    lv_draw_image(layer, &dsc, &coords);
 }
 
 /**
@@ -1184,112 +1268,71 @@ static void render_decorations(lv_layer_t* layer, bed_mesh_renderer_t* renderer,
 // ============================================================================
 
 /**
- * @brief Render a single quad using cached screen coordinates
+ * @brief Get the surface pixel buffer, (re)creating it when the canvas size changes
+ *
+ * @return ARGB8888 buffer of canvas size, or nullptr if allocation failed
+ */
+static lv_draw_buf_t* ensure_surface_buffer(bed_mesh_renderer_t* renderer, int canvas_width,
+                                            int canvas_height) {
+    lv_draw_buf_t* buf = renderer->surface_buf;
+    if (buf && (static_cast<int>(buf->header.w) != canvas_width ||
+                static_cast<int>(buf->header.h) != canvas_height)) {
+        lv_draw_buf_destroy(buf);
+        renderer->surface_buf = nullptr;
+    }
+
+    if (!renderer->surface_buf) {
+        renderer->surface_buf = lv_draw_buf_create(canvas_width, canvas_height,
+                                                   LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+        if (!renderer->surface_buf) {
+            spdlog::error("[Bed Mesh Renderer] Failed to create surface buffer {}x{}",
+                          canvas_width, canvas_height);
+        }
+    }
+    return renderer->surface_buf;
+}
+
+/**
+ * @brief Rasterize a single quad using cached screen coordinates
  *
  * IMPORTANT: Assumes quad screen coordinates are already computed via
  * project_and_cache_quads(). Does NOT perform projection - uses cached values.
  *
- * Uses helix::mesh rasterizer module for triangle fills - LVGL handles clipping
- * automatically via the layer system.
- *
- * For uniform-color quads (like the zero plane), uses LVGL's polygon fill to
- * avoid visible triangle seams along the diagonal.
- *
- * @param layer LVGL draw layer
- * @param quad Quad with cached screen_x[], screen_y[] coordinates
- * @param use_gradient true = gradient interpolation, false = solid color
+ * @param raster Rasterizer bound to the surface buffer for this frame
+ * @param quad Quad with cached screen_x[], screen_y[], depths[]
+ * @param min_depth Camera depth mapped to depth buffer value 0
+ * @param depth_scale Depth buffer units per camera depth unit
+ * @param use_gradient true = gradient interpolation, false = solid center color
  */
-static void render_quad(lv_layer_t* layer, const bed_mesh_quad_3d_t& quad, bool use_gradient) {
+static void render_quad(helix::mesh::MeshSpanRasterizer& raster, const bed_mesh_quad_3d_t& quad,
+                        double min_depth, double depth_scale, bool use_gradient) {
     /**
-     * Quad vertex layout:
+     * Render quad as 2 triangles (diagonal split from BR to TL):
      *
      *    [2]TL ──────── [3]TR
-     *      │              │
-     *      │     QUAD     │
-     *      │              │
-     *    [0]BL ──────── [1]BR
-     */
-
-    // Use quad's opacity (LV_OPA_COVER for mesh quads, translucent for zero plane)
-    lv_opa_t opacity = quad.opacity;
-
-    // For translucent quads (zero plane), use polygon fill instead of triangles
-    // to avoid visible diagonal seams. The plane is uniform color.
-    bool is_translucent = (opacity != LV_OPA_COVER);
-
-    if (is_translucent) {
-        // Render as a single filled polygon (no diagonal line)
-        // Vertex order: BL -> BR -> TR -> TL (clockwise for LVGL)
-        lv_point_precise_t points[4] = {
-            {static_cast<lv_value_precise_t>(quad.screen_x[0]),
-             static_cast<lv_value_precise_t>(quad.screen_y[0])}, // BL
-            {static_cast<lv_value_precise_t>(quad.screen_x[1]),
-             static_cast<lv_value_precise_t>(quad.screen_y[1])}, // BR
-            {static_cast<lv_value_precise_t>(quad.screen_x[3]),
-             static_cast<lv_value_precise_t>(quad.screen_y[3])}, // TR
-            {static_cast<lv_value_precise_t>(quad.screen_x[2]),
-             static_cast<lv_value_precise_t>(quad.screen_y[2])}, // TL
-        };
-
-        lv_draw_triangle_dsc_t tri_dsc;
-        lv_draw_triangle_dsc_init(&tri_dsc);
-        tri_dsc.color = quad.center_color;
-        tri_dsc.opa = opacity;
-
-        // LVGL 9 doesn't have polygon fill, so use 2 triangles but without gradient
-        // to minimize seam visibility. Use the native triangle draw for cleaner edges.
-        // Triangle 1: BL, BR, TR
-        tri_dsc.p[0] = points[0];
-        tri_dsc.p[1] = points[1];
-        tri_dsc.p[2] = points[2];
-        lv_draw_triangle(layer, &tri_dsc);
-
-        // Triangle 2: BL, TR, TL
-        tri_dsc.p[0] = points[0];
-        tri_dsc.p[1] = points[2];
-        tri_dsc.p[2] = points[3];
-        lv_draw_triangle(layer, &tri_dsc);
-        return;
-    }
-
-    // For opaque mesh quads, use triangle rasterizer with gradient support
-    bool should_use_gradient = use_gradient;
-
-    /**
-     * Render quad as 2 triangles (diagonal split from BL to TR):
-     *
-     *    [2]TL ──────── [3]TR
-     *      │  ╲          │
-     *      │    ╲  Tri2  │     Tri1: [0]BL → [1]BR → [2]TL (lower-right)
-     *      │ Tri1 ╲      │     Tri2: [1]BR → [3]TR → [2]TL (upper-left)
-     *      │        ╲    │
+     *      │          ╱  │
+     *      │  Tri1  ╱    │     Tri1: [0]BL → [1]BR → [2]TL
+     *      │      ╱      │     Tri2: [1]BR → [2]TL → [3]TR
+     *      │    ╱  Tri2  │
      *    [0]BL ──────── [1]BR
      *
-     * Using indices [0,1,2] and [1,3,2] creates CCW winding for front-facing triangles
+     * The rasterizer's fill rule draws pixels on the shared diagonal once, so even
+     * the translucent zero plane shows no seam.
      */
-
-    // Triangle 1: [0]BL → [1]BR → [2]TL
-    if (should_use_gradient) {
-        helix::mesh::fill_triangle_gradient(
-            layer, quad.screen_x[0], quad.screen_y[0], quad.vertices[0].color, quad.screen_x[1],
-            quad.screen_y[1], quad.vertices[1].color, quad.screen_x[2], quad.screen_y[2],
-            quad.vertices[2].color, opacity);
-    } else {
-        helix::mesh::fill_triangle_solid(layer, quad.screen_x[0], quad.screen_y[0],
-                                         quad.screen_x[1], quad.screen_y[1], quad.screen_x[2],
-                                         quad.screen_y[2], quad.center_color, opacity);
+    helix::mesh::MeshSpanRasterizer::Vertex v[4];
+    for (int i = 0; i < 4; i++) {
+        v[i].x = quad.screen_x[i];
+        v[i].y = quad.screen_y[i];
+        v[i].depth = static_cast<uint16_t>((quad.depths[i] - min_depth) * depth_scale);
+        v[i].color = quad.vertices[i].color;
     }
 
-    // Triangle 2: [1]BR → [3]TR → [2]TL
-    if (should_use_gradient) {
-        helix::mesh::fill_triangle_gradient(
-            layer, quad.screen_x[1], quad.screen_y[1], quad.vertices[1].color, quad.screen_x[2],
-            quad.screen_y[2], quad.vertices[2].color, quad.screen_x[3], quad.screen_y[3],
-            quad.vertices[3].color, opacity);
+    if (use_gradient) {
+        raster.fill_triangle_gradient(v[0], v[1], v[2], quad.opacity);
+        raster.fill_triangle_gradient(v[1], v[2], v[3], quad.opacity);
     } else {
-        helix::mesh::fill_triangle_solid(layer, quad.screen_x[1], quad.screen_y[1],
-                                         quad.screen_x[2], quad.screen_y[2], quad.screen_x[3],
-                                         quad.screen_y[3], quad.center_color, opacity);
+        raster.fill_triangle_solid(v[0], v[1], v[2], quad.center_color, quad.opacity);
+        raster.fill_triangle_solid(v[1], v[2], v[3], quad.center_color, quad.opacity);
     }
 }
 
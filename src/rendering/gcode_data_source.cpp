@@ -9,6 +9,7 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <cerrno>
 #include <cinttypes>
 #include <cstdio>
 #include <cstring>
@@ -16,8 +17,13 @@
 #include <fstream>
 #include <limits>
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 // For HTTP requests - use libhv which is already in the project
 #include "hv/hurl.h"
+#include "hv/json.hpp"
 #include "hv/requests.h"
 
 namespace helix {
@@ -62,24 +68,82 @@ std::vector<char> GCodeDataSource::read_all() {
     return result;
 }
 
+bool GCodeDataSource::read_line_blocks(uint32_t block_size,
+                                       const std::function<bool(std::string_view)>& visit) {
+    uint64_t size = file_size();
+    uint64_t offset = 0;
+    uint32_t length = std::max<uint32_t>(block_size, 1);
+
+    while (offset < size) {
+        std::vector<char> bytes;
+        std::string_view block = view_range(offset, length);
+        if (block.empty()) {
+            bytes = read_range(offset, length);
+            block = std::string_view(bytes.data(), bytes.size());
+        }
+        if (block.empty()) {
+            spdlog::error("[DataSource] Read failed at offset {} of {}", offset, source_name());
+            return false;
+        }
+
+        // Cut after the last newline; the partial line starts the next block
+        if (offset + block.size() < size) {
+            size_t newline = block.rfind('\n');
+            if (newline == std::string_view::npos) {
+                if (length > std::numeric_limits<uint32_t>::max() / 2) {
+                    spdlog::error("[DataSource] Line too long at offset {}", offset);
+                    return false;
+                }
+                length *= 2; // Line longer than a block
+                continue;
+            }
+            block = block.substr(0, newline + 1);
+        }
+
+        offset += block.size();
+        length = std::max<uint32_t>(block_size, 1);
+        if (!visit(block)) {
+            break;
+        }
+    }
+    return true;
+}
+
 // =============================================================================
 // FileDataSource
 // =============================================================================
 
-FileDataSource::FileDataSource(const std::string& filepath) : filepath_(filepath) {
+FileDataSource::FileDataSource(const std::string& filepath, bool use_mmap) : filepath_(filepath) {
     file_ = std::fopen(filepath.c_str(), "rb");
-    if (file_) {
-        // Get file size using 64-bit safe fseeko/ftello (handles > 2GB on 32-bit ARM)
-        fseeko(file_, 0, SEEK_END);
-        size_ = static_cast<uint64_t>(ftello(file_));
-        fseeko(file_, 0, SEEK_SET);
-        spdlog::debug("[FileDataSource] Opened '{}' ({} bytes)", filepath, size_);
-    } else {
+    if (!file_) {
         spdlog::error("[FileDataSource] Failed to open '{}'", filepath);
+        return;
+    }
+
+    // Get file size using 64-bit safe fseeko/ftello (handles > 2GB on 32-bit ARM)
+    fseeko(file_, 0, SEEK_END);
+    size_ = static_cast<uint64_t>(ftello(file_));
+    fseeko(file_, 0, SEEK_SET);
+
+    // Map the whole file; fread stays as fallback for filesystems without mmap
+    // (some USB/FUSE mounts) and files too large for the address space
+    if (use_mmap && size_ > 0 && static_cast<size_t>(size_) == size_) {
+        void* addr = mmap(nullptr, static_cast<size_t>(size_), PROT_READ, MAP_PRIVATE,
+                          fileno(file_), 0);
+        if (addr != MAP_FAILED) {
+            mapped_ = static_cast<const char*>(addr);
+        } else {
+            spdlog::debug("[FileDataSource] mmap failed for '{}' ({}), using fread",
+                          filepath, std::strerror(errno));
+        }
     }
+
+    spdlog::debug("[FileDataSource] Opened '{}' ({} bytes, {})", filepath, size_,
+                  mapped_ ? "mmap" : "fread");
 }
 
 FileDataSource::~FileDataSource() {
+    unmap();
     if (file_) {
         std::fclose(file_);
         file_ = nullptr;
@@ -87,25 +151,85 @@ FileDataSource::~FileDataSource() {
 }
 
 FileDataSource::FileDataSource(FileDataSource&& other) noexcept
-    : filepath_(std::move(other.filepath_)), file_(other.file_), size_(other.size_) {
+    : filepath_(std::move(other.filepath_)), file_(other.file_), size_(other.size_),
+      mapped_(other.mapped_), map_stale_(other.map_stale_.load()) {
     other.file_ = nullptr;
     other.size_ = 0;
+    other.mapped_ = nullptr;
 }
 
 FileDataSource& FileDataSource::operator=(FileDataSource&& other) noexcept {
     if (this != &other) {
+        unmap();
         if (file_) {
             std::fclose(file_);
         }
         filepath_ = std::move(other.filepath_);
         file_ = other.file_;
         size_ = other.size_;
+        mapped_ = other.mapped_;
+        map_stale_.store(other.map_stale_.load());
         other.file_ = nullptr;
         other.size_ = 0;
+        other.mapped_ = nullptr;
     }
     return *this;
 }
 
+void FileDataSource::unmap() {
+    if (mapped_) {
+        munmap(const_cast<char*>(mapped_), static_cast<size_t>(size_));
+        mapped_ = nullptr;
+    }
+}
+
+bool FileDataSource::mapping_intact() const {
+    if (!mapped_ || map_stale_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    // A shrunk file has mapped pages with nothing behind them (SIGBUS on access)
+    struct stat st{};
+    if (fstat(fileno(file_), &st) == 0 && static_cast<uint64_t>(st.st_size) >= size_) {
+        return true;
+    }
+    if (!map_stale_.exchange(true)) {
+        spdlog::warn("[FileDataSource] '{}' was truncated while open, no longer using mmap",
+                     filepath_);
+    }
+    return false;
+}
+
+std::string_view FileDataSource::view_range(uint64_t offset, uint32_t length) const {
+    if (offset >= size_ || !mapping_intact()) {
+        return {};
+    }
+    size_t available = static_cast<size_t>(std::min<uint64_t>(length, size_ - offset));
+    return std::string_view(mapped_ + offset, available);
+}
+
+void FileDataSource::advise(AccessPattern pattern) {
+    if (!mapped_) {
+        return;
+    }
+
+    int advice = MADV_NORMAL;
+    switch (pattern) {
+    case AccessPattern::Sequential:
+        advice = MADV_SEQUENTIAL;
+        break;
+    case AccessPattern::Random:
+        advice = MADV_RANDOM;
+        break;
+    case AccessPattern::Normal:
+        break;
+    }
+
+    if (madvise(const_cast<char*>(mapped_), static_cast<size_t>(size_), advice) != 0) {
+        spdlog::debug("[FileDataSource] madvise failed: {}", std::strerror(errno));
+    }
+}
+
 std::vector<char> FileDataSource::read_range(uint64_t offset, uint32_t length) {
     if (!file_ || offset >= size_) {
         return {};
@@ -117,8 +241,19 @@ std::vector<char> FileDataSource::read_range(uint64_t offset, uint32_t length) {
         return {};
     }
 
+    if (mapping_intact()) {
+        return std::vector<char>(mapped_ + offset, mapped_ + offset + available);
+    }
+
     std::vector<char> buffer(available);
 
+    if (mapped_) {
+        // Truncated while mapped; pread is positional, so this stays thread-safe
+        ssize_t got = pread(fileno(file_), buffer.data(), available, static_cast<off_t>(offset));
+        buffer.resize(got > 0 ? static_cast<size_t>(got) : 0);
+        return buffer;
+    }
+
     // Seek using 64-bit safe fseeko (handles files > 2GB on 32-bit ARM)
     if (fseeko(file_, static_cast<off_t>(offset), SEEK_SET) != 0) {
         spdlog::error("[FileDataSource] Seek failed at offset {}", offset);
@@ -154,6 +289,21 @@ std::string FileDataSource::indexable_file_path() const {
     return filepath_;
 }
 
+std::string FileDataSource::cache_key() const {
+    if (!is_valid()) {
+        return "";
+    }
+    std::error_code ec;
+    auto mtime = std::filesystem::last_write_time(filepath_, ec);
+    if (ec) {
+        return "";
+    }
+    std::error_code abs_ec;
+    auto absolute = std::filesystem::absolute(filepath_, abs_ec);
+    return fmt::format("file:{}|{}|{}", abs_ec ? filepath_ : absolute.string(), size_,
+                       static_cast<long long>(mtime.time_since_epoch().count()));
+}
+
 // =============================================================================
 // MoonrakerDataSource
 // =============================================================================
@@ -211,37 +361,41 @@ bool MoonrakerDataSource::fetch_metadata() {
         return false;
     }
 
-    // Parse JSON response for "size" field
-    // Simple parsing without JSON library
-    const std::string& resp_str = resp->body;
-    auto size_pos = resp_str.find("\"size\"");
-    if (size_pos == std::string::npos) {
-        spdlog::error("[MoonrakerDataSource] No 'size' in metadata response");
+    // "modified" (epoch seconds) keys on-disk caches; optional, caching is skipped without it
+    if (!parse_metadata_response(resp->body, size_, modified_)) {
+        spdlog::error("[MoonrakerDataSource] No file size in metadata response for '{}'",
+                      gcode_path_);
         return false;
     }
 
-    // Find the number after "size":
-    size_pos = resp_str.find(':', size_pos);
-    if (size_pos == std::string::npos) {
+    spdlog::debug("[MoonrakerDataSource] File size: {} bytes, modified: {:.3f}", size_, modified_);
+    return true;
+}
+
+bool MoonrakerDataSource::parse_metadata_response(const std::string& body, uint64_t& size,
+                                                  double& modified) {
+    // Look only at the result's own fields: thumbnails carry "size" keys too
+    nlohmann::json result;
+    try {
+        result = nlohmann::json::parse(body).at("result");
+    } catch (const nlohmann::json::exception& e) {
+        spdlog::debug("[MoonrakerDataSource] Unusable metadata response: {}", e.what());
         return false;
     }
-    size_pos++; // Skip colon
-
-    // Skip whitespace
-    while (size_pos < resp_str.size() && std::isspace(resp_str[size_pos])) {
-        size_pos++;
+    if (!result.is_object()) {
+        return false;
     }
 
-    // Parse number
-    char* end = nullptr;
-    size_ = std::strtoull(resp_str.c_str() + size_pos, &end, 10);
-
-    if (size_ == 0) {
-        spdlog::error("[MoonrakerDataSource] Failed to parse file size");
+    auto size_it = result.find("size");
+    if (size_it == result.end() || !size_it->is_number() || size_it->get<double>() < 1.0) {
         return false;
     }
+    size = size_it->get<uint64_t>();
 
-    spdlog::debug("[MoonrakerDataSource] File size: {} bytes", size_);
+    auto modified_it = result.find("modified");
+    if (modified_it != result.end() && modified_it->is_number()) {
+        modified = modified_it->get<double>();
+    }
     return true;
 }
 
@@ -417,6 +571,17 @@ bool MoonrakerDataSource::download_to_temp() {
     return true;
 }
 
+std::string_view MoonrakerDataSource::view_range(uint64_t offset, uint32_t length) const {
+    // Only the downloaded temp file can be viewed in place
+    return fallback_source_ ? fallback_source_->view_range(offset, length) : std::string_view();
+}
+
+void MoonrakerDataSource::advise(AccessPattern pattern) {
+    if (fallback_source_) {
+        fallback_source_->advise(pattern);
+    }
+}
+
 uint64_t MoonrakerDataSource::file_size() const {
     return size_;
 }
@@ -447,6 +612,13 @@ std::string MoonrakerDataSource::indexable_file_path() const {
     return "";
 }
 
+std::string MoonrakerDataSource::cache_key() const {
+    if (size_ == 0 || modified_ <= 0.0) {
+        return "";
+    }
+    return fmt::format("moonraker:{}/{}|{}|{:.3f}", moonraker_url_, gcode_path_, size_, modified_);
+}
+
 bool MoonrakerDataSource::ensure_indexable() {
     // If we already have a temp file, we're ready
     if (fallback_source_) {
@@ -491,6 +663,14 @@ std::vector<char> MemoryDataSource::read_range(uint64_t offset, uint32_t length)
     return std::vector<char>(data_.begin() + offset, data_.begin() + offset + available);
 }
 
+std::string_view MemoryDataSource::view_range(uint64_t offset, uint32_t length) const {
+    if (offset >= data_.size()) {
+        return {};
+    }
+    size_t available = std::min<size_t>(length, data_.size() - offset);
+    return std::string_view(data_.data() + offset, available);
+}
+
 uint64_t MemoryDataSource::file_size() const {
     return data_.size();
 }
@@ -4,6 +4,7 @@
 #include "gcode_file_modifier.h"
 
 #include "app_globals.h"
+#include "gcode_stream_modifier.h"
 #include "streaming_policy.h"
 
 #include <spdlog/spdlog.h>
@@ -15,11 +16,17 @@
 #include <random>
 #include <regex>
 #include <sstream>
-#include <unordered_map>
 
 namespace helix {
 namespace gcode {
 
+namespace {
+
+/// Read size for streaming mode; lines past the last modification are copied in these blocks
+constexpr size_t STREAM_BLOCK_SIZE = 256 * 1024;
+
+} // namespace
+
 // ============================================================================
 // GCodeFileModifier implementation
 // ============================================================================
@@ -215,6 +222,14 @@ ModificationResult GCodeFileModifier::apply(const std::filesystem::path& filepat
         return apply_streaming(filepath);
     }
 
+    // Header-only edits: rewrite the first few lines and block-copy the rest
+    if (last_modified_line() <= HEADER_REGION_LINES) {
+        spdlog::debug("[GCodeFileModifier] All modifications within first {} lines - header "
+                      "fast path",
+                      HEADER_REGION_LINES);
+        return apply_streaming(filepath);
+    }
+
     return apply_buffered(filepath);
 }
 
@@ -305,39 +320,19 @@ ModificationResult GCodeFileModifier::apply_buffered(const std::filesystem::path
     return result;
 }
 
-std::unordered_map<size_t, Modification> GCodeFileModifier::build_streaming_lookup() const {
-    std::unordered_map<size_t, Modification> lookup;
-
+size_t GCodeFileModifier::last_modified_line() const {
+    size_t last = 0;
     for (const auto& mod : modifications_) {
-        // For range modifications, we create entries for each line but note
-        // that streaming mode has limitations with multi-line operations
-        size_t end_line = (mod.end_line_number > 0) ? mod.end_line_number : mod.line_number;
-
-        if (mod.end_line_number > 0 && mod.type != ModificationType::COMMENT_OUT &&
-            mod.type != ModificationType::DELETE) {
-            spdlog::warn("[GCodeFileModifier] Streaming mode: multi-line {} not fully supported, "
-                         "processing line {} only",
-                         static_cast<int>(mod.type), mod.line_number);
-            end_line = mod.line_number;
-        }
-
-        for (size_t line = mod.line_number; line <= end_line; ++line) {
-            // Create a modified copy for each line in the range
-            Modification line_mod = mod;
-            line_mod.line_number = line;
-            line_mod.end_line_number = 0; // Reset to single-line for streaming
-            lookup[line] = line_mod;
-        }
+        last = std::max({last, mod.line_number, mod.end_line_number});
     }
-
-    return lookup;
+    return last;
 }
 
 ModificationResult GCodeFileModifier::apply_streaming(const std::filesystem::path& filepath) {
     ModificationResult result;
 
     // Open input file
-    std::ifstream infile(filepath);
+    std::ifstream infile(filepath, std::ios::binary);
     if (!infile.is_open()) {
         result.success = false;
         result.error_message = "Failed to open file: " + filepath.string();
@@ -346,139 +341,56 @@ ModificationResult GCodeFileModifier::apply_streaming(const std::filesystem::pat
     }
 
     // Generate output path
-    result.modified_path = generate_temp_path(filepath);
+    std::string modified_path = generate_temp_path(filepath);
 
     // Open output file
-    std::ofstream outfile(result.modified_path);
+    std::ofstream outfile(modified_path, std::ios::binary);
     if (!outfile.is_open()) {
         result.success = false;
-        result.error_message = "Failed to create temp file: " + result.modified_path;
+        result.modified_path = modified_path;
+        result.error_message = "Failed to create temp file: " + modified_path;
         spdlog::error("[GCodeFileModifier] {}", result.error_message);
         return result;
     }
 
-    // Build lookup map for O(1) per-line checks
-    auto lookup = build_streaming_lookup();
-
     spdlog::info("[GCodeFileModifier] Processing file in streaming mode ({} modifications)",
                  modifications_.size());
 
-    // Process line by line
-    std::string line;
-    size_t line_number = 0;
-    bool first_line = true;
-
-    while (std::getline(infile, line)) {
-        line_number++;
-        result.original_size += line.size() + 1;
-
-        // Check if this line has a modification
-        auto it = lookup.find(line_number);
-        if (it != lookup.end()) {
-            const auto& mod = it->second;
-
-            switch (mod.type) {
-            case ModificationType::COMMENT_OUT: {
-                // Skip if already a comment
-                if (!line.empty() && line[0] == ';') {
-                    if (!first_line)
-                        outfile << '\n';
-                    outfile << line;
-                } else {
-                    std::string commented = comment_out_line(line, mod.comment);
-                    if (!first_line)
-                        outfile << '\n';
-                    outfile << commented;
-                    result.lines_modified++;
-                }
-                result.modified_size += line.size() + (first_line ? 0 : 1);
-                first_line = false;
-                break;
-            }
-
-            case ModificationType::DELETE: {
-                // Simply skip the line (don't write it)
-                result.lines_removed++;
-                // Note: we don't add to modified_size for deleted lines
-                break;
-            }
-
-            case ModificationType::INJECT_BEFORE: {
-                // Write injected content first
-                std::istringstream ss(mod.gcode);
-                std::string inject_line;
-                while (std::getline(ss, inject_line)) {
-                    if (!first_line)
-                        outfile << '\n';
-                    outfile << inject_line;
-                    result.modified_size += inject_line.size() + (first_line ? 0 : 1);
-                    result.lines_added++;
-                    first_line = false;
-                }
-                // Then write the original line
-                if (!first_line)
-                    outfile << '\n';
-                outfile << line;
-                result.modified_size += line.size() + 1;
-                first_line = false;
-                break;
-            }
-
-            case ModificationType::INJECT_AFTER: {
-                // Write original line first
-                if (!first_line)
-                    outfile << '\n';
-                outfile << line;
-                result.modified_size += line.size() + (first_line ? 0 : 1);
-                first_line = false;
-                // Then write injected content
-                std::istringstream ss(mod.gcode);
-                std::string inject_line;
-                while (std::getline(ss, inject_line)) {
-                    outfile << '\n';
-                    outfile << inject_line;
-                    result.modified_size += inject_line.size() + 1;
-                    result.lines_added++;
-                }
-                break;
-            }
-
-            case ModificationType::REPLACE: {
-                // Write replacement content instead of original
-                std::istringstream ss(mod.gcode);
-                std::string replace_line;
-                bool first_replace = true;
-                while (std::getline(ss, replace_line)) {
-                    if (!first_line && !first_replace)
-                        outfile << '\n';
-                    if (!first_line && first_replace)
-                        outfile << '\n';
-                    outfile << replace_line;
-                    result.modified_size += replace_line.size() + (first_line ? 0 : 1);
-                    first_replace = false;
-                    first_line = false;
-                }
-                result.lines_modified++;
-                break;
-            }
-            }
-        } else {
-            // No modification - write line as-is
-            if (!first_line)
-                outfile << '\n';
-            outfile << line;
-            result.modified_size += line.size() + (first_line ? 0 : 1);
-            first_line = false;
+    GCodeStreamModifier stream(modifications_);
+    auto sink = [&outfile](const char* data, size_t size) {
+        outfile.write(data, static_cast<std::streamsize>(size));
+        return outfile.good();
+    };
+
+    std::vector<char> block(STREAM_BLOCK_SIZE);
+    bool ok = true;
+    while (ok && infile) {
+        infile.read(block.data(), static_cast<std::streamsize>(block.size()));
+        auto count = infile.gcount();
+        if (count > 0) {
+            ok = stream.feed(block.data(), static_cast<size_t>(count), sink);
         }
     }
-
-    infile.close();
+    ok = ok && !infile.bad() && stream.finish(sink);
     outfile.close();
 
-    result.success = true;
-    spdlog::info("[GCodeFileModifier] Streaming complete: {} ({} bytes, +{} -{} lines)",
+    result = stream.result();
+    result.modified_path = modified_path;
+    if (!ok || outfile.fail()) {
+        result.success = false;
+        if (result.error_message.empty()) {
+            result.error_message = "Failed to write temp file: " + modified_path;
+        }
+        spdlog::error("[GCodeFileModifier] {}", result.error_message);
+        std::error_code ec;
+        std::filesystem::remove(modified_path, ec);
+        return result;
+    }
+
+    spdlog::info("[GCodeFileModifier] Streaming complete: {} ({} bytes, +{} -{} lines, "
+                 "rewrote {} lines, copied the rest)",
                  result.modified_path, result.modified_size, result.lines_added,
-                 result.lines_removed);
+                 result.lines_removed, stream.lines_processed());
 
     return result;
 }
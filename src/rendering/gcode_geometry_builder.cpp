@@ -13,10 +13,14 @@
 
 #define GLM_ENABLE_EXPERIMENTAL
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
+#include <functional>
 #include <glm/gtx/norm.hpp>
+#include <iterator>
 #include <limits>
+#include <thread>
 #include <unordered_map>
 
 namespace helix {
@@ -35,6 +39,56 @@ constexpr uint32_t START_CAP = 0xFF00FF; // Bright Magenta
 constexpr uint32_t END_CAP = 0x00FFFF;   // Bright Cyan
 } // namespace DebugColors
 
+namespace {
+
+// Run tasks 0..task_count-1 on up to worker_count threads, the caller included
+void run_chunk_workers(size_t task_count, size_t worker_count,
+                       const std::function<void(size_t task)>& task) {
+    worker_count = std::min(worker_count, task_count);
+    std::atomic<size_t> next_task{0};
+    auto worker = [&]() {
+        for (size_t i = next_task.fetch_add(1); i < task_count; i = next_task.fetch_add(1)) {
+            task(i);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < worker_count; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+} // namespace
+
+/// Geometry for simplified segments [begin, end), with palettes local to the chunk
+struct GeometryBuilder::GeometryChunk {
+    size_t begin = 0;
+    size_t end = 0;
+    RibbonGeometry geometry;
+    std::vector<std::pair<size_t, size_t>> layer_strips; ///< Per layer: (first strip, count)
+
+    // layer_strips and geometry.layer_bboxes start at this layer
+    size_t layer_base = 0;
+    bool single_layer = false; ///< build_layer(): every strip is on layer_base, skip the Z lookup
+
+    // Placement in the merged geometry (merge_chunk_layout)
+    std::vector<uint16_t> normal_remap;
+    std::vector<uint8_t> color_remap;
+    size_t vertex_base = 0;
+    size_t strip_base = 0;
+
+    // Statistics, summed after the merge
+    size_t segments_skipped = 0;
+    size_t segments_shared = 0;
+    size_t sharing_candidates = 0;
+    float seg_y_min = FLT_MAX;
+    float seg_y_max = -FLT_MAX;
+};
+
 // ============================================================================
 // QuantizationParams Implementation
 // ============================================================================
@@ -110,7 +164,9 @@ RibbonGeometry::RibbonGeometry(RibbonGeometry&& other) noexcept
       max_layer_index(other.max_layer_index), layer_bboxes(std::move(other.layer_bboxes)),
       normal_cache(std::move(other.normal_cache)), color_cache(std::move(other.color_cache)),
       extrusion_triangle_count(other.extrusion_triangle_count),
-      travel_triangle_count(other.travel_triangle_count), quantization(other.quantization) {}
+      travel_triangle_count(other.travel_triangle_count), quantization(other.quantization),
+      layer_height_mm(other.layer_height_mm), lod_error_mm(other.lod_error_mm),
+      draw_arrays(std::move(other.draw_arrays)) {}
 
 RibbonGeometry& RibbonGeometry::operator=(RibbonGeometry&& other) noexcept {
     if (this != &other) {
@@ -129,6 +185,9 @@ RibbonGeometry& RibbonGeometry::operator=(RibbonGeometry&& other) noexcept {
         extrusion_triangle_count = other.extrusion_triangle_count;
         travel_triangle_count = other.travel_triangle_count;
         quantization = other.quantization;
+        layer_height_mm = other.layer_height_mm;
+        lod_error_mm = other.lod_error_mm;
+        draw_arrays = std::move(other.draw_arrays);
     }
     return *this;
 }
@@ -154,6 +213,73 @@ void RibbonGeometry::clear() {
 
     extrusion_triangle_count = 0;
     travel_triangle_count = 0;
+    draw_arrays.reset();
+}
+
+// ============================================================================
+// RibbonDrawArrays Implementation
+// ============================================================================
+
+const uint8_t* RibbonDrawArrays::colors_for(float dim_factor) {
+    if (dim_factor >= 1.0f) {
+        return colors.data();
+    }
+    if (dim_factor != dimmed_factor_ || dimmed_colors_.size() != colors.size()) {
+        dimmed_colors_.resize(colors.size());
+        for (size_t i = 0; i < colors.size(); i += 4) {
+            for (size_t c = 0; c < 3; ++c) {
+                dimmed_colors_[i + c] =
+                    static_cast<uint8_t>(std::lround(colors[i + c] * dim_factor));
+            }
+            dimmed_colors_[i + 3] = colors[i + 3];
+        }
+        dimmed_factor_ = dim_factor;
+    }
+    return dimmed_colors_.data();
+}
+
+RibbonDrawArrays build_draw_arrays(const RibbonGeometry& geometry) {
+    RibbonDrawArrays arrays;
+    extend_draw_arrays(arrays, geometry);
+    return arrays;
+}
+
+void extend_draw_arrays(RibbonDrawArrays& arrays, const RibbonGeometry& geometry) {
+    const size_t first_vertex = arrays.positions.size() / 3;
+    const size_t vertex_count = geometry.vertices.size();
+    arrays.positions.resize(vertex_count * 3);
+    arrays.normals.resize(vertex_count * 3);
+    arrays.colors.resize(vertex_count * 4);
+
+    for (size_t i = first_vertex; i < vertex_count; ++i) {
+        const RibbonVertex& vertex = geometry.vertices[i];
+
+        glm::vec3 pos = geometry.quantization.dequantize_vec3(vertex.position);
+        arrays.positions[i * 3] = pos.x;
+        arrays.positions[i * 3 + 1] = pos.y;
+        arrays.positions[i * 3 + 2] = pos.z;
+
+        const glm::vec3& normal = geometry.normal_palette[vertex.normal_index];
+        arrays.normals[i * 3] = normal.x;
+        arrays.normals[i * 3 + 1] = normal.y;
+        arrays.normals[i * 3 + 2] = normal.z;
+
+        uint32_t color_rgb = geometry.color_palette[vertex.color_index];
+        arrays.colors[i * 4] = static_cast<uint8_t>((color_rgb >> 16) & 0xFF);
+        arrays.colors[i * 4 + 1] = static_cast<uint8_t>((color_rgb >> 8) & 0xFF);
+        arrays.colors[i * 4 + 2] = static_cast<uint8_t>(color_rgb & 0xFF);
+        arrays.colors[i * 4 + 3] = 0xFF;
+    }
+
+    // A 4-vertex strip [v0 v1 v2 v3] draws (v0 v1 v2) then (v2 v1 v3) to keep
+    // the winding that culling depends on
+    const size_t first_strip = arrays.indices.size() / RibbonDrawArrays::INDICES_PER_STRIP;
+    arrays.indices.reserve(geometry.strips.size() * RibbonDrawArrays::INDICES_PER_STRIP);
+    for (size_t i = first_strip; i < geometry.strips.size(); ++i) {
+        const TriangleStrip& strip = geometry.strips[i];
+        arrays.indices.insert(arrays.indices.end(),
+                              {strip[0], strip[1], strip[2], strip[2], strip[1], strip[3]});
+    }
 }
 
 // ============================================================================
@@ -254,35 +380,58 @@ uint8_t GeometryBuilder::add_to_color_palette(RibbonGeometry& geometry, uint32_t
     return index;
 }
 
+SimplificationOptions GeometryBuilder::lod_level_options(size_t level) {
+    struct LodLevel {
+        float tolerance_mm;
+        float min_segment_length_mm;
+        uint32_t layer_merge;
+    };
+    // Level 1 matches the single coarse geometry built before the pyramid existed
+    static constexpr LodLevel LEVELS[LOD_LEVEL_COUNT] = {
+        {2.0f, 0.5f, 1},
+        {3.5f, 1.0f, 2},
+        {5.0f, 2.0f, 4},
+    };
+
+    const LodLevel& lod = LEVELS[std::clamp<size_t>(level, 1, LOD_LEVEL_COUNT) - 1];
+    SimplificationOptions options;
+    options.tolerance_mm = lod.tolerance_mm;
+    options.min_segment_length_mm = lod.min_segment_length_mm;
+    options.layer_merge = lod.layer_merge;
+    return options;
+}
+
 RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
                                       const SimplificationOptions& options) {
     // Start timing
     auto build_start = std::chrono::high_resolution_clock::now();
 
-    RibbonGeometry geometry;
     stats_ = {}; // Reset statistics
 
     // Validate and apply options
     SimplificationOptions validated_opts = options;
     validated_opts.validate();
 
-    spdlog::info("[GCode Geometry] Building G-code geometry (tolerance={:.3f}mm, merging={})",
-                 validated_opts.tolerance_mm, validated_opts.enable_merging);
+    spdlog::info("[GCode Geometry] Building G-code geometry (tolerance={:.3f}mm, merging={}, "
+                 "layer_merge={})",
+                 validated_opts.tolerance_mm, validated_opts.enable_merging,
+                 validated_opts.layer_merge);
+
+    // Merged layers: ribbons hang below the path Z, so the top layer of each group
+    // drawn N layers tall covers the whole group
+    const uint32_t layer_merge = validated_opts.layer_merge;
+    const float base_layer_height = layer_height_mm_;
+    layer_height_mm_ = base_layer_height * static_cast<float>(layer_merge);
 
     // Calculate quantization parameters from bounding box
-    // IMPORTANT: Expand bounds to account for tube width (vertices extend beyond segment positions)
-    // Use sqrt(2) safety factor because rectangular tubes on diagonal segments can expand
-    // in multiple dimensions simultaneously (e.g., perp_horizontal + perp_vertical)
-    float max_tube_width = std::max(extrusion_width_mm_, travel_width_mm_);
-    float expansion_margin = max_tube_width * 1.5f; // Safety factor for diagonal expansion
-    AABB expanded_bbox = gcode.global_bounding_box;
-    expanded_bbox.min -= glm::vec3(expansion_margin, expansion_margin, expansion_margin);
-    expanded_bbox.max += glm::vec3(expansion_margin, expansion_margin, expansion_margin);
-    quant_params_.calculate_scale(expanded_bbox);
+    set_quantization_bounds(gcode.global_bounding_box);
 
-    spdlog::debug(
-        "[GCode Geometry] Expanded quantization bounds by {:.1f}mm for tube width {:.1f}mm",
-        expansion_margin, max_tube_width);
+    // Resolve highlighted names to ids once so per-segment checks are bit lookups
+    if (gcode.object_names) {
+        highlighted_ids_.assign(highlighted_objects_, *gcode.object_names);
+    } else {
+        highlighted_ids_.clear();
+    }
 
     // Build Z-height to layer index lookup map
     // Used later to assign layer indices to strips for ghost layer rendering
@@ -293,9 +442,13 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
         z_to_layer_index[z_key] = static_cast<uint16_t>(i);
     }
 
-    // Collect all segments from all layers
+    // Collect all segments from all layers (only the top layer of each merged group)
     std::vector<ToolpathSegment> all_segments;
-    for (const auto& layer : gcode.layers) {
+    for (size_t i = 0; i < gcode.layers.size(); ++i) {
+        if (layer_merge > 1 && (i + 1) % layer_merge != 0 && i + 1 != gcode.layers.size()) {
+            continue;
+        }
+        const auto& layer = gcode.layers[i];
         all_segments.insert(all_segments.end(), layer.segments.begin(), layer.segments.end());
     }
 
@@ -348,121 +501,67 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
             max_z = z;
     }
 
-    // Step 2: Generate ribbon geometry with vertex sharing
-    // Track previous segment end vertices for reuse
-    std::optional<TubeCap> prev_end_cap;
-    glm::vec3 prev_end_pos{0.0f};
+    // Step 2: Generate ribbon geometry with vertex sharing, in contiguous chunks
+    // Debug face colors keep per-build diagnostics counters, so that mode stays on one thread
+    size_t workers = worker_count_;
+    if (workers == 0) {
+        unsigned int hw = std::thread::hardware_concurrency();
+        workers = std::clamp<size_t>(hw == 0 ? 1 : hw, 1, MAX_GEOMETRY_WORKERS);
+    }
+    size_t chunk_count = 1;
+    if (workers > 1 && !debug_face_colors_ && simplified.size() >= 2 * MIN_SEGMENTS_PER_CHUNK) {
+        // A few chunks per worker so uneven layers still balance
+        chunk_count = std::min(workers * 4, simplified.size() / MIN_SEGMENTS_PER_CHUNK);
+    }
+    const size_t chunk_size = (simplified.size() + chunk_count - 1) / chunk_count;
+
+    std::vector<GeometryChunk> chunks(chunk_count);
+    for (size_t c = 0; c < chunk_count; ++c) {
+        chunks[c].begin = std::min(c * chunk_size, simplified.size());
+        chunks[c].end = std::min(chunks[c].begin + chunk_size, simplified.size());
+        chunks[c].geometry.layer_bboxes.resize(gcode.layers.size());
+        chunks[c].layer_strips.resize(gcode.layers.size(), {0, 0});
+    }
+
+    run_chunk_workers(chunk_count, workers, [&](size_t c) {
+        build_chunk(simplified, z_to_layer_index, max_z, chunks[c]);
+    });
+
+    RibbonGeometry geometry;
+    if (chunk_count == 1) {
+        geometry = std::move(chunks[0].geometry);
+        geometry.layer_strip_ranges = std::move(chunks[0].layer_strips);
+    } else {
+        // Palettes and layer ranges merge in chunk order; the bulk copy is parallel again
+        geometry.layer_bboxes.resize(gcode.layers.size());
+        geometry.layer_strip_ranges.resize(gcode.layers.size(), {0, 0});
+        for (auto& chunk : chunks) {
+            merge_chunk_layout(geometry, chunk);
+        }
+        run_chunk_workers(chunk_count, workers, [&](size_t c) { copy_chunk(geometry, chunks[c]); });
+    }
 
-    // DEBUG: Track segment Y range and vertex sharing statistics
-    float seg_y_min = FLT_MAX, seg_y_max = -FLT_MAX;
     size_t segments_skipped = 0;
     size_t segments_shared = 0;
-    size_t sharing_candidates = 0; // Segments where prev_end_cap exists
+    size_t sharing_candidates = 0;
+    float seg_y_min = FLT_MAX, seg_y_max = -FLT_MAX;
+    for (const auto& chunk : chunks) {
+        segments_skipped += chunk.segments_skipped;
+        segments_shared += chunk.segments_shared;
+        sharing_candidates += chunk.sharing_candidates;
+        seg_y_min = std::min(seg_y_min, chunk.seg_y_min);
+        seg_y_max = std::max(seg_y_max, chunk.seg_y_max);
+    }
 
-    // Layer tracking for ghost layer rendering
-    // Temporary map to accumulate strips per layer, then convert to ranges
-    std::unordered_map<uint16_t, std::vector<size_t>> layer_to_strip_indices;
     geometry.max_layer_index =
         gcode.layers.empty() ? 0 : static_cast<uint16_t>(gcode.layers.size() - 1);
-
-    // Initialize per-layer bounding boxes for frustum culling
-    geometry.layer_bboxes.resize(gcode.layers.size());
-
     spdlog::info("[GCode::Builder] Setting max_layer_index = {} (from {} layers)",
                  geometry.max_layer_index, gcode.layers.size());
 
-    for (size_t i = 0; i < simplified.size(); ++i) {
-        const auto& segment = simplified[i];
-
-        // Note: Degenerate segments were already filtered before simplification
-
-        // Skip travel moves (non-extrusion moves)
-        // TODO: Make this configurable if we want to visualize travel paths
-        if (!segment.is_extrusion) {
-            segments_skipped++;
-            continue;
-        }
-
-        // Determine layer index from segment Z-height
-        int z_key = static_cast<int>(std::round(segment.start.z * 100.0f));
-        uint16_t layer_idx = 0;
-        auto it = z_to_layer_index.find(z_key);
-        if (it != z_to_layer_index.end()) {
-            layer_idx = it->second;
-        }
-
-        // Expand per-layer bounding box for frustum culling
-        if (layer_idx < geometry.layer_bboxes.size()) {
-            AABB& layer_bbox = geometry.layer_bboxes[layer_idx];
-            layer_bbox.expand(segment.start);
-            layer_bbox.expand(segment.end);
-        }
-
-        // Track Y range
-        seg_y_min = std::min({seg_y_min, segment.start.y, segment.end.y});
-        seg_y_max = std::max({seg_y_max, segment.start.y, segment.end.y});
-
-        // Check if we can share vertices with previous segment (OPTIMIZATION ENABLED!)
-        bool can_share = false;
-        float dist = 0.0f;
-        float connection_tolerance = 0.0f;
-        if (prev_end_cap.has_value()) {
-            sharing_candidates++;
-
-            // Segments must connect spatially (within epsilon) and be same type
-            dist = glm::distance(segment.start, prev_end_pos);
-            // Use width-based tolerance: if gap is less than extrusion width, consider them
-            // connected
-            connection_tolerance = segment.width * 1.5f; //  50% overlap tolerance
-            can_share = (dist < connection_tolerance) &&
-                        (segment.is_extrusion == simplified[i - 1].is_extrusion);
-
-            if (can_share) {
-                segments_shared++;
-            }
-
-            // Debug top layer connections
-            float z = std::round(segment.start.z * 100.0f) / 100.0f;
-            if (z == max_z) {
-                spdlog::trace("[GCode Geometry]   Seg {:3d}: dist={:.4f}mm, tol={:.4f}mm, "
-                              "width={:.4f}mm, can_share={}",
-                              i, dist, connection_tolerance, segment.width, can_share);
-            }
-        }
-
-        // Track strip count before generating geometry
-        size_t strips_before = geometry.strips.size();
-
-        // Generate geometry, reusing previous end cap if segments connect
-        TubeCap end_cap = generate_ribbon_vertices(segment, geometry, quant_params_,
-                                                   can_share ? prev_end_cap : std::nullopt);
-
-        // Track which strips belong to which layer
-        size_t strips_after = geometry.strips.size();
-        for (size_t s = strips_before; s < strips_after; ++s) {
-            geometry.strip_layer_index.push_back(layer_idx);
-            layer_to_strip_indices[layer_idx].push_back(s);
-        }
-
-        // Store for next iteration
-        prev_end_cap = end_cap;
-        prev_end_pos = segment.end;
-    }
-
-    // Build layer_strip_ranges from accumulated data
-    // Initialize with empty ranges for all layers
-    geometry.layer_strip_ranges.resize(gcode.layers.size(), {0, 0});
-    for (const auto& [layer_idx, strip_indices] : layer_to_strip_indices) {
-        if (!strip_indices.empty() && layer_idx < geometry.layer_strip_ranges.size()) {
-            // Find contiguous range (strips should be mostly contiguous per layer)
-            size_t first = strip_indices.front();
-            size_t count = strip_indices.size();
-            geometry.layer_strip_ranges[layer_idx] = {first, count};
-        }
-    }
-
-    spdlog::debug("[GCode::Builder] Layer tracking: {} layers, {} total strips",
-                  geometry.layer_strip_ranges.size(), geometry.strips.size());
+    spdlog::debug("[GCode::Builder] Layer tracking: {} layers, {} total strips ({} chunk(s) on "
+                  "{} thread(s))",
+                  geometry.layer_strip_ranges.size(), geometry.strips.size(), chunk_count,
+                  std::min(workers, chunk_count));
 
     spdlog::trace("[GCode Geometry] Segment Y range: [{:.1f}, {:.1f}]", seg_y_min, seg_y_max);
 
@@ -521,7 +620,17 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
     geometry.quantization = quant_params_;
 
     // Store layer height for Z-offset calculations during LOD rendering
-    geometry.layer_height_mm = layer_height_mm_;
+    geometry.layer_height_mm = base_layer_height;
+    layer_height_mm_ = base_layer_height;
+
+    // Worst-case deviation: a merged-away vertex, a dropped micro-segment, or the
+    // height of the layers folded into one ribbon
+    if (validated_opts.enable_merging) {
+        geometry.lod_error_mm =
+            std::max(validated_opts.tolerance_mm, validated_opts.min_segment_length_mm);
+    }
+    geometry.lod_error_mm = std::max(geometry.lod_error_mm,
+                                     base_layer_height * static_cast<float>(layer_merge - 1));
 
     // Update final statistics
     stats_.vertices_generated = geometry.vertices.size();
@@ -566,6 +675,302 @@ RibbonGeometry GeometryBuilder::build(const ParsedGCodeFile& gcode,
     return geometry;
 }
 
+void GeometryBuilder::set_quantization_bounds(const AABB& bounds) {
+    // IMPORTANT: Expand bounds to account for tube width (vertices extend beyond segment positions)
+    // Use sqrt(2) safety factor because rectangular tubes on diagonal segments can expand
+    // in multiple dimensions simultaneously (e.g., perp_horizontal + perp_vertical)
+    float max_tube_width = std::max(extrusion_width_mm_, travel_width_mm_);
+    float expansion_margin = max_tube_width * 1.5f; // Safety factor for diagonal expansion
+    AABB expanded_bbox = bounds;
+    expanded_bbox.min -= glm::vec3(expansion_margin, expansion_margin, expansion_margin);
+    expanded_bbox.max += glm::vec3(expansion_margin, expansion_margin, expansion_margin);
+    quant_params_.calculate_scale(expanded_bbox);
+
+    spdlog::debug(
+        "[GCode Geometry] Expanded quantization bounds by {:.1f}mm for tube width {:.1f}mm",
+        expansion_margin, max_tube_width);
+}
+
+// ============================================================================
+// Layer-by-Layer Building
+// ============================================================================
+
+RibbonGeometry GeometryBuilder::begin_layers(const AABB& bounds, size_t layer_count,
+                                             ObjectNameTable* object_names) {
+    stats_ = {};
+    layer_tail_.reset();
+    set_quantization_bounds(bounds);
+
+    if (object_names) {
+        highlighted_ids_.assign(highlighted_objects_, *object_names);
+    } else {
+        highlighted_ids_.clear();
+    }
+
+    RibbonGeometry geometry;
+    geometry.layer_bboxes.resize(layer_count);
+    geometry.layer_strip_ranges.resize(layer_count, {0, 0});
+    geometry.max_layer_index = layer_count == 0 ? 0 : static_cast<uint16_t>(layer_count - 1);
+    geometry.quantization = quant_params_;
+    geometry.layer_height_mm = layer_height_mm_;
+
+    spdlog::debug("[GCode::Builder] Building {} layers incrementally", layer_count);
+    return geometry;
+}
+
+GeometryBuilder::LayerGeometry
+GeometryBuilder::build_layer(size_t layer_index, const std::vector<ToolpathSegment>& segments,
+                             const SimplificationOptions& options) {
+    SimplificationOptions validated_opts = options;
+    validated_opts.validate();
+
+    std::vector<ToolpathSegment> layer_segments;
+    layer_segments.reserve(segments.size());
+    std::copy_if(segments.begin(), segments.end(), std::back_inserter(layer_segments),
+                 [](const ToolpathSegment& seg) {
+                     return glm::distance(seg.start, seg.end) >= 0.0001f;
+                 });
+    stats_.input_segments += segments.size();
+
+    if (validated_opts.enable_merging) {
+        layer_segments = simplify_segments(layer_segments, validated_opts);
+    }
+    stats_.output_segments += layer_segments.size();
+
+    // The previous layer's last segment goes in front, outside the chunk
+    GeometryChunk chunk;
+    if (layer_tail_) {
+        layer_segments.insert(layer_segments.begin(), *layer_tail_);
+        chunk.begin = 1;
+    }
+    chunk.end = layer_segments.size();
+    if (chunk.end > chunk.begin) {
+        layer_tail_ = layer_segments.back();
+    }
+
+    chunk.layer_base = layer_index;
+    chunk.single_layer = true;
+    chunk.geometry.layer_bboxes.resize(1);
+    chunk.layer_strips.resize(1, {0, 0});
+
+    static const std::unordered_map<int, uint16_t> no_z_lookup;
+    build_chunk(layer_segments, no_z_lookup, -std::numeric_limits<float>::infinity(), chunk);
+
+    LayerGeometry layer;
+    layer.layer_index = layer_index;
+    layer.geometry = std::move(chunk.geometry);
+    layer.geometry.layer_strip_ranges = std::move(chunk.layer_strips);
+    return layer;
+}
+
+void GeometryBuilder::append_layer(RibbonGeometry& geometry, LayerGeometry&& layer) {
+    if (geometry.layer_strip_ranges.size() <= layer.layer_index) {
+        geometry.layer_strip_ranges.resize(layer.layer_index + 1, {0, 0});
+        geometry.layer_bboxes.resize(layer.layer_index + 1);
+        geometry.max_layer_index = static_cast<uint16_t>(layer.layer_index);
+    }
+
+    GeometryChunk chunk;
+    chunk.layer_base = layer.layer_index;
+    chunk.layer_strips = std::move(layer.geometry.layer_strip_ranges);
+    chunk.geometry = std::move(layer.geometry);
+    merge_chunk_layout(geometry, chunk);
+    copy_chunk(geometry, chunk);
+}
+
+// ============================================================================
+// Chunked Geometry Generation
+// ============================================================================
+
+void GeometryBuilder::build_chunk(const std::vector<ToolpathSegment>& segments,
+                                  const std::unordered_map<int, uint16_t>& z_to_layer_index,
+                                  float max_z, GeometryChunk& chunk) {
+    RibbonGeometry& geometry = chunk.geometry;
+
+    // Track previous segment end vertices for reuse. generate_ribbon_vertices() only checks
+    // whether a previous cap exists (a shared segment skips its start cap), so a chunk can
+    // continue from the last extrusion of the chunk before it without its vertices.
+    std::optional<TubeCap> prev_end_cap;
+    glm::vec3 prev_end_pos{0.0f};
+    for (size_t p = chunk.begin; p-- > 0;) {
+        if (segments[p].is_extrusion) {
+            prev_end_cap = TubeCap{};
+            prev_end_pos = segments[p].end;
+            break;
+        }
+    }
+
+    for (size_t i = chunk.begin; i < chunk.end; ++i) {
+        const auto& segment = segments[i];
+
+        // Note: Degenerate segments were already filtered before simplification
+
+        // Skip travel moves (non-extrusion moves)
+        // TODO: Make this configurable if we want to visualize travel paths
+        if (!segment.is_extrusion) {
+            chunk.segments_skipped++;
+            continue;
+        }
+
+        // Determine layer index from segment Z-height
+        uint16_t layer_idx = static_cast<uint16_t>(chunk.layer_base);
+        if (!chunk.single_layer) {
+            int z_key = static_cast<int>(std::round(segment.start.z * 100.0f));
+            auto it = z_to_layer_index.find(z_key);
+            layer_idx = it != z_to_layer_index.end() ? it->second : 0;
+        }
+        const size_t local_layer = layer_idx - chunk.layer_base;
+
+        // Expand per-layer bounding box for frustum culling
+        if (local_layer < geometry.layer_bboxes.size()) {
+            AABB& layer_bbox = geometry.layer_bboxes[local_layer];
+            layer_bbox.expand(segment.start);
+            layer_bbox.expand(segment.end);
+        }
+
+        // Track Y range
+        chunk.seg_y_min = std::min({chunk.seg_y_min, segment.start.y, segment.end.y});
+        chunk.seg_y_max = std::max({chunk.seg_y_max, segment.start.y, segment.end.y});
+
+        // Check if we can share vertices with previous segment (OPTIMIZATION ENABLED!)
+        bool can_share = false;
+        if (prev_end_cap.has_value()) {
+            chunk.sharing_candidates++;
+
+            // Segments must connect spatially (within epsilon) and be same type
+            float dist = glm::distance(segment.start, prev_end_pos);
+            // Use width-based tolerance: if gap is less than extrusion width, consider them
+            // connected
+            float connection_tolerance = segment.width * 1.5f; //  50% overlap tolerance
+            can_share = (dist < connection_tolerance) &&
+                        (segment.is_extrusion == segments[i - 1].is_extrusion);
+
+            if (can_share) {
+                chunk.segments_shared++;
+            }
+
+            // Debug top layer connections
+            float z = std::round(segment.start.z * 100.0f) / 100.0f;
+            if (z == max_z) {
+                spdlog::trace("[GCode Geometry]   Seg {:3d}: dist={:.4f}mm, tol={:.4f}mm, "
+                              "width={:.4f}mm, can_share={}",
+                              i, dist, connection_tolerance, segment.width, can_share);
+            }
+        }
+
+        // Track strip count before generating geometry
+        size_t strips_before = geometry.strips.size();
+
+        // Generate geometry, reusing previous end cap if segments connect
+        TubeCap end_cap = generate_ribbon_vertices(segment, geometry, quant_params_,
+                                                   can_share ? prev_end_cap : std::nullopt);
+
+        // Track which strips belong to which layer
+        size_t strips_after = geometry.strips.size();
+        geometry.strip_layer_index.insert(geometry.strip_layer_index.end(),
+                                          strips_after - strips_before, layer_idx);
+        if (local_layer < chunk.layer_strips.size() && strips_after > strips_before) {
+            auto& [first, count] = chunk.layer_strips[local_layer];
+            if (count == 0) {
+                first = strips_before;
+            }
+            count += strips_after - strips_before;
+        }
+
+        // Store for next iteration
+        prev_end_cap = std::move(end_cap);
+        prev_end_pos = segment.end;
+    }
+}
+
+void GeometryBuilder::merge_chunk_layout(RibbonGeometry& geometry, GeometryChunk& chunk) {
+    RibbonGeometry& part = chunk.geometry;
+
+    // Palette entries are already quantized, so they are looked up as-is. Entries
+    // new to the result are appended in chunk order, which is the order a
+    // single-threaded build would have added them.
+    chunk.normal_remap.resize(part.normal_palette.size());
+    for (size_t i = 0; i < part.normal_palette.size(); ++i) {
+        const glm::vec3& normal = part.normal_palette[i];
+        auto it = geometry.normal_cache->find(normal);
+        if (it != geometry.normal_cache->end()) {
+            chunk.normal_remap[i] = it->second;
+        } else if (geometry.normal_palette.size() >= 65536) {
+            chunk.normal_remap[i] = 65535;
+        } else {
+            chunk.normal_remap[i] = static_cast<uint16_t>(geometry.normal_palette.size());
+            geometry.normal_palette.push_back(normal);
+            (*geometry.normal_cache)[normal] = chunk.normal_remap[i];
+        }
+    }
+
+    chunk.color_remap.resize(part.color_palette.size());
+    for (size_t i = 0; i < part.color_palette.size(); ++i) {
+        uint32_t color = part.color_palette[i];
+        auto it = geometry.color_cache->find(color);
+        if (it != geometry.color_cache->end()) {
+            chunk.color_remap[i] = it->second;
+        } else if (geometry.color_palette.size() >= 256) {
+            chunk.color_remap[i] = 255;
+        } else {
+            chunk.color_remap[i] = static_cast<uint8_t>(geometry.color_palette.size());
+            geometry.color_palette.push_back(color);
+            (*geometry.color_cache)[color] = chunk.color_remap[i];
+        }
+    }
+
+    // Reserve this chunk's slice; copy_chunk() fills it
+    chunk.vertex_base = geometry.vertices.size();
+    chunk.strip_base = geometry.strips.size();
+    geometry.vertices.resize(chunk.vertex_base + part.vertices.size());
+    geometry.strips.resize(chunk.strip_base + part.strips.size());
+    geometry.strip_layer_index.resize(chunk.strip_base + part.strip_layer_index.size());
+
+    for (size_t layer = 0; layer < chunk.layer_strips.size(); ++layer) {
+        const auto& [first, count] = chunk.layer_strips[layer];
+        if (count > 0) {
+            auto& range = geometry.layer_strip_ranges[chunk.layer_base + layer];
+            if (range.second == 0) {
+                range.first = chunk.strip_base + first;
+            }
+            range.second += count;
+        }
+
+        const AABB& part_bbox = part.layer_bboxes[layer];
+        if (part_bbox.min.x <= part_bbox.max.x) {
+            geometry.layer_bboxes[chunk.layer_base + layer].expand(part_bbox.min);
+            geometry.layer_bboxes[chunk.layer_base + layer].expand(part_bbox.max);
+        }
+    }
+
+    geometry.extrusion_triangle_count += part.extrusion_triangle_count;
+    geometry.travel_triangle_count += part.travel_triangle_count;
+}
+
+void GeometryBuilder::copy_chunk(RibbonGeometry& geometry, GeometryChunk& chunk) {
+    RibbonGeometry& part = chunk.geometry;
+
+    RibbonVertex* vertices = geometry.vertices.data() + chunk.vertex_base;
+    for (size_t i = 0; i < part.vertices.size(); ++i) {
+        const RibbonVertex& vertex = part.vertices[i];
+        vertices[i] = {vertex.position, chunk.normal_remap[vertex.normal_index],
+                       chunk.color_remap[vertex.color_index]};
+    }
+
+    const uint32_t vertex_base = static_cast<uint32_t>(chunk.vertex_base);
+    TriangleStrip* strips = geometry.strips.data() + chunk.strip_base;
+    for (size_t i = 0; i < part.strips.size(); ++i) {
+        const TriangleStrip& strip = part.strips[i];
+        strips[i] = {strip[0] + vertex_base, strip[1] + vertex_base, strip[2] + vertex_base,
+                     strip[3] + vertex_base};
+    }
+    std::copy(part.strip_layer_index.begin(), part.strip_layer_index.end(),
+              geometry.strip_layer_index.begin() + static_cast<std::ptrdiff_t>(chunk.strip_base));
+
+    // Release the chunk as soon as it is copied to keep the peak down
+    part = RibbonGeometry();
+}
+
 // ============================================================================
 // Segment Simplification
 // ============================================================================
@@ -594,7 +999,7 @@ GeometryBuilder::simplify_segments(const std::vector<ToolpathSegment>& segments,
 
         bool same_type = (current.is_extrusion == next.is_extrusion);
         bool endpoints_connect = glm::distance2(current.end, next.start) < 0.0001f;
-        bool same_object = (current.object_name == next.object_name);
+        bool same_object = (current.object_id == next.object_id);
 
         if (same_type && endpoints_connect && same_object) {
             // Check if current.start, current.end, next.end are collinear
@@ -656,22 +1061,22 @@ GeometryBuilder::TubeCap
 GeometryBuilder::generate_ribbon_vertices(const ToolpathSegment& segment, RibbonGeometry& geometry,
                                           const QuantizationParams& quant,
                                           std::optional<TubeCap> prev_start_cap) {
-    // Read tube cross-section configuration
-    static int tube_sides = -1; // Cache config value (read once)
-    if (tube_sides == -1) {
-        tube_sides = Config::get_instance()->get<int>("/gcode_viewer/tube_sides", 16);
+    // Read tube cross-section configuration (once; static init is safe across build workers)
+    static const int tube_sides = [] {
+        int sides = Config::get_instance()->get<int>("/gcode_viewer/tube_sides", 16);
 
         // Validate: only 4, 8, or 16 sides supported
-        if (tube_sides != 4 && tube_sides != 8 && tube_sides != 16) {
+        if (sides != 4 && sides != 8 && sides != 16) {
             spdlog::warn(
                 "[GCode Geometry] Invalid tube_sides={} (must be 4, 8, or 16), defaulting to 16",
-                tube_sides);
-            tube_sides = 16;
+                sides);
+            sides = 16;
         }
 
         spdlog::info("[GCode Geometry] G-code tube geometry: N={} sides (elliptical cross-section)",
-                     tube_sides);
-    }
+                     sides);
+        return sides;
+    }();
 
     // All phases complete - use configured N value
     const int N = tube_sides;
@@ -704,8 +1109,7 @@ GeometryBuilder::generate_ribbon_vertices(const ToolpathSegment& segment, Ribbon
 
     // Compute color
     uint32_t rgb = compute_segment_color(segment, quant.min_bounds.z, quant.max_bounds.z);
-    if (!highlighted_objects_.empty() && !segment.object_name.empty() &&
-        highlighted_objects_.count(segment.object_name) > 0) {
+    if (highlighted_ids_.contains(segment.object_id)) {
         constexpr float HIGHLIGHT_BRIGHTNESS = 1.8f;
         uint8_t r =
             static_cast<uint8_t>(std::min(255.0f, ((rgb >> 16) & 0xFF) * HIGHLIGHT_BRIGHTNESS));
@@ -1098,8 +1502,7 @@ uint32_t GeometryBuilder::parse_hex_color(const std::string& hex_color) const {
 uint32_t GeometryBuilder::compute_segment_color(const ToolpathSegment& segment, float z_min,
                                                 float z_max) const {
     // Priority 1: Tool-specific color from palette (multi-color prints)
-    if (!tool_color_palette_.empty() && segment.tool_index >= 0 &&
-        segment.tool_index < static_cast<int>(tool_color_palette_.size())) {
+    if (!tool_color_palette_.empty() && segment.tool_index < tool_color_palette_.size()) {
         const std::string& hex_color = tool_color_palette_[static_cast<size_t>(segment.tool_index)];
         if (!hex_color.empty()) {
             return parse_hex_color(hex_color);
@@ -0,0 +1,157 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_index_cache.h"
+
+#include "app_globals.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+// 64-bit FNV-1a; the full key is stored in the file, so collisions only cost a miss
+uint64_t hash_key(const std::string& key) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+bool is_cache_file(const fs::directory_entry& entry, const char* extension) {
+    std::error_code ec;
+    return entry.is_regular_file(ec) && entry.path().extension() == extension;
+}
+
+} // namespace
+
+std::string cache_file_name(const std::string& key, const char* extension) {
+    return fmt::format("{:016x}{}", hash_key(key), extension);
+}
+
+size_t evict_lru_cache_files(const std::string& directory, const char* extension,
+                             size_t max_bytes) {
+    struct CacheFile {
+        fs::path path;
+        fs::file_time_type mtime;
+        uintmax_t size;
+    };
+    std::vector<CacheFile> files;
+    uintmax_t total = 0;
+
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        if (!is_cache_file(entry, extension)) {
+            continue;
+        }
+        std::error_code stat_ec;
+        CacheFile file{entry.path(), fs::last_write_time(entry.path(), stat_ec),
+                       fs::file_size(entry.path(), stat_ec)};
+        if (!stat_ec) {
+            total += file.size;
+            files.push_back(std::move(file));
+        }
+    }
+    if (total <= max_bytes) {
+        return 0;
+    }
+
+    std::sort(files.begin(), files.end(),
+              [](const CacheFile& a, const CacheFile& b) { return a.mtime < b.mtime; });
+
+    size_t evicted = 0;
+    for (size_t i = 0; i + 1 < files.size() && total > max_bytes; ++i) {
+        if (fs::remove(files[i].path, ec)) {
+            total -= files[i].size;
+            ++evicted;
+        }
+    }
+    spdlog::debug("[IndexCache] Evicted {} {} files from {}, {} bytes remain", evicted, extension,
+                  directory, static_cast<uint64_t>(total));
+    return evicted;
+}
+
+GCodeIndexCache::GCodeIndexCache() : GCodeIndexCache(get_helix_cache_dir("gcode_index")) {}
+
+GCodeIndexCache::GCodeIndexCache(std::string directory, size_t max_bytes)
+    : directory_(std::move(directory)), max_bytes_(max_bytes) {
+    if (directory_.empty()) {
+        return;
+    }
+    std::error_code ec;
+    fs::create_directories(directory_, ec);
+    if (!fs::is_directory(directory_, ec)) {
+        spdlog::warn("[IndexCache] Cannot use cache directory {}, caching disabled", directory_);
+        directory_.clear();
+    }
+}
+
+std::string GCodeIndexCache::path_for(const std::string& key) const {
+    if (directory_.empty() || key.empty()) {
+        return "";
+    }
+    return (fs::path(directory_) / cache_file_name(key, FILE_EXTENSION)).string();
+}
+
+bool GCodeIndexCache::load(const std::string& key, const std::string& source_path,
+                           GCodeLayerIndex& index,
+                           std::shared_ptr<ObjectNameTable> object_names) const {
+    std::string path = path_for(key);
+    if (path.empty()) {
+        return false;
+    }
+
+    std::error_code ec;
+    if (!fs::exists(path, ec)) {
+        return false;
+    }
+    if (!index.load_from_cache_file(path, key, source_path, std::move(object_names))) {
+        return false;
+    }
+
+    // Mark as most recently used for eviction
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+bool GCodeIndexCache::store(const std::string& key, const GCodeLayerIndex& index) {
+    std::string path = path_for(key);
+    if (path.empty() || !index.is_valid()) {
+        return false;
+    }
+    if (!index.save_to_cache_file(path, key)) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(evict_mutex_);
+        evict_lru_cache_files(directory_, FILE_EXTENSION, max_bytes_);
+    }
+    return true;
+}
+
+void GCodeIndexCache::clear() {
+    if (directory_.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(evict_mutex_);
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(directory_, ec)) {
+        if (is_cache_file(entry, FILE_EXTENSION)) {
+            fs::remove(entry.path(), ec);
+        }
+    }
+}
+
+} // namespace gcode
+} // namespace helix
@@ -17,29 +17,26 @@ GCodeLayerCache::GCodeLayerCache(size_t memory_budget_bytes) : memory_budget_(me
 
 size_t GCodeLayerCache::estimate_memory(const std::vector<ToolpathSegment>& segments) {
     // Base cost: vector overhead + segment data
-    // Each ToolpathSegment is approximately:
-    // - glm::vec3 start: 12 bytes
-    // - glm::vec3 end: 12 bytes
-    // - bool is_extrusion: 1 byte (+ padding)
-    // - std::string object_name: 32 bytes (SSO buffer) + potential heap
-    // - float extrusion_amount: 4 bytes
-    // - float width: 4 bytes
-    // - int tool_index: 4 bytes
-    // Total: ~80 bytes base + string heap allocation
-
+    // ToolpathSegment is a fixed-size POD (positions, widths, interned object id,
+    // tool index and flags) - object names live in the shared ObjectNameTable,
+    // so there is no per-segment heap allocation to account for.
     size_t base_cost = sizeof(std::vector<ToolpathSegment>) + 64; // Vector overhead + some slack
 
-    size_t per_segment = BYTES_PER_SEGMENT;
+    return base_cost + (segments.capacity() * BYTES_PER_SEGMENT);
+}
 
-    // Add extra for segments with long object names
-    size_t string_overhead = 0;
-    for (const auto& seg : segments) {
-        if (seg.object_name.length() > 15) { // Beyond SSO threshold
-            string_overhead += seg.object_name.length() + 1;
-        }
+GCodeLayerCache::~GCodeLayerCache() {
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        prefetch_queue_.clear();
+        threads.swap(prefetch_threads_);
+    }
+    prefetch_cv_.notify_all();
+    for (auto& t : threads) {
+        t.join();
     }
-
-    return base_cost + (segments.size() * per_segment) + string_overhead;
 }
 
 GCodeLayerCache::CacheResult
@@ -48,12 +45,29 @@ GCodeLayerCache::get_or_load(size_t layer_index,
     // Periodically check memory pressure and adapt budget (rate-limited internally)
     check_memory_pressure();
 
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    // A prefetch thread is already loading it - wait rather than load twice
+    if (prefetch_in_flight_.count(layer_index) > 0) {
+        prefetch_stats_.misses++;
+        prefetch_done_cv_.wait(lock, [&] { return prefetch_in_flight_.count(layer_index) == 0; });
+        auto it = cache_.find(layer_index);
+        if (it != cache_.end()) {
+            miss_count_++;
+            it->second.prefetched = false;
+            touch(layer_index);
+            return CacheResult{it->second.segments, false, false};
+        }
+    }
 
     // Check if already cached
     auto it = cache_.find(layer_index);
     if (it != cache_.end()) {
         hit_count_++;
+        if (it->second.prefetched) {
+            prefetch_stats_.hits++;
+            it->second.prefetched = false;
+        }
         touch(layer_index);
         spdlog::trace("[LayerCache] Hit layer {} ({} segments)", layer_index,
                       it->second.segments->size());
@@ -61,6 +75,14 @@ GCodeLayerCache::get_or_load(size_t layer_index,
         return CacheResult{it->second.segments, true, false};
     }
 
+    // Still queued for prefetch - load it now instead
+    auto queued = std::find_if(prefetch_queue_.begin(), prefetch_queue_.end(),
+                               [&](const PrefetchRequest& r) { return r.layer_index == layer_index; });
+    if (queued != prefetch_queue_.end()) {
+        prefetch_queue_.erase(queued);
+        prefetch_stats_.misses++;
+    }
+
     // Cache miss - need to load
     miss_count_++;
     spdlog::debug("[LayerCache] Miss layer {}, loading...", layer_index);
@@ -79,6 +101,22 @@ GCodeLayerCache::get_or_load(size_t layer_index,
         // Still cache empty layers to avoid repeated loads
     }
 
+    // Insert into cache - use shared_ptr for thread-safe lifetime management
+    CacheEntry* entry = store(layer_index, std::move(segments), false);
+    if (!entry) {
+        // Not cached: the caller should check load_failed and handle accordingly
+        return CacheResult{nullptr, false, true};
+    }
+
+    // Return shared_ptr - data stays alive even if entry is evicted
+    return CacheResult{entry->segments, false, false};
+}
+
+GCodeLayerCache::CacheEntry* GCodeLayerCache::store(size_t layer_index,
+                                                    std::vector<ToolpathSegment>&& segments,
+                                                    bool prefetched) {
+    // Already holding lock when called
+
     // Calculate memory needed
     size_t needed = estimate_memory(segments);
 
@@ -86,24 +124,21 @@ GCodeLayerCache::get_or_load(size_t layer_index,
     if (needed > memory_budget_) {
         spdlog::warn("[LayerCache] Layer {} ({} segments, {} bytes) exceeds budget ({} bytes)",
                      layer_index, segments.size(), needed, memory_budget_);
-        // Return the data but don't cache it
-        // Note: This is a bit tricky - we return a temporary that will be destroyed
-        // The caller should check load_failed and handle accordingly
-        return CacheResult{nullptr, false, true};
+        return nullptr;
     }
 
     // Make room if needed
     evict_for_space(needed);
 
-    // Insert into cache - use shared_ptr for thread-safe lifetime management
     CacheEntry entry;
     entry.segments = std::make_shared<std::vector<ToolpathSegment>>(std::move(segments));
     entry.memory_bytes = needed;
+    entry.prefetched = prefetched;
 
     auto [inserted_it, success] = cache_.emplace(layer_index, std::move(entry));
     if (!success) {
         spdlog::error("[LayerCache] Failed to insert layer {} into cache", layer_index);
-        return CacheResult{nullptr, false, true};
+        return nullptr;
     }
 
     // Add to LRU tracking
@@ -115,8 +150,7 @@ GCodeLayerCache::get_or_load(size_t layer_index,
                   layer_index, inserted_it->second.segments->size(), needed,
                   static_cast<double>(current_memory_) / (1024 * 1024));
 
-    // Return shared_ptr - data stays alive even if entry is evicted
-    return CacheResult{inserted_it->second.segments, false, false};
+    return &inserted_it->second;
 }
 
 bool GCodeLayerCache::is_cached(size_t layer_index) const {
@@ -139,44 +173,197 @@ void GCodeLayerCache::prefetch(size_t center_layer, size_t radius,
     }
 }
 
-bool GCodeLayerCache::insert(size_t layer_index, std::vector<ToolpathSegment>&& segments) {
+void GCodeLayerCache::prefetch_async(size_t center_layer, size_t radius, LayerLoader loader,
+                                     size_t max_layer) {
+    if (center_layer > max_layer) {
+        return;
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
+    if (stopping_) {
+        return;
+    }
 
-    // Check if already cached
-    if (cache_.find(layer_index) != cache_.end()) {
-        // Already cached, just touch it
-        touch(layer_index);
-        return true;
+    // Priority order: center, then ahead in the direction of motion, then behind.
+    // Without motion (first call or same center) both sides alternate by distance.
+    int direction = 0;
+    if (prefetch_center_) {
+        if (center_layer > *prefetch_center_) {
+            direction = 1;
+        } else if (center_layer < *prefetch_center_) {
+            direction = -1;
+        }
+    }
+    prefetch_center_ = center_layer;
+
+    std::vector<size_t> wanted;
+    wanted.reserve(2 * radius + 1);
+    wanted.push_back(center_layer);
+    auto add_at = [&](size_t distance, int side) {
+        if (side > 0 && center_layer + distance <= max_layer) {
+            wanted.push_back(center_layer + distance);
+        } else if (side < 0 && distance <= center_layer) {
+            wanted.push_back(center_layer - distance);
+        }
+    };
+    if (direction != 0) {
+        for (size_t d = 1; d <= radius; ++d) {
+            add_at(d, direction);
+        }
+        for (size_t d = 1; d <= radius; ++d) {
+            add_at(d, -direction);
+        }
+    } else {
+        for (size_t d = 1; d <= radius; ++d) {
+            add_at(d, 1);
+            add_at(d, -1);
+        }
     }
 
-    size_t needed = estimate_memory(segments);
+    // Rebuild the queue; layers queued earlier keep their original queue time
+    auto now = std::chrono::steady_clock::now();
+    std::deque<PrefetchRequest> queue;
+    for (size_t layer : wanted) {
+        if (cache_.count(layer) > 0 || prefetch_in_flight_.count(layer) > 0) {
+            continue;
+        }
+        auto old = std::find_if(prefetch_queue_.begin(), prefetch_queue_.end(),
+                                [&](const PrefetchRequest& r) { return r.layer_index == layer; });
+        queue.push_back({layer, old != prefetch_queue_.end() ? old->queued_at : now});
+    }
+    for (const auto& r : prefetch_queue_) {
+        if (std::find(wanted.begin(), wanted.end(), r.layer_index) == wanted.end()) {
+            prefetch_stats_.cancelled++;
+        }
+    }
+    prefetch_queue_.swap(queue);
 
-    // Check if it would fit even with empty cache
-    if (needed > memory_budget_) {
-        spdlog::warn("[LayerCache] Layer {} ({} bytes) exceeds budget, not caching", layer_index,
-                     needed);
-        return false;
+    // Touch cached layers far-to-near so the center ends up most recently used
+    for (auto it = wanted.rbegin(); it != wanted.rend(); ++it) {
+        if (cache_.count(*it) > 0) {
+            touch(*it);
+        }
     }
 
-    // Make room
-    evict_for_space(needed);
+    if (prefetch_queue_.empty()) {
+        prefetch_done_cv_.notify_all();
+        return;
+    }
 
-    // Insert - use shared_ptr for thread-safe lifetime management
-    CacheEntry entry;
-    entry.segments = std::make_shared<std::vector<ToolpathSegment>>(std::move(segments));
-    entry.memory_bytes = needed;
+    prefetch_loader_ = std::move(loader);
 
-    cache_.emplace(layer_index, std::move(entry));
-    lru_order_.push_front(layer_index);
-    lru_map_[layer_index] = lru_order_.begin();
-    current_memory_ += needed;
+    // Threads start lazily and live until the cache is destroyed
+    while (prefetch_threads_.size() < prefetch_concurrency_) {
+        prefetch_threads_.emplace_back(&GCodeLayerCache::prefetch_worker, this);
+    }
+    prefetch_cv_.notify_all();
 
-    return true;
+    spdlog::trace("[LayerCache] Prefetch queued {} layers around {}", prefetch_queue_.size(),
+                  center_layer);
+}
+
+void GCodeLayerCache::prefetch_worker() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        prefetch_cv_.wait(lock, [&] {
+            return stopping_ ||
+                   (!prefetch_queue_.empty() && prefetch_in_flight_.size() < prefetch_concurrency_);
+        });
+        if (stopping_) {
+            return;
+        }
+
+        PrefetchRequest request = prefetch_queue_.front();
+        prefetch_queue_.pop_front();
+        if (cache_.count(request.layer_index) > 0 ||
+            prefetch_in_flight_.count(request.layer_index) > 0) {
+            prefetch_done_cv_.notify_all(); // Queue may now be empty
+            continue;
+        }
+
+        prefetch_in_flight_.insert(request.layer_index);
+        LayerLoader loader = prefetch_loader_;
+        uint64_t generation = generation_;
+
+        // Load without the lock so the UI thread keeps hitting the cache meanwhile
+        lock.unlock();
+        std::vector<ToolpathSegment> segments;
+        bool loaded = true;
+        try {
+            segments = loader(request.layer_index);
+        } catch (const std::exception& e) {
+            spdlog::error("[LayerCache] Prefetch of layer {} failed: {}", request.layer_index,
+                          e.what());
+            loaded = false;
+        }
+        lock.lock();
+
+        prefetch_in_flight_.erase(request.layer_index);
+        if (loaded && generation == generation_ && cache_.count(request.layer_index) == 0 &&
+            store(request.layer_index, std::move(segments), true)) {
+            double latency_ms = std::chrono::duration<double, std::milli>(
+                                    std::chrono::steady_clock::now() - request.queued_at)
+                                    .count();
+            prefetch_stats_.completed++;
+            prefetch_latency_total_ms_ += latency_ms;
+            prefetch_stats_.avg_queue_latency_ms =
+                prefetch_latency_total_ms_ / static_cast<double>(prefetch_stats_.completed);
+            prefetch_stats_.max_queue_latency_ms =
+                std::max(prefetch_stats_.max_queue_latency_ms, latency_ms);
+        }
+
+        prefetch_done_cv_.notify_all();
+        prefetch_cv_.notify_one(); // A load slot is free again
+    }
+}
+
+void GCodeLayerCache::cancel_prefetch() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    prefetch_stats_.cancelled += prefetch_queue_.size();
+    prefetch_queue_.clear();
+    prefetch_center_.reset();
+    prefetch_done_cv_.wait(lock, [&] { return prefetch_in_flight_.empty(); });
+}
+
+void GCodeLayerCache::wait_for_prefetch() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    prefetch_done_cv_.wait(lock,
+                           [&] { return prefetch_queue_.empty() && prefetch_in_flight_.empty(); });
+}
+
+void GCodeLayerCache::set_prefetch_concurrency(size_t max_in_flight) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    prefetch_concurrency_ = std::max<size_t>(max_in_flight, 1);
+    prefetch_cv_.notify_all();
+}
+
+GCodeLayerCache::PrefetchStats GCodeLayerCache::prefetch_stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return prefetch_stats_;
+}
+
+bool GCodeLayerCache::insert(size_t layer_index, std::vector<ToolpathSegment>&& segments) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Check if already cached
+    if (cache_.find(layer_index) != cache_.end()) {
+        // Already cached, just touch it
+        touch(layer_index);
+        return true;
+    }
+
+    return store(layer_index, std::move(segments), false) != nullptr;
 }
 
 void GCodeLayerCache::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
 
+    // Queued prefetches are dropped and running ones won't be stored
+    prefetch_stats_.cancelled += prefetch_queue_.size();
+    prefetch_queue_.clear();
+    generation_++;
+    prefetch_done_cv_.notify_all();
+
     cache_.clear();
     lru_order_.clear();
     lru_map_.clear();
@@ -238,6 +425,8 @@ void GCodeLayerCache::reset_stats() {
     std::lock_guard<std::mutex> lock(mutex_);
     hit_count_ = 0;
     miss_count_ = 0;
+    prefetch_stats_ = PrefetchStats{};
+    prefetch_latency_total_ms_ = 0.0;
 }
 
 void GCodeLayerCache::set_memory_budget(size_t budget_bytes) {
@@ -3,14 +3,19 @@
 
 #include "gcode_layer_index.h"
 
+#include "gcode_data_source.h"
+#include "gcode_line_scanner.h"
+
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstdio>
 #include <cstring>
 #include <fstream>
 #include <limits>
+#include <unordered_map>
 
 namespace helix {
 namespace gcode {
@@ -20,6 +25,25 @@ namespace {
 // Layer detection tolerance for Z changes
 constexpr float Z_EPSILON = 0.001f;
 
+// Bytes per scan block (zero-copy views when the file is mapped, reads otherwise)
+constexpr uint32_t INDEX_BLOCK_BYTES = 1024 * 1024;
+
+// Lines handed from scan_lines() to the indexer per batch (bounds the line buffer)
+constexpr size_t SCAN_BATCH_LINES = 4096;
+
+// Call fn(line) for each newline-terminated line in text (newline stripped;
+// a final unterminated line is included)
+template <typename Fn> void for_each_line(std::string_view text, Fn&& fn) {
+    const char* p = text.data();
+    const char* end = p + text.size();
+    while (p < end) {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        const char* line_end = nl ? nl : end;
+        fn(std::string_view(p, static_cast<size_t>(line_end - p)));
+        p = nl ? nl + 1 : end;
+    }
+}
+
 // Extract float parameter from G-code line (e.g., "Z1.2" -> 1.2)
 bool extract_z_param(const char* line, size_t len, float& out_z) {
     // Find 'Z' parameter (case-insensitive)
@@ -28,9 +52,7 @@ bool extract_z_param(const char* line, size_t len, float& out_z) {
             // Check if followed by a digit or sign
             char next = line[i + 1];
             if (next == '-' || next == '+' || next == '.' || (next >= '0' && next <= '9')) {
-                char* end = nullptr;
-                out_z = std::strtof(line + i + 1, &end);
-                if (end != line + i + 1) {
+                if (scan_gcode_float(line + i + 1, line + len, out_z) > 0) {
                     return true;
                 }
             }
@@ -147,8 +169,7 @@ bool extract_filament_color(const char* line, size_t len, std::string& out_color
 // Check if line is a layer change marker
 bool is_layer_marker(const char* line, size_t len) {
     // Look for ;LAYER_CHANGE or ; LAYER_CHANGE
-    const char* pos = std::strstr(line, "LAYER_CHANGE");
-    if (pos && pos < line + len) {
+    if (std::string_view(line, len).find("LAYER_CHANGE") != std::string_view::npos) {
         return true;
     }
     // Also check lowercase
@@ -181,32 +202,97 @@ bool is_layer_marker(const char* line, size_t len) {
     return false;
 }
 
+// --- Cache file serialization ---------------------------------------------
+// Layout: header {magic, version, payload size, FNV-1a of payload}, then the
+// payload as little-endian fields (ARM and x86 targets are both little-endian).
+
+constexpr char CACHE_MAGIC[4] = {'H', 'X', 'L', 'I'};
+constexpr size_t CACHE_HEADER_SIZE = 16;
+
+uint32_t fnv1a(const char* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+template <typename T> void put(std::vector<char>& out, T value) {
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+void put_string(std::vector<char>& out, const std::string& value) {
+    put<uint32_t>(out, static_cast<uint32_t>(value.size()));
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+// Bounds-checked reader; any overrun sets ok = false and yields zeros
+struct CacheReader {
+    const char* p;
+    const char* end;
+    bool ok{true};
+
+    template <typename T> T get() {
+        T value{};
+        if (static_cast<size_t>(end - p) < sizeof(T)) {
+            ok = false;
+            return value;
+        }
+        std::memcpy(&value, p, sizeof(T));
+        p += sizeof(T);
+        return value;
+    }
+
+    std::string get_string() {
+        uint32_t len = get<uint32_t>();
+        if (!ok || static_cast<size_t>(end - p) < len) {
+            ok = false;
+            return {};
+        }
+        std::string value(p, len);
+        p += len;
+        return value;
+    }
+};
+
 } // anonymous namespace
 
-bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
+bool GCodeLayerIndex::build_from_file(const std::string& filepath,
+                                      std::shared_ptr<ObjectNameTable> object_names) {
     auto start_time = std::chrono::high_resolution_clock::now();
 
     // Clear any previous data
     entries_.clear();
+    start_states_.clear();
     stats_ = LayerIndexStats{};
     source_path_ = filepath;
 
-    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
+    FileDataSource source(filepath);
+    if (!source.is_valid()) {
         spdlog::error("[LayerIndex] Failed to open file: {}", filepath);
         return false;
     }
+    source.advise(GCodeDataSource::AccessPattern::Sequential);
 
     // Get file size
-    stats_.total_bytes = static_cast<size_t>(file.tellg());
-    file.seekg(0, std::ios::beg);
+    stats_.total_bytes = static_cast<size_t>(source.file_size());
 
     spdlog::debug("[LayerIndex] Building index for {} ({} bytes)", filepath, stats_.total_bytes);
 
     // Reserve estimated capacity (assume ~100 layers for now)
     entries_.reserve(100);
+    start_states_.reserve(100);
 
-    // Read line by line
+    // Tracks modal state alongside the scan so each layer can be parsed on its own
+    if (!object_names) {
+        object_names = std::make_shared<ObjectNameTable>();
+    }
+    object_names_ = object_names;
+    GCodeStateTracker state_tracker(object_names);
+
+    // Only header comments are copied (extract_filament_color expects NUL-terminated text)
     std::string line;
     line.reserve(256);
 
@@ -218,12 +304,12 @@ bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
     bool pending_layer_start = false;
     bool first_layer_started = false;
 
-    while (std::getline(file, line)) {
-        size_t line_len = line.length();
+    auto index_line = [&](std::string_view text, uint8_t scan_flags) {
+        size_t line_len = text.size();
         stats_.total_lines++;
 
-        // Check for layer marker
-        if (is_layer_marker(line.c_str(), line_len)) {
+        // Check for layer marker (every marker contains '_')
+        if ((scan_flags & LINE_HAS_UNDERSCORE) && is_layer_marker(text.data(), line_len)) {
             use_layer_markers = true;
             pending_layer_start = true;
             // We'll start the new layer when we see the next Z move
@@ -231,8 +317,10 @@ bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
 
         // Extract filament color from metadata (only if not already found)
         // Only check comment lines in the header (first ~1000 lines)
-        if (stats_.filament_color.empty() && stats_.total_lines < 1000) {
+        if (stats_.filament_color.empty() && stats_.total_lines < 1000 && line_len >= 10 &&
+            text[0] == ';') {
             std::string color;
+            line.assign(text.data(), line_len);
             if (extract_filament_color(line.c_str(), line_len, color)) {
                 stats_.filament_color = color;
                 spdlog::debug("[LayerIndex] Found filament color: {}", color);
@@ -240,9 +328,9 @@ bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
         }
 
         // Check for movement commands
-        if (is_movement_command(line.c_str(), line_len)) {
+        if (is_movement_command(text.data(), line_len)) {
             float z;
-            if (extract_z_param(line.c_str(), line_len, z)) {
+            if ((scan_flags & LINE_HAS_Z) && extract_z_param(text.data(), line_len, z)) {
                 // Z change detected
                 bool is_new_layer = false;
 
@@ -277,6 +365,9 @@ bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
                     entry.flags = 0;
                     entries_.push_back(entry);
 
+                    // State before this line: the layer's bytes start here
+                    start_states_.push_back(state_tracker.snapshot());
+
                     if (!first_layer_started) {
                         stats_.min_z = z;
                         first_layer_started = true;
@@ -290,16 +381,41 @@ bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
             }
 
             // Track extrusion vs travel
-            if (has_positive_extrusion(line.c_str(), line_len)) {
+            if ((scan_flags & LINE_HAS_E) && has_positive_extrusion(text.data(), line_len)) {
                 stats_.extrusion_moves++;
             } else {
                 stats_.travel_moves++;
             }
         }
 
+        state_tracker.parse_line(text);
+
         current_layer_lines++;
         // Account for line length + newline character
         current_offset += line_len + 1;
+    };
+
+    // scan_lines() splits each block with SIMD compares and flags the few lines that
+    // can hold a marker, Z or E, so the checks above skip most lines entirely
+    std::vector<ScannedLine> lines;
+    lines.reserve(SCAN_BATCH_LINES);
+    bool read_ok = source.read_line_blocks(INDEX_BLOCK_BYTES, [&](std::string_view block) {
+        size_t pos = 0;
+        while (pos < block.size()) {
+            lines.clear();
+            std::string_view rest = block.substr(pos);
+            size_t consumed = scan_lines(rest, lines, SCAN_BATCH_LINES);
+            for (const ScannedLine& scanned : lines) {
+                index_line(rest.substr(scanned.offset, scanned.length), scanned.flags);
+            }
+            pos += consumed;
+        }
+        return true;
+    });
+    if (!read_ok) {
+        entries_.clear();
+        start_states_.clear();
+        return false;
     }
 
     // Finalize last layer
@@ -315,17 +431,18 @@ bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
     if (stats_.filament_color.empty() && stats_.total_bytes > 0) {
         // Read last 32KB of file to find metadata
         size_t footer_size = std::min(stats_.total_bytes, size_t(32768));
-        file.clear();
-        file.seekg(-static_cast<std::streamoff>(footer_size), std::ios::end);
+        auto footer = source.read_range(stats_.total_bytes - footer_size,
+                                        static_cast<uint32_t>(footer_size));
 
-        while (std::getline(file, line)) {
+        for_each_line(std::string_view(footer.data(), footer.size()), [&](std::string_view text) {
             std::string color;
-            if (extract_filament_color(line.c_str(), line.length(), color)) {
+            line.assign(text.data(), text.size());
+            if (stats_.filament_color.empty() &&
+                extract_filament_color(line.c_str(), line.length(), color)) {
                 stats_.filament_color = color;
                 spdlog::debug("[LayerIndex] Found filament color in footer: {}", color);
-                break;
             }
-        }
+        });
     }
 
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -341,6 +458,198 @@ bool GCodeLayerIndex::build_from_file(const std::string& filepath) {
     return !entries_.empty();
 }
 
+bool GCodeLayerIndex::save_to_cache_file(const std::string& path,
+                                         const std::string& source_key) const {
+    if (entries_.empty()) {
+        return false;
+    }
+
+    // Snapshot object ids are only meaningful with their table, so store names;
+    // index 0 means "no object"
+    std::vector<ObjectId> object_ids;
+    std::unordered_map<ObjectId, uint16_t> name_slots;
+    for (const auto& state : start_states_) {
+        if (state.object_id != NO_OBJECT_ID && name_slots.count(state.object_id) == 0) {
+            object_ids.push_back(state.object_id);
+            name_slots[state.object_id] = static_cast<uint16_t>(object_ids.size());
+        }
+    }
+
+    std::vector<char> payload;
+    payload.reserve(256 + entries_.size() * 48);
+    put_string(payload, source_key);
+
+    put<uint64_t>(payload, stats_.total_lines);
+    put<uint64_t>(payload, stats_.total_bytes);
+    put<float>(payload, stats_.min_z);
+    put<float>(payload, stats_.max_z);
+    put<uint64_t>(payload, stats_.extrusion_moves);
+    put<uint64_t>(payload, stats_.travel_moves);
+    put_string(payload, stats_.filament_color);
+
+    put<uint32_t>(payload, static_cast<uint32_t>(object_ids.size()));
+    for (ObjectId id : object_ids) {
+        put_string(payload, object_names_ ? object_names_->name(id) : std::string());
+    }
+
+    put<uint32_t>(payload, static_cast<uint32_t>(entries_.size()));
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        const StreamingLayerEntry& entry = entries_[i];
+        put<uint64_t>(payload, entry.file_offset);
+        put<uint32_t>(payload, entry.byte_length);
+        put<float>(payload, entry.z_height);
+        put<uint16_t>(payload, entry.line_count);
+        put<uint16_t>(payload, entry.flags);
+
+        const ParserStateSnapshot& state = get_start_state(i);
+        put<float>(payload, state.position.x);
+        put<float>(payload, state.position.y);
+        put<float>(payload, state.position.z);
+        put<float>(payload, state.e);
+        put<float>(payload, state.layer_z);
+        put<uint16_t>(payload, state.object_id == NO_OBJECT_ID ? 0 : name_slots[state.object_id]);
+        put<uint8_t>(payload, state.tool_index);
+        put<uint8_t>(payload, state.flags);
+    }
+
+    std::vector<char> header;
+    header.insert(header.end(), CACHE_MAGIC, CACHE_MAGIC + sizeof(CACHE_MAGIC));
+    put<uint32_t>(header, CACHE_FORMAT_VERSION);
+    put<uint32_t>(header, static_cast<uint32_t>(payload.size()));
+    put<uint32_t>(header, fnv1a(payload.data(), payload.size()));
+
+    // Write-then-rename so a crash never leaves a truncated cache file
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            spdlog::warn("[LayerIndex] Cannot write cache file: {}", tmp_path);
+            return false;
+        }
+        file.write(header.data(), static_cast<std::streamsize>(header.size()));
+        file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+        if (!file) {
+            spdlog::warn("[LayerIndex] Failed writing cache file: {}", tmp_path);
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+    spdlog::debug("[LayerIndex] Saved index cache {} ({} layers, {} bytes)", path,
+                  entries_.size(), header.size() + payload.size());
+    return true;
+}
+
+bool GCodeLayerIndex::load_from_cache_file(const std::string& path, const std::string& source_key,
+                                           const std::string& source_path,
+                                           std::shared_ptr<ObjectNameTable> object_names) {
+    auto start_time = std::chrono::high_resolution_clock::now();
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    auto file_size = static_cast<size_t>(file.tellg());
+    if (file_size < CACHE_HEADER_SIZE) {
+        return false;
+    }
+    std::vector<char> data(file_size);
+    file.seekg(0, std::ios::beg);
+    if (!file.read(data.data(), static_cast<std::streamsize>(file_size))) {
+        return false;
+    }
+
+    CacheReader header{data.data(), data.data() + CACHE_HEADER_SIZE};
+    if (std::memcmp(data.data(), CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0) {
+        return false;
+    }
+    header.p += sizeof(CACHE_MAGIC);
+    uint32_t version = header.get<uint32_t>();
+    uint32_t payload_size = header.get<uint32_t>();
+    uint32_t checksum = header.get<uint32_t>();
+    if (version != CACHE_FORMAT_VERSION) {
+        spdlog::debug("[LayerIndex] Cache file {} has version {} (want {})", path, version,
+                      CACHE_FORMAT_VERSION);
+        return false;
+    }
+    const char* payload = data.data() + CACHE_HEADER_SIZE;
+    if (payload_size != file_size - CACHE_HEADER_SIZE || fnv1a(payload, payload_size) != checksum) {
+        spdlog::warn("[LayerIndex] Cache file {} is corrupt", path);
+        return false;
+    }
+
+    CacheReader in{payload, payload + payload_size};
+    if (in.get_string() != source_key || !in.ok) {
+        return false; // Different file, or hash collision on the cache name
+    }
+
+    LayerIndexStats stats;
+    stats.total_lines = in.get<uint64_t>();
+    stats.total_bytes = in.get<uint64_t>();
+    stats.min_z = in.get<float>();
+    stats.max_z = in.get<float>();
+    stats.extrusion_moves = in.get<uint64_t>();
+    stats.travel_moves = in.get<uint64_t>();
+    stats.filament_color = in.get_string();
+
+    if (!object_names) {
+        object_names = std::make_shared<ObjectNameTable>();
+    }
+    uint32_t name_count = in.get<uint32_t>();
+    std::vector<ObjectId> slot_ids{NO_OBJECT_ID};
+    for (uint32_t i = 0; i < name_count && in.ok; ++i) {
+        slot_ids.push_back(object_names->intern(in.get_string()));
+    }
+
+    uint32_t layer_count = in.get<uint32_t>();
+    if (!in.ok || layer_count == 0 || layer_count > payload_size / 40) {
+        return false;
+    }
+    std::vector<StreamingLayerEntry> entries(layer_count);
+    std::vector<ParserStateSnapshot> states(layer_count);
+    for (uint32_t i = 0; i < layer_count && in.ok; ++i) {
+        StreamingLayerEntry& entry = entries[i];
+        entry.file_offset = in.get<uint64_t>();
+        entry.byte_length = in.get<uint32_t>();
+        entry.z_height = in.get<float>();
+        entry.line_count = in.get<uint16_t>();
+        entry.flags = in.get<uint16_t>();
+
+        ParserStateSnapshot& state = states[i];
+        state.position.x = in.get<float>();
+        state.position.y = in.get<float>();
+        state.position.z = in.get<float>();
+        state.e = in.get<float>();
+        state.layer_z = in.get<float>();
+        uint16_t slot = in.get<uint16_t>();
+        state.object_id = slot < slot_ids.size() ? slot_ids[slot] : NO_OBJECT_ID;
+        state.tool_index = in.get<uint8_t>();
+        state.flags = in.get<uint8_t>();
+    }
+    if (!in.ok) {
+        spdlog::warn("[LayerIndex] Cache file {} is truncated", path);
+        return false;
+    }
+
+    entries_ = std::move(entries);
+    start_states_ = std::move(states);
+    stats_ = std::move(stats);
+    stats_.total_layers = entries_.size();
+    stats_.build_time_ms = std::chrono::duration<double, std::milli>(
+                               std::chrono::high_resolution_clock::now() - start_time)
+                               .count();
+    source_path_ = source_path;
+    object_names_ = object_names;
+
+    spdlog::info("[LayerIndex] Loaded cached index: {} layers, Z=[{:.2f}, {:.2f}], {:.1f}ms",
+                 stats_.total_layers, stats_.min_z, stats_.max_z, stats_.build_time_ms);
+    return true;
+}
+
 StreamingLayerEntry GCodeLayerIndex::get_entry(size_t layer_index) const {
     if (layer_index < entries_.size()) {
         return entries_[layer_index];
@@ -349,6 +658,13 @@ StreamingLayerEntry GCodeLayerIndex::get_entry(size_t layer_index) const {
     return StreamingLayerEntry{0, 0, 0.0f, 0, 0};
 }
 
+ParserStateSnapshot GCodeLayerIndex::get_start_state(size_t layer_index) const {
+    if (layer_index < start_states_.size()) {
+        return start_states_[layer_index];
+    }
+    return ParserStateSnapshot{};
+}
+
 int GCodeLayerIndex::find_layer_at_z(float z) const {
     if (entries_.empty()) {
         return -1;
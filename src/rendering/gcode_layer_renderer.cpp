@@ -8,6 +8,7 @@
 #include "memory_monitor.h"
 #include "memory_utils.h"
 #include "theme_manager.h"
+#include "toolpath_rasterizer.h"
 
 #include <spdlog/spdlog.h>
 
@@ -20,6 +21,15 @@
 namespace helix {
 namespace gcode {
 
+namespace {
+
+uint32_t to_argb(lv_color_t color, uint8_t alpha = 255) {
+    return (static_cast<uint32_t>(alpha) << 24) | (static_cast<uint32_t>(color.red) << 16) |
+           (static_cast<uint32_t>(color.green) << 8) | color.blue;
+}
+
+} // namespace
+
 // ============================================================================
 // Construction
 // ============================================================================
@@ -30,6 +40,10 @@ GCodeLayerRenderer::GCodeLayerRenderer() {
 
     // Load configuration values
     load_config();
+
+    raster_pool_ = std::make_unique<RasterWorkerPool>(static_cast<size_t>(render_threads_));
+    spdlog::debug("[GCodeLayerRenderer] Tiled rasterizer using {} thread(s)",
+                  raster_pool_->worker_count());
 }
 
 GCodeLayerRenderer::~GCodeLayerRenderer() {
@@ -50,6 +64,7 @@ void GCodeLayerRenderer::set_gcode(const ParsedGCodeFile* gcode) {
     bounds_valid_ = false;
     current_layer_ = 0;
     warmup_frames_remaining_ = WARMUP_FRAMES; // Allow panel to render before heavy caching
+    resolve_object_ids();
     invalidate_cache();
 
     if (gcode_) {
@@ -64,6 +79,7 @@ void GCodeLayerRenderer::set_streaming_controller(GCodeStreamingController* cont
     bounds_valid_ = false;
     current_layer_ = 0;
     warmup_frames_remaining_ = WARMUP_FRAMES; // Allow panel to render before heavy caching
+    resolve_object_ids();
     invalidate_cache();
 
     if (streaming_controller_) {
@@ -151,6 +167,7 @@ void GCodeLayerRenderer::set_excluded_objects(const std::unordered_set<std::stri
         return; // No change - skip expensive cache invalidation
     }
     excluded_objects_ = names;
+    resolve_object_ids();
     invalidate_cache();
 }
 
@@ -166,9 +183,45 @@ void GCodeLayerRenderer::set_highlighted_objects(const std::unordered_set<std::s
         }
     }
     highlighted_objects_ = names;
+    resolve_object_ids();
     invalidate_cache();
 }
 
+std::shared_ptr<ObjectNameTable> GCodeLayerRenderer::object_names() const {
+    if (streaming_controller_) {
+        return streaming_controller_->get_object_names();
+    }
+    if (gcode_) {
+        return gcode_->object_names;
+    }
+    return nullptr;
+}
+
+void GCodeLayerRenderer::resolve_object_ids() {
+    resolved_names_ = object_names();
+    object_flags_.clear();
+    if (!resolved_names_) {
+        return;
+    }
+
+    // Interning unknown names means objects in not-yet-parsed streaming
+    // layers still match once their layer is loaded
+    auto mark = [this](const std::unordered_set<std::string>& names, uint8_t flag) {
+        for (const auto& name : names) {
+            ObjectId id = resolved_names_->intern(name);
+            if (id == NO_OBJECT_ID) {
+                continue;
+            }
+            if (id >= object_flags_.size()) {
+                object_flags_.resize(static_cast<size_t>(id) + 1, 0);
+            }
+            object_flags_[id] |= flag;
+        }
+    };
+    mark(excluded_objects_, OBJECT_EXCLUDED);
+    mark(highlighted_objects_, OBJECT_HIGHLIGHTED);
+}
+
 // ============================================================================
 // Viewport Control
 // ============================================================================
@@ -185,42 +238,9 @@ void GCodeLayerRenderer::auto_fit() {
     // Get bounding box from either full file or streaming index stats
     AABB bb;
     if (streaming_controller_) {
-        // In streaming mode, compute actual X/Y bounds from layer data
-        // The index stats only have Z bounds, so we sample layers for X/Y
-        const auto& stats = streaming_controller_->get_index_stats();
-
-        // Initialize with Z bounds from index
-        bb.min = {std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
-                  stats.min_z};
-        bb.max = {std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
-                  stats.max_z};
-
-        // Sample a few layers to compute X/Y bounds (first, middle, last)
-        size_t layer_count = streaming_controller_->get_layer_count();
-        std::vector<size_t> sample_layers;
-        if (layer_count > 0) {
-            sample_layers.push_back(0); // First layer
-            if (layer_count > 2) {
-                sample_layers.push_back(layer_count / 2); // Middle layer
-            }
-            if (layer_count > 1) {
-                sample_layers.push_back(layer_count - 1); // Last layer
-            }
-        }
-
-        bool found_bounds = false;
-        for (size_t layer_idx : sample_layers) {
-            auto segments = streaming_controller_->get_layer_segments(layer_idx);
-            if (segments && !segments->empty()) {
-                for (const auto& seg : *segments) {
-                    bb.min.x = std::min(bb.min.x, std::min(seg.start.x, seg.end.x));
-                    bb.max.x = std::max(bb.max.x, std::max(seg.start.x, seg.end.x));
-                    bb.min.y = std::min(bb.min.y, std::min(seg.start.y, seg.end.y));
-                    bb.max.y = std::max(bb.max.y, std::max(seg.start.y, seg.end.y));
-                    found_bounds = true;
-                }
-            }
-        }
+        // In streaming mode, compute actual X/Y bounds from sampled layer data
+        // (the index stats only have Z bounds)
+        bool found_bounds = streaming_controller_->sample_bounds(bb);
 
         // Fallback to 200x200 if no layer data available yet
         if (!found_bounds) {
@@ -232,8 +252,8 @@ void GCodeLayerRenderer::auto_fit() {
                 "[GCodeLayerRenderer] Streaming: no layers loaded yet, using default 200x200");
         } else {
             spdlog::info("[GCodeLayerRenderer] Streaming: computed bounds X[{:.1f},{:.1f}] "
-                         "Y[{:.1f},{:.1f}] from {} layers",
-                         bb.min.x, bb.max.x, bb.min.y, bb.max.y, sample_layers.size());
+                         "Y[{:.1f},{:.1f}] from sampled layers",
+                         bb.min.x, bb.max.x, bb.min.y, bb.max.y);
         }
     } else if (gcode_) {
         bb = gcode_->global_bounding_box;
@@ -451,97 +471,59 @@ void GCodeLayerRenderer::render_layers_to_cache(int from_layer, int to_layer) {
     transform.canvas_width = cached_width_;
     transform.canvas_height = cached_height_;
 
-    int layer_count = get_layer_count();
-    size_t segments_rendered = 0;
-
     // Compute base color once (full filament color with full alpha)
     uint8_t base_r = color_extrusion_.red;
     uint8_t base_g = color_extrusion_.green;
     uint8_t base_b = color_extrusion_.blue;
+    const bool shade = depth_shading_ && view_mode_ == ViewMode::FRONT;
 
-    for (int layer_idx = from_layer; layer_idx <= to_layer; ++layer_idx) {
-        if (layer_idx < 0 || layer_idx >= layer_count)
-            continue;
+    auto style = [&](const ToolpathSegment& seg, uint32_t& color, int& /*width*/) {
+        if (!should_render_segment(seg))
+            return false;
 
-        // Get segments from appropriate source
-        // For streaming mode, hold shared_ptr to keep data alive during iteration
-        std::shared_ptr<const std::vector<ToolpathSegment>> segments_holder;
-        const std::vector<ToolpathSegment>* segments = nullptr;
+        // Skip non-extrusion moves for solid rendering (travels are subtle)
+        if (!seg.is_extrusion)
+            return false;
 
-        if (streaming_controller_) {
-            // Streaming mode: get segments from controller (returns shared_ptr)
-            segments_holder =
-                streaming_controller_->get_layer_segments(static_cast<size_t>(layer_idx));
-            segments = segments_holder.get();
-        } else if (gcode_) {
-            // Full file mode: get segments from parsed file
-            segments = &gcode_->layers[layer_idx].segments;
+        uint8_t flags = object_flags(seg.object_id);
+        if (flags & OBJECT_EXCLUDED) {
+            // Excluded: orange-red with reduced alpha
+            color = (153u << 24) | 0xFF6B35u; // 60% alpha
+            return true;
+        }
+        if (flags & OBJECT_HIGHLIGHTED) {
+            // Highlighted: selection blue, full alpha
+            color = 0xFF42A5F5u;
+            return true;
         }
 
-        if (!segments)
-            continue;
-
-        for (const auto& seg : *segments) {
-            if (!should_render_segment(seg))
-                continue;
-
-            // Skip non-extrusion moves for solid rendering (travels are subtle)
-            if (!seg.is_extrusion)
-                continue;
-
-            // Convert world coordinates to screen using cached transform
-            glm::ivec2 p1 = world_to_screen_raw(transform, seg.start.x, seg.start.y, seg.start.z);
-            glm::ivec2 p2 = world_to_screen_raw(transform, seg.end.x, seg.end.y, seg.end.z);
-
-            // Skip zero-length segments
-            if (p1.x == p2.x && p1.y == p2.y)
-                continue;
-
-            // Calculate color with depth shading for 3D-like appearance
-            uint8_t r = base_r, g = base_g, b = base_b;
-            if (depth_shading_ && view_mode_ == ViewMode::FRONT) {
-                float avg_z = (seg.start.z + seg.end.z) * 0.5f;
-                float avg_y = (seg.start.y + seg.end.y) * 0.5f;
-                float brightness = compute_depth_brightness(avg_z, bounds_min_z_, bounds_max_z_,
-                                                            avg_y, bounds_min_y_, bounds_max_y_);
-
-                r = static_cast<uint8_t>(base_r * brightness);
-                g = static_cast<uint8_t>(base_g * brightness);
-                b = static_cast<uint8_t>(base_b * brightness);
-            }
+        // Calculate color with depth shading for 3D-like appearance
+        uint32_t r = base_r, g = base_g, b = base_b;
+        if (shade) {
+            float avg_z = (seg.start.z + seg.end.z) * 0.5f;
+            float avg_y = (seg.start.y + seg.end.y) * 0.5f;
+            float brightness = compute_depth_brightness(avg_z, bounds_min_z_, bounds_max_z_,
+                                                        avg_y, bounds_min_y_, bounds_max_y_);
+
+            r = static_cast<uint8_t>(base_r * brightness);
+            g = static_cast<uint8_t>(base_g * brightness);
+            b = static_cast<uint8_t>(base_b * brightness);
+        }
 
-            // Override color for excluded/highlighted objects
-            if (!seg.object_name.empty()) {
-                if (excluded_objects_.count(seg.object_name) > 0) {
-                    // Excluded: orange-red with reduced alpha
-                    r = 0xFF;
-                    g = 0x6B;
-                    b = 0x35;
-                    uint32_t color = (153u << 24) | (r << 16) | (g << 8) | b; // 60% alpha
-                    draw_line_bresenham_solid(p1.x, p1.y, p2.x, p2.y, color);
-                    ++segments_rendered;
-                    continue;
-                }
-                if (highlighted_objects_.count(seg.object_name) > 0) {
-                    // Highlighted: selection blue, full alpha
-                    r = 0x42;
-                    g = 0xA5;
-                    b = 0xF5;
-                }
-            }
+        // Build ARGB8888 color (full alpha for solid layers)
+        color = (255u << 24) | (r << 16) | (g << 8) | b;
+        return true;
+    };
 
-            // Build ARGB8888 color (full alpha for solid layers)
-            uint32_t color = (255u << 24) | (r << 16) | (g << 8) | b;
+    std::vector<RasterLine> lines;
+    project_layers(from_layer, to_layer, transform, style, lines);
 
-            // Draw using software Bresenham - bypasses LVGL draw API for AD5M compatibility
-            draw_line_bresenham_solid(p1.x, p1.y, p2.x, p2.y, color);
-            ++segments_rendered;
-        }
-    }
+    // Draw straight into the buffer - bypasses LVGL draw API for AD5M compatibility
+    rasterize_tiled(cache_target(), lines, false, raster_pool_.get());
 
     spdlog::trace("[GCodeLayerRenderer] Rendered layers {}-{}: {} segments to cache (direct), "
                   "color=#{:02X}{:02X}{:02X}, buf={}x{} stride={}",
-                  from_layer, to_layer, segments_rendered, base_r, base_g, base_b, cached_width_,
+                  from_layer, to_layer, lines.size(), base_r, base_g, base_b, cached_width_,
                   cached_height_, cache_buf_ ? cache_buf_->header.stride : 0);
 }
 
@@ -559,6 +541,144 @@ void GCodeLayerRenderer::blit_cache(lv_layer_t* target) {
     lv_draw_image(target, &dsc, &coords);
 }
 
+RasterTarget GCodeLayerRenderer::cache_target() const {
+    if (!cache_buf_) {
+        return {};
+    }
+    return RasterTarget{static_cast<uint8_t*>(cache_buf_->data), cached_width_, cached_height_,
+                        static_cast<int>(cache_buf_->header.stride)};
+}
+
+size_t GCodeLayerRenderer::render_layer_direct(const std::vector<ToolpathSegment>& segments) {
+    ensure_cache(canvas_width_, canvas_height_);
+    if (!cache_buf_) {
+        return 0;
+    }
+
+    // The FRONT view's incremental cache shares this buffer; make it rebuild
+    lv_draw_buf_clear(cache_buf_, nullptr);
+    cached_up_to_layer_ = -1;
+
+    TransformParams transform = capture_transform_params();
+    transform.canvas_width = cached_width_;
+    transform.canvas_height = cached_height_;
+
+    // Styles are resolved once per frame; segments only pick one by flag
+    struct LineStyle {
+        uint32_t color;
+        int width;
+    };
+    const LineStyle travel{to_argb(color_travel_, LV_OPA_50), 1};
+    const LineStyle extrusion{to_argb(color_extrusion_), 2};
+    const LineStyle support{to_argb(color_support_), 2};
+    const LineStyle excluded{to_argb(lv_color_hex(0xFF6B35), LV_OPA_60), 1};
+    const LineStyle highlighted{to_argb(lv_color_hex(0x42A5F5)), 3};
+
+    auto style = [&](const ToolpathSegment& seg, uint32_t& color, int& width) {
+        if (!should_render_segment(seg))
+            return false;
+
+        uint8_t flags = object_flags(seg.object_id);
+        const LineStyle& picked = (flags & OBJECT_EXCLUDED)      ? excluded
+                                  : (flags & OBJECT_HIGHLIGHTED) ? highlighted
+                                  : !seg.is_extrusion            ? travel
+                                  : is_support_segment(seg)      ? support
+                                                                 : extrusion;
+        color = picked.color;
+        width = picked.width;
+        return true;
+    };
+
+    std::vector<RasterLine> lines;
+    project_segments({&segments}, transform, style, lines);
+    rasterize_tiled(cache_target(), lines, antialias_, raster_pool_.get());
+    return lines.size();
+}
+
+void GCodeLayerRenderer::project_segments(
+    const std::vector<const std::vector<ToolpathSegment>*>& layers,
+    const TransformParams& transform, const SegmentStyle& style, std::vector<RasterLine>& lines) {
+    // Chunks small enough to balance across workers, large enough to amortize dispatch
+    constexpr size_t CHUNK_SEGMENTS = 8192;
+    struct Chunk {
+        const std::vector<ToolpathSegment>* segments;
+        size_t begin;
+        size_t end;
+    };
+    std::vector<Chunk> chunks;
+    for (const auto* segments : layers) {
+        if (!segments)
+            continue;
+        for (size_t begin = 0; begin < segments->size(); begin += CHUNK_SEGMENTS) {
+            chunks.push_back({segments, begin, std::min(begin + CHUNK_SEGMENTS, segments->size())});
+        }
+    }
+
+    std::vector<std::vector<RasterLine>> chunk_lines(chunks.size());
+    auto project_chunk = [&](size_t index) {
+        const Chunk& chunk = chunks[index];
+        auto& out = chunk_lines[index];
+        out.reserve(chunk.end - chunk.begin);
+        for (size_t i = chunk.begin; i < chunk.end; ++i) {
+            const ToolpathSegment& seg = (*chunk.segments)[i];
+            uint32_t color = 0;
+            int width = 1;
+            if (!style(seg, color, width))
+                continue;
+
+            glm::ivec2 p1 = world_to_screen_raw(transform, seg.start.x, seg.start.y, seg.start.z);
+            glm::ivec2 p2 = world_to_screen_raw(transform, seg.end.x, seg.end.y, seg.end.z);
+
+            // Skip zero-length segments
+            if (p1.x == p2.x && p1.y == p2.y)
+                continue;
+
+            out.push_back({p1.x, p1.y, p2.x, p2.y, color, width});
+        }
+    };
+    if (raster_pool_) {
+        raster_pool_->run(chunks.size(), project_chunk);
+    } else {
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            project_chunk(i);
+        }
+    }
+
+    size_t total = lines.size();
+    for (const auto& out : chunk_lines) {
+        total += out.size();
+    }
+    lines.reserve(total);
+    for (const auto& out : chunk_lines) {
+        lines.insert(lines.end(), out.begin(), out.end());
+    }
+}
+
+void GCodeLayerRenderer::project_layers(int from_layer, int to_layer,
+                                        const TransformParams& transform,
+                                        const SegmentStyle& style,
+                                        std::vector<RasterLine>& lines) {
+    int layer_count = get_layer_count();
+
+    // For streaming mode, hold shared_ptrs to keep layer data alive while projecting.
+    // This prevents use-after-free if the cache evicts a layer mid-frame.
+    std::vector<std::shared_ptr<const std::vector<ToolpathSegment>>> holders;
+    std::vector<const std::vector<ToolpathSegment>*> layers;
+    for (int layer_idx = std::max(from_layer, 0); layer_idx <= to_layer; ++layer_idx) {
+        if (layer_idx >= layer_count)
+            break;
+
+        if (streaming_controller_) {
+            holders.push_back(
+                streaming_controller_->get_layer_segments(static_cast<size_t>(layer_idx)));
+            layers.push_back(holders.back().get());
+        } else if (gcode_) {
+            layers.push_back(&gcode_->layers[layer_idx].segments);
+        }
+    }
+    project_segments(layers, transform, style, lines);
+}
+
 // ============================================================================
 // Ghost Cache (faded preview of all layers)
 // ============================================================================
@@ -598,60 +718,6 @@ void GCodeLayerRenderer::ensure_ghost_cache(int width, int height) {
     }
 }
 
-void GCodeLayerRenderer::render_ghost_layers(int from_layer, int to_layer) {
-    if (!ghost_buf_ || !gcode_)
-        return;
-
-    // Manually initialize layer for offscreen rendering (no canvas widget)
-    // This avoids clip area contamination from overlays/toasts on lv_layer_top()
-    lv_layer_t ghost_layer;
-    lv_memzero(&ghost_layer, sizeof(ghost_layer));
-    ghost_layer.draw_buf = ghost_buf_;
-    ghost_layer.color_format = LV_COLOR_FORMAT_ARGB8888;
-    ghost_layer.buf_area.x1 = 0;
-    ghost_layer.buf_area.y1 = 0;
-    ghost_layer.buf_area.x2 = cached_width_ - 1;
-    ghost_layer.buf_area.y2 = cached_height_ - 1;
-    ghost_layer._clip_area = ghost_layer.buf_area; // Full buffer as clip area
-    ghost_layer.phy_clip_area = ghost_layer.buf_area;
-
-    int saved_offset_x = widget_offset_x_;
-    int saved_offset_y = widget_offset_y_;
-    widget_offset_x_ = 0;
-    widget_offset_y_ = 0;
-
-    size_t segments_rendered = 0;
-    for (int layer_idx = from_layer; layer_idx <= to_layer; ++layer_idx) {
-        if (layer_idx < 0 || layer_idx >= static_cast<int>(gcode_->layers.size()))
-            continue;
-
-        const Layer& layer_data = gcode_->layers[layer_idx];
-        for (const auto& seg : layer_data.segments) {
-            if (should_render_segment(seg)) {
-                // Render with reduced opacity for ghost effect
-                render_segment(&ghost_layer, seg, true); // ghost=true
-                ++segments_rendered;
-            }
-        }
-    }
-
-    // Dispatch pending draw tasks (equivalent to lv_canvas_finish_layer)
-    lv_draw_dispatch_wait_for_request();
-    while (ghost_layer.draw_task_head) {
-        lv_draw_dispatch_layer(nullptr, &ghost_layer);
-        if (ghost_layer.draw_task_head) {
-            lv_draw_dispatch_wait_for_request();
-        }
-    }
-
-    widget_offset_x_ = saved_offset_x;
-    widget_offset_y_ = saved_offset_y;
-
-    spdlog::trace("[GCodeLayerRenderer] Rendered ghost layers {}-{}: {} segments", from_layer,
-                  to_layer, segments_rendered);
-    helix::MemoryMonitor::log_now("gcode_ghost_render_done");
-}
-
 void GCodeLayerRenderer::blit_ghost_cache(lv_layer_t* target) {
     if (!ghost_buf_)
         return;
@@ -682,6 +748,12 @@ void GCodeLayerRenderer::render(lv_layer_t* layer, const lv_area_t* widget_area)
 
     uint32_t start_time = lv_tick_get();
 
+    // Streaming controller swaps its name table when a new file is opened
+    if (object_names() != resolved_names_) {
+        resolve_object_ids();
+        invalidate_cache();
+    }
+
     // Store widget screen offset for world_to_screen()
     if (widget_area) {
         widget_offset_x_ = widget_area->x1;
@@ -746,6 +818,10 @@ void GCodeLayerRenderer::render(lv_layer_t* layer, const lv_area_t* widget_area)
                 // This prevents UI freezing during initial load or big jumps
                 int from_layer = cached_up_to_layer_ + 1;
                 int to_layer = std::min(from_layer + layers_per_frame_ - 1, target_layer);
+                if (from_layer == 0) {
+                    // May still hold a TOP_DOWN/ISOMETRIC frame
+                    lv_draw_buf_clear(cache_buf_, nullptr);
+                }
 
                 render_layers_to_cache(from_layer, to_layer);
                 cached_up_to_layer_ = to_layer;
@@ -801,12 +877,8 @@ void GCodeLayerRenderer::render(lv_layer_t* layer, const lv_area_t* widget_area)
         }
 
         if (segments) {
-            for (const auto& seg : *segments) {
-                if (!should_render_segment(seg))
-                    continue;
-                render_segment(layer, seg);
-                ++segments_rendered;
-            }
+            segments_rendered = render_layer_direct(*segments);
+            blit_cache(layer);
         }
     }
 
@@ -870,75 +942,6 @@ bool GCodeLayerRenderer::should_render_segment(const ToolpathSegment& seg) const
     return show_travels_;
 }
 
-void GCodeLayerRenderer::render_segment(lv_layer_t* layer, const ToolpathSegment& seg, bool ghost) {
-    // Convert world coordinates to screen (uses Z for FRONT view)
-    glm::ivec2 p1 = world_to_screen(seg.start.x, seg.start.y, seg.start.z);
-    glm::ivec2 p2 = world_to_screen(seg.end.x, seg.end.y, seg.end.z);
-
-    // Skip zero-length segments
-    if (p1.x == p2.x && p1.y == p2.y) {
-        return;
-    }
-
-    // Initialize line drawing descriptor
-    lv_draw_line_dsc_t dsc;
-    lv_draw_line_dsc_init(&dsc);
-
-    lv_color_t base_color;
-    if (ghost) {
-        // Ghost mode: use darkened version of the model's extrusion color
-        // This provides visual continuity between ghost and solid layers
-        lv_color_t model_color = color_extrusion_;
-        // Darken to 40% brightness for ghost effect
-        base_color = lv_color_make(model_color.red * 40 / 100, model_color.green * 40 / 100,
-                                   model_color.blue * 40 / 100);
-    } else {
-        base_color = get_segment_color(seg);
-    }
-
-    // Apply depth shading for 3D-like appearance
-    if (depth_shading_ && view_mode_ == ViewMode::FRONT) {
-        float avg_z = (seg.start.z + seg.end.z) * 0.5f;
-        float avg_y = (seg.start.y + seg.end.y) * 0.5f;
-        float brightness = compute_depth_brightness(avg_z, bounds_min_z_, bounds_max_z_, avg_y,
-                                                    bounds_min_y_, bounds_max_y_);
-
-        uint8_t r = static_cast<uint8_t>(base_color.red * brightness);
-        uint8_t g = static_cast<uint8_t>(base_color.green * brightness);
-        uint8_t b = static_cast<uint8_t>(base_color.blue * brightness);
-        dsc.color = lv_color_make(r, g, b);
-    } else {
-        dsc.color = base_color;
-    }
-
-    // Check excluded/highlighted state for width/opacity
-    bool is_excluded = !seg.object_name.empty() && excluded_objects_.count(seg.object_name) > 0;
-    bool is_highlighted =
-        !seg.object_name.empty() && highlighted_objects_.count(seg.object_name) > 0;
-
-    if (is_excluded) {
-        dsc.width = 1;
-        dsc.opa = LV_OPA_60;
-    } else if (is_highlighted) {
-        dsc.width = 3;
-        dsc.opa = LV_OPA_COVER;
-    } else if (seg.is_extrusion) {
-        dsc.width = 2;
-        dsc.opa = LV_OPA_COVER;
-    } else {
-        dsc.width = 1;
-        dsc.opa = LV_OPA_50;
-    }
-
-    // LVGL 9: points are stored in the descriptor struct
-    dsc.p1.x = static_cast<lv_value_precise_t>(p1.x);
-    dsc.p1.y = static_cast<lv_value_precise_t>(p1.y);
-    dsc.p2.x = static_cast<lv_value_precise_t>(p2.x);
-    dsc.p2.y = static_cast<lv_value_precise_t>(p2.y);
-
-    lv_draw_line(layer, &dsc);
-}
-
 // ============================================================================
 // Transformation - Single Source of Truth
 // ============================================================================
@@ -966,22 +969,9 @@ glm::ivec2 GCodeLayerRenderer::world_to_screen(float x, float y, float z) const
 }
 
 bool GCodeLayerRenderer::is_support_segment(const ToolpathSegment& seg) const {
-    // Support detection via object name (from EXCLUDE_OBJECT metadata)
-    if (seg.object_name.empty()) {
-        return false;
-    }
-
-    // Common patterns used by slicers for support structures:
-    // - OrcaSlicer/PrusaSlicer: "support_*", "*_support", "SUPPORT_*"
-    // - Cura: "support", "Support"
-    const std::string& name = seg.object_name;
-
-    // Case-insensitive check for "support" anywhere in the name
-    std::string lower_name = name;
-    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(),
-                   [](unsigned char c) { return std::tolower(c); });
-
-    return lower_name.find("support") != std::string::npos;
+    // Support detection via object name (from EXCLUDE_OBJECT metadata) is done
+    // once per object by the parser and stored in the segment flags
+    return seg.is_support;
 }
 
 std::optional<std::string> GCodeLayerRenderer::pick_object_at(int screen_x, int screen_y) const {
@@ -1016,12 +1006,13 @@ std::optional<std::string> GCodeLayerRenderer::pick_object_at(int screen_x, int
         return std::nullopt;
 
     glm::vec2 click_pos(static_cast<float>(screen_x), static_cast<float>(screen_y));
+    ObjectId picked_id = NO_OBJECT_ID;
 
     for (const auto& seg : *segments) {
         if (!should_render_segment(seg))
             continue;
 
-        if (seg.object_name.empty())
+        if (seg.object_id == NO_OBJECT_ID)
             continue;
 
         // Project segment endpoints to screen space
@@ -1043,32 +1034,17 @@ std::optional<std::string> GCodeLayerRenderer::pick_object_at(int screen_x, int
 
         if (dist < PICK_THRESHOLD && dist < closest_distance) {
             closest_distance = dist;
-            picked_object = seg.object_name;
+            picked_id = seg.object_id;
         }
     }
 
-    return picked_object;
-}
-
-lv_color_t GCodeLayerRenderer::get_segment_color(const ToolpathSegment& seg) const {
-    // Check excluded/highlighted state first
-    if (!seg.object_name.empty()) {
-        if (excluded_objects_.count(seg.object_name) > 0) {
-            return lv_color_hex(0xFF6B35); // Orange-red for excluded
-        }
-        if (highlighted_objects_.count(seg.object_name) > 0) {
-            return lv_color_hex(0x42A5F5); // Selection blue for highlighted
+    if (picked_id != NO_OBJECT_ID) {
+        if (auto names = object_names()) {
+            picked_object = names->name(picked_id);
         }
     }
 
-    // Existing logic below
-    if (!seg.is_extrusion) {
-        return color_travel_;
-    }
-    if (is_support_segment(seg)) {
-        return color_support_;
-    }
-    return color_extrusion_;
+    return picked_object;
 }
 
 void GCodeLayerRenderer::render_selection_brackets(lv_layer_t* layer) {
@@ -1272,8 +1248,14 @@ void GCodeLayerRenderer::background_ghost_render_thread() {
     // Color (can be changed via set_extrusion_color() on main thread)
     const lv_color_t local_color_extrusion = color_extrusion_;
 
-    // Capture excluded objects for ghost rendering (thread-safe copy)
-    const auto local_excluded = excluded_objects_;
+    // Capture object flags for ghost rendering (thread-safe copy)
+    const std::vector<uint8_t> local_flags = object_flags_;
+    auto local_flags_of = [&local_flags](ObjectId id) -> uint8_t {
+        return id < local_flags.size() ? local_flags[id] : 0;
+    };
+
+    const RasterTarget ghost_target{ghost_raw_buffer_.get(), ghost_raw_width_, ghost_raw_height_,
+                                    ghost_raw_stride_};
 
     // Local version of should_render_segment using captured flags
     auto local_should_render = [&](const ToolpathSegment& seg) -> bool {
@@ -1293,61 +1275,34 @@ void GCodeLayerRenderer::background_ghost_render_thread() {
     uint8_t ghost_a = 255; // Full alpha, we'll apply 40% when blitting
     uint32_t ghost_color = (ghost_a << 24) | (ghost_r << 16) | (ghost_g << 8) | ghost_b;
 
-    // Render all layers to raw buffer
-    // Works with both full-file mode (gcode_) and streaming mode (streaming_controller_)
-    for (int layer_idx = 0; layer_idx < total_layers; ++layer_idx) {
-        // Check for cancellation periodically
+    // Use excluded color for excluded objects even in ghost (dim orange-red)
+    const uint32_t excluded_color =
+        (255u << 24) | ((0xFF * 40 / 100) << 16) | ((0x6B * 40 / 100) << 8) | (0x35 * 40 / 100);
+
+    auto style = [&](const ToolpathSegment& seg, uint32_t& color, int& /*width*/) {
+        if (!local_should_render(seg))
+            return false;
+        color = (local_flags_of(seg.object_id) & OBJECT_EXCLUDED) ? excluded_color : ghost_color;
+        return true;
+    };
+
+    // Render all layers to raw buffer in batches: project on the pool, then draw the
+    // batch in row tiles. Works with both full-file mode (gcode_) and streaming mode.
+    std::vector<RasterLine> lines;
+    for (int batch_start = 0; batch_start < total_layers; batch_start += GHOST_BATCH_LAYERS) {
+        // Check for cancellation between batches
         if (ghost_thread_cancel_.load()) {
-            spdlog::debug("[GCodeLayerRenderer] Ghost render cancelled at layer {}/{}", layer_idx,
-                          total_layers);
+            spdlog::debug("[GCodeLayerRenderer] Ghost render cancelled at layer {}/{}",
+                          batch_start, total_layers);
             ghost_thread_running_.store(false);
             return;
         }
 
-        // Get segments from appropriate source
-        // CRITICAL: For streaming mode, hold shared_ptr to keep data alive during iteration.
-        // This prevents use-after-free if cache evicts the layer while we're iterating.
-        std::shared_ptr<const std::vector<ToolpathSegment>> segments_holder;
-        const std::vector<ToolpathSegment>* segments = nullptr;
-
-        if (streaming_controller_) {
-            // Streaming mode: get segments from controller (returns shared_ptr)
-            segments_holder =
-                streaming_controller_->get_layer_segments(static_cast<size_t>(layer_idx));
-            segments = segments_holder.get();
-        } else if (gcode_) {
-            segments = &gcode_->layers[layer_idx].segments;
-        }
-
-        if (!segments)
-            continue;
-
-        for (const auto& seg : *segments) {
-            if (!local_should_render(seg))
-                continue;
-
-            // Use unified world_to_screen_raw - includes content offset!
-            glm::ivec2 p1 = world_to_screen_raw(transform, seg.start.x, seg.start.y, seg.start.z);
-            glm::ivec2 p2 = world_to_screen_raw(transform, seg.end.x, seg.end.y, seg.end.z);
-
-            // Skip zero-length segments
-            if (p1.x == p2.x && p1.y == p2.y)
-                continue;
-
-            // Use excluded color for excluded objects even in ghost
-            uint32_t seg_color = ghost_color;
-            if (!seg.object_name.empty() && local_excluded.count(seg.object_name) > 0) {
-                // Excluded: dim orange-red
-                uint8_t ex_r = 0xFF * 40 / 100;
-                uint8_t ex_g = 0x6B * 40 / 100;
-                uint8_t ex_b = 0x35 * 40 / 100;
-                seg_color = (255u << 24) | (ex_r << 16) | (ex_g << 8) | ex_b;
-            }
-
-            // Draw line using Bresenham algorithm
-            draw_line_bresenham(p1.x, p1.y, p2.x, p2.y, seg_color);
-            ++segments_rendered;
-        }
+        lines.clear();
+        project_layers(batch_start, batch_start + GHOST_BATCH_LAYERS - 1, transform, style,
+                       lines);
+        rasterize_tiled(ghost_target, lines, false, raster_pool_.get());
+        segments_rendered += lines.size();
     }
 
     // Mark as ready for main thread to copy
@@ -1407,105 +1362,6 @@ void GCodeLayerRenderer::copy_raw_to_ghost_buf() {
                   ghost_raw_height_);
 }
 
-void GCodeLayerRenderer::blend_pixel(int x, int y, uint32_t color) {
-    // Bounds check
-    if (x < 0 || x >= ghost_raw_width_ || y < 0 || y >= ghost_raw_height_) {
-        return;
-    }
-
-    // Calculate pixel offset (ARGB8888 = 4 bytes per pixel)
-    uint8_t* pixel = ghost_raw_buffer_.get() + y * ghost_raw_stride_ + x * 4;
-
-    // Simple overwrite for now (could add alpha blending later)
-    // LVGL uses ARGB8888: byte order is B, G, R, A on little-endian
-    pixel[0] = color & 0xFF;         // B
-    pixel[1] = (color >> 8) & 0xFF;  // G
-    pixel[2] = (color >> 16) & 0xFF; // R
-    pixel[3] = (color >> 24) & 0xFF; // A
-}
-
-void GCodeLayerRenderer::blend_pixel_solid(int x, int y, uint32_t color) {
-    // Bounds check using cached dimensions
-    if (x < 0 || x >= cached_width_ || y < 0 || y >= cached_height_ || !cache_buf_) {
-        return;
-    }
-
-    // Get stride from LVGL buffer (may differ from width * 4 due to alignment)
-    uint32_t stride = cache_buf_->header.stride;
-
-    // Calculate pixel offset (ARGB8888 = 4 bytes per pixel)
-    uint8_t* pixel = static_cast<uint8_t*>(cache_buf_->data) + y * stride + x * 4;
-
-    // LVGL uses ARGB8888: byte order is B, G, R, A on little-endian
-    pixel[0] = color & 0xFF;         // B
-    pixel[1] = (color >> 8) & 0xFF;  // G
-    pixel[2] = (color >> 16) & 0xFF; // R
-    pixel[3] = (color >> 24) & 0xFF; // A
-}
-
-void GCodeLayerRenderer::draw_line_bresenham_solid(int x0, int y0, int x1, int y1, uint32_t color) {
-    // Bresenham's line algorithm for software line drawing to solid cache
-
-    int dx = std::abs(x1 - x0);
-    int dy = -std::abs(y1 - y0);
-    int sx = x0 < x1 ? 1 : -1;
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
-
-    while (true) {
-        blend_pixel_solid(x0, y0, color);
-
-        if (x0 == x1 && y0 == y1)
-            break;
-
-        int e2 = 2 * err;
-        if (e2 >= dy) {
-            if (x0 == x1)
-                break;
-            err += dy;
-            x0 += sx;
-        }
-        if (e2 <= dx) {
-            if (y0 == y1)
-                break;
-            err += dx;
-            y0 += sy;
-        }
-    }
-}
-
-void GCodeLayerRenderer::draw_line_bresenham(int x0, int y0, int x1, int y1, uint32_t color) {
-    // Bresenham's line algorithm for software line drawing
-    // This runs in the background thread where LVGL APIs are not available
-
-    int dx = std::abs(x1 - x0);
-    int dy = -std::abs(y1 - y0);
-    int sx = x0 < x1 ? 1 : -1;
-    int sy = y0 < y1 ? 1 : -1;
-    int err = dx + dy;
-
-    while (true) {
-        blend_pixel(x0, y0, color);
-
-        if (x0 == x1 && y0 == y1)
-            break;
-
-        int e2 = 2 * err;
-        if (e2 >= dy) {
-            if (x0 == x1)
-                break;
-            err += dy;
-            x0 += sx;
-        }
-        if (e2 <= dx) {
-            if (y0 == y1)
-                break;
-            err += dx;
-            y0 += sy;
-        }
-    }
-}
-
 // ============================================================================
 // Configuration
 // ============================================================================
@@ -1540,6 +1396,10 @@ void GCodeLayerRenderer::load_config() {
 
     spdlog::debug("[GCodeLayerRenderer] Adaptive target: {}ms", adaptive_target_ms_);
 
+    antialias_ = config->get<bool>("/gcode_viewer/antialias", false);
+    render_threads_ = std::clamp(config->get<int>("/gcode_viewer/render_threads", 0), 0,
+                                 static_cast<int>(MAX_RASTER_WORKERS));
+
     // Detect device tier and apply appropriate limits for constrained devices
     auto mem_info = ::helix::get_system_memory_info();
     is_constrained_device_ = mem_info.is_constrained_device();
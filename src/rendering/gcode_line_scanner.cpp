@@ -0,0 +1,205 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_line_scanner.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define HELIX_LINE_SCANNER_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define HELIX_LINE_SCANNER_NEON 1
+#endif
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+inline uint8_t classify_byte(char c) {
+    char lower = static_cast<char>(c | 0x20);
+    uint8_t flags = 0;
+    flags |= lower == 'z' ? LINE_HAS_Z : 0;
+    flags |= lower == 'e' ? LINE_HAS_E : 0;
+    flags |= c == '_' ? LINE_HAS_UNDERSCORE : 0;
+    return flags;
+}
+
+#if defined(HELIX_LINE_SCANNER_SSE2) || defined(HELIX_LINE_SCANNER_NEON)
+
+// Match masks for one 16-byte chunk; byte i owns bits [i * BITS_PER_BYTE, (i + 1) * BITS_PER_BYTE)
+struct ChunkMasks {
+    uint64_t newline;
+    uint64_t z;
+    uint64_t e;
+    uint64_t underscore;
+};
+
+#if defined(HELIX_LINE_SCANNER_SSE2)
+
+constexpr unsigned BITS_PER_BYTE = 1;
+
+inline ChunkMasks load_chunk(const char* p) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20)); // 'Z' -> 'z', 'E' -> 'e'
+    ChunkMasks m;
+    m.newline = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))));
+    m.z = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(lower, _mm_set1_epi8('z'))));
+    m.e = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(lower, _mm_set1_epi8('e'))));
+    m.underscore =
+        static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('_'))));
+    return m;
+}
+
+#else
+
+// NEON has no movemask; narrowing each 16-bit lane by 4 leaves one nibble per byte
+constexpr unsigned BITS_PER_BYTE = 4;
+
+inline uint64_t nibble_mask(uint8x16_t eq) {
+    uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+inline ChunkMasks load_chunk(const char* p) {
+    uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+    uint8x16_t lower = vorrq_u8(v, vdupq_n_u8(0x20));
+    ChunkMasks m;
+    m.newline = nibble_mask(vceqq_u8(v, vdupq_n_u8('\n')));
+    m.z = nibble_mask(vceqq_u8(lower, vdupq_n_u8('z')));
+    m.e = nibble_mask(vceqq_u8(lower, vdupq_n_u8('e')));
+    m.underscore = nibble_mask(vceqq_u8(v, vdupq_n_u8('_')));
+    return m;
+}
+
+#endif
+
+// Bits for bytes [0, byte_count) of a chunk
+inline uint64_t low_bytes_mask(unsigned byte_count) {
+    unsigned bits = byte_count * BITS_PER_BYTE;
+    return bits >= 64 ? ~uint64_t{0} : (uint64_t{1} << bits) - 1;
+}
+
+inline uint8_t flags_in(const ChunkMasks& m, uint64_t range) {
+    uint8_t flags = 0;
+    flags |= (m.z & range) ? LINE_HAS_Z : 0;
+    flags |= (m.e & range) ? LINE_HAS_E : 0;
+    flags |= (m.underscore & range) ? LINE_HAS_UNDERSCORE : 0;
+    return flags;
+}
+
+#endif
+
+} // namespace
+
+size_t scan_lines_scalar(std::string_view text, std::vector<ScannedLine>& out, size_t max_lines) {
+    const char* data = text.data();
+    size_t size = text.size();
+    size_t line_start = 0;
+    uint8_t flags = 0;
+    size_t emitted = 0;
+
+    for (size_t i = 0; i < size && emitted < max_lines; ++i) {
+        if (data[i] == '\n') {
+            out.push_back({static_cast<uint32_t>(line_start),
+                           static_cast<uint32_t>(i - line_start), flags});
+            line_start = i + 1;
+            flags = 0;
+            ++emitted;
+        } else {
+            flags |= classify_byte(data[i]);
+        }
+    }
+
+    if (emitted < max_lines && line_start < size) {
+        out.push_back({static_cast<uint32_t>(line_start),
+                       static_cast<uint32_t>(size - line_start), flags});
+        return size;
+    }
+    return line_start;
+}
+
+#if defined(HELIX_LINE_SCANNER_SSE2) || defined(HELIX_LINE_SCANNER_NEON)
+
+size_t scan_lines(std::string_view text, std::vector<ScannedLine>& out, size_t max_lines) {
+    if (max_lines == 0) {
+        return 0;
+    }
+
+    const char* data = text.data();
+    size_t size = text.size();
+    size_t line_start = 0;
+    uint8_t flags = 0;
+    size_t emitted = 0;
+    size_t i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        ChunkMasks m = load_chunk(data + i);
+        if ((m.newline | m.z | m.e | m.underscore) == 0) {
+            continue; // Middle of a line with nothing interesting (most chunks)
+        }
+
+        unsigned chunk_pos = 0; // First byte of this chunk belonging to the current line
+        uint64_t newlines = m.newline;
+        while (newlines != 0) {
+            unsigned nl = static_cast<unsigned>(__builtin_ctzll(newlines)) / BITS_PER_BYTE;
+            flags |= flags_in(m, low_bytes_mask(nl) & ~low_bytes_mask(chunk_pos));
+
+            size_t line_end = i + nl;
+            out.push_back({static_cast<uint32_t>(line_start),
+                           static_cast<uint32_t>(line_end - line_start), flags});
+            line_start = line_end + 1;
+            flags = 0;
+            if (++emitted == max_lines) {
+                return line_start;
+            }
+
+            chunk_pos = nl + 1;
+            newlines &= ~low_bytes_mask(chunk_pos);
+        }
+        flags |= flags_in(m, ~low_bytes_mask(chunk_pos));
+    }
+
+    // Tail shorter than a chunk
+    for (; i < size; ++i) {
+        if (data[i] == '\n') {
+            out.push_back({static_cast<uint32_t>(line_start),
+                           static_cast<uint32_t>(i - line_start), flags});
+            line_start = i + 1;
+            flags = 0;
+            if (++emitted == max_lines) {
+                return line_start;
+            }
+        } else {
+            flags |= classify_byte(data[i]);
+        }
+    }
+
+    if (line_start < size) {
+        out.push_back({static_cast<uint32_t>(line_start),
+                       static_cast<uint32_t>(size - line_start), flags});
+        return size;
+    }
+    return line_start;
+}
+
+#else
+
+size_t scan_lines(std::string_view text, std::vector<ScannedLine>& out, size_t max_lines) {
+    return scan_lines_scalar(text, out, max_lines);
+}
+
+#endif
+
+const char* line_scanner_isa() {
+#if defined(HELIX_LINE_SCANNER_SSE2)
+    return "sse2";
+#elif defined(HELIX_LINE_SCANNER_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+} // namespace gcode
+} // namespace helix
@@ -108,6 +108,21 @@ GCodeObjectThumbnailRenderer::render_impl(const ParsedGCodeFile* gcode, int thum
         return result;
     }
 
+    // Index contexts by interned object id so the segment loop avoids string hashing
+    std::vector<ObjectRenderContext*> contexts_by_id;
+    if (gcode->object_names) {
+        for (auto& [name, ctx] : contexts) {
+            ObjectId id = gcode->object_names->find(name);
+            if (id == NO_OBJECT_ID) {
+                continue;
+            }
+            if (id >= contexts_by_id.size()) {
+                contexts_by_id.resize(static_cast<size_t>(id) + 1, nullptr);
+            }
+            contexts_by_id[id] = &ctx;
+        }
+    }
+
     // Single pass through all layers and segments
     size_t segments_rendered = 0;
     for (size_t layer_idx = 0; layer_idx < gcode->layers.size(); ++layer_idx) {
@@ -121,17 +136,16 @@ GCodeObjectThumbnailRenderer::render_impl(const ParsedGCodeFile* gcode, int thum
         const auto& layer = gcode->layers[layer_idx];
         for (const auto& seg : layer.segments) {
             // Skip non-extrusion and unnamed segments
-            if (!seg.is_extrusion || seg.object_name.empty()) {
+            if (!seg.is_extrusion || seg.object_id == NO_OBJECT_ID) {
                 continue;
             }
 
             // Find the render context for this object
-            auto it = contexts.find(seg.object_name);
-            if (it == contexts.end()) {
+            if (seg.object_id >= contexts_by_id.size() || !contexts_by_id[seg.object_id]) {
                 continue;
             }
 
-            auto& ctx = it->second;
+            auto& ctx = *contexts_by_id[seg.object_id];
 
             // Convert world coordinates to pixel coordinates (FRONT view with Z)
             int px0, py0, px1, py1;
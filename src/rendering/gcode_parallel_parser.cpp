@@ -0,0 +1,307 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_parallel_parser.h"
+
+#include "gcode_data_source.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+// Block of whole lines waiting for a worker, resuming from the state before it
+struct ParseChunk {
+    size_t index = 0;        ///< Slot in the results
+    std::string_view text;   ///< Into the mapped file, or into bytes
+    std::vector<char> bytes; ///< Owned copy when the file isn't mapped
+    ParserStateSnapshot state;
+    std::vector<ObjectId> defined_objects; ///< EXCLUDE_OBJECT_DEFINEs before this chunk
+};
+
+// Decoded chunk, held until the merge; its raw bytes are already released
+struct ChunkResult {
+    bool continues_layer = false; ///< Chunk resumed mid-layer
+    ParsedGCodeFile result;
+};
+
+void expand_bounds(AABB& target, const AABB& source) {
+    if (!source.is_empty()) {
+        target.expand(source.min);
+        target.expand(source.max);
+    }
+}
+
+// Append one chunk's layers to the result. A chunk that resumed mid-layer
+// starts with the continuation of the previous chunk's last layer. Objects
+// come first from the chunk holding their EXCLUDE_OBJECT_DEFINE; later chunks
+// only declare them by name and add to their bounds.
+void merge_chunk(ParsedGCodeFile& out, ParsedGCodeFile& chunk, bool continues_layer) {
+    size_t first = 0;
+    if (continues_layer && !chunk.layers.empty() && !out.layers.empty()) {
+        Layer& dst = out.layers.back();
+        Layer& src = chunk.layers.front();
+        dst.segments.insert(dst.segments.end(), std::make_move_iterator(src.segments.begin()),
+                            std::make_move_iterator(src.segments.end()));
+        expand_bounds(dst.bounding_box, src.bounding_box);
+        dst.segment_count_extrusion += src.segment_count_extrusion;
+        dst.segment_count_travel += src.segment_count_travel;
+        first = 1;
+    }
+    for (size_t i = first; i < chunk.layers.size(); ++i) {
+        out.layers.push_back(std::move(chunk.layers[i]));
+    }
+
+    expand_bounds(out.global_bounding_box, chunk.global_bounding_box);
+
+    for (auto& [name, obj] : chunk.objects) {
+        auto it = out.objects.find(name);
+        if (it == out.objects.end()) {
+            out.objects.emplace(name, std::move(obj));
+        } else {
+            expand_bounds(it->second.bounding_box, obj.bounding_box);
+        }
+    }
+}
+
+// Read-ahead pass over one chunk: modal state, plus comments for the metadata parser
+void track_state(GCodeStateTracker& tracker, GCodeParser& metadata_parser, std::string_view text) {
+    const char* p = text.data();
+    const char* end = p + text.size();
+    while (p < end) {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        std::string_view line(p, static_cast<size_t>((nl ? nl : end) - p));
+        tracker.parse_line(line);
+        size_t comment_pos = line.find(';');
+        if (comment_pos != std::string_view::npos) {
+            metadata_parser.parse_line(line.substr(comment_pos));
+        }
+        p = nl ? nl + 1 : end;
+    }
+}
+
+bool parse_file_sequential(FileDataSource& source, ParsedGCodeFile& out) {
+    GCodeParser parser;
+    bool ok = source.read_line_blocks(PARSE_CHUNK_BYTES, [&](std::string_view block) {
+        parse_gcode_buffer(parser, block.data(), block.size());
+        return true;
+    });
+    if (!ok) {
+        return false;
+    }
+
+    out = parser.finalize();
+    out.filename = source.filepath();
+    return true;
+}
+
+} // namespace
+
+size_t default_parse_worker_count() {
+    unsigned int hw = std::thread::hardware_concurrency();
+    return std::clamp<size_t>(hw == 0 ? 1 : hw, 1, MAX_PARSE_WORKERS);
+}
+
+void run_parse_workers(size_t task_count, size_t worker_count,
+                       const std::function<void(size_t task, size_t worker)>& task) {
+    if (task_count == 0) {
+        return;
+    }
+    if (worker_count == 0) {
+        worker_count = default_parse_worker_count();
+    }
+    worker_count = std::min(worker_count, task_count);
+
+    std::atomic<size_t> next_task{0};
+    auto worker = [&](size_t slot) {
+        for (size_t i = next_task.fetch_add(1); i < task_count; i = next_task.fetch_add(1)) {
+            task(i, slot);
+        }
+    };
+
+    if (worker_count <= 1) {
+        worker(0);
+        return;
+    }
+
+    // The calling thread works too, so spawn one fewer
+    std::vector<std::thread> threads;
+    threads.reserve(worker_count - 1);
+    for (size_t slot = 1; slot < worker_count; ++slot) {
+        threads.emplace_back(worker, slot);
+    }
+    worker(0);
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void parse_gcode_buffer(GCodeParser& parser, const char* data, size_t size) {
+    const char* p = data;
+    const char* end = data + size;
+    while (p < end) {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+        const char* line_end = nl ? nl : end;
+        parser.parse_line(std::string_view(p, static_cast<size_t>(line_end - p)));
+        p = nl ? nl + 1 : end;
+    }
+}
+
+bool parse_gcode_file_parallel(const std::string& filepath, ParsedGCodeFile& out,
+                               size_t worker_count) {
+    FileDataSource source(filepath);
+    return parse_gcode_file_parallel(source, out, worker_count);
+}
+
+bool parse_gcode_file_parallel(FileDataSource& source, ParsedGCodeFile& out, size_t worker_count,
+                               ParallelParseStats* stats) {
+    if (worker_count == 0) {
+        worker_count = default_parse_worker_count();
+    }
+
+    if (!source.is_valid()) {
+        return false;
+    }
+    source.advise(GCodeDataSource::AccessPattern::Sequential);
+
+    if (worker_count <= 1) {
+        return parse_file_sequential(source, out);
+    }
+
+    auto start_time = std::chrono::steady_clock::now();
+
+    // The state tracker runs ahead on this thread and snapshots the state at each
+    // chunk start; workers decode the chunks meanwhile. Only comments go to the
+    // metadata parser, whose finalize() supplies the file-level fields.
+    auto object_names = std::make_shared<ObjectNameTable>();
+    GCodeStateTracker state_tracker(object_names);
+    GCodeParser metadata_parser(object_names);
+    metadata_parser.set_state_only(true);
+
+    const size_t max_queued = PARSE_QUEUE_CHUNKS_PER_WORKER * worker_count;
+    std::deque<ParseChunk> queue;    // Read, not yet taken by a worker
+    std::deque<ChunkResult> results; // deque: references stay valid while the reader appends
+    std::mutex mutex;
+    std::condition_variable chunk_ready; // Queue gained a chunk, or reading finished
+    std::condition_variable chunk_taken; // Queue has room again
+    bool reading_done = false;
+    size_t max_seen = 0;
+
+    auto worker = [&]() {
+        for (;;) {
+            ParseChunk chunk;
+            ChunkResult* slot = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                chunk_ready.wait(lock, [&] { return !queue.empty() || reading_done; });
+                if (queue.empty()) {
+                    return;
+                }
+                chunk = std::move(queue.front()); // Moving bytes keeps text valid
+                queue.pop_front();
+                slot = &results[chunk.index];
+            }
+            chunk_taken.notify_one();
+
+            GCodeParser parser(object_names);
+            parser.restore_state(chunk.state);
+            parser.declare_objects(chunk.defined_objects);
+            parse_gcode_buffer(parser, chunk.text.data(), chunk.text.size());
+            slot->result = parser.finalize();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(worker_count - 1);
+    for (size_t i = 1; i < worker_count; ++i) {
+        threads.emplace_back(worker);
+    }
+
+    // Mapped blocks are handed to workers in place; read blocks are copied
+    // because their buffer only lives for the callback
+    bool read_ok = source.read_line_blocks(PARSE_CHUNK_BYTES, [&](std::string_view block) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            chunk_taken.wait(lock, [&] { return queue.size() < max_queued; });
+        }
+
+        ParseChunk chunk;
+        chunk.state = state_tracker.snapshot();
+        chunk.defined_objects = state_tracker.defined_objects();
+        track_state(state_tracker, metadata_parser, block);
+        if (source.is_memory_mapped()) {
+            chunk.text = block;
+        } else {
+            chunk.bytes.assign(block.begin(), block.end());
+            chunk.text = std::string_view(chunk.bytes.data(), chunk.bytes.size());
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            chunk.index = results.size();
+            results.emplace_back();
+            results.back().continues_layer = chunk.state.has(ParserStateSnapshot::HAS_LAYER);
+            queue.push_back(std::move(chunk));
+            max_seen = std::max(max_seen, queue.size());
+        }
+        chunk_ready.notify_one();
+        return true;
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        reading_done = true;
+    }
+    chunk_ready.notify_all();
+
+    // Help with whatever is left, then wait for the others
+    worker();
+    for (auto& t : threads) {
+        t.join();
+    }
+    if (stats) {
+        stats->chunks = results.size();
+        stats->max_queued_chunks = max_seen;
+    }
+    if (!read_ok) {
+        return false;
+    }
+
+    // Metadata comes from the comment pass, objects from the chunks that define them
+    out = metadata_parser.finalize();
+    out.filename = source.filepath();
+
+    for (auto& chunk : results) {
+        merge_chunk(out, chunk.result, chunk.continues_layer);
+        chunk.result = ParsedGCodeFile{}; // Release chunk memory as we go
+    }
+
+    out.total_segments = 0;
+    for (const auto& layer : out.layers) {
+        out.total_segments += layer.segments.size();
+    }
+
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                             start_time);
+    spdlog::info("[ParallelParser] Parsed {} layers, {} segments, {} objects in {} chunks with {} "
+                 "workers in {:.1f}ms",
+                 out.layers.size(), out.total_segments, out.objects.size(), results.size(),
+                 worker_count, elapsed.count());
+
+    return true;
+}
+
+} // namespace gcode
+} // namespace helix
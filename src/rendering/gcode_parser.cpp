@@ -8,7 +8,9 @@
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <cstdint>
 #include <fstream>
+#include <limits>
 #include <sstream>
 #include <sys/stat.h>
 
@@ -56,6 +58,425 @@ int ParsedGCodeFile::find_layer_at_z(float z) const {
     return closest;
 }
 
+// ============================================================================
+// Object Name Interning
+// ============================================================================
+
+ObjectNameTable::ObjectNameTable() {
+    names_.emplace_back(); // NO_OBJECT_ID → ""
+}
+
+ObjectId ObjectNameTable::intern(std::string_view name) {
+    if (name.empty()) {
+        return NO_OBJECT_ID;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+
+    if (names_.size() > std::numeric_limits<ObjectId>::max()) {
+        spdlog::warn("[GCode Parser] Object name table full, ignoring object '{}'", name);
+        return NO_OBJECT_ID;
+    }
+
+    auto id = static_cast<ObjectId>(names_.size());
+    names_.emplace_back(name);
+    ids_.emplace(std::string_view(names_.back()), id);
+    return id;
+}
+
+ObjectId ObjectNameTable::find(std::string_view name) const {
+    if (name.empty()) {
+        return NO_OBJECT_ID;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    return it != ids_.end() ? it->second : NO_OBJECT_ID;
+}
+
+const std::string& ObjectNameTable::name(ObjectId id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return id < names_.size() ? names_[id] : names_[NO_OBJECT_ID];
+}
+
+size_t ObjectNameTable::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return names_.size();
+}
+
+void ObjectIdSet::assign(const std::unordered_set<std::string>& names, ObjectNameTable& table) {
+    bits_.clear();
+    for (const auto& name : names) {
+        ObjectId id = table.intern(name);
+        if (id == NO_OBJECT_ID) {
+            continue;
+        }
+        if (id >= bits_.size()) {
+            bits_.resize(static_cast<size_t>(id) + 1, 0);
+        }
+        bits_[id] = 1;
+    }
+}
+
+// ============================================================================
+// Allocation-free scanning helpers
+// ============================================================================
+
+size_t scan_gcode_float(const char* begin, const char* end, float& out_value) {
+    // Exact powers of ten representable as double (enough for any sane G-code literal)
+    static constexpr double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                        1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                        1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    constexpr int kMaxPow10 = 22;
+    constexpr int kMaxMantissaDigits = 18; // Fits in uint64_t without overflow
+
+    const char* p = begin;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int significant_digits = 0;
+    int exponent = 0; // Power of ten applied to mantissa
+    bool has_digits = false;
+
+    while (p < end && *p >= '0' && *p <= '9') {
+        if (significant_digits < kMaxMantissaDigits) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+            if (mantissa != 0) {
+                significant_digits++;
+            }
+        } else {
+            exponent++; // Integer digit beyond precision: scale instead of accumulate
+        }
+        has_digits = true;
+        ++p;
+    }
+
+    if (p < end && *p == '.') {
+        ++p;
+        while (p < end && *p >= '0' && *p <= '9') {
+            if (significant_digits < kMaxMantissaDigits) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                if (mantissa != 0) {
+                    significant_digits++;
+                }
+                exponent--;
+            }
+            has_digits = true;
+            ++p;
+        }
+    }
+
+    if (!has_digits) {
+        return 0;
+    }
+
+    double value = static_cast<double>(mantissa);
+    if (exponent < 0) {
+        value = (-exponent <= kMaxPow10) ? value / kPow10[-exponent]
+                                         : value / std::pow(10.0, -exponent);
+    } else if (exponent > 0) {
+        value = (exponent <= kMaxPow10) ? value * kPow10[exponent] : value * std::pow(10.0, exponent);
+    }
+
+    out_value = static_cast<float>(negative ? -value : value);
+    return static_cast<size_t>(p - begin);
+}
+
+namespace {
+
+inline bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+
+inline bool starts_with(std::string_view text, std::string_view prefix) {
+    return text.size() >= prefix.size() && text.compare(0, prefix.size(), prefix) == 0;
+}
+
+/// Case-insensitive prefix match (prefix must be upper case)
+inline bool starts_with_upper(std::string_view text, std::string_view prefix) {
+    if (text.size() < prefix.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < prefix.size(); ++i) {
+        if (std::toupper(static_cast<unsigned char>(text[i])) != prefix[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Name used to tag wipe tower segments (WIPE_TOWER_START/END comment markers)
+constexpr std::string_view WIPE_TOWER_OBJECT_NAME = "__WIPE_TOWER__";
+
+/// Slicer naming for support structures: "support_*", "*_support", "SUPPORT_*", "Support"
+bool is_support_object_name(std::string_view name) {
+    constexpr std::string_view needle = "support";
+    if (name.size() < needle.size()) {
+        return false;
+    }
+    for (size_t i = 0; i + needle.size() <= name.size(); ++i) {
+        size_t j = 0;
+        while (j < needle.size() &&
+               std::tolower(static_cast<unsigned char>(name[i + j])) == needle[j]) {
+            j++;
+        }
+        if (j == needle.size()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline std::string_view trim_view(std::string_view text) {
+    size_t start = 0;
+    while (start < text.size() && is_space(text[start])) {
+        start++;
+    }
+    size_t end = text.size();
+    while (end > start && is_space(text[end - 1])) {
+        end--;
+    }
+    return text.substr(start, end - start);
+}
+
+/// std::stof() equivalent for string_view: skips leading whitespace, parses the numeric prefix
+inline bool parse_float_prefix(std::string_view text, float& out_value) {
+    size_t start = 0;
+    while (start < text.size() && is_space(text[start])) {
+        start++;
+    }
+    const char* begin = text.data() + start;
+    return scan_gcode_float(begin, text.data() + text.size(), out_value) > 0;
+}
+
+/// std::stoi() equivalent for string_view: skips leading whitespace, parses the integer prefix
+inline bool parse_int_prefix(std::string_view text, int& out_value) {
+    size_t pos = 0;
+    while (pos < text.size() && is_space(text[pos])) {
+        pos++;
+    }
+    bool negative = false;
+    if (pos < text.size() && (text[pos] == '-' || text[pos] == '+')) {
+        negative = (text[pos] == '-');
+        pos++;
+    }
+    if (pos >= text.size() || !std::isdigit(static_cast<unsigned char>(text[pos]))) {
+        return false;
+    }
+    long value = 0;
+    while (pos < text.size() && std::isdigit(static_cast<unsigned char>(text[pos]))) {
+        value = value * 10 + (text[pos] - '0');
+        if (value > std::numeric_limits<int>::max()) {
+            return false;
+        }
+        pos++;
+    }
+    out_value = static_cast<int>(negative ? -value : value);
+    return true;
+}
+
+// Line classification shared by GCodeParser and GCodeStateTracker, which must agree
+// on every line that changes snapshot state
+
+/// Strip the comment and surrounding whitespace
+inline std::string_view strip_comment(std::string_view line) {
+    size_t comment_pos = line.find(';');
+    if (comment_pos != std::string_view::npos) {
+        line = line.substr(0, comment_pos);
+    }
+    return trim_view(line);
+}
+
+/// Command word followed by space, tab or end of line ("G92" but not "G920")
+inline bool is_command_word(std::string_view line, std::string_view word) {
+    return starts_with(line, word) &&
+           (line.size() == word.size() || line[word.size()] == ' ' || line[word.size()] == '\t');
+}
+
+/// G0/G1 (trimmed line)
+inline bool is_move_command(std::string_view line) {
+    return line.size() >= 2 && line[0] == 'G' && (line[1] == '0' || line[1] == '1') &&
+           (line.size() == 2 || line[2] == ' ' || line[2] == '\t');
+}
+
+/// Axis words of a G0/G1/G92 line
+struct AxisWords {
+    float x = 0.0f, y = 0.0f, z = 0.0f, e = 0.0f;
+    bool has_x = false, has_y = false, has_z = false, has_e = false;
+};
+
+/// Tokenize the parameter words in a single pass. Only the first occurrence
+/// of each axis letter counts, matching the previous find()-based lookup.
+AxisWords scan_axis_words(std::string_view line) {
+    AxisWords words;
+    const char* p = line.data();
+    const char* end = p + line.size();
+    while (p < end && !is_space(*p)) {
+        ++p; // Skip command word
+    }
+    while (p < end) {
+        while (p < end && is_space(*p)) {
+            ++p;
+        }
+        if (p >= end) {
+            break;
+        }
+
+        char letter = *p++;
+        float value = 0.0f;
+        size_t consumed = 0;
+        if (letter == 'X' || letter == 'Y' || letter == 'Z' || letter == 'E') {
+            consumed = scan_gcode_float(p, end, value); // F and others are never read
+        }
+        if (consumed > 0) {
+            switch (letter) {
+            case 'X':
+                if (!words.has_x) {
+                    words.x = value;
+                    words.has_x = true;
+                }
+                break;
+            case 'Y':
+                if (!words.has_y) {
+                    words.y = value;
+                    words.has_y = true;
+                }
+                break;
+            case 'Z':
+                if (!words.has_z) {
+                    words.z = value;
+                    words.has_z = true;
+                }
+                break;
+            case 'E':
+                if (!words.has_e) {
+                    words.e = value;
+                    words.has_e = true;
+                }
+                break;
+            default:
+                break;
+            }
+            p += consumed;
+        }
+
+        // Skip any trailing garbage in this word
+        while (p < end && !is_space(*p)) {
+            ++p;
+        }
+    }
+    return words;
+}
+
+/// G92: set the given axes, or zero all of them when none is given
+void apply_set_position(const AxisWords& words, glm::vec3& position, float& e) {
+    if (!words.has_x && !words.has_y && !words.has_z && !words.has_e) {
+        position = glm::vec3(0.0f, 0.0f, 0.0f);
+        e = 0.0f;
+        return;
+    }
+    if (words.has_x) {
+        position.x = words.x;
+    }
+    if (words.has_y) {
+        position.y = words.y;
+    }
+    if (words.has_z) {
+        position.z = words.z;
+    }
+    if (words.has_e) {
+        e = words.e;
+    }
+}
+
+/// Standalone tool change ("T0", "T12"); false for anything else starting with 'T'
+bool parse_tool_word(std::string_view line, int& out_tool) {
+    if (line.length() < 2 || line[0] != 'T') {
+        return false;
+    }
+    size_t i = 1;
+    int tool_num = 0;
+    while (i < line.length() && std::isdigit(static_cast<unsigned char>(line[i]))) {
+        tool_num = tool_num * 10 + (line[i] - '0');
+        i++;
+    }
+    if (i == 1 || (i < line.length() && !is_space(line[i]))) {
+        return false; // No digits, or not standalone
+    }
+    out_tool = tool_num;
+    return true;
+}
+
+/// ";LAYER_CHANGE", ";LAYER:N", "; layer_change" (comment includes its ';')
+bool is_layer_change_comment(std::string_view comment) {
+    if (comment.length() < 2 || comment[0] != ';') {
+        return false;
+    }
+    size_t start = 1;
+    while (start < comment.length() && is_space(comment[start])) {
+        start++;
+    }
+    std::string_view content = comment.substr(start);
+    return starts_with_upper(content, "LAYER_CHANGE") || starts_with_upper(content, "LAYER:");
+}
+
+/// WIPE_TOWER(_BRIM)_START -> 1, WIPE_TOWER(_BRIM)_END -> -1, anything else -> 0
+int wipe_tower_marker(std::string_view comment) {
+    if (comment.find("WIPE_TOWER_") == std::string_view::npos) {
+        return 0;
+    }
+    if (comment.find("WIPE_TOWER_START") != std::string_view::npos ||
+        comment.find("WIPE_TOWER_BRIM_START") != std::string_view::npos) {
+        return 1;
+    }
+    if (comment.find("WIPE_TOWER_END") != std::string_view::npos ||
+        comment.find("WIPE_TOWER_BRIM_END") != std::string_view::npos) {
+        return -1;
+    }
+    return 0;
+}
+
+/// "PARAM=value" lookup; the value runs to the next space
+bool find_string_param(std::string_view line, std::string_view param,
+                       std::string_view& out_value) {
+    // Find "PARAM=" without building a temporary search string
+    size_t pos = line.find(param);
+    while (pos != std::string_view::npos) {
+        size_t eq = pos + param.length();
+        if (eq < line.length() && line[eq] == '=') {
+            break;
+        }
+        pos = line.find(param, pos + 1);
+    }
+    if (pos == std::string_view::npos) {
+        return false;
+    }
+
+    size_t start = pos + param.length() + 1; // Skip "PARAM="
+    if (start >= line.length()) {
+        return false;
+    }
+
+    // Find end of value (space or end of line)
+    size_t end = line.find(' ', start);
+    if (end == std::string_view::npos) {
+        end = line.length();
+    }
+
+    out_value = line.substr(start, end - start);
+    return true;
+}
+
+} // namespace
+
 // ============================================================================
 // GCodeParser Implementation
 // ============================================================================
@@ -64,15 +485,29 @@ GCodeParser::GCodeParser() {
     reset();
 }
 
+GCodeParser::GCodeParser(std::shared_ptr<ObjectNameTable> object_names)
+    : object_names_(std::move(object_names)), shared_object_names_(true) {
+    reset();
+}
+
 void GCodeParser::reset() {
     current_position_ = glm::vec3(0.0f, 0.0f, 0.0f);
     current_e_ = 0.0f;
     current_object_.clear();
+    current_object_id_ = NO_OBJECT_ID;
+    current_object_is_support_ = false;
+    if (!shared_object_names_ || !object_names_) {
+        // finalize() hands the table to the result, so start a fresh one
+        object_names_ = std::make_shared<ObjectNameTable>();
+    }
     is_absolute_positioning_ = true;
     is_absolute_extrusion_ = true;
     layers_.clear();
     objects_.clear();
+    defined_objects_.clear();
     global_bounds_ = AABB();
+    layers_started_ = 0;
+    has_segments_ = false;
     lines_parsed_ = 0;
     out_of_range_width_count_ = 0;
 
@@ -80,30 +515,30 @@ void GCodeParser::reset() {
     // (see add_segment() which creates a layer if layers_ is empty)
 }
 
-void GCodeParser::parse_line(const std::string& line) {
+void GCodeParser::parse_line(std::string_view line) {
     lines_parsed_++;
 
     // Extract and parse metadata comments before trimming
     size_t comment_pos = line.find(';');
-    if (comment_pos != std::string::npos) {
-        std::string comment = line.substr(comment_pos);
+    if (comment_pos != std::string_view::npos) {
+        std::string_view comment = line.substr(comment_pos);
         parse_metadata_comment(comment);
         parse_wipe_tower_marker(comment);
     }
 
-    std::string trimmed = trim_line(line);
+    std::string_view trimmed = trim_line(line);
     if (trimmed.empty()) {
         return;
     }
 
     // Check for tool changes (T0, T1, T2, etc.)
-    if (!trimmed.empty() && trimmed[0] == 'T') {
+    if (trimmed[0] == 'T') {
         parse_tool_change_command(trimmed);
         // Continue processing - some G-code files have commands after tool changes
     }
 
     // Check for EXCLUDE_OBJECT commands first
-    if (trimmed.find("EXCLUDE_OBJECT") == 0) {
+    if (trimmed[0] == 'E' && starts_with(trimmed, "EXCLUDE_OBJECT")) {
         parse_exclude_object_command(trimmed);
         return;
     }
@@ -121,33 +556,35 @@ void GCodeParser::parse_line(const std::string& line) {
     } else if (trimmed == "M83") {
         is_absolute_extrusion_ = false;
         return;
+    } else if (is_command_word(trimmed, "G92")) {
+        parse_set_position_command(trimmed);
+        return;
     }
 
     // Parse movement commands (G0, G1)
-    if (trimmed[0] == 'G' && (trimmed.find("G0 ") == 0 || trimmed.find("G1 ") == 0 ||
-                              trimmed == "G0" || trimmed == "G1")) {
+    if (is_move_command(trimmed)) {
         parse_movement_command(trimmed);
     }
 }
 
-bool GCodeParser::parse_movement_command(const std::string& line) {
+bool GCodeParser::parse_movement_command(std::string_view line) {
     glm::vec3 new_position = current_position_;
     float new_e = current_e_;
     bool has_movement = false;
     bool has_extrusion = false;
 
-    // Extract X, Y, Z parameters
-    float value;
-    if (extract_param(line, 'X', value)) {
-        new_position.x = is_absolute_positioning_ ? value : current_position_.x + value;
+    AxisWords words = scan_axis_words(line);
+
+    if (words.has_x) {
+        new_position.x = is_absolute_positioning_ ? words.x : current_position_.x + words.x;
         has_movement = true;
     }
-    if (extract_param(line, 'Y', value)) {
-        new_position.y = is_absolute_positioning_ ? value : current_position_.y + value;
+    if (words.has_y) {
+        new_position.y = is_absolute_positioning_ ? words.y : current_position_.y + words.y;
         has_movement = true;
     }
-    if (extract_param(line, 'Z', value)) {
-        new_position.z = is_absolute_positioning_ ? value : current_position_.z + value;
+    if (words.has_z) {
+        new_position.z = is_absolute_positioning_ ? words.z : current_position_.z + words.z;
         has_movement = true;
 
         // Layer change detection:
@@ -169,8 +606,8 @@ bool GCodeParser::parse_movement_command(const std::string& line) {
     }
 
     // Extract E (extrusion) parameter
-    if (extract_param(line, 'E', value)) {
-        new_e = is_absolute_extrusion_ ? value : current_e_ + value;
+    if (words.has_e) {
+        new_e = is_absolute_extrusion_ ? words.e : current_e_ + words.e;
         has_extrusion = true;
     }
 
@@ -197,26 +634,28 @@ bool GCodeParser::parse_movement_command(const std::string& line) {
     return has_movement;
 }
 
-bool GCodeParser::parse_exclude_object_command(const std::string& line) {
+void GCodeParser::parse_set_position_command(std::string_view line) {
+    apply_set_position(scan_axis_words(line), current_position_, current_e_);
+}
+
+bool GCodeParser::parse_exclude_object_command(std::string_view line) {
     // EXCLUDE_OBJECT_DEFINE NAME=... CENTER=... POLYGON=...
-    if (line.find("EXCLUDE_OBJECT_DEFINE") == 0) {
-        std::string name;
+    if (starts_with(line, "EXCLUDE_OBJECT_DEFINE")) {
+        std::string_view name;
         if (!extract_string_param(line, "NAME", name)) {
             return false;
         }
 
         GCodeObject obj;
-        obj.name = name;
+        obj.name = std::string(name);
 
         // Extract CENTER (format: "X,Y")
-        std::string center_str;
+        std::string_view center_str;
         if (extract_string_param(line, "CENTER", center_str)) {
             size_t comma = center_str.find(',');
-            if (comma != std::string::npos) {
-                try {
-                    obj.center.x = std::stof(center_str.substr(0, comma));
-                    obj.center.y = std::stof(center_str.substr(comma + 1));
-                } catch (...) {
+            if (comma != std::string_view::npos) {
+                if (!parse_float_prefix(center_str.substr(0, comma), obj.center.x) ||
+                    !parse_float_prefix(center_str.substr(comma + 1), obj.center.y)) {
                     // Internal parsing error - no user notification needed
                     spdlog::debug("[GCode Parser] Failed to parse CENTER for object: {}", name);
                 }
@@ -224,14 +663,9 @@ bool GCodeParser::parse_exclude_object_command(const std::string& line) {
         }
 
         // Extract POLYGON (format: "[[x1,y1],[x2,y2],...]")
-        // For now, we'll do basic parsing - full JSON parsing would be better
-        std::string polygon_str;
+        // Whitespace inside the list is skipped by parse_float_prefix()
+        std::string_view polygon_str;
         if (extract_string_param(line, "POLYGON", polygon_str)) {
-            // Simple extraction of number pairs
-            // Remove all whitespace first for easier parsing
-            polygon_str.erase(std::remove_if(polygon_str.begin(), polygon_str.end(), ::isspace),
-                              polygon_str.end());
-
             // Skip outer opening bracket if present
             size_t pos = 0;
             if (!polygon_str.empty() && polygon_str[0] == '[') {
@@ -240,58 +674,69 @@ bool GCodeParser::parse_exclude_object_command(const std::string& line) {
 
             while (pos < polygon_str.length()) {
                 // Find opening bracket for this point
-                if (polygon_str[pos] == '[') {
-                    pos++;
-                    // Extract x coordinate (everything until comma)
-                    size_t comma = polygon_str.find(',', pos);
-                    if (comma != std::string::npos) {
-                        try {
-                            float x = std::stof(polygon_str.substr(pos, comma - pos));
-                            pos = comma + 1;
-
-                            // Extract y coordinate (everything until closing bracket)
-                            size_t close = polygon_str.find(']', pos);
-                            if (close != std::string::npos) {
-                                float y = std::stof(polygon_str.substr(pos, close - pos));
-                                obj.polygon.push_back(glm::vec2(x, y));
-                                pos = close + 1;
-                                spdlog::trace("[GCode Parser] Parsed polygon point: ({}, {})", x,
-                                              y);
-                            } else {
-                                break;
-                            }
-                        } catch (...) {
-                            break;
-                        }
-                    } else {
-                        break;
-                    }
-                } else {
+                if (polygon_str[pos] != '[') {
                     pos++;
+                    continue;
+                }
+                pos++;
+
+                // Extract x coordinate (everything until comma)
+                size_t comma = polygon_str.find(',', pos);
+                if (comma == std::string_view::npos) {
+                    break;
                 }
+                float x = 0.0f;
+                if (!parse_float_prefix(polygon_str.substr(pos, comma - pos), x)) {
+                    break;
+                }
+                pos = comma + 1;
+
+                // Extract y coordinate (everything until closing bracket)
+                size_t close = polygon_str.find(']', pos);
+                if (close == std::string_view::npos) {
+                    break;
+                }
+                float y = 0.0f;
+                if (!parse_float_prefix(polygon_str.substr(pos, close - pos), y)) {
+                    break;
+                }
+                obj.polygon.push_back(glm::vec2(x, y));
+                pos = close + 1;
+                spdlog::trace("[GCode Parser] Parsed polygon point: ({}, {})", x, y);
             }
         }
 
-        objects_[name] = obj;
-        spdlog::trace("[GCode Parser] Defined object: {} at ({}, {})", name, obj.center.x,
+        spdlog::trace("[GCode Parser] Defined object: {} at ({}, {})", obj.name, obj.center.x,
                       obj.center.y);
+        if (objects_.find(obj.name) == objects_.end()) {
+            defined_objects_.push_back(object_names_->intern(obj.name));
+        }
+        objects_[obj.name] = std::move(obj);
         return true;
     }
     // EXCLUDE_OBJECT_START NAME=...
-    else if (line.find("EXCLUDE_OBJECT_START") == 0) {
-        if (!extract_string_param(line, "NAME", current_object_)) {
+    else if (starts_with(line, "EXCLUDE_OBJECT_START")) {
+        std::string_view name;
+        if (!extract_string_param(line, "NAME", name)) {
             current_object_.clear();
+            current_object_id_ = NO_OBJECT_ID;
+            current_object_is_support_ = false;
             return false;
         }
+        current_object_.assign(name.data(), name.size());
+        current_object_id_ = object_names_->intern(name);
+        current_object_is_support_ = is_support_object_name(name);
         spdlog::trace("[GCode Parser] Started object: {}", current_object_);
         return true;
     }
     // EXCLUDE_OBJECT_END NAME=...
-    else if (line.find("EXCLUDE_OBJECT_END") == 0) {
-        std::string name;
+    else if (starts_with(line, "EXCLUDE_OBJECT_END")) {
+        std::string_view name;
         if (extract_string_param(line, "NAME", name) && name == current_object_) {
             spdlog::trace("[GCode Parser] Ended object: {}", current_object_);
             current_object_.clear();
+            current_object_id_ = NO_OBJECT_ID;
+            current_object_is_support_ = false;
             return true;
         }
     }
@@ -299,7 +744,7 @@ bool GCodeParser::parse_exclude_object_command(const std::string& line) {
     return false;
 }
 
-void GCodeParser::parse_metadata_comment(const std::string& line) {
+void GCodeParser::parse_metadata_comment(std::string_view line) {
     // OrcaSlicer/PrusaSlicer format: "; key = value"
     // Use fuzzy matching to handle variations across slicers
 
@@ -309,17 +754,8 @@ void GCodeParser::parse_metadata_comment(const std::string& line) {
 
     // Check for layer change markers FIRST (before key=value parsing)
     // Common formats: ";LAYER_CHANGE", ";LAYER:N", "; LAYER_CHANGE"
-    std::string content_upper = line.substr(1);
-    // Remove leading whitespace for comparison
-    size_t ws_start = 0;
-    while (ws_start < content_upper.length() && std::isspace(content_upper[ws_start])) {
-        ws_start++;
-    }
-    content_upper = content_upper.substr(ws_start);
-    std::transform(content_upper.begin(), content_upper.end(), content_upper.begin(), ::toupper);
-
     // Detect layer change markers (but not LAYER_COUNT which is metadata)
-    if (content_upper.find("LAYER_CHANGE") == 0 || content_upper.find("LAYER:") == 0) {
+    if (is_layer_change_comment(line)) {
         // Mark that we found layer markers (prefer this over Z-based detection)
         use_layer_markers_ = true;
         pending_layer_marker_ = true;
@@ -328,51 +764,38 @@ void GCodeParser::parse_metadata_comment(const std::string& line) {
         return; // Don't process as key=value metadata
     }
 
-    // Skip '; ' to get key=value or key: value part
-    std::string content = line.substr(1);
-
-    // Trim leading whitespace
-    size_t start = 0;
-    while (start < content.length() && std::isspace(content[start])) {
-        start++;
+    // Skip ';' and leading whitespace
+    std::string_view content = line.substr(1);
+    size_t ws_start = 0;
+    while (ws_start < content.length() && is_space(content[ws_start])) {
+        ws_start++;
     }
-    content = content.substr(start);
+    content = content.substr(ws_start);
 
     // Look for '=' or ':' separator (support both OrcaSlicer and PrusaSlicer formats)
     size_t eq_pos = content.find('=');
     size_t colon_pos = content.find(':');
-    size_t sep_pos = std::string::npos;
+    size_t sep_pos = std::string_view::npos;
 
     // Prefer '=' if present and before any ':', otherwise use ':'
-    if (eq_pos != std::string::npos && (colon_pos == std::string::npos || eq_pos < colon_pos)) {
+    if (eq_pos != std::string_view::npos &&
+        (colon_pos == std::string_view::npos || eq_pos < colon_pos)) {
         sep_pos = eq_pos;
-    } else if (colon_pos != std::string::npos) {
+    } else if (colon_pos != std::string_view::npos) {
         sep_pos = colon_pos;
     }
 
-    if (sep_pos == std::string::npos) {
+    if (sep_pos == std::string_view::npos) {
         return;
     }
 
-    // Extract key and value
-    std::string key = content.substr(0, sep_pos);
-    std::string value = content.substr(sep_pos + 1);
-
-    // Trim whitespace from key and value
-    auto trim = [](std::string& s) {
-        size_t start = 0;
-        while (start < s.length() && std::isspace(s[start]))
-            start++;
-        size_t end = s.length();
-        while (end > start && std::isspace(s[end - 1]))
-            end--;
-        s = s.substr(start, end - start);
-    };
-    trim(key);
-    trim(value);
+    // Extract key and value, trimming whitespace
+    std::string_view key = trim_view(content.substr(0, sep_pos));
+    std::string_view value = trim_view(content.substr(sep_pos + 1));
 
     // Convert key to lowercase for case-insensitive matching
-    std::string key_lower = key;
+    // (short per-line keys like "TYPE" or "WIDTH" stay within SSO, so no heap allocation)
+    std::string key_lower(key);
     std::transform(key_lower.begin(), key_lower.end(), key_lower.begin(), ::tolower);
 
     // Helper to check if key contains all substrings (fuzzy match)
@@ -394,104 +817,76 @@ void GCodeParser::parse_metadata_comment(const std::string& line) {
     // Fallback: Parse single filament_colour if extruder_colour not yet found
     else if (contains_all({"filament", "col"}) && tool_color_palette_.empty()) {
         // Check if it's a semicolon-separated list (multi-color)
-        if (value.find(';') != std::string::npos) {
+        if (value.find(';') != std::string_view::npos) {
             parse_extruder_color_metadata(line);
         } else {
             // Single color metadata
-            metadata_filament_color_ = value;
+            metadata_filament_color_ = std::string(value);
             spdlog::trace("[GCode Parser] Parsed single filament color: {}", value);
         }
     } else if (contains_all({"filament", "type"})) {
-        metadata_filament_type_ = value;
+        metadata_filament_type_ = std::string(value);
         spdlog::trace("[GCode Parser] Parsed filament type: {}", value);
     } else if (contains_all({"printer", "model"}) || contains_all({"printer", "name"})) {
-        metadata_printer_model_ = value;
+        metadata_printer_model_ = std::string(value);
         spdlog::trace("[GCode Parser] Parsed printer model: {}", value);
     } else if (contains_all({"nozzle", "diameter"})) {
-        try {
-            metadata_nozzle_diameter_ = std::stof(value);
+        if (parse_float_prefix(value, metadata_nozzle_diameter_)) {
             spdlog::trace("[GCode Parser] Parsed nozzle diameter: {}mm", metadata_nozzle_diameter_);
-        } catch (...) {
         }
     } else if (contains_all({"filament"}) &&
                (key_lower.find("[mm]") != std::string::npos || contains_all({"length"}))) {
-        try {
-            metadata_filament_length_ = std::stof(value);
+        if (parse_float_prefix(value, metadata_filament_length_)) {
             spdlog::trace("[GCode Parser] Parsed filament length: {}mm", metadata_filament_length_);
-        } catch (...) {
         }
     } else if (contains_all({"filament"}) &&
                (key_lower.find("[g]") != std::string::npos || contains_all({"weight"}))) {
-        try {
-            metadata_filament_weight_ = std::stof(value);
+        if (parse_float_prefix(value, metadata_filament_weight_)) {
             spdlog::trace("[GCode Parser] Parsed filament weight: {}g", metadata_filament_weight_);
-        } catch (...) {
         }
     } else if (contains_all({"filament", "cost"}) || contains_all({"material", "cost"})) {
-        try {
-            metadata_filament_cost_ = std::stof(value);
+        if (parse_float_prefix(value, metadata_filament_cost_)) {
             spdlog::trace("[GCode Parser] Parsed filament cost: ${}", metadata_filament_cost_);
-        } catch (...) {
         }
     } else if (contains_all({"layer"}) && contains_all({"total"}) &&
                (contains_all({"number"}) || contains_all({"count"}) ||
                 key_lower.find("total layer") != std::string::npos)) {
         // Match "total layer number", "total layers count", but NOT "interlocking_beam_layer_count"
-        try {
-            metadata_layer_count_ = std::stoi(value);
+        if (parse_int_prefix(value, metadata_layer_count_)) {
             spdlog::trace("[GCode Parser] Parsed total layer count: {}", metadata_layer_count_);
-        } catch (...) {
         }
     } else if ((contains_all({"time"}) &&
                 (contains_all({"print"}) || contains_all({"estimated"}))) ||
                contains_all({"print", "time"})) {
         // Parse various time formats: "29m 25s", "1h 23m", "45s", etc.
         float minutes = 0.0f;
+        float part = 0.0f;
 
         // Try to find hours
         size_t h_pos = value.find('h');
-        if (h_pos != std::string::npos) {
-            try {
-                float hours = std::stof(value.substr(0, h_pos));
-                minutes += hours * 60.0f;
-            } catch (...) {
-            }
+        if (h_pos != std::string_view::npos && parse_float_prefix(value.substr(0, h_pos), part)) {
+            minutes += part * 60.0f;
         }
 
         // Try to find minutes
         size_t m_pos = value.find('m');
-        if (m_pos != std::string::npos) {
-            try {
-                size_t start_pos = (h_pos != std::string::npos) ? h_pos + 1 : 0;
-                std::string min_str = value.substr(start_pos, m_pos - start_pos);
-                // Trim spaces
-                size_t min_start = 0;
-                while (min_start < min_str.length() && std::isspace(min_str[min_start]))
-                    min_start++;
-                if (min_start < min_str.length()) {
-                    minutes += std::stof(min_str.substr(min_start));
-                }
-            } catch (...) {
+        if (m_pos != std::string_view::npos) {
+            size_t start_pos = (h_pos != std::string_view::npos) ? h_pos + 1 : 0;
+            if (start_pos <= m_pos &&
+                parse_float_prefix(value.substr(start_pos, m_pos - start_pos), part)) {
+                minutes += part;
             }
         }
 
         // Try to find seconds
         size_t s_pos = value.find('s');
-        if (s_pos != std::string::npos) {
-            try {
-                size_t start_pos = (m_pos != std::string::npos)   ? m_pos + 1
-                                   : (h_pos != std::string::npos) ? h_pos + 1
-                                                                  : 0;
-                std::string sec_str = value.substr(start_pos, s_pos - start_pos);
-                // Trim spaces
-                size_t sec_start = 0;
-                while (sec_start < sec_str.length() && std::isspace(sec_str[sec_start]))
-                    sec_start++;
-                if (sec_start < sec_str.length()) {
-                    float seconds = std::stof(sec_str.substr(sec_start));
-                    minutes += seconds / 60.0f;
-                }
-            } catch (...) {
+        if (s_pos != std::string_view::npos) {
+            size_t start_pos = (m_pos != std::string_view::npos)   ? m_pos + 1
+                               : (h_pos != std::string_view::npos) ? h_pos + 1
+                                                                   : 0;
+            if (start_pos <= s_pos &&
+                parse_float_prefix(value.substr(start_pos, s_pos - start_pos), part)) {
+                minutes += part / 60.0f;
             }
         }
 
@@ -500,7 +895,7 @@ void GCodeParser::parse_metadata_comment(const std::string& line) {
             spdlog::trace("[GCode Parser] Parsed estimated time: {:.2f} minutes", minutes);
         }
     } else if (contains_all({"generated"}) || contains_all({"slicer"})) {
-        metadata_slicer_name_ = value;
+        metadata_slicer_name_ = std::string(value);
         spdlog::trace("[GCode Parser] Parsed slicer: {}", value);
     }
     // Parse extrusion width metadata
@@ -509,74 +904,61 @@ void GCodeParser::parse_metadata_comment(const std::string& line) {
     else if (contains_all({"extrusion", "width"}) ||
              (key_lower.find("line_width") != std::string::npos) ||
              (key_lower.find("linewidth") != std::string::npos)) {
-        // Extract numeric value (handle "0.45mm" format and plain "0.4")
-        std::string numeric_value = value;
-        // Remove "mm" suffix if present
-        size_t mm_pos = numeric_value.find("mm");
-        if (mm_pos != std::string::npos) {
-            numeric_value = numeric_value.substr(0, mm_pos);
+        // Numeric prefix parse handles both "0.45mm" and plain "0.4"
+        float width = 0.0f;
+        if (!parse_float_prefix(value, width)) {
+            return; // Failed to parse width value
         }
 
-        try {
-            float width = std::stof(numeric_value);
-
-            // Categorize by feature type
-            if (contains_all({"first", "layer"}) || contains_all({"initial", "layer"})) {
-                metadata_first_layer_extrusion_width_ = width;
-                spdlog::trace("[GCode Parser] Parsed first layer extrusion width: {}mm", width);
-            } else if (contains_all({"perimeter"}) || key_lower.find("wall") != std::string::npos) {
-                // Handles "perimeter" (Prusa/Orca) and "wall" (Cura)
-                metadata_perimeter_extrusion_width_ = width;
-                spdlog::trace("[GCode Parser] Parsed perimeter/wall extrusion width: {}mm", width);
-            } else if (contains_all({"infill"})) {
-                metadata_infill_extrusion_width_ = width;
-                spdlog::trace("[GCode Parser] Parsed infill extrusion width: {}mm", width);
-            } else {
-                // General extrusion width (fallback for "line_width", etc.)
-                if (metadata_extrusion_width_ == 0.0f) {
-                    metadata_extrusion_width_ = width;
-                    spdlog::trace("[GCode Parser] Parsed default extrusion width: {}mm", width);
-                }
+        // Categorize by feature type
+        if (contains_all({"first", "layer"}) || contains_all({"initial", "layer"})) {
+            metadata_first_layer_extrusion_width_ = width;
+            spdlog::trace("[GCode Parser] Parsed first layer extrusion width: {}mm", width);
+        } else if (contains_all({"perimeter"}) || key_lower.find("wall") != std::string::npos) {
+            // Handles "perimeter" (Prusa/Orca) and "wall" (Cura)
+            metadata_perimeter_extrusion_width_ = width;
+            spdlog::trace("[GCode Parser] Parsed perimeter/wall extrusion width: {}mm", width);
+        } else if (contains_all({"infill"})) {
+            metadata_infill_extrusion_width_ = width;
+            spdlog::trace("[GCode Parser] Parsed infill extrusion width: {}mm", width);
+        } else {
+            // General extrusion width (fallback for "line_width", etc.)
+            if (metadata_extrusion_width_ == 0.0f) {
+                metadata_extrusion_width_ = width;
+                spdlog::trace("[GCode Parser] Parsed default extrusion width: {}mm", width);
             }
-        } catch (...) {
-            // Failed to parse width value
         }
     }
 }
 
-void GCodeParser::parse_extruder_color_metadata(const std::string& line) {
+void GCodeParser::parse_extruder_color_metadata(std::string_view line) {
     // Format: "; extruder_colour = #ED1C24;#00C1AE;#F4E2C1;#000000"
     //     OR: "; filament_colour = ..." (fallback)
     //     OR: ";extruder_colour=#AA0000 ; #00BB00 ;#0000CC" (with variations)
 
     // Find '=' character (with or without spaces)
     size_t eq_pos = line.find('=');
-    if (eq_pos == std::string::npos) {
+    if (eq_pos == std::string_view::npos) {
         return;
     }
 
-    std::string colors_str = line.substr(eq_pos + 1);
-
-    // Trim leading whitespace from colors_str
-    size_t start = colors_str.find_first_not_of(" \t\r\n");
-    if (start != std::string::npos) {
-        colors_str = colors_str.substr(start);
-    }
-
     // Split by semicolons
-    std::stringstream ss(colors_str);
-    std::string color;
-    while (std::getline(ss, color, ';')) {
-        // Trim whitespace
-        color.erase(0, color.find_first_not_of(" \t\r\n"));
-        color.erase(color.find_last_not_of(" \t\r\n") + 1);
+    std::string_view colors_str = line.substr(eq_pos + 1);
+    while (!colors_str.empty()) {
+        size_t sep = colors_str.find(';');
+        std::string_view color = trim_view(colors_str.substr(0, sep));
 
         if (!color.empty() && color[0] == '#') {
-            tool_color_palette_.push_back(color);
+            tool_color_palette_.emplace_back(color);
         } else if (!color.empty()) {
             // Non-empty but invalid format - use placeholder
             tool_color_palette_.push_back("");
         }
+
+        if (sep == std::string_view::npos) {
+            break;
+        }
+        colors_str.remove_prefix(sep + 1);
     }
 
     // Log color palette (manual join since fmt::join may not be available)
@@ -595,105 +977,31 @@ void GCodeParser::parse_extruder_color_metadata(const std::string& line) {
     }
 }
 
-void GCodeParser::parse_tool_change_command(const std::string& line) {
+void GCodeParser::parse_tool_change_command(std::string_view line) {
     // Format: "T0", "T1", "T2", etc. (standalone line)
-    if (line.empty() || line[0] != 'T') {
+    int tool_num = 0;
+    if (!parse_tool_word(line, tool_num)) {
         return;
     }
 
-    // Check if it's JUST "T" + digits (no other commands on line)
-    if (line.length() < 2) {
-        return;
-    }
-
-    // Extract tool number
-    size_t i = 1;
-    while (i < line.length() && std::isdigit(line[i])) {
-        i++;
-    }
-
-    if (i == 1) {
-        return; // No digits after T
-    }
-    if (i < line.length() && !std::isspace(line[i])) {
-        return; // Not standalone
-    }
-
-    std::string tool_str = line.substr(1, i - 1);
-    int tool_num = std::stoi(tool_str);
-
     current_tool_index_ = tool_num;
     spdlog::trace("[GCode Parser] Tool change: T{}", tool_num);
 }
 
-void GCodeParser::parse_wipe_tower_marker(const std::string& comment) {
-    if (comment.find("WIPE_TOWER_START") != std::string::npos ||
-        comment.find("WIPE_TOWER_BRIM_START") != std::string::npos) {
+void GCodeParser::parse_wipe_tower_marker(std::string_view comment) {
+    int marker = wipe_tower_marker(comment);
+    if (marker > 0) {
         in_wipe_tower_ = true;
         spdlog::debug("[GCode Parser] Entering wipe tower section");
-    } else if (comment.find("WIPE_TOWER_END") != std::string::npos ||
-               comment.find("WIPE_TOWER_BRIM_END") != std::string::npos) {
+    } else if (marker < 0) {
         in_wipe_tower_ = false;
         spdlog::debug("[GCode Parser] Exiting wipe tower section");
     }
 }
 
-bool GCodeParser::extract_param(const std::string& line, char param, float& out_value) {
-    size_t pos = line.find(param);
-    if (pos == std::string::npos) {
-        return false;
-    }
-
-    // Make sure it's a parameter (preceded by space or at start after command)
-    if (pos > 0 && line[pos - 1] != ' ' && line[pos - 1] != '\t') {
-        return false;
-    }
-
-    // Extract number after parameter letter
-    size_t start = pos + 1;
-    if (start >= line.length()) {
-        return false;
-    }
-
-    // Find end of number (space, end of string, or another letter)
-    size_t end = start;
-    while (end < line.length() &&
-           (std::isdigit(line[end]) || line[end] == '.' || line[end] == '-' || line[end] == '+')) {
-        end++;
-    }
-
-    if (end == start) {
-        return false;
-    }
-
-    try {
-        out_value = std::stof(line.substr(start, end - start));
-        return true;
-    } catch (...) {
-        return false;
-    }
-}
-
-bool GCodeParser::extract_string_param(const std::string& line, const std::string& param,
-                                       std::string& out_value) {
-    size_t pos = line.find(param + "=");
-    if (pos == std::string::npos) {
-        return false;
-    }
-
-    size_t start = pos + param.length() + 1; // Skip "PARAM="
-    if (start >= line.length()) {
-        return false;
-    }
-
-    // Find end of value (space or end of line)
-    size_t end = line.find(' ', start);
-    if (end == std::string::npos) {
-        end = line.length();
-    }
-
-    out_value = line.substr(start, end - start);
-    return true;
+bool GCodeParser::extract_string_param(std::string_view line, std::string_view param,
+                                       std::string_view& out_value) {
+    return find_string_param(line, param, out_value);
 }
 
 void GCodeParser::add_segment(const glm::vec3& start, const glm::vec3& end, bool is_extrusion,
@@ -702,19 +1010,30 @@ void GCodeParser::add_segment(const glm::vec3& start, const glm::vec3& end, bool
         start_new_layer(start.z);
     }
 
+    // For bounding box: skip start position if this is the first segment ever
+    // (avoids including implicit (0,0,0) starting position in print bounds)
+    bool is_first_segment = (layers_started_ == 1 && !has_segments_);
+    has_segments_ = true;
+
+    if (state_only_) {
+        return;
+    }
+
     ToolpathSegment segment;
     segment.start = start;
     segment.end = end;
     segment.is_extrusion = is_extrusion;
-    segment.object_name = current_object_;
     segment.extrusion_amount = e_delta;
 
     // Multi-color support: Tag segment with current tool
-    segment.tool_index = current_tool_index_;
+    segment.tool_index = static_cast<uint8_t>(std::clamp(current_tool_index_, 0, 255));
 
     // Wipe tower support: Tag wipe tower segments with special object name
     if (in_wipe_tower_) {
-        segment.object_name = "__WIPE_TOWER__";
+        segment.object_id = object_names_->intern(WIPE_TOWER_OBJECT_NAME);
+    } else {
+        segment.object_id = current_object_id_;
+        segment.is_support = current_object_is_support_;
     }
 
     // Calculate actual extrusion width from E-delta and XY distance
@@ -753,11 +1072,7 @@ void GCodeParser::add_segment(const glm::vec3& start, const glm::vec3& end, bool
 
     // Update layer data
     Layer& current_layer = layers_.back();
-    current_layer.segments.push_back(segment);
-
-    // For bounding box: skip start position if this is the first segment ever
-    // (avoids including implicit (0,0,0) starting position in print bounds)
-    bool is_first_segment = (layers_.size() == 1 && current_layer.segments.size() == 1);
+    current_layer.segments.push_back(std::move(segment));
 
     if (!is_first_segment) {
         current_layer.bounding_box.expand(start);
@@ -773,18 +1088,22 @@ void GCodeParser::add_segment(const glm::vec3& start, const glm::vec3& end, bool
     }
 
     // Update object bounding box (only for extrusion moves, not travels)
-    if (!current_object_.empty() && objects_.count(current_object_) > 0 && is_extrusion) {
-        objects_[current_object_].bounding_box.expand(start);
-        objects_[current_object_].bounding_box.expand(end);
-
-        // Debug: Log first few extrusion segments per object
-        static std::map<std::string, int> segment_counts;
-        segment_counts[current_object_]++;
-        if (segment_counts[current_object_] <= 3) {
-            spdlog::trace(
-                "[GCode Parser] Object '{}' extrusion segment: start=({:.2f},{:.2f},{:.2f}) "
-                "end=({:.2f},{:.2f},{:.2f})",
-                current_object_, start.x, start.y, start.z, end.x, end.y, end.z);
+    if (is_extrusion && !current_object_.empty()) {
+        auto obj_it = objects_.find(current_object_);
+        if (obj_it != objects_.end()) {
+            obj_it->second.bounding_box.expand(start);
+            obj_it->second.bounding_box.expand(end);
+
+            // Debug: Log first few extrusion segments per object (map only touched when tracing)
+            if (spdlog::should_log(spdlog::level::trace)) {
+                static std::map<std::string, int> segment_counts;
+                if (++segment_counts[current_object_] <= 3) {
+                    spdlog::trace(
+                        "[GCode Parser] Object '{}' extrusion segment: "
+                        "start=({:.2f},{:.2f},{:.2f}) end=({:.2f},{:.2f},{:.2f})",
+                        current_object_, start.x, start.y, start.z, end.x, end.y, end.z);
+                }
+            }
         }
     }
 }
@@ -794,6 +1113,13 @@ void GCodeParser::start_new_layer(float z) {
     if (!layers_.empty() && std::abs(layers_.back().z_height - z) < 0.001f) {
         return;
     }
+    layers_started_++;
+
+    // State-only mode keeps just the layer in progress
+    if (state_only_ && !layers_.empty()) {
+        layers_.back().z_height = z;
+        return;
+    }
 
     Layer layer;
     layer.z_height = z;
@@ -802,32 +1128,227 @@ void GCodeParser::start_new_layer(float z) {
     spdlog::trace("[GCode Parser] Started layer {} at Z={:.3f}", layers_.size() - 1, z);
 }
 
-std::string GCodeParser::trim_line(const std::string& line) {
-    if (line.empty()) {
-        return line;
+ParserStateSnapshot GCodeParser::snapshot_state() const {
+    ParserStateSnapshot state;
+    state.position = current_position_;
+    state.e = current_e_;
+    state.object_id = current_object_id_;
+    state.tool_index = static_cast<uint8_t>(std::clamp(current_tool_index_, 0, 255));
+
+    uint8_t flags = 0;
+    if (is_absolute_positioning_) {
+        flags |= ParserStateSnapshot::ABSOLUTE_POSITIONING;
+    }
+    if (is_absolute_extrusion_) {
+        flags |= ParserStateSnapshot::ABSOLUTE_EXTRUSION;
+    }
+    if (in_wipe_tower_) {
+        flags |= ParserStateSnapshot::IN_WIPE_TOWER;
+    }
+    if (use_layer_markers_) {
+        flags |= ParserStateSnapshot::USE_LAYER_MARKERS;
+    }
+    if (pending_layer_marker_) {
+        flags |= ParserStateSnapshot::PENDING_LAYER_MARKER;
+    }
+    if (!layers_.empty()) {
+        flags |= ParserStateSnapshot::HAS_LAYER;
+        state.layer_z = layers_.back().z_height;
+    }
+    if (layers_started_ > 1) {
+        flags |= ParserStateSnapshot::MULTIPLE_LAYERS;
+    }
+    if (has_segments_) {
+        flags |= ParserStateSnapshot::HAS_SEGMENTS;
+    }
+    state.flags = flags;
+
+    return state;
+}
+
+void GCodeParser::restore_state(const ParserStateSnapshot& state) {
+    current_position_ = state.position;
+    current_e_ = state.e;
+
+    const std::string& object_name = object_names_->name(state.object_id);
+    current_object_ = object_name;
+    current_object_id_ = state.object_id;
+    current_object_is_support_ = is_support_object_name(object_name);
+    current_tool_index_ = state.tool_index;
+
+    is_absolute_positioning_ = state.has(ParserStateSnapshot::ABSOLUTE_POSITIONING);
+    is_absolute_extrusion_ = state.has(ParserStateSnapshot::ABSOLUTE_EXTRUSION);
+    in_wipe_tower_ = state.has(ParserStateSnapshot::IN_WIPE_TOWER);
+    use_layer_markers_ = state.has(ParserStateSnapshot::USE_LAYER_MARKERS);
+    pending_layer_marker_ = state.has(ParserStateSnapshot::PENDING_LAYER_MARKER);
+    has_segments_ = state.has(ParserStateSnapshot::HAS_SEGMENTS);
+
+    layers_.clear();
+    layers_started_ = 0;
+    if (state.has(ParserStateSnapshot::HAS_LAYER)) {
+        // Continuation of the layer in progress at the snapshot point
+        Layer layer;
+        layer.z_height = state.layer_z;
+        layers_.push_back(layer);
+        layers_started_ = state.has(ParserStateSnapshot::MULTIPLE_LAYERS) ? 2 : 1;
     }
+}
 
-    // Remove comments (everything after ';')
+void GCodeParser::declare_objects(const std::vector<ObjectId>& ids) {
+    for (ObjectId id : ids) {
+        const std::string& name = object_names_->name(id);
+        if (objects_.find(name) != objects_.end()) {
+            continue;
+        }
+        GCodeObject obj;
+        obj.name = name;
+        objects_.emplace(name, std::move(obj));
+        defined_objects_.push_back(id);
+    }
+}
+
+// ============================================================================
+// GCodeStateTracker Implementation
+// ============================================================================
+
+GCodeStateTracker::GCodeStateTracker(std::shared_ptr<ObjectNameTable> object_names)
+    : object_names_(std::move(object_names)) {}
+
+void GCodeStateTracker::parse_line(std::string_view line) {
+    // Mirrors GCodeParser::parse_line() for the commands that change snapshot state
     size_t comment_pos = line.find(';');
-    std::string without_comment =
-        (comment_pos != std::string::npos) ? line.substr(0, comment_pos) : line;
+    if (comment_pos != std::string_view::npos) {
+        parse_comment(line.substr(comment_pos));
+        line = line.substr(0, comment_pos);
+    }
 
-    // Trim leading/trailing whitespace
-    size_t start = 0;
-    while (start < without_comment.length() && std::isspace(without_comment[start])) {
-        start++;
+    std::string_view trimmed = trim_view(line);
+    if (trimmed.empty()) {
+        return;
     }
 
-    if (start == without_comment.length()) {
-        return "";
+    switch (trimmed[0]) {
+    case 'G':
+        if (is_move_command(trimmed)) {
+            parse_move(trimmed);
+        } else if (trimmed == "G90" || trimmed == "G91") {
+            set_flag(ParserStateSnapshot::ABSOLUTE_POSITIONING, trimmed[2] == '0');
+        } else if (is_command_word(trimmed, "G92")) {
+            apply_set_position(scan_axis_words(trimmed), state_.position, state_.e);
+        }
+        break;
+    case 'M':
+        if (trimmed == "M82" || trimmed == "M83") {
+            set_flag(ParserStateSnapshot::ABSOLUTE_EXTRUSION, trimmed[2] == '2');
+        }
+        break;
+    case 'T': {
+        int tool = 0;
+        if (parse_tool_word(trimmed, tool)) {
+            state_.tool_index = static_cast<uint8_t>(std::clamp(tool, 0, 255));
+        }
+        break;
+    }
+    case 'E':
+        if (starts_with(trimmed, "EXCLUDE_OBJECT")) {
+            parse_exclude_object(trimmed);
+        }
+        break;
+    default:
+        break;
     }
+}
 
-    size_t end = without_comment.length();
-    while (end > start && std::isspace(without_comment[end - 1])) {
-        end--;
+void GCodeStateTracker::parse_comment(std::string_view comment) {
+    if (is_layer_change_comment(comment)) {
+        set_flag(ParserStateSnapshot::USE_LAYER_MARKERS, true);
+        set_flag(ParserStateSnapshot::PENDING_LAYER_MARKER, true);
+    }
+    int wipe_tower = wipe_tower_marker(comment);
+    if (wipe_tower != 0) {
+        set_flag(ParserStateSnapshot::IN_WIPE_TOWER, wipe_tower > 0);
+    }
+}
+
+void GCodeStateTracker::parse_move(std::string_view line) {
+    AxisWords words = scan_axis_words(line);
+    bool absolute = state_.has(ParserStateSnapshot::ABSOLUTE_POSITIONING);
+    glm::vec3 next = state_.position;
+
+    if (words.has_x) {
+        next.x = absolute ? words.x : state_.position.x + words.x;
+    }
+    if (words.has_y) {
+        next.y = absolute ? words.y : state_.position.y + words.y;
+    }
+    if (words.has_z) {
+        next.z = absolute ? words.z : state_.position.z + words.z;
+        if (std::abs(next.z - state_.position.z) > 0.001f) {
+            if (!state_.has(ParserStateSnapshot::USE_LAYER_MARKERS)) {
+                start_layer(next.z);
+            } else if (state_.has(ParserStateSnapshot::PENDING_LAYER_MARKER)) {
+                start_layer(next.z);
+                set_flag(ParserStateSnapshot::PENDING_LAYER_MARKER, false);
+            }
+        }
+    }
+    if (words.has_e) {
+        state_.e = state_.has(ParserStateSnapshot::ABSOLUTE_EXTRUSION) ? words.e
+                                                                      : state_.e + words.e;
+    }
+
+    // Where GCodeParser emits a segment; the first one opens a layer at the start height
+    bool moved = words.has_x || words.has_y || words.has_z;
+    if (moved && (next.x != state_.position.x || next.y != state_.position.y)) {
+        if (!state_.has(ParserStateSnapshot::HAS_LAYER)) {
+            start_layer(state_.position.z);
+        }
+        set_flag(ParserStateSnapshot::HAS_SEGMENTS, true);
+    }
+    state_.position = next;
+}
+
+void GCodeStateTracker::parse_exclude_object(std::string_view line) {
+    std::string_view name;
+    if (starts_with(line, "EXCLUDE_OBJECT_DEFINE")) {
+        if (find_string_param(line, "NAME", name)) {
+            ObjectId id = object_names_->intern(name);
+            if (std::find(defined_objects_.begin(), defined_objects_.end(), id) ==
+                defined_objects_.end()) {
+                defined_objects_.push_back(id);
+            }
+        }
+    } else if (starts_with(line, "EXCLUDE_OBJECT_START")) {
+        if (find_string_param(line, "NAME", name)) {
+            current_object_.assign(name.data(), name.size());
+            state_.object_id = object_names_->intern(name);
+        } else {
+            current_object_.clear();
+            state_.object_id = NO_OBJECT_ID;
+        }
+    } else if (starts_with(line, "EXCLUDE_OBJECT_END")) {
+        if (find_string_param(line, "NAME", name) && name == current_object_) {
+            current_object_.clear();
+            state_.object_id = NO_OBJECT_ID;
+        }
     }
+}
+
+void GCodeStateTracker::start_layer(float z) {
+    // Same duplicate-Z rule as GCodeParser::start_new_layer()
+    if (state_.has(ParserStateSnapshot::HAS_LAYER)) {
+        if (std::abs(state_.layer_z - z) < 0.001f) {
+            return;
+        }
+        set_flag(ParserStateSnapshot::MULTIPLE_LAYERS, true);
+    }
+    set_flag(ParserStateSnapshot::HAS_LAYER, true);
+    state_.layer_z = z;
+}
 
-    return without_comment.substr(start, end - start);
+std::string_view GCodeParser::trim_line(std::string_view line) {
+    // Remove comments (everything after ';') and surrounding whitespace
+    return strip_comment(line);
 }
 
 ParsedGCodeFile GCodeParser::finalize() {
@@ -835,6 +1356,7 @@ ParsedGCodeFile GCodeParser::finalize() {
     result.filename = "";
     result.layers = std::move(layers_);
     result.objects = std::move(objects_);
+    result.object_names = object_names_;
     result.global_bounding_box = global_bounds_;
 
     // Calculate statistics
@@ -863,8 +1385,10 @@ ParsedGCodeFile GCodeParser::finalize() {
     // Transfer multi-color tool palette
     result.tool_color_palette = tool_color_palette_;
 
-    spdlog::info("[GCode Parser] Parsed G-code: {} layers, {} segments, {} objects",
-                 result.layers.size(), result.total_segments, result.objects.size());
+    // State-only passes (layer indexing) and per-layer parses would flood the log
+    spdlog::log(state_only_ || shared_object_names_ ? spdlog::level::debug : spdlog::level::info,
+                "[GCode Parser] Parsed G-code: {} layers, {} segments, {} objects",
+                result.layers.size(), result.total_segments, result.objects.size());
 
     // Log warning summary if any out-of-range width calculations occurred
     if (out_of_range_width_count_ > 0) {
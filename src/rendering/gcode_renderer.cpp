@@ -131,6 +131,19 @@ void GCodeRenderer::render(lv_layer_t* layer, const ParsedGCodeFile& gcode,
     segments_rendered_ = 0;
     segments_culled_ = 0;
 
+    // Resolve highlight/exclude names to ids for this file's name table
+    if (gcode.object_names) {
+        std::unordered_set<std::string> highlighted = options_.highlighted_objects;
+        if (!options_.highlighted_object.empty()) {
+            highlighted.insert(options_.highlighted_object);
+        }
+        highlighted_ids_.assign(highlighted, *gcode.object_names);
+        excluded_ids_.assign(options_.excluded_objects, *gcode.object_names);
+    } else {
+        highlighted_ids_.clear();
+        excluded_ids_.clear();
+    }
+
     // Get view-projection matrix
     glm::mat4 transform = camera.get_view_projection_matrix();
 
@@ -344,12 +357,8 @@ lv_draw_line_dsc_t GCodeRenderer::get_line_style(const ToolpathSegment& segment,
 
     // Determine line width and base opacity
     // Check both legacy single-object and multi-select highlighting
-    bool is_highlighted = !segment.object_name.empty() &&
-                          (options_.highlighted_objects.count(segment.object_name) > 0 ||
-                           (!options_.highlighted_object.empty() &&
-                            segment.object_name == options_.highlighted_object));
-    bool is_excluded =
-        !segment.object_name.empty() && options_.excluded_objects.count(segment.object_name) > 0;
+    bool is_highlighted = highlighted_ids_.contains(segment.object_id);
+    bool is_excluded = excluded_ids_.contains(segment.object_id);
 
     lv_opa_t base_opa;
     int line_width;
@@ -469,7 +478,7 @@ std::optional<std::string> GCodeRenderer::pick_object(const glm::vec2& screen_po
                                                       const ParsedGCodeFile& gcode,
                                                       const GCodeCamera& camera) const {
     // Segment-based picking: find closest rendered segment to click point
-    // This works even without EXCLUDE_OBJECT metadata by checking segment.object_name
+    // This works even without EXCLUDE_OBJECT metadata by checking segment.object_id
 
     glm::mat4 transform = camera.get_view_projection_matrix();
     float closest_distance = std::numeric_limits<float>::max();
@@ -498,7 +507,7 @@ std::optional<std::string> GCodeRenderer::pick_object(const glm::vec2& screen_po
             }
 
             // Skip segments without object names
-            if (segment.object_name.empty()) {
+            if (segment.object_id == NO_OBJECT_ID) {
                 continue;
             }
 
@@ -530,7 +539,7 @@ std::optional<std::string> GCodeRenderer::pick_object(const glm::vec2& screen_po
             // Update if this is the closest segment within threshold
             if (dist < PICK_THRESHOLD && dist < closest_distance) {
                 closest_distance = dist;
-                picked_object = segment.object_name;
+                picked_object = gcode.object_name(segment);
             }
         }
     }
@@ -0,0 +1,234 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_stream_modifier.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+size_t last_line_of(const Modification& mod) {
+    return std::max(mod.line_number, mod.end_line_number);
+}
+
+bool replaces_line(ModificationType type) {
+    return type == ModificationType::COMMENT_OUT || type == ModificationType::DELETE ||
+           type == ModificationType::REPLACE;
+}
+
+} // namespace
+
+GCodeStreamModifier::GCodeStreamModifier(std::vector<Modification> modifications)
+    : modifications_(std::move(modifications)) {
+    std::stable_sort(
+        modifications_.begin(), modifications_.end(),
+        [](const Modification& a, const Modification& b) { return a.line_number < b.line_number; });
+
+    for (const auto& mod : modifications_) {
+        if (mod.line_number == 0) {
+            spdlog::warn("[GCodeStreamModifier] Ignoring modification at line 0 (lines are "
+                         "1-indexed)");
+            continue;
+        }
+        passthrough_line_ = std::max(passthrough_line_, last_line_of(mod));
+    }
+    passthrough_ = passthrough_line_ == 0;
+    out_.reserve(OUTPUT_CHUNK_SIZE);
+}
+
+bool GCodeStreamModifier::feed(const char* data, size_t size, const Sink& sink) {
+    if (failed_) {
+        return false;
+    }
+    result_.original_size += size;
+
+    const char* end = data + size;
+    while (data < end && !passthrough_) {
+        const char* nl = static_cast<const char*>(std::memchr(data, '\n', end - data));
+        if (!nl) {
+            if (carry_.size() + static_cast<size_t>(end - data) > MAX_LINE_LENGTH) {
+                return fail("Line " + std::to_string(line_number_ + 1) + " is longer than " +
+                            std::to_string(MAX_LINE_LENGTH) + " bytes");
+            }
+            carry_.append(data, end);
+            return true;
+        }
+
+        std::string_view line(data, static_cast<size_t>(nl - data));
+        if (!carry_.empty()) {
+            carry_.append(data, nl);
+            line = carry_;
+        }
+        data = nl + 1;
+
+        bool crlf = !line.empty() && line.back() == '\r';
+        if (crlf) {
+            line.remove_suffix(1);
+        }
+        process_line(line, crlf ? "\r\n" : "\n");
+        carry_.clear();
+
+        if (out_.size() >= OUTPUT_CHUNK_SIZE && !flush(sink)) {
+            return false;
+        }
+    }
+
+    if (data < end) {
+        // Past the last modification: forward the rest of the chunk without splitting it
+        if (!flush(sink)) {
+            return false;
+        }
+        size_t rest = static_cast<size_t>(end - data);
+        result_.modified_size += rest;
+        if (!sink(data, rest)) {
+            return fail("Output stream aborted");
+        }
+    }
+    return true;
+}
+
+bool GCodeStreamModifier::finish(const Sink& sink) {
+    if (failed_) {
+        return false;
+    }
+
+    if (!carry_.empty()) {
+        // Final line without a newline; keep it that way
+        std::string line = std::move(carry_);
+        carry_.clear();
+        process_line(line, "");
+    }
+
+    if (!passthrough_) {
+        spdlog::warn("[GCodeStreamModifier] Line {} out of range (file has {} lines)",
+                     passthrough_line_, line_number_);
+    }
+
+    if (!flush(sink)) {
+        return false;
+    }
+    result_.success = true;
+    return true;
+}
+
+void GCodeStreamModifier::process_line(std::string_view line, std::string_view eol) {
+    ++line_number_;
+
+    while (next_mod_ < modifications_.size() &&
+           modifications_[next_mod_].line_number <= line_number_) {
+        const Modification& mod = modifications_[next_mod_++];
+        if (mod.line_number != 0) {
+            active_.push_back(&mod);
+        }
+    }
+    active_.erase(std::remove_if(active_.begin(), active_.end(),
+                                 [this](const Modification* mod) {
+                                     return last_line_of(*mod) < line_number_;
+                                 }),
+                  active_.end());
+
+    // Lines written in place of this one are separated by its own line ending
+    std::string_view separator = eol.empty() ? std::string_view("\n") : eol;
+    bool wrote = false;
+
+    const Modification* body = nullptr;
+    for (const Modification* mod : active_) {
+        if (mod->type == ModificationType::INJECT_BEFORE && mod->line_number == line_number_) {
+            result_.lines_added += put_lines(mod->gcode, separator, wrote);
+        } else if (!body && replaces_line(mod->type)) {
+            body = mod;
+        }
+    }
+
+    if (!body) {
+        put_line(line, separator, wrote);
+    } else {
+        switch (body->type) {
+        case ModificationType::COMMENT_OUT:
+            if (!line.empty() && line[0] == ';') {
+                put_line(line, separator, wrote); // Already a comment
+            } else {
+                put_line(GCodeFileModifier::comment_out_line(std::string(line), body->comment),
+                         separator, wrote);
+                result_.lines_modified++;
+            }
+            break;
+        case ModificationType::DELETE:
+            result_.lines_removed++;
+            break;
+        case ModificationType::REPLACE:
+            result_.lines_removed++;
+            if (body->line_number == line_number_) {
+                result_.lines_added += put_lines(body->gcode, separator, wrote);
+                result_.lines_modified++;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    for (const Modification* mod : active_) {
+        if (mod->type == ModificationType::INJECT_AFTER && mod->line_number == line_number_) {
+            result_.lines_added += put_lines(mod->gcode, separator, wrote);
+        }
+    }
+
+    if (wrote) {
+        out_.append(eol.data(), eol.size());
+    }
+    if (line_number_ == passthrough_line_) {
+        passthrough_ = true;
+    }
+}
+
+void GCodeStreamModifier::put_line(std::string_view text, std::string_view separator,
+                                   bool& wrote) {
+    if (wrote) {
+        out_.append(separator.data(), separator.size());
+    }
+    out_.append(text.data(), text.size());
+    wrote = true;
+}
+
+size_t GCodeStreamModifier::put_lines(std::string_view gcode, std::string_view separator,
+                                      bool& wrote) {
+    // Same splitting as std::getline: no empty line after a trailing '\n'
+    size_t count = 0;
+    size_t pos = 0;
+    while (pos < gcode.size()) {
+        size_t nl = gcode.find('\n', pos);
+        size_t len = (nl == std::string_view::npos ? gcode.size() : nl) - pos;
+        put_line(gcode.substr(pos, len), separator, wrote);
+        ++count;
+        pos += len + 1;
+    }
+    return count;
+}
+
+bool GCodeStreamModifier::flush(const Sink& sink) {
+    if (out_.empty()) {
+        return true;
+    }
+    result_.modified_size += out_.size();
+    bool ok = sink(out_.data(), out_.size());
+    out_.clear();
+    return ok || fail("Output stream aborted");
+}
+
+bool GCodeStreamModifier::fail(const std::string& message) {
+    failed_ = true;
+    result_.success = false;
+    result_.error_message = message;
+    spdlog::error("[GCodeStreamModifier] {}", message);
+    return false;
+}
+
+} // namespace gcode
+} // namespace helix
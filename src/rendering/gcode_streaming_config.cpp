@@ -121,6 +121,14 @@ bool should_use_gcode_streaming(size_t file_size_bytes) {
     return false; // Unreachable, but satisfies compiler
 }
 
+bool is_gcode_toolpath_cache_enabled() {
+    Config* config = Config::get_instance();
+    if (config != nullptr) {
+        return config->get<bool>("/gcode_viewer/toolpath_cache", true);
+    }
+    return true;
+}
+
 std::string get_streaming_config_description() {
     GCodeStreamingMode mode = get_gcode_streaming_mode();
     std::string mode_str;
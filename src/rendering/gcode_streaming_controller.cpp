@@ -3,13 +3,14 @@
 
 #include "gcode_streaming_controller.h"
 
+#include "gcode_parallel_parser.h"
 #include "memory_monitor.h"
 #include "memory_utils.h"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
-#include <sstream>
+#include <filesystem>
 #include <thread>
 
 namespace helix {
@@ -140,6 +141,16 @@ void BackgroundGhostBuilder::worker_thread() {
 // Static member initialization
 const LayerIndexStats GCodeStreamingController::empty_stats_{};
 
+namespace {
+
+// Leave one core for the UI thread
+size_t prefetch_concurrency() {
+    size_t workers = default_parse_worker_count();
+    return workers > 1 ? workers - 1 : 1;
+}
+
+} // namespace
+
 // =============================================================================
 // Construction / Destruction
 // =============================================================================
@@ -163,6 +174,7 @@ GCodeStreamingController::GCodeStreamingController()
     }
 
     cache_.set_memory_budget(budget);
+    cache_.set_prefetch_concurrency(prefetch_concurrency());
 
     // Enable adaptive mode on constrained/normal devices (not desktop)
     if (!mem.is_good_device()) {
@@ -177,6 +189,7 @@ GCodeStreamingController::GCodeStreamingController()
 
 GCodeStreamingController::GCodeStreamingController(size_t cache_budget_bytes)
     : cache_(std::max(cache_budget_bytes, MIN_CACHE_BUDGET)) {
+    cache_.set_prefetch_concurrency(prefetch_concurrency());
     spdlog::debug("[StreamingController] Created with {:.1f}MB cache budget",
                   static_cast<double>(cache_budget_bytes) / (1024 * 1024));
 }
@@ -191,6 +204,10 @@ GCodeStreamingController::~GCodeStreamingController() {
             // Ignore exceptions during shutdown
         }
     }
+
+    // The writer thread and prefetch loads call back into members destroyed before cache_
+    stop_toolpath_cache();
+    cache_.cancel_prefetch();
 }
 
 // =============================================================================
@@ -302,6 +319,13 @@ bool GCodeStreamingController::open_moonraker(const std::string& moonraker_url,
 
     data_source_ = std::move(source);
 
+    // A cached index makes the full download for indexing unnecessary; layers
+    // then come from range requests (or a lazy download if unsupported)
+    if (load_cached_index()) {
+        is_open_.store(true);
+        return true;
+    }
+
     // Ensure the source is ready for indexing (may download to temp file)
     if (!data_source_->ensure_indexable()) {
         spdlog::error("[StreamingController] Failed to prepare source for indexing");
@@ -355,8 +379,12 @@ void GCodeStreamingController::close() {
         index_complete_callback_ = nullptr;
     }
 
+    // Running prefetch loads and the toolpath writer still read the source released below
+    stop_toolpath_cache();
+    cache_.cancel_prefetch();
     cache_.clear();
     index_.clear();
+    index_from_cache_.store(false);
     data_source_.reset();
     is_open_.store(false);
 
@@ -364,6 +392,7 @@ void GCodeStreamingController::close() {
         std::lock_guard<std::mutex> lock(metadata_mutex_);
         metadata_extracted_ = false;
         header_metadata_.reset();
+        object_names_ = std::make_shared<ObjectNameTable>();
     }
 
     spdlog::debug("[StreamingController] Closed");
@@ -409,7 +438,7 @@ GCodeStreamingController::get_layer_segments(size_t layer_index) {
         return nullptr;
     }
 
-    // Trigger prefetch for nearby layers
+    // Queue nearby layers for background loading
     prefetch_around(layer_index, prefetch_radius_);
 
     // Return shared_ptr - data stays valid as long as caller holds the pointer
@@ -421,8 +450,9 @@ void GCodeStreamingController::request_layer(size_t layer_index) {
         return;
     }
 
-    // Just trigger the load (get_or_load handles caching)
-    cache_.get_or_load(layer_index, make_loader());
+    // Requested layer goes to the front of the background queue
+    cache_.prefetch_async(layer_index, prefetch_radius_, make_loader(),
+                          index_.get_layer_count() - 1);
 }
 
 bool GCodeStreamingController::is_layer_cached(size_t layer_index) const {
@@ -439,7 +469,12 @@ void GCodeStreamingController::prefetch_around(size_t center_layer, size_t radiu
         return; // Nothing to prefetch
     }
 
-    cache_.prefetch(center_layer, radius, make_loader(), layer_count - 1);
+    // Every layer resumes from its own index snapshot, so they load independently
+    cache_.prefetch_async(center_layer, radius, make_loader(), layer_count - 1);
+}
+
+void GCodeStreamingController::wait_for_prefetch() {
+    cache_.wait_for_prefetch();
 }
 
 // =============================================================================
@@ -458,6 +493,50 @@ int GCodeStreamingController::find_layer_at_z(float z) const {
     return index_.find_layer_at_z(z);
 }
 
+bool GCodeStreamingController::sample_bounds(AABB& bounds) {
+    const auto& stats = get_index_stats();
+    bounds.min.z = stats.min_z;
+    bounds.max.z = stats.max_z;
+
+    // Sample a few layers to compute X/Y bounds (first, middle, last)
+    size_t layer_count = get_layer_count();
+    std::vector<size_t> sample_layers;
+    if (layer_count > 0) {
+        sample_layers.push_back(0); // First layer
+        if (layer_count > 2) {
+            sample_layers.push_back(layer_count / 2); // Middle layer
+        }
+        if (layer_count > 1) {
+            sample_layers.push_back(layer_count - 1); // Last layer
+        }
+    }
+
+    AABB sampled;
+    for (size_t layer_idx : sample_layers) {
+        auto segments = get_layer_segments(layer_idx);
+        if (!segments) {
+            continue;
+        }
+        for (const auto& seg : *segments) {
+            sampled.expand(seg.start);
+            sampled.expand(seg.end);
+        }
+    }
+
+    bool found_bounds = sampled.min.x <= sampled.max.x;
+    if (found_bounds) {
+        bounds.min.x = sampled.min.x;
+        bounds.min.y = sampled.min.y;
+        bounds.max.x = sampled.max.x;
+        bounds.max.y = sampled.max.y;
+        spdlog::debug("[StreamingController] Sampled bounds X[{:.1f},{:.1f}] Y[{:.1f},{:.1f}] "
+                      "from {} layers",
+                      bounds.min.x, bounds.max.x, bounds.min.y, bounds.max.y,
+                      sample_layers.size());
+    }
+    return found_bounds;
+}
+
 const LayerIndexStats& GCodeStreamingController::get_index_stats() const {
     if (index_.is_valid()) {
         return index_.get_stats();
@@ -477,6 +556,10 @@ float GCodeStreamingController::get_cache_hit_rate() const {
     return cache_.hit_rate();
 }
 
+GCodeLayerCache::PrefetchStats GCodeStreamingController::get_prefetch_stats() const {
+    return cache_.prefetch_stats();
+}
+
 size_t GCodeStreamingController::get_cache_memory_usage() const {
     return cache_.memory_usage_bytes();
 }
@@ -517,6 +600,39 @@ const GCodeHeaderMetadata* GCodeStreamingController::get_header_metadata() const
     return header_metadata_.get();
 }
 
+void GCodeStreamingController::set_index_cache(std::shared_ptr<GCodeIndexCache> cache) {
+    index_cache_ = std::move(cache);
+}
+
+bool GCodeStreamingController::is_index_from_cache() const {
+    return index_from_cache_.load();
+}
+
+void GCodeStreamingController::set_toolpath_cache_dir(const std::string& directory,
+                                                      size_t max_bytes) {
+    toolpath_cache_dir_ = directory;
+    toolpath_cache_max_bytes_ = max_bytes;
+    if (!directory.empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(directory, ec);
+    }
+}
+
+bool GCodeStreamingController::is_toolpath_cache_ready() const {
+    return toolpath_reader() != nullptr;
+}
+
+void GCodeStreamingController::wait_for_toolpath_cache() {
+    if (toolpath_writer_.joinable()) {
+        toolpath_writer_.join();
+    }
+}
+
+std::shared_ptr<ObjectNameTable> GCodeStreamingController::get_object_names() const {
+    std::lock_guard<std::mutex> lock(metadata_mutex_);
+    return object_names_;
+}
+
 // =============================================================================
 // Private Implementation
 // =============================================================================
@@ -524,33 +640,62 @@ const GCodeHeaderMetadata* GCodeStreamingController::get_header_metadata() const
 std::vector<ToolpathSegment> GCodeStreamingController::load_layer(size_t layer_index) {
     std::vector<ToolpathSegment> segments;
 
+    // Pre-parsed layers decode straight into segments. The first layer still goes
+    // through the parser because header metadata is extracted from it.
+    auto reader = toolpath_reader();
+    bool need_metadata;
+    {
+        std::lock_guard<std::mutex> lock(metadata_mutex_);
+        need_metadata = !metadata_extracted_;
+    }
+    if (reader && !need_metadata) {
+        if (reader->read_layer(layer_index, segments)) {
+            spdlog::trace("[StreamingController] Loaded layer {} from toolpath cache ({} segments)",
+                          layer_index, segments.size());
+            return segments;
+        }
+        segments.clear(); // Corrupt blob: fall back to the G-code
+    }
+
+    parse_layer(layer_index, segments);
+    return segments;
+}
+
+bool GCodeStreamingController::parse_layer(size_t layer_index,
+                                           std::vector<ToolpathSegment>& segments) {
     if (!data_source_ || !index_.is_valid()) {
-        return segments;
+        return false;
     }
 
     auto entry = index_.get_entry(layer_index);
     if (!entry.is_valid()) {
         spdlog::warn("[StreamingController] Invalid index entry for layer {}", layer_index);
-        return segments;
+        return false;
     }
 
-    // Read layer bytes from source
-    auto bytes = data_source_->read_range(entry.file_offset, entry.byte_length);
-    if (bytes.empty()) {
+    // Parse straight from the mapped file when possible. Otherwise copy the bytes out;
+    // those sources seek, so reads are serialized while parsing runs in parallel.
+    std::string_view text = data_source_->view_range(entry.file_offset, entry.byte_length);
+    std::vector<char> bytes;
+    if (text.empty()) {
+        std::lock_guard<std::mutex> lock(source_mutex_);
+        bytes = data_source_->read_range(entry.file_offset, entry.byte_length);
+        text = std::string_view(bytes.data(), bytes.size());
+    }
+    if (text.empty()) {
         spdlog::warn("[StreamingController] Failed to read bytes for layer {} "
                      "(offset={}, length={})",
                      layer_index, entry.file_offset, entry.byte_length);
-        return segments;
+        return false;
     }
 
-    // Parse the bytes line by line
-    GCodeParser parser;
-    std::istringstream stream(std::string(bytes.begin(), bytes.end()));
-    std::string line;
-
-    while (std::getline(stream, line)) {
-        parser.parse_line(line);
-    }
+    // Parse the bytes line by line, interning object names into the file-wide table
+    // so ids stay comparable across independently parsed layers. Resuming from the
+    // index snapshot carries position, E mode, tool and active object across the
+    // layer boundary.
+    GCodeParser parser(get_object_names());
+    parser.restore_state(index_.get_start_state(layer_index));
+    parse_gcode_buffer(parser, text.data(), text.size());
 
     // Get parsed result
     auto result = parser.finalize();
@@ -577,9 +722,9 @@ std::vector<ToolpathSegment> GCodeStreamingController::load_layer(size_t layer_i
     }
 
     spdlog::debug("[StreamingController] Loaded layer {} ({} segments, {} bytes)", layer_index,
-                  segments.size(), bytes.size());
+                  segments.size(), text.size());
 
-    return segments;
+    return true;
 }
 
 bool GCodeStreamingController::build_index() {
@@ -590,10 +735,24 @@ bool GCodeStreamingController::build_index() {
     // Use the virtual method to get an indexable file path
     // This works for FileDataSource (returns original filepath) and
     // MoonrakerDataSource (returns temp file path after download)
+    if (load_cached_index()) {
+        return true;
+    }
+
     std::string file_path = data_source_->indexable_file_path();
 
     if (!file_path.empty()) {
-        return index_.build_from_file(file_path);
+        if (!index_.build_from_file(file_path, get_object_names())) {
+            return false;
+        }
+        std::string key = data_source_->cache_key();
+        if (index_cache_ && !key.empty()) {
+            index_cache_->store(key, index_);
+        }
+        // From here on layers are read in viewing order, not file order
+        data_source_->advise(GCodeDataSource::AccessPattern::Random);
+        start_toolpath_cache();
+        return true;
     }
 
     // Sources without file path (e.g., MemoryDataSource) cannot be indexed
@@ -602,6 +761,103 @@ bool GCodeStreamingController::build_index() {
     return false;
 }
 
+bool GCodeStreamingController::load_cached_index() {
+    index_from_cache_.store(false);
+    std::string key = data_source_->cache_key();
+    if (!index_cache_ || key.empty()) {
+        return false;
+    }
+    if (!index_cache_->load(key, data_source_->source_name(), index_, get_object_names())) {
+        return false;
+    }
+
+    index_from_cache_.store(true);
+    data_source_->advise(GCodeDataSource::AccessPattern::Random);
+    start_toolpath_cache();
+    return true;
+}
+
+void GCodeStreamingController::start_toolpath_cache() {
+    std::string key = data_source_->cache_key();
+    if (toolpath_cache_dir_.empty() || key.empty()) {
+        return;
+    }
+    std::string path = toolpath_cache_dir_ + "/" + cache_file_name(key, TOOLPATH_CACHE_EXTENSION);
+
+    auto reader = std::make_shared<ToolpathCacheReader>();
+    if (reader->open(path, key, get_object_names()) &&
+        reader->layer_count() == index_.get_layer_count()) {
+        std::lock_guard<std::mutex> lock(toolpath_mutex_);
+        toolpath_reader_ = std::move(reader);
+        spdlog::debug("[StreamingController] Using toolpath cache {}", path);
+        return;
+    }
+
+    toolpath_cancel_.store(false);
+    toolpath_writer_ =
+        std::thread(&GCodeStreamingController::write_toolpath_cache, this, path, key);
+}
+
+void GCodeStreamingController::stop_toolpath_cache() {
+    toolpath_cancel_.store(true);
+    if (toolpath_writer_.joinable()) {
+        toolpath_writer_.join();
+    }
+    std::lock_guard<std::mutex> lock(toolpath_mutex_);
+    toolpath_reader_.reset();
+}
+
+void GCodeStreamingController::write_toolpath_cache(const std::string& path,
+                                                    const std::string& key) {
+    auto start_time = std::chrono::steady_clock::now();
+
+    ToolpathCacheWriter writer;
+    if (!writer.open(path, key, get_object_names())) {
+        return;
+    }
+
+    std::vector<ToolpathSegment> segments;
+    size_t layer_count = index_.get_layer_count();
+    for (size_t i = 0; i < layer_count; ++i) {
+        if (toolpath_cancel_.load()) {
+            spdlog::debug("[StreamingController] Toolpath cache write cancelled at layer {}/{}", i,
+                          layer_count);
+            return; // Writer destructor discards the partial file
+        }
+        segments.clear();
+        if (!parse_layer(i, segments) || !writer.add_layer(segments)) {
+            spdlog::warn("[StreamingController] Toolpath cache write failed at layer {}", i);
+            return;
+        }
+        // Layer loads for the UI take priority over this background pass
+        std::this_thread::yield();
+    }
+    if (!writer.finish()) {
+        return;
+    }
+    evict_lru_cache_files(toolpath_cache_dir_, TOOLPATH_CACHE_EXTENSION,
+                          toolpath_cache_max_bytes_);
+
+    auto reader = std::make_shared<ToolpathCacheReader>();
+    if (!reader->open(path, key, get_object_names())) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(toolpath_mutex_);
+        toolpath_reader_ = std::move(reader);
+    }
+
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                             start_time);
+    spdlog::info("[StreamingController] Toolpath cache ready: {} layers in {:.0f}ms", layer_count,
+                 elapsed.count());
+}
+
+std::shared_ptr<const ToolpathCacheReader> GCodeStreamingController::toolpath_reader() const {
+    std::lock_guard<std::mutex> lock(toolpath_mutex_);
+    return toolpath_reader_;
+}
+
 std::function<std::vector<ToolpathSegment>(size_t)> GCodeStreamingController::make_loader() {
     return [this](size_t layer_index) { return load_layer(layer_index); };
 }
@@ -6,7 +6,9 @@
 #ifdef ENABLE_TINYGL_3D
 
 #include "config.h"
+#include "gcode_streaming_controller.h"
 #include "memory_monitor.h"
+#include "memory_utils.h"
 #include "runtime_config.h"
 
 #include <spdlog/spdlog.h>
@@ -14,6 +16,10 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 // TinyGL headers
 #include <GL/gl.h>
 extern "C" {
@@ -50,6 +56,7 @@ GCodeTinyGLRenderer::GCodeTinyGLRenderer()
 }
 
 GCodeTinyGLRenderer::~GCodeTinyGLRenderer() {
+    stop_streaming();
     shutdown_tinygl();
 
     if (draw_buf_) {
@@ -96,6 +103,7 @@ void GCodeTinyGLRenderer::set_interaction_mode(bool interacting) {
         // (3M triangles), not pixel fill. Resolution reduction hurts quality without
         // significantly improving frame rate.
         adaptive_layer_step_ = 1;
+        lod_budget_level_ = 1;           // First LOD level, as the single coarse LOD did
         smoothed_render_time_ms_ = 0.0f; // Reset EMA for fresh measurement
 
         spdlog::debug("[GCode::Renderer] Entering interaction mode: adaptive layer skip (start=1)");
@@ -166,7 +174,11 @@ void GCodeTinyGLRenderer::set_simplification_tolerance(float tolerance_mm) {
 }
 
 size_t GCodeTinyGLRenderer::get_memory_usage() const {
-    return geometry_ ? geometry_->memory_usage() : 0;
+    if (!geometry_) {
+        return 0;
+    }
+    return geometry_->memory_usage() +
+           (geometry_->draw_arrays ? geometry_->draw_arrays->memory_usage() : 0);
 }
 
 size_t GCodeTinyGLRenderer::get_triangle_count() const {
@@ -234,6 +246,22 @@ void GCodeTinyGLRenderer::init_tinygl() {
         glShadeModel(GL_PHONG);
     }
 
+    // Packed vertex arrays trade memory for per-vertex submission cost (0 MB = off)
+    int default_budget_mb = get_system_memory_info().is_constrained_device()
+                                ? CONSTRAINED_VERTEX_ARRAY_BUDGET_MB
+                                : DEFAULT_VERTEX_ARRAY_BUDGET_MB;
+    int budget_mb = cfg->get<int>("/gcode_viewer/vertex_array_budget_mb", default_budget_mb);
+    vertex_array_budget_bytes_ = static_cast<size_t>(std::max(budget_mb, 0)) * 1024 * 1024;
+
+    // Triangle fills split across screen tiles (0 = one per core up to 4, 1 = single-threaded)
+    int raster_threads = cfg->get<int>("/gcode_viewer/raster_threads", 0);
+    if (raster_threads <= 0) {
+        raster_threads = std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1,
+                                    MAX_AUTO_RASTER_THREADS);
+    }
+    glSetRasterThreads(raster_threads);
+    spdlog::debug("[GCode TinyGL] Rasterizing triangles on {} thread(s)", raster_threads);
+
     // Set material properties (use current specular settings)
     // GL_COLOR_MATERIAL only controls ambient/diffuse, so we must set specular separately
     GLfloat specular[] = {specular_intensity_, specular_intensity_, specular_intensity_, 1.0f};
@@ -570,8 +598,13 @@ void GCodeTinyGLRenderer::set_prebuilt_geometry(std::unique_ptr<RibbonGeometry>
     spdlog::info("[GCode::Renderer] set_prebuilt_geometry: incoming max_layer_index={}",
                  geometry->max_layer_index);
 
+    // A complete geometry replaces anything still streaming in
+    stop_streaming();
+    streaming_controller_ = nullptr;
+
     geometry_ = std::move(*geometry); // Move the value from unique_ptr into optional
     current_gcode_filename_ = filename;
+    lod_levels_.clear(); // Levels for this geometry follow via add_prebuilt_lod_level()
 
     // Invalidate cached framebuffer - new geometry requires full re-render
     framebuffer_valid_ = false;
@@ -585,23 +618,265 @@ void GCodeTinyGLRenderer::set_prebuilt_geometry(std::unique_ptr<RibbonGeometry>
 }
 
 void GCodeTinyGLRenderer::set_prebuilt_coarse_geometry(std::unique_ptr<RibbonGeometry> geometry) {
+    lod_levels_.clear();
     if (!geometry) {
-        coarse_geometry_.reset();
         spdlog::debug("[GCode::Renderer] Coarse LOD geometry cleared");
         return;
     }
+    add_prebuilt_lod_level(std::move(geometry));
+}
+
+void GCodeTinyGLRenderer::add_prebuilt_lod_level(std::unique_ptr<RibbonGeometry> geometry) {
+    if (!geometry) {
+        return;
+    }
 
     size_t coarse_tris = geometry->extrusion_triangle_count + geometry->travel_triangle_count;
     size_t full_tris =
         geometry_ ? geometry_->extrusion_triangle_count + geometry_->travel_triangle_count : 0;
     float reduction =
         full_tris > 0 ? 100.0f * (1.0f - float(coarse_tris) / float(full_tris)) : 0.0f;
+    float error_mm = geometry->lod_error_mm;
 
-    coarse_geometry_ = std::move(*geometry);
+    auto pos = std::upper_bound(
+        lod_levels_.begin(), lod_levels_.end(), error_mm,
+        [](float error, const RibbonGeometry& level) { return error < level.lod_error_mm; });
+    lod_levels_.insert(pos, std::move(*geometry));
 
-    spdlog::info(
-        "[GCode::Renderer] Coarse LOD geometry set: {} triangles ({:.0f}% reduction from full)",
-        coarse_tris, reduction);
+    spdlog::info("[GCode::Renderer] LOD level added: {} triangles ({:.0f}% reduction from full), "
+                 "error {:.2f}mm, {} level(s)",
+                 coarse_tris, reduction, error_mm, lod_levels_.size());
+}
+
+// ==============================================
+// Streaming (layer-by-layer geometry)
+// ==============================================
+
+void GCodeTinyGLRenderer::set_streaming_controller(GCodeStreamingController* controller) {
+    stop_streaming();
+    streaming_controller_ = controller;
+    current_gcode_filename_.clear(); // Next render() (re)builds from its source
+
+    if (controller) {
+        geometry_.reset();
+        lod_levels_.clear();
+        framebuffer_valid_ = false;
+    }
+}
+
+bool GCodeTinyGLRenderer::needs_more_frames() const {
+    if (streaming_active_.load()) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(streaming_mutex_);
+    return streamed_base_.has_value() || !streamed_pending_.empty();
+}
+
+float GCodeTinyGLRenderer::get_streaming_progress() const {
+    if (!streaming_controller_ || streaming_total_layers_ == 0) {
+        return 1.0f;
+    }
+    return std::min(1.0f, static_cast<float>(streamed_layer_count_.load()) /
+                              static_cast<float>(streaming_total_layers_));
+}
+
+void GCodeTinyGLRenderer::start_streaming() {
+    stop_streaming();
+
+    StreamingJob job;
+    job.controller = streaming_controller_;
+    job.layer_count = streaming_controller_->get_layer_count();
+    job.first_layer = static_cast<size_t>(std::max(layer_start_, 0));
+    job.end_layer = layer_end_ < 0 ? job.layer_count
+                                   : std::min(static_cast<size_t>(layer_end_) + 1, job.layer_count);
+    job.show_extrusions = show_extrusions_;
+    job.show_travels = show_travels_;
+    job.simplification = simplification_;
+
+    // Same settings as build_geometry(); per-file settings are read by the worker
+    job.builder = std::make_unique<GeometryBuilder>(*geometry_builder_);
+    job.builder->set_highlighted_objects(highlighted_objects_);
+
+    // 0 MB = no cap
+    int default_budget_mb = get_system_memory_info().is_constrained_device()
+                                ? CONSTRAINED_STREAMING_GEOMETRY_BUDGET_MB
+                                : DEFAULT_STREAMING_GEOMETRY_BUDGET_MB;
+    int budget_mb = Config::get_instance()->get<int>("/gcode_viewer/streaming_geometry_budget_mb",
+                                                     default_budget_mb);
+    job.budget_bytes = budget_mb > 0 ? static_cast<size_t>(budget_mb) * 1024 * 1024 : SIZE_MAX;
+
+    current_gcode_filename_ = streaming_controller_->get_source_name();
+    streaming_total_layers_ = job.end_layer > job.first_layer ? job.end_layer - job.first_layer : 0;
+    streamed_layer_count_.store(0);
+    streaming_truncated_.store(false);
+    streaming_cancel_.store(false);
+    streaming_active_.store(true);
+    last_streamed_append_ = {};
+
+    spdlog::info("[GCode TinyGL] Streaming geometry for {} ({} layers, budget {} MB)",
+                 current_gcode_filename_, streaming_total_layers_, budget_mb);
+
+    streaming_thread_ =
+        std::thread([this, job = std::move(job)]() mutable { streaming_worker(std::move(job)); });
+}
+
+void GCodeTinyGLRenderer::stop_streaming() {
+    streaming_cancel_.store(true);
+    streaming_cv_.notify_all();
+    if (streaming_thread_.joinable()) {
+        streaming_thread_.join();
+    }
+    streaming_active_.store(false);
+
+    std::lock_guard<std::mutex> lock(streaming_mutex_);
+    streamed_base_.reset();
+    streamed_pending_.clear();
+    streamed_pending_bytes_ = 0;
+}
+
+void GCodeTinyGLRenderer::streaming_worker(StreamingJob job) {
+    auto start = std::chrono::steady_clock::now();
+    GeometryBuilder& builder = *job.builder;
+    GCodeStreamingController& controller = *job.controller;
+
+    // Quantization needs the model extent before the first layer; sampling also
+    // parses the first layer, which fills in the header metadata
+    AABB bounds;
+    if (!controller.sample_bounds(bounds)) {
+        bounds.min = {0.0f, 0.0f, bounds.min.z};
+        bounds.max = {200.0f, 200.0f, bounds.max.z};
+    }
+
+    const auto& stats = controller.get_index_stats();
+    builder.set_filament_color(stats.filament_color.empty()
+                                   ? std::string(GeometryBuilder::DEFAULT_FILAMENT_COLOR)
+                                   : stats.filament_color);
+    float layer_height = 0.0f;
+    if (const GCodeHeaderMetadata* metadata = controller.get_header_metadata()) {
+        layer_height = static_cast<float>(metadata->layer_height);
+        if (!metadata->tool_colors.empty()) {
+            builder.set_tool_color_palette(metadata->tool_colors);
+        }
+    }
+    if (layer_height <= 0.0f && job.layer_count > 2) {
+        layer_height = controller.get_layer_z(2) - controller.get_layer_z(1);
+    }
+    if (layer_height > 0.0f) {
+        builder.set_layer_height(layer_height);
+    }
+
+    RibbonGeometry base =
+        builder.begin_layers(bounds, job.layer_count, controller.get_object_names().get());
+    {
+        std::lock_guard<std::mutex> lock(streaming_mutex_);
+        streamed_base_ = std::move(base);
+    }
+
+    // Past 3/4 of the budget, finish with the first LOD level's settings
+    const SimplificationOptions coarse = GeometryBuilder::lod_level_options(1);
+    const size_t coarse_threshold = job.budget_bytes / 4 * 3;
+    bool coarse_mode = false;
+    size_t built_bytes = 0;
+    size_t layers_built = 0;
+
+    std::vector<ToolpathSegment> filtered;
+    for (size_t l = job.first_layer; l < job.end_layer && !streaming_cancel_.load(); ++l) {
+        auto segments = controller.get_layer_segments(l);
+        if (!segments) {
+            streamed_layer_count_.store(l + 1 - job.first_layer);
+            continue;
+        }
+
+        const std::vector<ToolpathSegment>* layer_segments = segments.get();
+        if (!job.show_travels || !job.show_extrusions) {
+            filtered.clear();
+            for (const auto& segment : *segments) {
+                if (segment.is_extrusion ? job.show_extrusions : job.show_travels) {
+                    filtered.push_back(segment);
+                }
+            }
+            layer_segments = &filtered;
+        }
+
+        auto layer =
+            builder.build_layer(l, *layer_segments, coarse_mode ? coarse : job.simplification);
+        size_t bytes = layer.memory_usage();
+        if (built_bytes + bytes > job.budget_bytes) {
+            spdlog::warn("[GCode TinyGL] Streaming geometry budget ({} MB) reached - showing "
+                         "layers {}-{} of {}",
+                         job.budget_bytes / (1024 * 1024), job.first_layer, l - 1,
+                         job.layer_count);
+            streaming_truncated_.store(true);
+            break;
+        }
+        built_bytes += bytes;
+        if (!coarse_mode && built_bytes > coarse_threshold) {
+            coarse_mode = true;
+            spdlog::info("[GCode TinyGL] Streaming geometry at {:.1f} MB after layer {} - "
+                         "building remaining layers coarse",
+                         built_bytes / (1024.0 * 1024.0), l);
+        }
+
+        {
+            // Wait for the UI thread to take queued layers so they don't pile up
+            std::unique_lock<std::mutex> lock(streaming_mutex_);
+            streaming_cv_.wait(lock, [this] {
+                return streaming_cancel_.load() ||
+                       streamed_pending_bytes_ < MAX_PENDING_STREAMED_BYTES;
+            });
+            if (streaming_cancel_.load()) {
+                break;
+            }
+            streamed_pending_bytes_ += bytes;
+            streamed_pending_.push_back(std::move(layer));
+        }
+        ++layers_built;
+        streamed_layer_count_.store(l + 1 - job.first_layer);
+    }
+
+    streaming_active_.store(false);
+
+    auto elapsed_ms = std::chrono::duration<double, std::milli>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+    spdlog::info("[GCode TinyGL] Streamed {} layers, {:.1f} MB of geometry in {:.0f}ms{}",
+                 layers_built, built_bytes / (1024.0 * 1024.0), elapsed_ms,
+                 streaming_cancel_.load() ? " (cancelled)" : "");
+}
+
+bool GCodeTinyGLRenderer::append_streamed_layers() {
+    auto now = std::chrono::steady_clock::now();
+    if (streaming_active_.load() && geometry_ &&
+        now - last_streamed_append_ < STREAMING_REFRESH_INTERVAL) {
+        return false;
+    }
+
+    std::optional<RibbonGeometry> base;
+    std::vector<GeometryBuilder::LayerGeometry> layers;
+    {
+        std::lock_guard<std::mutex> lock(streaming_mutex_);
+        base.swap(streamed_base_);
+        layers.swap(streamed_pending_);
+        streamed_pending_bytes_ = 0;
+    }
+    streaming_cv_.notify_all();
+
+    if (base) {
+        geometry_ = std::move(*base);
+        lod_levels_.clear();
+    }
+    if (!geometry_ || layers.empty()) {
+        return base.has_value();
+    }
+
+    for (auto& layer : layers) {
+        GeometryBuilder::append_layer(*geometry_, std::move(layer));
+    }
+    last_streamed_append_ = now;
+
+    spdlog::trace("[GCode TinyGL] Appended {} streamed layers ({} strips total)", layers.size(),
+                  geometry_->strips.size());
+    return true;
 }
 
 void GCodeTinyGLRenderer::render_geometry(const GCodeCamera& camera) {
@@ -612,10 +887,12 @@ void GCodeTinyGLRenderer::render_geometry(const GCodeCamera& camera) {
     // LOD selection: use coarse geometry during interaction if available
     // This gives much better frame rates than runtime layer skipping (Phase 1)
     // because the coarse geometry has actual merged/simplified triangles
-    active_geometry_ = &(*geometry_);
-    if (interaction_mode_ && use_lod_for_interaction_ && coarse_geometry_.has_value()) {
-        active_geometry_ = &(*coarse_geometry_);
+    size_t lod_level = select_lod_level(camera);
+    if (lod_level != active_lod_level_) {
+        spdlog::debug("[GCode::Renderer] LOD level {} -> {}", active_lod_level_, lod_level);
+        active_lod_level_ = lod_level;
     }
+    active_geometry_ = lod_level == 0 ? &(*geometry_) : &lod_levels_[lod_level - 1];
 
     // Clear buffers
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -687,12 +964,61 @@ void GCodeTinyGLRenderer::render_geometry(const GCodeCamera& camera) {
     }
 }
 
+RibbonDrawArrays* GCodeTinyGLRenderer::ensure_draw_arrays(RibbonGeometry& geometry) {
+    // Streamed geometry grows after its arrays were built; only the new tail is converted
+    bool stale = geometry.draw_arrays &&
+                 geometry.draw_arrays->indices.size() <
+                     geometry.strips.size() * RibbonDrawArrays::INDICES_PER_STRIP;
+    if (geometry.draw_arrays && !stale) {
+        return geometry.draw_arrays.get();
+    }
+
+    size_t bytes =
+        RibbonDrawArrays::estimate_bytes(geometry.vertices.size(), geometry.strips.size());
+    if (bytes > vertex_array_budget_bytes_) {
+        geometry.draw_arrays.reset();
+        if (vertex_array_skipped_ != &geometry) {
+            spdlog::debug("[GCode TinyGL] Vertex arrays need {:.1f} MB (budget {} MB), using "
+                          "immediate mode",
+                          bytes / (1024.0 * 1024.0), vertex_array_budget_bytes_ / (1024 * 1024));
+            vertex_array_skipped_ = &geometry;
+        }
+        return nullptr;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    if (stale) {
+        extend_draw_arrays(*geometry.draw_arrays, geometry);
+    } else {
+        geometry.draw_arrays = std::make_unique<RibbonDrawArrays>(build_draw_arrays(geometry));
+    }
+    auto elapsed_ms = std::chrono::duration<double, std::milli>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+    spdlog::debug("[GCode TinyGL] Built vertex arrays: {} vertices, {} strips, {:.1f} MB in "
+                  "{:.1f}ms",
+                  geometry.vertices.size(), geometry.strips.size(),
+                  geometry.draw_arrays->memory_usage() / (1024.0 * 1024.0), elapsed_ms);
+    return geometry.draw_arrays.get();
+}
+
 void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, float dim_factor) {
     if (!active_geometry_ || active_geometry_->strips.empty()) {
         return;
     }
 
-    // Helper lambda to render a single strip with given dim factor
+    // Bulk path: one glDrawElements per contiguous strip range
+    RibbonDrawArrays* arrays = ensure_draw_arrays(*active_geometry_);
+    if (arrays) {
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_NORMAL_ARRAY);
+        glEnableClientState(GL_COLOR_ARRAY);
+        glVertexPointer(3, GL_FLOAT, 0, arrays->positions.data());
+        glNormalPointer(GL_FLOAT, 0, arrays->normals.data());
+        glColorPointer(4, GL_UNSIGNED_BYTE, 0, arrays->colors_for(dim_factor));
+    }
+
+    // Helper lambda to render a single strip with given dim factor (immediate mode)
     auto render_strip = [this, dim_factor](size_t strip_idx) {
         const auto& strip = active_geometry_->strips[strip_idx];
 
@@ -720,12 +1046,35 @@ void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, flo
         glEnd();
     };
 
+    // Draw strips [first, first + count) through whichever path is active
+    auto draw_strips = [&](size_t first, size_t count) {
+        if (count == 0) {
+            return;
+        }
+        if (arrays) {
+            constexpr size_t PER_STRIP = RibbonDrawArrays::INDICES_PER_STRIP;
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(count * PER_STRIP), GL_UNSIGNED_INT,
+                           arrays->indices.data() + first * PER_STRIP);
+            return;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            render_strip(first + i);
+        }
+    };
+
+    auto finish = [arrays]() {
+        if (arrays) {
+            glDisableClientState(GL_VERTEX_ARRAY);
+            glDisableClientState(GL_NORMAL_ARRAY);
+            glDisableClientState(GL_COLOR_ARRAY);
+        }
+    };
+
     // If we don't have layer tracking data, render all strips
     if (active_geometry_->strip_layer_index.empty()) {
         // Fallback: render all strips with the given dim factor
-        for (size_t i = 0; i < active_geometry_->strips.size(); ++i) {
-            render_strip(i);
-        }
+        draw_strips(0, active_geometry_->strips.size());
+        finish();
         return;
     }
 
@@ -738,10 +1087,10 @@ void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, flo
         int clamped_end = std::min(max_layer, end_layer);
 
         // Layer skipping (Phase 1) - only used if LOD geometry not available
-        // When coarse LOD geometry is active, skip layer skipping since the geometry
-        // is already simplified and we want to render all of it.
+        // When LOD levels exist, skip layer skipping since coarser levels already
+        // draw fewer, taller layers and we want to render all of it.
         int layer_step = 1;
-        if (interaction_mode_ && !coarse_geometry_.has_value()) {
+        if (interaction_mode_ && lod_levels_.empty()) {
             // Fallback: use adaptive layer skipping when no LOD available
             layer_step = adaptive_layer_step_;
         }
@@ -749,9 +1098,11 @@ void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, flo
         // Trace: show actual rendering configuration (every 30 frames to reduce spam)
         static int log_counter = 0;
         if (++log_counter % 30 == 1) {
-            spdlog::trace("[GCode::Render] LOD={}, layer_step={}, layers={}-{}, triangles={}",
-                          coarse_geometry_.has_value() ? "coarse" : "full", layer_step,
-                          clamped_start, clamped_end, active_geometry_->extrusion_triangle_count);
+            spdlog::trace(
+                "[GCode::Render] LOD={}, layer_step={}, layers={}-{}, triangles={}, path={}",
+                active_lod_level_, layer_step, clamped_start,
+                clamped_end, active_geometry_->extrusion_triangle_count,
+                arrays ? "arrays" : "immediate");
         }
 
         // Iterate through layers and render strips directly using pre-computed ranges
@@ -774,23 +1125,32 @@ void GCodeTinyGLRenderer::render_layer_range(int start_layer, int end_layer, flo
 
             auto [first_strip, strip_count] =
                 active_geometry_->layer_strip_ranges[static_cast<size_t>(layer)];
-            for (size_t i = 0; i < strip_count; ++i) {
-                render_strip(first_strip + i);
-            }
+            draw_strips(first_strip, strip_count);
         }
+        finish();
         return;
     }
 
-    // Fallback: O(N) scan through all strips (used if layer_strip_ranges not populated)
+    // Fallback: O(N) scan through all strips (used if layer_strip_ranges not populated),
+    // drawing each run of in-range strips at once
+    size_t run_start = 0;
+    size_t run_length = 0;
     for (size_t i = 0; i < active_geometry_->strips.size(); ++i) {
         // Check if this strip's layer is in range
         uint16_t strip_layer = active_geometry_->strip_layer_index[i];
         if (static_cast<int>(strip_layer) < start_layer ||
             static_cast<int>(strip_layer) > end_layer) {
-            continue; // Skip strips outside the layer range
+            draw_strips(run_start, run_length); // Skip strips outside the layer range
+            run_length = 0;
+            continue;
         }
-        render_strip(i);
+        if (run_length == 0) {
+            run_start = i;
+        }
+        ++run_length;
     }
+    draw_strips(run_start, run_length);
+    finish();
 }
 
 void GCodeTinyGLRenderer::draw_to_lvgl(lv_layer_t* layer, const lv_area_t* widget_coords) {
@@ -867,6 +1227,32 @@ void GCodeTinyGLRenderer::draw_to_lvgl(lv_layer_t* layer, const lv_area_t* widge
 
 void GCodeTinyGLRenderer::render(lv_layer_t* layer, const ParsedGCodeFile& gcode,
                                  const GCodeCamera& camera, const lv_area_t* widget_coords) {
+    // Build geometry if needed
+    build_geometry(gcode);
+
+    render_frame(layer, &gcode, camera, widget_coords);
+}
+
+void GCodeTinyGLRenderer::render(lv_layer_t* layer, const GCodeCamera& camera,
+                                 const lv_area_t* widget_coords) {
+    if (!streaming_controller_) {
+        return;
+    }
+
+    // Start over for a new file, or after a setting that changes the geometry
+    if (current_gcode_filename_ != streaming_controller_->get_source_name()) {
+        start_streaming();
+    }
+
+    if (append_streamed_layers()) {
+        framebuffer_valid_ = false;
+    }
+
+    render_frame(layer, nullptr, camera, widget_coords);
+}
+
+void GCodeTinyGLRenderer::render_frame(lv_layer_t* layer, const ParsedGCodeFile* gcode,
+                                       const GCodeCamera& camera, const lv_area_t* widget_coords) {
     // Initialize TinyGL if needed
     if (!zbuffer_) {
         init_tinygl();
@@ -875,9 +1261,6 @@ void GCodeTinyGLRenderer::render(lv_layer_t* layer, const ParsedGCodeFile& gcode
         }
     }
 
-    // Build geometry if needed
-    build_geometry(gcode);
-
     // Build current render state for dirty flag check
     CachedRenderState current_state;
     current_state.camera_azimuth = camera.get_azimuth();
@@ -910,10 +1293,16 @@ void GCodeTinyGLRenderer::render(lv_layer_t* layer, const ParsedGCodeFile& gcode
 
     auto t1 = std::chrono::high_resolution_clock::now();
 
-    // Render bounding box wireframe for highlighted objects
-    spdlog::trace("[GCode TinyGL] TinyGL render: {} highlighted objects, gcode.objects.size()={}",
-                  highlighted_objects_.size(), gcode.objects.size());
-    render_bounding_box(gcode);
+    // Render bounding box wireframe for highlighted objects (object bounds need the full file)
+    if (gcode) {
+        spdlog::trace(
+            "[GCode TinyGL] TinyGL render: {} highlighted objects, gcode.objects.size()={}",
+            highlighted_objects_.size(), gcode->objects.size());
+        render_bounding_box(*gcode);
+    }
+
+    // Wait for the raster threads before the framebuffer is read
+    glFinish();
 
     auto t2 = std::chrono::high_resolution_clock::now();
 
@@ -982,6 +1371,25 @@ void GCodeTinyGLRenderer::update_adaptive_optimization(float render_time_ms) {
                                    (1.0f - kSmoothingFactor) * smoothed_render_time_ms_;
     }
 
+    // With an LOD pyramid the budget picks a coarser level instead of skipping layers
+    if (!lod_levels_.empty()) {
+        size_t old_level = lod_budget_level_;
+        bool too_slow = smoothed_render_time_ms_ > kTargetFrameTimeMs;
+        if (too_slow && lod_budget_level_ < lod_levels_.size()) {
+            ++lod_budget_level_;
+        } else if (smoothed_render_time_ms_ < kMinFrameTimeMs && lod_budget_level_ > 1) {
+            --lod_budget_level_;
+        }
+        if (lod_budget_level_ != old_level) {
+            spdlog::debug("[GCode::Adaptive] {:.0f}ms smoothed, LOD budget level {} → {}",
+                          smoothed_render_time_ms_, old_level, lod_budget_level_);
+            smoothed_render_time_ms_ = 0.0f; // Measure the new level fresh
+        }
+        spdlog::trace("[GCode::Adaptive] render={:.1f}ms, smoothed={:.1f}ms, lod_budget={}",
+                      render_time_ms, smoothed_render_time_ms_, lod_budget_level_);
+        return;
+    }
+
     int old_step = adaptive_layer_step_;
 
     // Escalate optimization if too slow
@@ -1008,6 +1416,26 @@ void GCodeTinyGLRenderer::update_adaptive_optimization(float render_time_ms) {
                   render_time_ms, smoothed_render_time_ms_, adaptive_layer_step_);
 }
 
+size_t GCodeTinyGLRenderer::select_lod_level(const GCodeCamera& camera) const {
+    if (!interaction_mode_ || !use_lod_for_interaction_ || lod_levels_.empty()) {
+        return 0;
+    }
+
+    // Screen pixels per mm at the camera target: projection Y scale to NDC, NDC to pixels
+    // (perspective also divides by the view depth)
+    glm::mat4 projection = camera.get_projection_matrix();
+    float pixels_per_mm = projection[1][1] * 0.5f * static_cast<float>(viewport_height_);
+    if (projection[2][3] != 0.0f && camera.get_distance() > 0.0f) {
+        pixels_per_mm /= camera.get_distance();
+    }
+
+    size_t level = std::min(lod_budget_level_, lod_levels_.size());
+    while (level > 1 && lod_levels_[level - 1].lod_error_mm * pixels_per_mm > kMaxLodErrorPixels) {
+        --level;
+    }
+    return level;
+}
+
 // ==============================================
 // Rendering Options Implementation
 // ==============================================
@@ -1143,7 +1571,7 @@ std::optional<std::string> GCodeTinyGLRenderer::pick_object(const glm::vec2& scr
             }
 
             // Skip segments without object names
-            if (segment.object_name.empty()) {
+            if (segment.object_id == NO_OBJECT_ID) {
                 continue;
             }
 
@@ -1192,7 +1620,7 @@ std::optional<std::string> GCodeTinyGLRenderer::pick_object(const glm::vec2& scr
             // Update if this is the closest segment within threshold
             if (dist < PICK_THRESHOLD && dist < closest_distance) {
                 closest_distance = dist;
-                picked_object = segment.object_name;
+                picked_object = gcode.object_name(segment);
             }
         }
     }
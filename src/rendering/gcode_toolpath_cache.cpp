@@ -0,0 +1,483 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_toolpath_cache.h"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+// File layout:
+//   header    {magic, version, reserved u64}
+//   blobs     one encode_toolpath_layer() blob per layer, in layer order
+//   directory {key, object names 1..N, layer count, per layer {offset, size, checksum}}
+//   trailer   {directory offset u64, directory checksum u32, magic}
+// The directory is written last so layers can be streamed out without knowing their sizes.
+
+constexpr char MAGIC[4] = {'H', 'X', 'T', 'P'};
+constexpr size_t HEADER_SIZE = 16;
+constexpr size_t TRAILER_SIZE = 16;
+
+// Per-segment flag bits
+constexpr uint8_t SEG_EXTRUSION = 1 << 0;
+constexpr uint8_t SEG_SUPPORT = 1 << 1;
+constexpr uint8_t SEG_JUMP = 1 << 2;   ///< Start differs from the previous end
+constexpr uint8_t SEG_OBJECT = 1 << 3; ///< Object id changed
+constexpr uint8_t SEG_TOOL = 1 << 4;   ///< Tool changed
+constexpr uint8_t SEG_WIDTH = 1 << 5;  ///< Width changed
+constexpr uint8_t SEG_DZ = 1 << 6;     ///< End Z differs from start Z
+constexpr uint8_t SEG_E = 1 << 7;      ///< Non-zero extrusion amount
+
+uint32_t fnv1a(const uint8_t* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+int32_t quantize(float value, float units_per_mm) {
+    return static_cast<int32_t>(std::lround(value * units_per_mm));
+}
+
+float dequantize(int64_t value) {
+    return static_cast<float>(value) / TOOLPATH_POSITION_UNITS_PER_MM;
+}
+
+void put_uvarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void put_svarint(std::vector<uint8_t>& out, int64_t value) {
+    put_uvarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+template <typename T> void put(std::vector<uint8_t>& out, T value) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+void put_string(std::vector<uint8_t>& out, const std::string& value) {
+    put<uint32_t>(out, static_cast<uint32_t>(value.size()));
+    out.insert(out.end(), value.begin(), value.end());
+}
+
+// Bounds-checked reader; any overrun sets ok = false and yields zeros
+struct ByteReader {
+    const uint8_t* p;
+    const uint8_t* end;
+    bool ok{true};
+
+    uint64_t uvarint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (p >= end) {
+                ok = false;
+                return 0;
+            }
+            uint8_t byte = *p++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+        ok = false;
+        return 0;
+    }
+
+    int64_t svarint() {
+        uint64_t value = uvarint();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    template <typename T> T get() {
+        T value{};
+        if (static_cast<size_t>(end - p) < sizeof(T)) {
+            ok = false;
+            return value;
+        }
+        std::memcpy(&value, p, sizeof(T));
+        p += sizeof(T);
+        return value;
+    }
+
+    std::string get_string() {
+        uint32_t len = get<uint32_t>();
+        if (!ok || static_cast<size_t>(end - p) < len) {
+            ok = false;
+            return {};
+        }
+        std::string value(reinterpret_cast<const char*>(p), len);
+        p += len;
+        return value;
+    }
+};
+
+} // namespace
+
+// =============================================================================
+// Layer Codec
+// =============================================================================
+
+void encode_toolpath_layer(const std::vector<ToolpathSegment>& segments,
+                           std::vector<uint8_t>& out) {
+    put_uvarint(out, segments.size());
+
+    int32_t px = 0, py = 0, pz = 0;
+    ObjectId object = NO_OBJECT_ID;
+    uint8_t tool = 0;
+    int32_t width = 0;
+
+    for (const auto& seg : segments) {
+        int32_t sx = quantize(seg.start.x, TOOLPATH_POSITION_UNITS_PER_MM);
+        int32_t sy = quantize(seg.start.y, TOOLPATH_POSITION_UNITS_PER_MM);
+        int32_t sz = quantize(seg.start.z, TOOLPATH_POSITION_UNITS_PER_MM);
+        int32_t ex = quantize(seg.end.x, TOOLPATH_POSITION_UNITS_PER_MM);
+        int32_t ey = quantize(seg.end.y, TOOLPATH_POSITION_UNITS_PER_MM);
+        int32_t ez = quantize(seg.end.z, TOOLPATH_POSITION_UNITS_PER_MM);
+        int32_t e = quantize(seg.extrusion_amount, TOOLPATH_EXTRUSION_UNITS_PER_MM);
+        int32_t w = quantize(seg.width, TOOLPATH_WIDTH_UNITS_PER_MM);
+
+        uint8_t flags = 0;
+        flags |= seg.is_extrusion ? SEG_EXTRUSION : 0;
+        flags |= seg.is_support ? SEG_SUPPORT : 0;
+        flags |= (sx != px || sy != py || sz != pz) ? SEG_JUMP : 0;
+        flags |= seg.object_id != object ? SEG_OBJECT : 0;
+        flags |= seg.tool_index != tool ? SEG_TOOL : 0;
+        flags |= w != width ? SEG_WIDTH : 0;
+        flags |= ez != sz ? SEG_DZ : 0;
+        flags |= e != 0 ? SEG_E : 0;
+        out.push_back(flags);
+
+        if (flags & SEG_JUMP) {
+            put_svarint(out, static_cast<int64_t>(sx) - px);
+            put_svarint(out, static_cast<int64_t>(sy) - py);
+            put_svarint(out, static_cast<int64_t>(sz) - pz);
+        }
+        put_svarint(out, static_cast<int64_t>(ex) - sx);
+        put_svarint(out, static_cast<int64_t>(ey) - sy);
+        if (flags & SEG_DZ) {
+            put_svarint(out, static_cast<int64_t>(ez) - sz);
+        }
+        if (flags & SEG_E) {
+            put_svarint(out, e);
+        }
+        if (flags & SEG_WIDTH) {
+            put_svarint(out, w);
+            width = w;
+        }
+        if (flags & SEG_OBJECT) {
+            put_uvarint(out, seg.object_id);
+            object = seg.object_id;
+        }
+        if (flags & SEG_TOOL) {
+            out.push_back(seg.tool_index);
+            tool = seg.tool_index;
+        }
+
+        px = ex;
+        py = ey;
+        pz = ez;
+    }
+}
+
+bool decode_toolpath_layer(const uint8_t* data, size_t size,
+                           const std::vector<ObjectId>& object_remap,
+                           std::vector<ToolpathSegment>& out) {
+    ByteReader in{data, data + size};
+    out.clear();
+
+    // Every segment takes at least 3 bytes, which bounds a corrupt count
+    uint64_t count = in.uvarint();
+    if (!in.ok || count > size / 3) {
+        return false;
+    }
+    out.reserve(static_cast<size_t>(count));
+
+    int64_t px = 0, py = 0, pz = 0;
+    ObjectId object = NO_OBJECT_ID;
+    uint8_t tool = 0;
+    float width = 0.0f;
+
+    for (uint64_t i = 0; i < count; ++i) {
+        uint8_t flags = in.get<uint8_t>();
+        int64_t sx = px, sy = py, sz = pz;
+        if (flags & SEG_JUMP) {
+            sx += in.svarint();
+            sy += in.svarint();
+            sz += in.svarint();
+        }
+        int64_t ex = sx + in.svarint();
+        int64_t ey = sy + in.svarint();
+        int64_t ez = (flags & SEG_DZ) ? sz + in.svarint() : sz;
+
+        ToolpathSegment seg;
+        seg.start = {dequantize(sx), dequantize(sy), dequantize(sz)};
+        seg.end = {dequantize(ex), dequantize(ey), dequantize(ez)};
+        if (flags & SEG_E) {
+            seg.extrusion_amount =
+                static_cast<float>(in.svarint()) / TOOLPATH_EXTRUSION_UNITS_PER_MM;
+        }
+        if (flags & SEG_WIDTH) {
+            width = static_cast<float>(in.svarint()) / TOOLPATH_WIDTH_UNITS_PER_MM;
+        }
+        if (flags & SEG_OBJECT) {
+            uint64_t id = in.uvarint();
+            if (!object_remap.empty()) {
+                object = id < object_remap.size() ? object_remap[id] : NO_OBJECT_ID;
+            } else {
+                object = static_cast<ObjectId>(id);
+            }
+        }
+        if (flags & SEG_TOOL) {
+            tool = in.get<uint8_t>();
+        }
+        if (!in.ok) {
+            out.clear();
+            return false;
+        }
+
+        seg.width = width;
+        seg.object_id = object;
+        seg.tool_index = tool;
+        seg.is_extrusion = (flags & SEG_EXTRUSION) != 0;
+        seg.is_support = (flags & SEG_SUPPORT) != 0;
+        out.push_back(seg);
+
+        px = ex;
+        py = ey;
+        pz = ez;
+    }
+    return true;
+}
+
+// =============================================================================
+// ToolpathCacheWriter
+// =============================================================================
+
+ToolpathCacheWriter::~ToolpathCacheWriter() {
+    abort();
+}
+
+bool ToolpathCacheWriter::open(const std::string& path, const std::string& source_key,
+                               std::shared_ptr<ObjectNameTable> object_names) {
+    abort();
+
+    path_ = path;
+    tmp_path_ = path + ".tmp";
+    source_key_ = source_key;
+    object_names_ = std::move(object_names);
+    layers_.clear();
+    max_object_id_ = NO_OBJECT_ID;
+
+    file_ = std::fopen(tmp_path_.c_str(), "wb");
+    if (!file_) {
+        spdlog::warn("[ToolpathCache] Cannot create {}", tmp_path_);
+        return false;
+    }
+
+    std::vector<uint8_t> header(MAGIC, MAGIC + sizeof(MAGIC));
+    put<uint32_t>(header, TOOLPATH_CACHE_VERSION);
+    put<uint64_t>(header, 0);
+    if (std::fwrite(header.data(), 1, header.size(), file_) != header.size()) {
+        abort();
+        return false;
+    }
+    offset_ = HEADER_SIZE;
+    return true;
+}
+
+bool ToolpathCacheWriter::add_layer(const std::vector<ToolpathSegment>& segments) {
+    if (!file_) {
+        return false;
+    }
+
+    blob_.clear();
+    encode_toolpath_layer(segments, blob_);
+    if (std::fwrite(blob_.data(), 1, blob_.size(), file_) != blob_.size()) {
+        spdlog::warn("[ToolpathCache] Write failed for {}", tmp_path_);
+        abort();
+        return false;
+    }
+
+    for (const auto& seg : segments) {
+        max_object_id_ = std::max(max_object_id_, seg.object_id);
+    }
+    layers_.push_back({offset_, static_cast<uint32_t>(blob_.size()),
+                       fnv1a(blob_.data(), blob_.size())});
+    offset_ += blob_.size();
+    return true;
+}
+
+bool ToolpathCacheWriter::finish() {
+    if (!file_) {
+        return false;
+    }
+
+    std::vector<uint8_t> directory;
+    put_string(directory, source_key_);
+    put<uint32_t>(directory, max_object_id_);
+    for (ObjectId id = 1; id <= max_object_id_ && id != 0; ++id) {
+        put_string(directory, object_names_ ? object_names_->name(id) : std::string());
+    }
+    put<uint32_t>(directory, static_cast<uint32_t>(layers_.size()));
+    for (const auto& layer : layers_) {
+        put<uint64_t>(directory, layer.offset);
+        put<uint32_t>(directory, layer.size);
+        put<uint32_t>(directory, layer.checksum);
+    }
+
+    std::vector<uint8_t> trailer;
+    put<uint64_t>(trailer, offset_);
+    put<uint32_t>(trailer, fnv1a(directory.data(), directory.size()));
+    trailer.insert(trailer.end(), MAGIC, MAGIC + sizeof(MAGIC));
+
+    bool ok = std::fwrite(directory.data(), 1, directory.size(), file_) == directory.size() &&
+              std::fwrite(trailer.data(), 1, trailer.size(), file_) == trailer.size();
+    ok = (std::fclose(file_) == 0) && ok;
+    file_ = nullptr;
+    if (!ok || std::rename(tmp_path_.c_str(), path_.c_str()) != 0) {
+        spdlog::warn("[ToolpathCache] Failed to finish {}", path_);
+        std::remove(tmp_path_.c_str());
+        return false;
+    }
+
+    spdlog::info("[ToolpathCache] Wrote {} layers, {} KB to {}", layers_.size(),
+                 (offset_ + directory.size() + TRAILER_SIZE) / 1024, path_);
+    return true;
+}
+
+void ToolpathCacheWriter::abort() {
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+        std::remove(tmp_path_.c_str());
+    }
+}
+
+// =============================================================================
+// ToolpathCacheReader
+// =============================================================================
+
+bool ToolpathCacheReader::open(const std::string& path, const std::string& source_key,
+                               std::shared_ptr<ObjectNameTable> object_names) {
+    source_.reset();
+    layers_.clear();
+    object_remap_.clear();
+
+    auto source = std::make_unique<FileDataSource>(path);
+    uint64_t size = source->is_valid() ? source->file_size() : 0;
+    if (size < HEADER_SIZE + TRAILER_SIZE) {
+        return false;
+    }
+
+    std::vector<char> header = source->read_range(0, HEADER_SIZE);
+    std::vector<char> trailer = source->read_range(size - TRAILER_SIZE, TRAILER_SIZE);
+    if (header.size() != HEADER_SIZE || trailer.size() != TRAILER_SIZE ||
+        std::memcmp(header.data(), MAGIC, sizeof(MAGIC)) != 0 ||
+        std::memcmp(trailer.data() + 12, MAGIC, sizeof(MAGIC)) != 0) {
+        return false;
+    }
+    uint32_t version = 0;
+    std::memcpy(&version, header.data() + 4, sizeof(version));
+    if (version != TOOLPATH_CACHE_VERSION) {
+        spdlog::debug("[ToolpathCache] {} has version {} (want {})", path, version,
+                      TOOLPATH_CACHE_VERSION);
+        return false;
+    }
+
+    uint64_t directory_offset = 0;
+    uint32_t directory_checksum = 0;
+    std::memcpy(&directory_offset, trailer.data(), sizeof(directory_offset));
+    std::memcpy(&directory_checksum, trailer.data() + 8, sizeof(directory_checksum));
+    if (directory_offset < HEADER_SIZE || directory_offset > size - TRAILER_SIZE) {
+        return false;
+    }
+    auto directory_size = static_cast<uint32_t>(size - TRAILER_SIZE - directory_offset);
+    std::vector<char> directory = source->read_range(directory_offset, directory_size);
+    const auto* dir = reinterpret_cast<const uint8_t*>(directory.data());
+    if (directory.size() != directory_size ||
+        fnv1a(dir, directory.size()) != directory_checksum) {
+        spdlog::warn("[ToolpathCache] {} is corrupt", path);
+        return false;
+    }
+
+    ByteReader in{dir, dir + directory.size()};
+    if (in.get_string() != source_key || !in.ok) {
+        return false;
+    }
+
+    if (!object_names) {
+        object_names = std::make_shared<ObjectNameTable>();
+    }
+    uint32_t name_count = in.get<uint32_t>();
+    if (name_count > directory_size) {
+        return false;
+    }
+    std::vector<ObjectId> remap{NO_OBJECT_ID};
+    for (uint32_t i = 0; i < name_count && in.ok; ++i) {
+        remap.push_back(object_names->intern(in.get_string()));
+    }
+
+    uint32_t layer_count = in.get<uint32_t>();
+    if (!in.ok || layer_count > directory_size / 16) {
+        return false;
+    }
+    std::vector<LayerEntry> layers(layer_count);
+    for (auto& layer : layers) {
+        layer.offset = in.get<uint64_t>();
+        layer.size = in.get<uint32_t>();
+        layer.checksum = in.get<uint32_t>();
+        if (layer.offset < HEADER_SIZE || layer.offset + layer.size > directory_offset) {
+            return false;
+        }
+    }
+    if (!in.ok) {
+        return false;
+    }
+
+    source->advise(GCodeDataSource::AccessPattern::Random);
+    source_ = std::move(source);
+    layers_ = std::move(layers);
+    object_remap_ = std::move(remap);
+    spdlog::debug("[ToolpathCache] Opened {} ({} layers, {} objects)", path, layers_.size(),
+                  name_count);
+    return true;
+}
+
+bool ToolpathCacheReader::read_layer(size_t layer_index, std::vector<ToolpathSegment>& out) const {
+    if (!source_ || layer_index >= layers_.size()) {
+        return false;
+    }
+    const LayerEntry& layer = layers_[layer_index];
+
+    std::string_view view = source_->view_range(layer.offset, layer.size);
+    std::vector<char> bytes;
+    if (view.size() != layer.size) {
+        std::lock_guard<std::mutex> lock(read_mutex_);
+        bytes = source_->read_range(layer.offset, layer.size);
+        view = std::string_view(bytes.data(), bytes.size());
+    }
+
+    const auto* data = reinterpret_cast<const uint8_t*>(view.data());
+    if (view.size() != layer.size || fnv1a(data, view.size()) != layer.checksum) {
+        spdlog::warn("[ToolpathCache] Layer {} failed its checksum", layer_index);
+        return false;
+    }
+    return decode_toolpath_layer(data, view.size(), object_remap_, out);
+}
+
+} // namespace gcode
+} // namespace helix
@@ -0,0 +1,345 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "toolpath_rasterizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+namespace helix {
+namespace gcode {
+
+namespace {
+
+// Rounded x / 255 for x in [0, 255 * 255]
+inline uint32_t div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+// Source-over blend of an 0xAARRGGBB color at alpha into a non-premultiplied pixel
+inline void blend(uint32_t& dst, uint32_t color, uint32_t alpha) {
+    if (alpha == 0) {
+        return;
+    }
+    uint32_t rgb = color & 0x00FFFFFFu;
+    uint32_t dst_a = dst >> 24;
+    if (alpha >= 255 || dst_a == 0) {
+        dst = rgb | (alpha << 24);
+        return;
+    }
+
+    uint32_t inv = 255 - alpha;
+    if (dst_a == 255) {
+        uint32_t r = div255(((color >> 16) & 0xFF) * alpha + ((dst >> 16) & 0xFF) * inv);
+        uint32_t g = div255(((color >> 8) & 0xFF) * alpha + ((dst >> 8) & 0xFF) * inv);
+        uint32_t b = div255((color & 0xFF) * alpha + (dst & 0xFF) * inv);
+        dst = 0xFF000000u | (r << 16) | (g << 8) | b;
+        return;
+    }
+
+    // Both translucent: weight the destination by its own coverage
+    uint32_t dst_w = div255(dst_a * inv);
+    uint32_t out_a = alpha + dst_w;
+    auto mix = [&](int shift) {
+        uint32_t s = (color >> shift) & 0xFF;
+        uint32_t d = (dst >> shift) & 0xFF;
+        return ((s * alpha + d * dst_w + out_a / 2) / out_a) << shift;
+    };
+    dst = (out_a << 24) | mix(16) | mix(8) | mix(0);
+}
+
+} // namespace
+
+void ToolpathRasterizer::clear() {
+    if (!target_.data) {
+        return;
+    }
+    std::memset(target_.data, 0, static_cast<size_t>(target_.stride) * target_.height);
+}
+
+void ToolpathRasterizer::draw_line(int x0, int y0, int x1, int y1, uint32_t color, int width) {
+    if (!target_.data || target_.width <= 0 || target_.height <= 0 || (color >> 24) == 0) {
+        return;
+    }
+    width = std::max(width, 1);
+
+    // Lines entirely above or below the row band (with room for thickness)
+    const int reach = 2 * width + 1;
+    if (std::max(y0, y1) + reach < first_row() || std::min(y0, y1) - reach > last_row()) {
+        return;
+    }
+
+    if (antialias_) {
+        draw_antialiased(x0, y0, x1, y1, color, width);
+    } else {
+        draw_aliased(x0, y0, x1, y1, color, width);
+    }
+}
+
+void ToolpathRasterizer::draw_aliased(int x0, int y0, int x1, int y1, uint32_t color, int width) {
+    // The walk follows the unclipped line and starts at the clip boundary, so
+    // clipped and tiled lines keep exactly the pixels of the whole line
+    const uint32_t alpha = color >> 24;
+    const int max_x = target_.width - 1;
+    const int band_first = first_row();
+    const int band_last = last_row();
+    size_t touched = 0;
+
+    if (width == 1) {
+        if (alpha == 255) {
+            bresenham_line_clipped(x0, y0, x1, y1, 0, max_x, band_first, band_last,
+                                   [&](int x, int y) {
+                                       row(y)[x] = color;
+                                       ++touched;
+                                   });
+        } else {
+            bresenham_line_clipped(x0, y0, x1, y1, 0, max_x, band_first, band_last,
+                                   [&](int x, int y) {
+                                       blend(row(y)[x], color, alpha);
+                                       ++touched;
+                                   });
+        }
+        pixels_touched_ += touched;
+        return;
+    }
+
+    // Thick line: a run across the minor axis at every Bresenham step, sized so the
+    // perpendicular width is right at any angle
+    double adx = std::abs(static_cast<double>(x1) - x0);
+    double ady = std::abs(static_cast<double>(y1) - y0);
+    double major = std::max(adx, ady);
+    int run = width;
+    if (major > 0) {
+        double length = std::sqrt(adx * adx + ady * ady);
+        run = std::max(1, static_cast<int>(std::lround(width * length / major)));
+    }
+    const int before = (run - 1) / 2;
+    const int after = run - 1 - before;
+
+    // Centers just outside the target still reach it with their runs
+    if (adx >= ady) {
+        bresenham_line_clipped(x0, y0, x1, y1, 0, max_x, band_first - after, band_last + before,
+                               [&](int x, int y) {
+                                   int first = std::max(y - before, band_first);
+                                   int last = std::min(y + after, band_last);
+                                   for (int py = first; py <= last; ++py) {
+                                       blend(row(py)[x], color, alpha);
+                                   }
+                                   touched += static_cast<size_t>(last - first + 1);
+                               });
+    } else {
+        bresenham_line_clipped(x0, y0, x1, y1, -after, max_x + before, band_first, band_last,
+                               [&](int x, int y) {
+                                   int first = std::max(x - before, 0);
+                                   int last = std::min(x + after, max_x);
+                                   uint32_t* pixels = row(y);
+                                   for (int px = first; px <= last; ++px) {
+                                       blend(pixels[px], color, alpha);
+                                   }
+                                   touched += static_cast<size_t>(last - first + 1);
+                               });
+    }
+    pixels_touched_ += touched;
+}
+
+void ToolpathRasterizer::draw_antialiased(int x0, int y0, int x1, int y1, uint32_t color,
+                                          int width) {
+    const bool x_major = std::abs(x1 - x0) >= std::abs(y1 - y0);
+
+    // Work in (major, minor) coordinates so one loop handles both orientations
+    int m0 = x_major ? x0 : y0;
+    int n0 = x_major ? y0 : x0;
+    int m1 = x_major ? x1 : y1;
+    int n1 = x_major ? y1 : x1;
+    if (m0 > m1) {
+        std::swap(m0, m1);
+        std::swap(n0, n1);
+    }
+    const int major_max = (x_major ? target_.width : target_.height) - 1;
+    const int minor_max = (x_major ? target_.height : target_.width) - 1;
+
+    const double slope = m1 > m0 ? static_cast<double>(n1 - n0) / (m1 - m0) : 0.0;
+    const double half = 0.5 * width * std::sqrt(1.0 + slope * slope);
+
+    // Reject lines whose band misses the target entirely
+    if (m1 < 0 || m0 > major_max || std::max(n0, n1) + half < -0.5 ||
+        std::min(n0, n1) - half > minor_max + 0.5) {
+        return;
+    }
+
+    // The line is walked from its first on-target column regardless of the row
+    // band, so the fixed-point center is the same in every tile
+    const int m_start = std::max(m0, 0);
+    int m_first = m_start;
+    int m_last = std::min(m1, major_max);
+    int minor_first = 0;
+    int minor_last = minor_max;
+    if (x_major) {
+        minor_first = first_row();
+        minor_last = std::min(minor_max, last_row());
+    } else {
+        m_first = std::max(m_first, first_row());
+        m_last = std::min(m_last, last_row());
+    }
+
+    // 16.16 fixed point: minor coordinate of the line center and band half-height
+    constexpr int64_t ONE = 1 << 16;
+    constexpr int64_t HALF_PIXEL = ONE / 2;
+    const int64_t step = static_cast<int64_t>(std::llround(slope * ONE));
+    const int64_t half_fx = static_cast<int64_t>(std::llround(half * ONE));
+    int64_t center = static_cast<int64_t>(n0) * ONE +
+                     static_cast<int64_t>(std::llround(slope * (m_start - m0) * ONE)) +
+                     step * (m_first - m_start);
+
+    const uint32_t alpha = color >> 24;
+    size_t touched = 0;
+    for (int m = m_first; m <= m_last; ++m, center += step) {
+        const int64_t top = center - half_fx;
+        const int64_t bottom = center + half_fx;
+        // Pixel p covers [p - 0.5, p + 0.5)
+        int first = static_cast<int>((top + HALF_PIXEL) >> 16);
+        int last = static_cast<int>((bottom + HALF_PIXEL - 1) >> 16);
+        first = std::max(first, minor_first);
+        last = std::min(last, minor_last);
+
+        for (int p = first; p <= last; ++p) {
+            int64_t lo = std::max(top, static_cast<int64_t>(p) * ONE - HALF_PIXEL);
+            int64_t hi = std::min(bottom, static_cast<int64_t>(p) * ONE + HALF_PIXEL);
+            if (hi <= lo) {
+                continue;
+            }
+            uint32_t coverage_alpha = static_cast<uint32_t>((alpha * (hi - lo)) >> 16);
+            uint32_t& pixel = x_major ? row(p)[m] : row(m)[p];
+            blend(pixel, color, coverage_alpha);
+            ++touched;
+        }
+    }
+    pixels_touched_ += touched;
+}
+
+// ============================================================================
+// Tiled rendering
+// ============================================================================
+
+RasterWorkerPool::RasterWorkerPool(size_t worker_count) {
+    if (worker_count == 0) {
+        unsigned int hw = std::thread::hardware_concurrency();
+        worker_count = std::clamp<size_t>(hw == 0 ? 1 : hw, 1, MAX_RASTER_WORKERS);
+    }
+    // The calling thread works too, so start one fewer
+    for (size_t i = 1; i < worker_count; ++i) {
+        threads_.emplace_back(&RasterWorkerPool::worker_loop, this);
+    }
+}
+
+RasterWorkerPool::~RasterWorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& t : threads_) {
+        t.join();
+    }
+}
+
+void RasterWorkerPool::run(size_t task_count, const std::function<void(size_t task)>& task) {
+    std::unique_lock<std::mutex> job_lock(job_mutex_, std::try_to_lock);
+    if (!job_lock.owns_lock() || threads_.empty() || task_count <= 1) {
+        for (size_t i = 0; i < task_count; ++i) {
+            task(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        task_count_ = task_count;
+        next_task_.store(0);
+        active_ = threads_.size();
+        ++generation_;
+    }
+    wake_.notify_all();
+    work();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return active_ == 0; });
+    task_ = nullptr;
+}
+
+void RasterWorkerPool::worker_loop() {
+    uint64_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+        }
+        work();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--active_ == 0) {
+                done_.notify_one();
+            }
+        }
+    }
+}
+
+void RasterWorkerPool::work() {
+    for (size_t i = next_task_.fetch_add(1); i < task_count_; i = next_task_.fetch_add(1)) {
+        (*task_)(i);
+    }
+}
+
+size_t rasterize_tiled(const RasterTarget& target, const std::vector<RasterLine>& lines,
+                       bool antialias, RasterWorkerPool* pool) {
+    if (!target.data || target.height <= 0 || lines.empty()) {
+        return 0;
+    }
+
+    // Two tiles per worker so a dense band does not leave the others idle
+    constexpr int MIN_TILE_ROWS = 16;
+    size_t workers = pool ? pool->worker_count() : 1;
+    int tiles = static_cast<int>(std::min<size_t>(
+        workers == 1 ? 1 : workers * 2,
+        static_cast<size_t>(std::max(1, target.height / MIN_TILE_ROWS))));
+    int tile_rows = (target.height + tiles - 1) / tiles;
+
+    std::vector<size_t> touched(static_cast<size_t>(tiles), 0);
+    auto draw_tile = [&](size_t tile) {
+        ToolpathRasterizer raster(target);
+        raster.set_antialias(antialias);
+        if (tiles > 1) {
+            int begin = static_cast<int>(tile) * tile_rows;
+            raster.set_row_band(begin, begin + tile_rows);
+        }
+        for (const auto& line : lines) {
+            raster.draw_line(line.x0, line.y0, line.x1, line.y1, line.color, line.width);
+        }
+        touched[tile] = raster.pixels_touched();
+    };
+
+    if (tiles == 1 || !pool) {
+        for (int tile = 0; tile < tiles; ++tile) {
+            draw_tile(static_cast<size_t>(tile));
+        }
+    } else {
+        pool->run(static_cast<size_t>(tiles), draw_tile);
+    }
+
+    size_t total = 0;
+    for (size_t n : touched) {
+        total += n;
+    }
+    return total;
+}
+
+} // namespace gcode
+} // namespace helix
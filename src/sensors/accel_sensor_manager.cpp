@@ -118,6 +118,16 @@ void AccelSensorManager::discover_from_config(const nlohmann::json& config_keys)
 }
 
 void AccelSensorManager::update_from_status(const nlohmann::json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool AccelSensorManager::handles_status_object(const std::string& object) const {
+    std::string sensor_name;
+    AccelSensorType type{};
+    return parse_klipper_name(object, sensor_name, type);
+}
+
+void AccelSensorManager::update_from_objects(const StatusObjects& objects) {
     bool any_changed = false;
 
     {
@@ -126,11 +136,12 @@ void AccelSensorManager::update_from_status(const nlohmann::json& status) {
         for (const auto& sensor : sensors_) {
             const std::string& key = sensor.klipper_name;
 
-            if (!status.contains(key)) {
+            const auto* found = objects.find(key);
+            if (!found) {
                 continue;
             }
 
-            const auto& sensor_data = status[key];
+            const auto& sensor_data = *found;
             auto& state = states_[sensor.klipper_name];
             AccelSensorState old_state = state;
 
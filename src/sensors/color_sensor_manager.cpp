@@ -157,6 +157,21 @@ void ColorSensorManager::discover_from_moonraker(const nlohmann::json& moonraker
 }
 
 void ColorSensorManager::update_from_status(const nlohmann::json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool ColorSensorManager::handles_status_object(const std::string& object) const {
+    // Device IDs are "td1_lane0"-style names or serials like "E6625877D318C430".
+    // Klipper objects are lowercase modules, optionally followed by " <name>".
+    if (object.rfind("td1", 0) == 0) {
+        return true;
+    }
+    return !object.empty() && std::none_of(object.begin(), object.end(), [](char c) {
+        return c == ' ' || (c >= 'a' && c <= 'z');
+    });
+}
+
+void ColorSensorManager::update_from_objects(const StatusObjects& objects) {
     bool any_changed = false;
 
     {
@@ -165,11 +180,12 @@ void ColorSensorManager::update_from_status(const nlohmann::json& status) {
         for (const auto& sensor : sensors_) {
             const std::string& key = sensor.device_id;
 
-            if (!status.contains(key)) {
+            const auto* found = objects.find(key);
+            if (!found) {
                 continue;
             }
 
-            const auto& sensor_data = status[key];
+            const auto& sensor_data = *found;
             auto& state = states_[sensor.device_id];
             ColorSensorState old_state = state;
 
@@ -116,6 +116,16 @@ void HumiditySensorManager::discover(const std::vector<std::string>& klipper_obj
 }
 
 void HumiditySensorManager::update_from_status(const nlohmann::json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool HumiditySensorManager::handles_status_object(const std::string& object) const {
+    std::string sensor_name;
+    HumiditySensorType type{};
+    return parse_klipper_name(object, sensor_name, type);
+}
+
+void HumiditySensorManager::update_from_objects(const StatusObjects& objects) {
     bool any_changed = false;
 
     {
@@ -124,11 +134,12 @@ void HumiditySensorManager::update_from_status(const nlohmann::json& status) {
         for (const auto& sensor : sensors_) {
             const std::string& key = sensor.klipper_name;
 
-            if (!status.contains(key)) {
+            const auto* found = objects.find(key);
+            if (!found) {
                 continue;
             }
 
-            const auto& sensor_data = status[key];
+            const auto& sensor_data = *found;
             auto& state = states_[sensor.klipper_name];
             HumiditySensorState old_state = state;
 
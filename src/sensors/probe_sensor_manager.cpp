@@ -115,6 +115,16 @@ void ProbeSensorManager::discover(const std::vector<std::string>& klipper_object
 }
 
 void ProbeSensorManager::update_from_status(const nlohmann::json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool ProbeSensorManager::handles_status_object(const std::string& object) const {
+    std::string sensor_name;
+    ProbeSensorType type{};
+    return parse_klipper_name(object, sensor_name, type);
+}
+
+void ProbeSensorManager::update_from_objects(const StatusObjects& objects) {
     bool any_changed = false;
 
     {
@@ -123,11 +133,12 @@ void ProbeSensorManager::update_from_status(const nlohmann::json& status) {
         for (const auto& sensor : sensors_) {
             const std::string& key = sensor.klipper_name;
 
-            if (!status.contains(key)) {
+            const auto* found = objects.find(key);
+            if (!found) {
                 continue;
             }
 
-            const auto& sensor_data = status[key];
+            const auto& sensor_data = *found;
             auto& state = states_[sensor.klipper_name];
             ProbeSensorState old_state = state;
 
@@ -166,6 +166,16 @@ void TemperatureSensorManager::discover(const std::vector<std::string>& klipper_
 }
 
 void TemperatureSensorManager::update_from_status(const nlohmann::json& status) {
+    update_from_objects(StatusObjects(status));
+}
+
+bool TemperatureSensorManager::handles_status_object(const std::string& object) const {
+    std::string sensor_name;
+    TemperatureSensorType type{};
+    return parse_klipper_name(object, sensor_name, type);
+}
+
+void TemperatureSensorManager::update_from_objects(const StatusObjects& objects) {
     bool any_changed = false;
 
     {
@@ -174,11 +184,12 @@ void TemperatureSensorManager::update_from_status(const nlohmann::json& status)
         for (const auto& sensor : sensors_) {
             const std::string& key = sensor.klipper_name;
 
-            if (!status.contains(key)) {
+            const auto* found = objects.find(key);
+            if (!found) {
                 continue;
             }
 
-            const auto& sensor_data = status[key];
+            const auto& sensor_data = *found;
             auto& state = states_[sensor.klipper_name];
             TemperatureSensorState old_state = state;
 
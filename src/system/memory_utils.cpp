@@ -177,7 +177,8 @@ bool is_gcode_3d_render_safe(size_t file_size_bytes) {
 bool is_gcode_2d_streaming_safe_impl(size_t file_size_bytes, size_t available_kb, int display_width,
                                      int display_height) {
     // 2D streaming mode memory requirements:
-    // 1. Layer index: ~24 bytes per layer (estimate 1 layer per 500 bytes of G-code)
+    // 1. Layer index: ~48 bytes per layer incl. parser state snapshot (estimate 1 layer per
+    //    500 bytes of G-code)
     // 2. LRU layer cache: 1MB fixed budget for parsed layer segments
     // 3. Ghost buffer: display_width * display_height * 4 bytes (ARGB8888)
     // 4. Safety margin: 3MB for other allocations
@@ -185,7 +186,7 @@ bool is_gcode_2d_streaming_safe_impl(size_t file_size_bytes, size_t available_kb
     // Note: NO download spike - file streams directly to disk
 
     size_t estimated_layers = file_size_bytes / 500;
-    size_t layer_index_kb = (estimated_layers * 24) / 1024;
+    size_t layer_index_kb = (estimated_layers * 48) / 1024;
     constexpr size_t lru_cache_kb = 1024; // 1MB
     size_t ghost_buffer_kb =
         (static_cast<size_t>(display_width) * static_cast<size_t>(display_height) * 4) / 1024;
@@ -6,8 +6,10 @@
 #include "ui_update_queue.h"
 #include "ui_utils.h"
 
+#include "app_globals.h"
 #include "gcode_camera.h"
 #include "gcode_layer_renderer.h"
+#include "gcode_parallel_parser.h"
 #include "gcode_parser.h"
 #include "gcode_streaming_config.h"
 #include "gcode_streaming_controller.h"
@@ -32,9 +34,9 @@ constexpr size_t GCODE_FPS_WINDOW_SIZE = 10; // Rolling window of frame times
 #include <atomic>
 #include <cstdlib>
 #include <cstring>
-#include <fstream>
 #include <memory>
 #include <optional>
+#include <string>
 #include <thread>
 #include <unordered_set>
 
@@ -87,6 +89,9 @@ class GCodeViewerState {
         // RAII cleanup: signal cancellation and wait for thread
         cancel_build();
 
+        // The renderer may be streaming from the controller, which is destroyed first
+        release_streaming_controller();
+
         // Clean up LVGL timer if pending
         // Guard against LVGL shutdown - timer may already be destroyed
         if (long_press_timer_ && lv_is_initialized()) {
@@ -95,6 +100,16 @@ class GCodeViewerState {
         }
     }
 
+    /// Drop the streaming controller after detaching the 3D renderer from it
+    void release_streaming_controller() {
+#ifdef ENABLE_TINYGL_3D
+        if (renderer_) {
+            renderer_->set_streaming_controller(nullptr);
+        }
+#endif
+        streaming_controller_.reset();
+    }
+
     // Non-copyable, non-movable (prevents accidental thread ownership issues)
     GCodeViewerState(const GCodeViewerState&) = delete;
     GCodeViewerState& operator=(const GCodeViewerState&) = delete;
@@ -202,8 +217,8 @@ class GCodeViewerState {
     lv_obj_t* loading_spinner{nullptr};
     lv_obj_t* loading_label{nullptr};
 
-    // Ghost build progress label (streaming mode only)
-    lv_obj_t* ghost_progress_label_{nullptr};
+    // Streaming status label: 2D ghost build progress, 3D geometry progress or truncation
+    lv_obj_t* status_label_{nullptr};
 
     // ========================================================================
     // Render Mode (Phase 5: 2D Layer View)
@@ -296,6 +311,72 @@ static bool has_gcode_data(const gcode_viewer_state_t* st) {
 // Event Callbacks
 // ==============================================
 
+/**
+ * @brief Schedule another frame from inside the draw callback
+ *
+ * Cannot call lv_obj_invalidate() during the draw callback - LVGL asserts if we
+ * invalidate while rendering_in_progress is true. Use ui_async_call() to schedule
+ * invalidation after render completes.
+ */
+static void request_redraw_after_draw(lv_obj_t* obj) {
+    ui_async_call(
+        [](void* user_data) {
+            lv_obj_t* widget = static_cast<lv_obj_t*>(user_data);
+            if (lv_obj_is_valid(widget)) {
+                lv_obj_invalidate(widget);
+            }
+        },
+        obj);
+}
+
+/**
+ * @brief Show text in the bottom-left status label, or remove the label
+ *
+ * Objects cannot be created, changed or deleted during the draw callback, so
+ * the update is deferred until rendering completes.
+ *
+ * @param text Label text; empty removes the label
+ */
+static void queue_status_label(lv_obj_t* obj, gcode_viewer_state_t* st, const std::string& text) {
+    if (text.empty()) {
+        if (st->status_label_) {
+            lv_obj_t* label_to_delete = st->status_label_;
+            st->status_label_ = nullptr; // Clear reference immediately
+            ui_async_call(
+                [](void* user_data) {
+                    lv_obj_t* widget = static_cast<lv_obj_t*>(user_data);
+                    lv_obj_safe_delete(widget);
+                },
+                label_to_delete);
+        }
+        return;
+    }
+
+    struct StatusLabelUpdate {
+        lv_obj_t* viewer;
+        std::string text;
+    };
+    auto update = std::make_unique<StatusLabelUpdate>(StatusLabelUpdate{obj, text});
+    ui_queue_update<StatusLabelUpdate>(std::move(update), [](StatusLabelUpdate* u) {
+        if (!lv_obj_is_valid(u->viewer)) {
+            return;
+        }
+        auto* state = static_cast<GCodeViewerState*>(lv_obj_get_user_data(u->viewer));
+        if (!state) {
+            return;
+        }
+        if (!state->status_label_) {
+            state->status_label_ = lv_label_create(u->viewer);
+            lv_obj_set_style_text_color(state->status_label_, theme_manager_get_color("text_muted"),
+                                        LV_PART_MAIN);
+            lv_obj_set_style_text_font(state->status_label_, theme_manager_get_font("font_small"),
+                                       LV_PART_MAIN);
+            lv_obj_align(state->status_label_, LV_ALIGN_BOTTOM_LEFT, 8, -8);
+        }
+        lv_label_set_text(state->status_label_, u->text.c_str());
+    });
+}
+
 /**
  * @brief Main draw callback - renders G-code using custom renderer
  *
@@ -396,67 +477,45 @@ static void gcode_viewer_draw_cb(lv_event_t* e) {
         // Check if progressive rendering needs more frames
         // This drives ghost cache and solid cache completion
         if (st->layer_renderer_2d_->needs_more_frames()) {
-            // IMPORTANT: Cannot call lv_obj_invalidate() during draw callback!
-            // LVGL asserts if we invalidate while rendering_in_progress is true.
-            // Use ui_async_call() to schedule invalidation after render completes.
-            ui_async_call(
-                [](void* user_data) {
-                    lv_obj_t* widget = static_cast<lv_obj_t*>(user_data);
-                    if (lv_obj_is_valid(widget)) {
-                        lv_obj_invalidate(widget);
-                    }
-                },
-                obj);
+            request_redraw_after_draw(obj);
         }
 
-        // Update ghost build progress label (streaming mode)
-        // IMPORTANT: Cannot create/delete/modify objects during draw callback!
-        // Use ui_queue_update() to defer all label operations to after render completes.
+        // Ghost build progress (streaming mode)
         if (st->layer_renderer_2d_->is_ghost_build_running()) {
             int percent =
                 static_cast<int>(st->layer_renderer_2d_->get_ghost_build_progress() * 100.0f);
-            // Capture needed data for deferred update
-            struct GhostProgressUpdate {
-                lv_obj_t* viewer;
-                int percent;
-            };
-            auto update = std::make_unique<GhostProgressUpdate>(GhostProgressUpdate{obj, percent});
-            ui_queue_update<GhostProgressUpdate>(std::move(update), [](GhostProgressUpdate* u) {
-                if (!lv_obj_is_valid(u->viewer)) {
-                    return;
-                }
-                auto* state = static_cast<GCodeViewerState*>(lv_obj_get_user_data(u->viewer));
-                if (!state) {
-                    return;
-                }
-                // Create label if needed
-                if (!state->ghost_progress_label_) {
-                    state->ghost_progress_label_ = lv_label_create(u->viewer);
-                    lv_obj_set_style_text_color(state->ghost_progress_label_,
-                                                theme_manager_get_color("text_muted"),
-                                                LV_PART_MAIN);
-                    lv_obj_set_style_text_font(state->ghost_progress_label_,
-                                               theme_manager_get_font("font_small"), LV_PART_MAIN);
-                    lv_obj_align(state->ghost_progress_label_, LV_ALIGN_BOTTOM_LEFT, 8, -8);
-                }
-                static char text[32];
-                lv_snprintf(text, sizeof(text), "Building preview: %d%%", u->percent);
-                lv_label_set_text(state->ghost_progress_label_, text);
-            });
-        } else if (st->ghost_progress_label_) {
-            // Defer label deletion to after render
-            lv_obj_t* label_to_delete = st->ghost_progress_label_;
-            st->ghost_progress_label_ = nullptr; // Clear reference immediately
-            ui_async_call(
-                [](void* user_data) {
-                    lv_obj_t* widget = static_cast<lv_obj_t*>(user_data);
-                    lv_obj_safe_delete(widget);
-                },
-                label_to_delete);
+            queue_status_label(obj, st, "Building preview: " + std::to_string(percent) + "%");
+        } else {
+            queue_status_label(obj, st, "");
         }
     } else {
         // 3D TinyGL Renderer (isometric ribbon view)
-        st->renderer_->render(layer, *st->gcode_file, *st->camera_, &widget_coords);
+        if (st->gcode_file) {
+            st->renderer_->render(layer, *st->gcode_file, *st->camera_, &widget_coords);
+        }
+#ifdef ENABLE_TINYGL_3D
+        else {
+            // Streaming mode: geometry arrives layer by layer from a worker thread
+            st->renderer_->render(layer, *st->camera_, &widget_coords);
+            if (st->renderer_->needs_more_frames()) {
+                request_redraw_after_draw(obj);
+            }
+
+            // The geometry budget may leave the top layers out: say so instead of a
+            // finished-looking preview
+            std::string status;
+            if (st->renderer_->is_streaming_truncated()) {
+                status = "Preview limited to " +
+                         std::to_string(st->renderer_->get_streamed_layer_count()) + " of " +
+                         std::to_string(st->renderer_->get_streaming_total_layers()) +
+                         " layers (memory)";
+            } else if (st->renderer_->get_streaming_progress() < 1.0f) {
+                int percent = static_cast<int>(st->renderer_->get_streaming_progress() * 100.0f);
+                status = "Building preview: " + std::to_string(percent) + "%";
+            }
+            queue_status_label(obj, st, status);
+        }
+#endif
     }
 
     auto render_end = std::chrono::high_resolution_clock::now();
@@ -874,12 +933,48 @@ struct AsyncBuildResult {
     std::unique_ptr<helix::gcode::ParsedGCodeFile> gcode_file;
 #ifdef ENABLE_TINYGL_3D
     std::unique_ptr<helix::gcode::RibbonGeometry> geometry;        ///< Full detail geometry
-    std::unique_ptr<helix::gcode::RibbonGeometry> coarse_geometry; ///< Coarse LOD for interaction
+    std::unique_ptr<helix::gcode::RibbonGeometry> coarse_geometry; ///< Low-memory fallback only
 #endif
     std::string error_msg;
     bool success{true};
 };
 
+#ifdef ENABLE_TINYGL_3D
+// One LOD pyramid level, built after the full geometry is already on screen
+struct AsyncLodLevelResult {
+    std::unique_ptr<helix::gcode::RibbonGeometry> geometry;
+    std::string filename; ///< File the level was built for (discarded if another is loaded)
+};
+
+/**
+ * @brief Move a parsed file's segments into a file holding only what the builder reads
+ *
+ * Lets the full file go to the UI thread (segments cleared) while the worker
+ * keeps the segments to build the LOD pyramid.
+ */
+static std::unique_ptr<helix::gcode::ParsedGCodeFile>
+take_segments_for_lod(helix::gcode::ParsedGCodeFile& gcode) {
+    auto source = std::make_unique<helix::gcode::ParsedGCodeFile>();
+    source->filename = gcode.filename;
+    source->global_bounding_box = gcode.global_bounding_box;
+    source->object_names = gcode.object_names;
+    source->layers.resize(gcode.layers.size());
+    for (size_t i = 0; i < gcode.layers.size(); ++i) {
+        source->layers[i].z_height = gcode.layers[i].z_height;
+        source->layers[i].segments = std::move(gcode.layers[i].segments);
+    }
+    return source;
+}
+#endif
+
+/**
+ * @brief Layer index cache in the helix cache dir, shared by every viewer
+ */
+static std::shared_ptr<helix::gcode::GCodeIndexCache> shared_index_cache() {
+    static auto cache = std::make_shared<helix::gcode::GCodeIndexCache>();
+    return cache;
+}
+
 /**
  * @brief Asynchronously load and build G-code geometry in background thread
  *
@@ -898,7 +993,7 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
     st->first_render = true; // Reset for new file
 
     // Clear any existing data sources (mutually exclusive: streaming XOR full-file)
-    st->streaming_controller_.reset();
+    st->release_streaming_controller();
     st->gcode_file.reset();
     st->layer_renderer_2d_.reset(); // Will be recreated on first render
 
@@ -959,6 +1054,11 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
 
         // Create streaming controller
         st->streaming_controller_ = std::make_unique<helix::gcode::GCodeStreamingController>();
+        st->streaming_controller_->set_index_cache(shared_index_cache());
+        if (helix::is_gcode_toolpath_cache_enabled()) {
+            st->streaming_controller_->set_toolpath_cache_dir(
+                get_helix_cache_dir("gcode_toolpath"));
+        }
 
         // Launch async index building with completion callback
         // The callback runs on the background thread, so we use lv_async_call to marshal to UI
@@ -1029,6 +1129,15 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
                     // Note: Ghost mode is disabled in streaming mode (requires all layers)
                     // The renderer handles this automatically in set_streaming_controller()
 
+#ifdef ENABLE_TINYGL_3D
+                    // 3D view builds its geometry from the same controller, layer by layer
+                    st->renderer_->set_streaming_controller(st->streaming_controller_.get());
+                    helix::gcode::AABB bounds;
+                    if (st->streaming_controller_->sample_bounds(bounds)) {
+                        st->camera_->fit_to_bounds(bounds);
+                    }
+#endif
+
                     st->viewer_state = GCODE_VIEWER_STATE_LOADED;
                     st->first_render = false;
 
@@ -1096,26 +1205,19 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
     // Automatically cancels any existing build and joins the thread
     st->start_build([st, obj, path = std::string(file_path)]() {
         auto result = std::make_unique<AsyncBuildResult>();
+#ifdef ENABLE_TINYGL_3D
+        std::unique_ptr<helix::gcode::ParsedGCodeFile> lod_source;
+        helix::gcode::GeometryBuilder lod_builder;
+#endif
 
         try {
-            // PHASE 1: Parse G-code file (fast, ~100ms)
-            std::ifstream file(path);
-            if (!file.is_open()) {
+            // PHASE 1: Parse G-code file (fast, ~100ms; layers decoded on all cores)
+            auto parsed = std::make_unique<helix::gcode::ParsedGCodeFile>();
+            if (!helix::gcode::parse_gcode_file_parallel(path, *parsed)) {
                 result->success = false;
                 result->error_msg = "Failed to open file: " + path;
             } else {
-                helix::gcode::GCodeParser parser;
-                std::string line;
-
-                while (std::getline(file, line)) {
-                    parser.parse_line(line);
-                }
-
-                file.close();
-
-                result->gcode_file =
-                    std::make_unique<helix::gcode::ParsedGCodeFile>(parser.finalize());
-                result->gcode_file->filename = path;
+                result->gcode_file = std::move(parsed);
 
                 spdlog::debug("[GCode Viewer] Parsed {} layers, {} segments",
                               result->gcode_file->layers.size(),
@@ -1170,36 +1272,24 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
                                 result->geometry->travel_triangle_count);
                     }
 
-                    // Build coarse LOD geometry for interaction
-                    // More aggressive simplification for better frame rate during drag
-                    // 2.0mm tolerance gives ~55% fewer triangles - good balance of quality/speed
-                    {
+                    if (memory_constrained) {
+                        // Coarse geometry only: the first LOD level's settings
+                        // (2.0mm tolerance gives ~55% fewer triangles)
                         helix::gcode::GeometryBuilder coarse_builder;
                         configure_builder(coarse_builder);
 
-                        helix::gcode::SimplificationOptions coarse_opts{
-                            .tolerance_mm = 2.0f, .min_segment_length_mm = 0.5f};
-
+                        auto coarse_opts = helix::gcode::GeometryBuilder::lod_level_options(1);
                         result->coarse_geometry = std::make_unique<helix::gcode::RibbonGeometry>(
                             coarse_builder.build(*result->gcode_file, coarse_opts));
 
-                        size_t coarse_tris = result->coarse_geometry->extrusion_triangle_count +
-                                             result->coarse_geometry->travel_triangle_count;
-
-                        if (memory_constrained) {
-                            spdlog::info("[GCode Viewer] Built coarse-only geometry: {} triangles",
-                                         coarse_tris);
-                        } else {
-                            size_t full_tris = result->geometry->extrusion_triangle_count +
-                                               result->geometry->travel_triangle_count;
-                            float reduction =
-                                full_tris > 0
-                                    ? 100.0f * (1.0f - float(coarse_tris) / float(full_tris))
-                                    : 0.0f;
-                            spdlog::info("[GCode Viewer] Built coarse LOD: {} triangles ({:.0f}% "
-                                         "reduction from full)",
-                                         coarse_tris, reduction);
-                        }
+                        spdlog::info("[GCode Viewer] Built coarse-only geometry: {} triangles",
+                                     result->coarse_geometry->extrusion_triangle_count +
+                                         result->coarse_geometry->travel_triangle_count);
+                    } else {
+                        // LOD pyramid for interaction is built after the full geometry is
+                        // shown; keep the segments for it instead of freeing them here
+                        lod_source = take_segments_for_lod(*result->gcode_file);
+                        configure_builder(lod_builder);
                     }
 
                     // Free parsed segment data - 3D mode doesn't need raw segments
@@ -1259,13 +1349,10 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
                 // On memory-constrained systems, we only have coarse geometry
 #ifdef ENABLE_TINYGL_3D
                 if (r->geometry) {
-                    // Normal case: full + coarse geometry
-                    spdlog::debug("[GCode Viewer] Setting full + coarse geometry");
+                    // Normal case: full geometry now, LOD levels follow from the worker
+                    spdlog::debug("[GCode Viewer] Setting full geometry");
                     st->renderer_->set_prebuilt_geometry(std::move(r->geometry),
                                                          st->gcode_file->filename);
-                    if (r->coarse_geometry) {
-                        st->renderer_->set_prebuilt_coarse_geometry(std::move(r->coarse_geometry));
-                    }
                 } else if (r->coarse_geometry) {
                     // Memory-constrained: use coarse as primary (no separate LOD)
                     spdlog::info("[GCode Viewer] Memory-constrained mode: using coarse geometry as "
@@ -1330,6 +1417,40 @@ static void ui_gcode_viewer_load_file_async(lv_obj_t* obj, const char* file_path
                 }
             }
         });
+
+#ifdef ENABLE_TINYGL_3D
+        // PHASE 4: LOD pyramid for interaction, finest level first. The full geometry is
+        // already on screen; each level is handed over as soon as it is built.
+        if (!lod_source) {
+            return;
+        }
+        for (size_t level = 1; level <= helix::gcode::GeometryBuilder::LOD_LEVEL_COUNT; ++level) {
+            if (st->is_cancelled()) {
+                return;
+            }
+            auto lod = std::make_unique<AsyncLodLevelResult>();
+            lod->filename = lod_source->filename;
+            try {
+                lod->geometry = std::make_unique<helix::gcode::RibbonGeometry>(lod_builder.build(
+                    *lod_source, helix::gcode::GeometryBuilder::lod_level_options(level)));
+            } catch (const std::exception& ex) {
+                spdlog::warn("[GCode Viewer] LOD level {} build failed: {}", level, ex.what());
+                return;
+            }
+            if (st->is_cancelled()) {
+                return;
+            }
+            ui_queue_update<AsyncLodLevelResult>(std::move(lod), [obj](AsyncLodLevelResult* r) {
+                gcode_viewer_state_t* st = get_state(obj);
+                if (!st || !st->gcode_file || st->gcode_file->filename != r->filename) {
+                    return; // Widget destroyed or another file loaded meanwhile
+                }
+                st->renderer_->add_prebuilt_lod_level(std::move(r->geometry));
+            });
+        }
+        spdlog::debug("[GCode Viewer] LOD pyramid complete, freeing {} MB of segment data",
+                      lod_source->clear_segments() / (1024 * 1024));
+#endif
     });
 }
 
@@ -1356,7 +1477,7 @@ void ui_gcode_viewer_set_gcode_data(lv_obj_t* obj, void* gcode_data) {
         return;
 
     // Clear streaming controller (mutually exclusive with gcode_file)
-    st->streaming_controller_.reset();
+    st->release_streaming_controller();
 
     // Take ownership of the data (caller must use new to allocate)
     st->gcode_file.reset(static_cast<helix::gcode::ParsedGCodeFile*>(gcode_data));
@@ -1388,7 +1509,7 @@ void ui_gcode_viewer_clear(lv_obj_t* obj) {
         return;
 
     st->gcode_file.reset();
-    st->streaming_controller_.reset();       // Clear streaming controller (Phase 6)
+    st->release_streaming_controller();      // Clear streaming controller (Phase 6)
     st->layer_renderer_2d_.reset();          // Clear 2D renderer to avoid dangling pointer
     st->has_external_color_override = false; // Clear external color override
     st->viewer_state = GCODE_VIEWER_STATE_EMPTY;
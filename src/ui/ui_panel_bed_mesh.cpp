@@ -498,8 +498,8 @@ void BedMeshPanel::setup_moonraker_subscription() {
 
     auto alive = alive_; // Capture shared_ptr by value for destruction detection [L012]
 
-    SubscriptionId id =
-        api->get_client().register_notify_update([this, api, alive](nlohmann::json notification) {
+    SubscriptionId id = api->get_client().register_notify_update(
+        [this, api, alive](const nlohmann::json& notification) {
             // Check destruction flag FIRST - panel may have been deleted
             if (!alive->load()) {
                 return;
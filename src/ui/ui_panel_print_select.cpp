@@ -30,6 +30,7 @@
 #include "app_globals.h"
 #include "config.h"
 #include "display_manager.h"
+#include "file_metadata_cache.h"
 #include "format_utils.h"
 #include "gcode_parser.h" // For extract_thumbnails_from_content (USB thumbnail fallback)
 #include "lvgl/src/xml/lv_xml.h"
@@ -799,6 +800,8 @@ void PrintSelectPanel::fetch_metadata_range(size_t start, size_t end) {
 
     auto* self = this;
     size_t fetch_count = 0;
+    size_t cached_count = 0;
+    auto& metadata_cache = helix::get_file_metadata_cache();
 
     // Capture current navigation generation to detect directory changes during async ops
     uint32_t captured_gen = nav_generation_.load();
@@ -813,18 +816,18 @@ void PrintSelectPanel::fetch_metadata_range(size_t start, size_t end) {
 
         // Mark as fetched immediately to prevent duplicate requests
         file_list_[i].metadata_fetched = true;
-        fetch_count++;
 
         const std::string filename = file_list_[i].filename;
         // Build full path for metadata request (e.g., "usb/flowrate_0.gcode")
         const std::string file_path =
             current_path_.empty() ? filename : current_path_ + "/" + filename;
+        const double modified = static_cast<double>(file_list_[i].modified_timestamp);
 
-        api_->get_file_metadata(
-            file_path,
-            // Metadata success callback (runs on background thread)
-            [self, i, filename, file_path, captured_gen,
-             alive = self->alive_](const FileMetadata& metadata) {
+        // Unchanged files are answered from the persistent cache before this returns;
+        // misses go through its queue, which caps how many RPCs are in flight
+        bool cached = metadata_cache.request(
+            file_path, modified, make_metadata_fetcher(file_path),
+            [self, i, filename, captured_gen, alive = self->alive_](const FileMetadata& metadata) {
                 // Check panel is still alive before accessing any members
                 if (!alive->load()) {
                     return;
@@ -836,89 +839,68 @@ void PrintSelectPanel::fetch_metadata_range(size_t start, size_t end) {
                                   self->nav_generation_.load());
                     return;
                 }
-
-                // Check if metadata is empty (file hasn't been scanned yet)
-                // This happens for USB files added via symlink - they need metascan
-                bool metadata_empty = metadata.thumbnails.empty() && metadata.estimated_time == 0;
-
-                if (metadata_empty && self->api_) {
-                    spdlog::debug("[{}] Empty metadata for {}, triggering metascan",
-                                  self->get_name(), filename);
-                    // Trigger metascan to generate metadata on-demand
-                    self->api_->metascan_file(
-                        file_path,
-                        [self, i, filename, captured_gen, alive](const FileMetadata& scanned) {
-                            if (!alive->load()) {
-                                return;
-                            }
-                            // Discard if directory changed during metascan
-                            if (self->nav_generation_.load() != captured_gen) {
-                                return;
-                            }
-                            // Metascan succeeded - process the fresh metadata
-                            self->process_metadata_result(i, filename, scanned);
-                        },
-                        [self, filename, alive](const MoonrakerError& error) {
-                            if (!alive->load()) {
-                                return;
-                            }
-                            spdlog::debug("[{}] Metascan failed for {}: {}", self->get_name(),
-                                          filename, error.message);
-                        });
-                    return; // Don't process empty metadata
-                }
-
-                // Process metadata (either from cache or non-empty response)
                 self->process_metadata_result(i, filename, metadata);
             },
-            // Metadata error callback
-            [self, i, filename, file_path, captured_gen,
-             alive = self->alive_](const MoonrakerError& error) {
-                // Check panel is still alive before accessing any members
+            [self, filename, alive = self->alive_](const std::string& error) {
                 if (!alive->load()) {
                     return;
                 }
-                // Discard if user navigated to a different directory since this request
-                if (self->nav_generation_.load() != captured_gen) {
-                    return;
-                }
+                spdlog::debug("[{}] No metadata for {}: {}", self->get_name(), filename, error);
+            });
+        if (cached) {
+            cached_count++;
+        } else {
+            fetch_count++;
+        }
+    }
 
-                spdlog::debug("[{}] Failed to get metadata for {}: {} ({})", self->get_name(),
-                              filename, error.message, error.get_type_string());
+    if (fetch_count > 0 || cached_count > 0) {
+        spdlog::trace("[{}] fetch_metadata_range({}, {}): {} from cache, {} requested",
+                      get_name(), start, end, cached_count, fetch_count);
+    }
+}
 
-                // Metadata doesn't exist - try metascan to generate it
-                if (self->api_) {
-                    spdlog::debug("[{}] Triggering metascan for {} after metadata failure",
-                                  self->get_name(), filename);
-                    self->api_->metascan_file(
-                        file_path,
-                        [self, i, filename, captured_gen, alive](const FileMetadata& scanned) {
-                            if (!alive->load()) {
-                                return;
-                            }
-                            // Discard if directory changed during metascan
-                            if (self->nav_generation_.load() != captured_gen) {
-                                return;
-                            }
-                            self->process_metadata_result(i, filename, scanned);
-                        },
-                        [self, filename, alive](const MoonrakerError& scan_error) {
-                            if (!alive->load()) {
-                                return;
-                            }
-                            spdlog::debug("[{}] Metascan also failed for {}: {}", self->get_name(),
-                                          filename, scan_error.message);
-                        });
+// Files Moonraker hasn't analyzed yet (e.g. USB files added via symlink) come back
+// empty or as an error, so those fall back to a metascan that generates metadata on demand
+helix::FileMetadataCache::Fetcher
+PrintSelectPanel::make_metadata_fetcher(const std::string& file_path) {
+    MoonrakerAPI* api = api_;
+    return [api, file_path, alive = alive_](helix::FileMetadataCache::MetadataCallback on_success,
+                                            helix::FileMetadataCache::FailureCallback on_error) {
+        // Queued fetches can start after the panel is gone
+        if (!alive->load()) {
+            on_error("Panel destroyed");
+            return;
+        }
+
+        auto metascan = [api, file_path, on_success, on_error]() {
+            api->metascan_file(
+                file_path, on_success,
+                [on_error](const MoonrakerError& error) { on_error(error.message); });
+        };
+
+        api->get_file_metadata(
+            file_path,
+            [file_path, on_success, metascan](const FileMetadata& metadata) {
+                // Check if metadata is empty (file hasn't been scanned yet)
+                if (metadata.thumbnails.empty() && metadata.estimated_time == 0) {
+                    spdlog::debug("[PrintSelectPanel] Empty metadata for {}, triggering metascan",
+                                  file_path);
+                    metascan();
+                    return;
                 }
+                on_success(metadata);
+            },
+            [file_path, metascan](const MoonrakerError& error) {
+                // Metadata doesn't exist - try metascan to generate it
+                spdlog::debug("[PrintSelectPanel] Failed to get metadata for {}: {} ({}), "
+                              "triggering metascan",
+                              file_path, error.message, error.get_type_string());
+                metascan();
             },
             true // silent - don't trigger RPC_ERROR event/toast
         );
-    }
-
-    if (fetch_count > 0) {
-        spdlog::trace("[{}] fetch_metadata_range({}, {}): started {} metadata requests", get_name(),
-                      start, end, fetch_count);
-    }
+    };
 }
 
 /**
@@ -10,6 +10,7 @@
 
 #include "active_print_media_manager.h"
 #include "app_globals.h"
+#include "gcode_stream_modifier.h"
 #include "memory_utils.h"
 #include "operation_registry.h"
 
@@ -31,6 +32,30 @@ namespace helix::ui {
 using helix::CapabilityOrigin;
 using helix::OperationCategory;
 
+namespace {
+
+/// Queue the edits for a modified print: comment out file ops, append PRINT_START skip params
+void add_print_modifications(
+    gcode::GCodeFileModifier& modifier, const gcode::ScanResult& scan_result,
+    const std::vector<gcode::OperationType>& ops_to_disable,
+    const std::vector<std::pair<std::string, std::string>>& macro_skip_params) {
+    // Disable file-embedded operations (comment them out)
+    modifier.disable_operations(scan_result, ops_to_disable);
+
+    // Add skip parameters to PRINT_START call (if any)
+    if (!macro_skip_params.empty()) {
+        if (modifier.add_print_start_skip_params(scan_result, macro_skip_params)) {
+            spdlog::info("[PrintPreparationManager] Added {} skip params to PRINT_START",
+                         macro_skip_params.size());
+        } else {
+            spdlog::warn("[PrintPreparationManager] Could not add skip params - "
+                         "PRINT_START not found in G-code");
+        }
+    }
+}
+
+} // namespace
+
 // ============================================================================
 // Construction / Destruction
 // ============================================================================
@@ -1203,19 +1228,107 @@ void PrintPreparationManager::modify_and_print(
     }
 
     // UNIFIED STREAMING PATH: Always use streaming to avoid memory spikes
-    // 1. Download to disk (streaming)
-    // 2. Modify on disk (file-to-file, minimal memory)
-    // 3. Upload modified file to server
-    // 4. If plugin available: use path-based API for symlink/history patching
+    // 1. Download, modify and upload in one pass (download chunks are rewritten
+    //    on the fly into a chunked upload body - no local files)
+    // 2. If plugin available: use path-based API for symlink/history patching
     //    Otherwise: use standard start_print
     //
+    // If the piped transfer fails, falls back to download to disk -> modify on
+    // disk -> upload from disk.
+    //
     // This prevents TTC errors on memory-constrained devices like AD5M (512MB RAM)
     // by never loading the entire G-code file into memory.
     bool has_plugin = printer_state_ && printer_state_->service_has_helix_plugin();
     spdlog::info("[PrintPreparationManager] Using unified streaming modification flow (plugin: {})",
                  has_plugin);
-    modify_and_print_streaming(file_path, display_filename, ops_to_disable, macro_skip_params,
-                               mod_names, on_navigate_to_status, has_plugin);
+    modify_and_print_piped(file_path, display_filename, ops_to_disable, macro_skip_params,
+                           mod_names, on_navigate_to_status, has_plugin);
+}
+
+void PrintPreparationManager::modify_and_print_piped(
+    const std::string& file_path, const std::string& display_filename,
+    const std::vector<gcode::OperationType>& ops_to_disable,
+    const std::vector<std::pair<std::string, std::string>>& macro_skip_params,
+    const std::vector<std::string>& mod_names, NavigateToStatusCallback on_navigate_to_status,
+    bool use_plugin) {
+    auto* self = this;
+    auto alive = alive_guard_; // Capture for lifetime checking in async callbacks
+
+    if (!cached_scan_result_.has_value()) {
+        NOTIFY_ERROR("Cannot modify G-code: scan result not available");
+        if (printer_state_)
+            printer_state_->set_print_in_progress(false);
+        return;
+    }
+
+    gcode::GCodeFileModifier modifier;
+    add_print_modifications(modifier, *cached_scan_result_, ops_to_disable, macro_skip_params);
+    auto stream = std::make_shared<gcode::GCodeStreamModifier>(modifier.modifications());
+
+    auto timestamp = std::to_string(std::time(nullptr));
+    std::string remote_temp_path = ".helix_temp/modified_" + timestamp + "_" + display_filename;
+
+    spdlog::info("[PrintPreparationManager] Piped modification: {} -> {} ({} modifications, "
+                 "rewriting first {} lines)",
+                 file_path, remote_temp_path, modifier.modifications().size(),
+                 stream->passthrough_line());
+
+    // Show busy overlay (will appear after 300ms grace period if operation takes that long)
+    BusyOverlay::show("Preparing print...");
+
+    // Progress callback - NOTE: called from HTTP thread
+    auto transfer_progress = [](size_t received, size_t total) {
+        float pct = (total > 0)
+                        ? (100.0f * static_cast<float>(received) / static_cast<float>(total))
+                        : 0.0f;
+        ui_async_call(
+            [](void* data) {
+                auto pct_val = static_cast<float>(reinterpret_cast<uintptr_t>(data)) / 100.0f;
+                BusyOverlay::set_progress("Transferring", pct_val);
+            },
+            reinterpret_cast<void*>(static_cast<uintptr_t>(pct * 100.0f)));
+    };
+
+    api_->transform_file(
+        "gcodes", file_path, remote_temp_path,
+        // Runs on HTTP thread, once per downloaded chunk and once (size 0) at the end
+        [stream](const char* data, size_t size, const MoonrakerAPI::ChunkSink& sink) {
+            return size > 0 ? stream->feed(data, size, sink) : stream->finish(sink);
+        },
+        // Upload complete - NOTE: runs on HTTP thread
+        [self, alive, stream, file_path, display_filename, remote_temp_path, mod_names,
+         on_navigate_to_status, use_plugin]() {
+            if (!alive || !*alive) {
+                spdlog::debug("[PrintPreparationManager] Skipping piped upload callback - "
+                              "manager destroyed");
+                return;
+            }
+
+            const auto& result = stream->result();
+            spdlog::info("[PrintPreparationManager] Piped modification complete ({} lines "
+                         "modified, {} -> {} bytes)",
+                         result.lines_modified, result.original_size, result.modified_size);
+
+            self->start_uploaded_modified_print(file_path, display_filename, remote_temp_path,
+                                                mod_names, on_navigate_to_status, use_plugin);
+        },
+        // Piped transfer failed - retry through local temp files (main thread)
+        [self, alive, file_path, display_filename, ops_to_disable, macro_skip_params, mod_names,
+         on_navigate_to_status, use_plugin](const MoonrakerError& error) {
+            spdlog::warn("[PrintPreparationManager] Piped modification of {} failed ({}), "
+                         "falling back to temp files",
+                         file_path, error.message);
+            ui_queue_update([self, alive, file_path, display_filename, ops_to_disable,
+                             macro_skip_params, mod_names, on_navigate_to_status, use_plugin]() {
+                if (!alive || !*alive) {
+                    return;
+                }
+                self->modify_and_print_streaming(file_path, display_filename, ops_to_disable,
+                                                 macro_skip_params, mod_names,
+                                                 on_navigate_to_status, use_plugin);
+            });
+        },
+        transfer_progress);
 }
 
 void PrintPreparationManager::modify_and_print_streaming(
@@ -1290,20 +1403,7 @@ void PrintPreparationManager::modify_and_print_streaming(
 
             // Step 2: Apply streaming modification (file-to-file, minimal memory)
             gcode::GCodeFileModifier modifier;
-
-            // Disable file-embedded operations (comment them out)
-            modifier.disable_operations(*scan_result, ops_to_disable);
-
-            // Add skip parameters to PRINT_START call (if any)
-            if (!macro_skip_params.empty()) {
-                if (modifier.add_print_start_skip_params(*scan_result, macro_skip_params)) {
-                    spdlog::info("[PrintPreparationManager] Added {} skip params to PRINT_START",
-                                 macro_skip_params.size());
-                } else {
-                    spdlog::warn("[PrintPreparationManager] Could not add skip params - "
-                                 "PRINT_START not found in G-code");
-                }
-            }
+            add_print_modifications(modifier, *scan_result, ops_to_disable, macro_skip_params);
 
             auto result = modifier.apply_streaming(local_download_path);
 
@@ -1349,111 +1449,9 @@ void PrintPreparationManager::modify_and_print_streaming(
                         return;
                     }
 
-                    spdlog::info("[PrintPreparationManager] Modified file uploaded, starting "
-                                 "print (use_plugin={})",
-                                 use_plugin);
-
-                    // Step 4: Start print with modified file
-                    // If plugin available, use path-based API for symlink/history patching
-                    // Otherwise, use standard start_print
-
-                    // Define common callbacks to avoid code duplication
-                    auto on_print_success = [self, on_navigate_to_status, display_filename,
-                                             file_path]() {
-                        spdlog::info("[PrintPreparationManager] Print started with "
-                                     "modified G-code (streaming, original: {})",
-                                     display_filename);
-
-                        // Clear in-progress flag on success
-                        if (self->printer_state_) {
-                            self->printer_state_->set_print_in_progress(false);
-                        }
-
-                        // Defer LVGL operations to main thread
-                        struct PrintStartedData {
-                            std::string display_filename; // For display purposes
-                            std::string original_path;    // Full path for metadata lookup
-                            NavigateToStatusCallback navigate_cb;
-                        };
-                        ui_queue_update<PrintStartedData>(
-                            std::make_unique<PrintStartedData>(PrintStartedData{
-                                display_filename, file_path, on_navigate_to_status}),
-                            [](PrintStartedData* d) {
-                                // Hide overlay now that print is starting
-                                BusyOverlay::hide();
-
-                                // Set thumbnail source override for modified temp files
-                                // Uses original_path (e.g., usb/flowrate_0.gcode) for metadata
-                                // lookup
-                                // - Panel: local gcode viewer and thumbnail display
-                                // - Manager: shared subjects for HomePanel
-                                get_global_print_status_panel().set_thumbnail_source(
-                                    d->original_path);
-                                helix::get_active_print_media_manager().set_thumbnail_source(
-                                    d->original_path);
-
-                                if (d->navigate_cb) {
-                                    d->navigate_cb();
-                                }
-                            });
-                    };
-
-                    auto on_print_error = [self, alive,
-                                           remote_temp_path](const MoonrakerError& error) {
-                        // Hide overlay on error (defer to main thread)
-                        ui_async_call([](void*) { BusyOverlay::hide(); }, nullptr);
-
-                        NOTIFY_ERROR("Failed to start print: {}", error.message);
-                        LOG_ERROR_INTERNAL(
-                            "[PrintPreparationManager] Print start failed for {}: {}",
-                            remote_temp_path, error.message);
-
-                        // Clear in-progress flag on error
-                        if (self->printer_state_) {
-                            self->printer_state_->set_print_in_progress(false);
-                        }
-
-                        // Check if manager still valid before cleanup
-                        if (!alive || !*alive) {
-                            spdlog::debug(
-                                "[PrintPreparationManager] Skipping remote cleanup - manager "
-                                "destroyed");
-                            return;
-                        }
-
-                        // Clean up remote temp file on failure
-                        // Moonraker's delete_file requires full path including root
-                        std::string full_path = "gcodes/" + remote_temp_path;
-                        self->api_->delete_file(
-                            full_path,
-                            []() {
-                                spdlog::debug("[PrintPreparationManager] Cleaned up "
-                                              "remote temp file after print failure");
-                            },
-                            [](const MoonrakerError& /*del_err*/) {
-                                // Ignore delete errors - file may not exist or cleanup
-                                // isn't critical
-                            });
-                    };
-
-                    if (use_plugin) {
-                        // Plugin path: Use path-based API (v2.0)
-                        // The plugin will create symlink, patch history, and start print
-                        self->api_->start_modified_print(
-                            file_path,        // Original filename for history
-                            remote_temp_path, // Path to uploaded modified file
-                            mod_names,
-                            [on_print_success](const ModifiedPrintResult& result) {
-                                spdlog::info("[PrintPreparationManager] Plugin accepted print: "
-                                             "{} -> {}",
-                                             result.original_filename, result.print_filename);
-                                on_print_success();
-                            },
-                            on_print_error);
-                    } else {
-                        // Standard path: Just start print with modified file
-                        self->api_->start_print(remote_temp_path, on_print_success, on_print_error);
-                    }
+                    self->start_uploaded_modified_print(file_path, display_filename,
+                                                        remote_temp_path, mod_names,
+                                                        on_navigate_to_status, use_plugin);
                 },
                 // Upload error - clean up local file
                 [self, modified_path](const MoonrakerError& error) {
@@ -1504,6 +1502,109 @@ void PrintPreparationManager::modify_and_print_streaming(
         download_progress);
 }
 
+void PrintPreparationManager::start_uploaded_modified_print(
+    const std::string& file_path, const std::string& display_filename,
+    const std::string& remote_temp_path, const std::vector<std::string>& mod_names,
+    NavigateToStatusCallback on_navigate_to_status, bool use_plugin) {
+    auto* self = this;
+    auto alive = alive_guard_;
+
+    spdlog::info("[PrintPreparationManager] Modified file uploaded, starting print (use_plugin={})",
+                 use_plugin);
+
+    // Start print with modified file
+    // If plugin available, use path-based API for symlink/history patching
+    // Otherwise, use standard start_print
+
+    // Define common callbacks to avoid code duplication
+    auto on_print_success = [self, on_navigate_to_status, display_filename, file_path]() {
+        spdlog::info("[PrintPreparationManager] Print started with modified G-code (streaming, "
+                     "original: {})",
+                     display_filename);
+
+        // Clear in-progress flag on success
+        if (self->printer_state_) {
+            self->printer_state_->set_print_in_progress(false);
+        }
+
+        // Defer LVGL operations to main thread
+        struct PrintStartedData {
+            std::string display_filename; // For display purposes
+            std::string original_path;    // Full path for metadata lookup
+            NavigateToStatusCallback navigate_cb;
+        };
+        ui_queue_update<PrintStartedData>(
+            std::make_unique<PrintStartedData>(
+                PrintStartedData{display_filename, file_path, on_navigate_to_status}),
+            [](PrintStartedData* d) {
+                // Hide overlay now that print is starting
+                BusyOverlay::hide();
+
+                // Set thumbnail source override for modified temp files
+                // Uses original_path (e.g., usb/flowrate_0.gcode) for metadata lookup
+                // - Panel: local gcode viewer and thumbnail display
+                // - Manager: shared subjects for HomePanel
+                get_global_print_status_panel().set_thumbnail_source(d->original_path);
+                helix::get_active_print_media_manager().set_thumbnail_source(d->original_path);
+
+                if (d->navigate_cb) {
+                    d->navigate_cb();
+                }
+            });
+    };
+
+    auto on_print_error = [self, alive, remote_temp_path](const MoonrakerError& error) {
+        // Hide overlay on error (defer to main thread)
+        ui_async_call([](void*) { BusyOverlay::hide(); }, nullptr);
+
+        NOTIFY_ERROR("Failed to start print: {}", error.message);
+        LOG_ERROR_INTERNAL("[PrintPreparationManager] Print start failed for {}: {}",
+                           remote_temp_path, error.message);
+
+        // Clear in-progress flag on error
+        if (self->printer_state_) {
+            self->printer_state_->set_print_in_progress(false);
+        }
+
+        // Check if manager still valid before cleanup
+        if (!alive || !*alive) {
+            spdlog::debug("[PrintPreparationManager] Skipping remote cleanup - manager destroyed");
+            return;
+        }
+
+        // Clean up remote temp file on failure
+        // Moonraker's delete_file requires full path including root
+        std::string full_path = "gcodes/" + remote_temp_path;
+        self->api_->delete_file(
+            full_path,
+            []() {
+                spdlog::debug(
+                    "[PrintPreparationManager] Cleaned up remote temp file after print failure");
+            },
+            [](const MoonrakerError& /*del_err*/) {
+                // Ignore delete errors - file may not exist or cleanup isn't critical
+            });
+    };
+
+    if (use_plugin) {
+        // Plugin path: Use path-based API (v2.0)
+        // The plugin will create symlink, patch history, and start print
+        api_->start_modified_print(
+            file_path,        // Original filename for history
+            remote_temp_path, // Path to uploaded modified file
+            mod_names,
+            [on_print_success](const ModifiedPrintResult& result) {
+                spdlog::info("[PrintPreparationManager] Plugin accepted print: {} -> {}",
+                             result.original_filename, result.print_filename);
+                on_print_success();
+            },
+            on_print_error);
+    } else {
+        // Standard path: Just start print with modified file
+        api_->start_print(remote_temp_path, on_print_success, on_print_error);
+    }
+}
+
 void PrintPreparationManager::start_print_directly(const std::string& filename,
                                                    NavigateToStatusCallback on_navigate_to_status,
                                                    PrintCompletionCallback on_completion) {
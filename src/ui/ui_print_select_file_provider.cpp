@@ -7,6 +7,7 @@
 #include "ui_print_select_card_view.h"
 #include "ui_update_queue.h"
 
+#include "file_metadata_cache.h"
 #include "moonraker_api.h"
 #include "print_file_data.h"
 #include "thumbnail_cache.h"
@@ -68,6 +69,9 @@ void PrintSelectFileProvider::refresh_files(const std::string& current_path,
          on_err](const std::vector<FileInfo>& files) {
             spdlog::debug("[FileProvider] Received {} items from Moonraker", files.size());
 
+            // Forget cached metadata for files that were deleted or re-uploaded
+            helix::get_file_metadata_cache().revalidate(path_copy, files);
+
             std::vector<PrintFileData> file_list;
 
             // Add ".." parent directory entry if not at root
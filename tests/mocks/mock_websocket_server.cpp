@@ -130,11 +130,17 @@ void MockWebSocketServer::on_any_method(Handler handler) {
     fallback_handler_ = std::move(handler);
 }
 
+void MockWebSocketServer::ignore_method(const std::string& method) {
+    std::lock_guard<std::mutex> lock(handlers_mutex_);
+    ignored_methods_.insert(method);
+}
+
 void MockWebSocketServer::clear_handlers() {
     std::lock_guard<std::mutex> lock(handlers_mutex_);
     handlers_.clear();
     error_handlers_.clear();
     fallback_handler_ = nullptr;
+    ignored_methods_.clear();
 }
 
 void MockWebSocketServer::handle_message(const WebSocketChannelPtr& channel,
@@ -176,6 +182,11 @@ void MockWebSocketServer::handle_message(const WebSocketChannelPtr& channel,
     {
         std::lock_guard<std::mutex> lock(handlers_mutex_);
 
+        if (ignored_methods_.count(method) != 0) {
+            spdlog::debug("[MockWS] Ignoring '{}' (id={})", method, id);
+            return;
+        }
+
         // Check for error handler first
         auto error_it = error_handlers_.find(method);
         if (error_it != error_handlers_.end()) {
@@ -29,6 +29,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -137,6 +138,13 @@ class MockWebSocketServer {
      */
     void on_any_method(Handler handler);
 
+    /**
+     * @brief Never respond to a method (request stays pending until it times out)
+     *
+     * @param method Method name
+     */
+    void ignore_method(const std::string& method);
+
     /**
      * @brief Clear all registered handlers
      */
@@ -218,6 +226,7 @@ class MockWebSocketServer {
     std::map<std::string, Handler> handlers_;
     std::map<std::string, ErrorHandler> error_handlers_;
     Handler fallback_handler_;
+    std::set<std::string> ignored_methods_;
     mutable std::mutex handlers_mutex_;
 
     std::vector<WebSocketChannelPtr> channels_;
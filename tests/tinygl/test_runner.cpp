@@ -11,6 +11,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <thread>
 
 using namespace tinygl_test;
 
@@ -262,6 +263,105 @@ void test_lighting_configurations(TinyGLTestFramework& framework) {
     }
 }
 
+void test_vertex_arrays(TinyGLTestFramework& framework) {
+    print_separator("Vertex Array Submission Test");
+
+    SceneConfig config;
+    config.enable_smooth_shading = true;
+
+    std::cout << "\n🧵 Comparing immediate mode vs glDrawElements on toolpath ribbons...\n\n";
+
+    // Both paths must rasterize the same image from the same first frame
+    ToolpathRibbonScene immediate(40, 50, false);
+    ToolpathRibbonScene arrays(40, 50, true);
+    framework.render_scene(&immediate, config);
+    auto immediate_img = framework.capture_framebuffer_rgb();
+    framework.render_scene(&arrays, config);
+    auto arrays_img = framework.capture_framebuffer_rgb();
+    framework.save_screenshot("tests/tinygl/output/toolpath_ribbons.ppm");
+
+    auto metrics = TinyGLTestFramework::compare_images(immediate_img, arrays_img, 800, 600);
+    bool passed = metrics.psnr >= MIN_PSNR && metrics.max_diff <= MAX_PIXEL_DIFF;
+    std::cout << "  " << (passed ? "✅" : "❌") << " Image match: PSNR " << std::fixed
+              << std::setprecision(2) << metrics.psnr << " dB, max diff "
+              << static_cast<int>(metrics.max_diff) << "/255, " << metrics.diff_pixels
+              << " pixels differ\n";
+    if (g_verify_mode) {
+        g_test_results.push_back(
+            {"Vertex_Arrays", passed, passed ? "" : "Array path differs from immediate", metrics});
+    }
+
+    // Orbiting camera, as when the user drags the 3D view
+    for (int lines : {25, 50, 100}) {
+        ToolpathRibbonScene imm_scene(40, lines, false);
+        ToolpathRibbonScene arr_scene(40, lines, true);
+        auto imm = framework.benchmark_scene(&imm_scene, config, 30);
+        auto arr = framework.benchmark_scene(&arr_scene, config, 30);
+
+        std::cout << "  " << std::setw(7) << imm_scene.get_triangle_count()
+                  << " triangles: " << std::fixed << std::setprecision(1) << "immediate "
+                  << (1000.0 / imm.frame_time_ms) << " FPS, arrays "
+                  << (1000.0 / arr.frame_time_ms) << " FPS (" << std::setprecision(2)
+                  << (imm.frame_time_ms / arr.frame_time_ms) << "x)\n";
+    }
+}
+
+void test_raster_threads(TinyGLTestFramework& framework) {
+    print_separator("Multi-threaded Rasterization Test");
+
+    std::cout << "\n🧵 Binned tile fills on 1-4 threads (" << std::thread::hardware_concurrency()
+              << " cores available)...\n\n";
+
+    struct Mode {
+        const char* name;
+        bool smooth;
+        bool phong;
+    };
+    const Mode modes[] = {{"flat", false, false}, {"smooth", true, false}, {"phong", true, true}};
+
+    for (const auto& mode : modes) {
+        SceneConfig config;
+        config.enable_smooth_shading = mode.smooth;
+        config.enable_phong_shading = mode.phong;
+
+        // Threads only split the fill work, so every tile must match direct rasterization.
+        // Each image comes from a fresh scene so the orbiting camera starts at the same angle.
+        framework.set_raster_threads(1);
+        ToolpathRibbonScene direct_scene(40, 50, true);
+        framework.render_scene(&direct_scene, config);
+        auto direct_img = framework.capture_framebuffer_rgb();
+        auto direct = framework.benchmark_scene(&direct_scene, config, 20);
+
+        std::cout << "  " << std::setw(6) << std::left << mode.name << std::right
+                  << " 1 thread : " << std::fixed << std::setprecision(1)
+                  << (1000.0 / direct.frame_time_ms) << " FPS\n";
+
+        for (int threads = 2; threads <= 4; threads++) {
+            framework.set_raster_threads(threads);
+            ToolpathRibbonScene binned_scene(40, 50, true);
+            framework.render_scene(&binned_scene, config);
+            auto binned_img = framework.capture_framebuffer_rgb();
+            auto binned = framework.benchmark_scene(&binned_scene, config, 20);
+
+            auto metrics = TinyGLTestFramework::compare_images(direct_img, binned_img, 800, 600);
+            bool passed = metrics.diff_pixels == 0;
+            std::cout << "  " << std::setw(6) << std::left << mode.name << std::right << " "
+                      << threads << " threads: " << std::fixed << std::setprecision(1)
+                      << (1000.0 / binned.frame_time_ms) << " FPS (" << std::setprecision(2)
+                      << (direct.frame_time_ms / binned.frame_time_ms) << "x) "
+                      << (passed ? "✅" : "❌") << " " << metrics.diff_pixels
+                      << " pixels differ\n";
+            if (g_verify_mode) {
+                g_test_results.push_back({std::string("Raster_Threads_") + mode.name + "_" +
+                                              std::to_string(threads),
+                                          passed, passed ? "" : "Binned fill differs from direct",
+                                          metrics});
+            }
+        }
+    }
+    framework.set_raster_threads(1);
+}
+
 void generate_reference_images(TinyGLTestFramework& framework) {
     print_separator("Generating Reference Images");
 
@@ -460,6 +560,8 @@ int main(int argc, char** argv) {
             std::cout << "  performance - Performance benchmarks\n";
             std::cout << "  lighting    - Lighting configuration tests\n";
             std::cout << "  phong       - Phong vs Gouraud comparison\n";
+            std::cout << "  arrays      - Vertex arrays vs immediate mode\n";
+            std::cout << "  threads     - Multi-threaded rasterization vs direct\n";
             std::cout << "  reference   - Generate reference images\n\n";
             std::cout << "Options:\n";
             std::cout << "  --verify    - Verify rendering against reference images\n";
@@ -511,6 +613,10 @@ int main(int argc, char** argv) {
         test_lighting_configurations(framework);
     } else if (test_name == "phong") {
         test_phong_vs_gouraud(framework);
+    } else if (test_name == "arrays") {
+        test_vertex_arrays(framework);
+    } else if (test_name == "threads") {
+        test_raster_threads(framework);
     } else if (test_name == "reference") {
         generate_reference_images(framework);
     } else if (test_name == "all") {
@@ -525,7 +631,8 @@ int main(int argc, char** argv) {
     } else {
         std::cout << "Unknown test: " << test_name << "\n";
         std::cout
-            << "Available tests: all, basic, gouraud, banding, performance, lighting, reference\n";
+            << "Available tests: all, basic, gouraud, banding, performance, lighting, arrays, "
+               "threads, reference\n";
         std::cout << "Run with --help for full usage information\n";
         return 1;
     }
@@ -108,7 +108,11 @@ void TinyGLTestFramework::setup_standard_lighting(const SceneConfig& config) {
     }
 
     // Setup shading model
-    glShadeModel(config.enable_smooth_shading ? GL_SMOOTH : GL_FLAT);
+    if (config.enable_phong_shading) {
+        glShadeModel(GL_PHONG);
+    } else {
+        glShadeModel(config.enable_smooth_shading ? GL_SMOOTH : GL_FLAT);
+    }
 
     // Enable depth testing if requested
     if (config.enable_depth) {
@@ -126,6 +130,10 @@ void TinyGLTestFramework::set_phong_shading(bool enable) {
     glShadeModel(enable ? GL_PHONG : GL_SMOOTH);
 }
 
+void TinyGLTestFramework::set_raster_threads(int threads) {
+    glSetRasterThreads(threads);
+}
+
 void TinyGLTestFramework::render_scene(TestScene* scene, const SceneConfig& config) {
     setup_standard_lighting(config);
     clear_buffers();
@@ -133,11 +141,13 @@ void TinyGLTestFramework::render_scene(TestScene* scene, const SceneConfig& conf
     scene->setup(config);
     scene->render();
 
-    // No need to flush in software renderer
+    // Wait for binned triangle fills (no-op when rasterizing directly)
+    glFinish();
 }
 
 std::vector<uint8_t> TinyGLTestFramework::capture_framebuffer_rgb() {
     // Copy framebuffer from TinyGL
+    glFinish();
     ZB_copyFrameBuffer(zb_, framebuffer_.data(), width_ * sizeof(unsigned int));
 
     // Convert to RGB24
@@ -222,6 +232,7 @@ PerfMetrics TinyGLTestFramework::benchmark_scene(TestScene* scene, const SceneCo
     // Warm-up render
     clear_buffers();
     scene->render();
+    glFinish();
 
     // Benchmark multiple frames
     auto start = std::chrono::high_resolution_clock::now();
@@ -229,6 +240,7 @@ PerfMetrics TinyGLTestFramework::benchmark_scene(TestScene* scene, const SceneCo
     for (int i = 0; i < num_frames; i++) {
         clear_buffers();
         scene->render();
+        glFinish();
     }
 
     auto end = std::chrono::high_resolution_clock::now();
@@ -656,6 +668,121 @@ void ColorBandingScene::render_smooth_sphere() {
     }
 }
 
+// ============================================================================
+// ToolpathRibbonScene Implementation
+// ============================================================================
+
+ToolpathRibbonScene::ToolpathRibbonScene(int layers, int lines_per_layer, bool use_vertex_arrays)
+    : layers_(layers), lines_per_layer_(lines_per_layer), use_vertex_arrays_(use_vertex_arrays),
+      rotation_(0.0f) {
+    generate_ribbons();
+}
+
+void ToolpathRibbonScene::setup(const SceneConfig& /*config*/) {
+    // Geometry is generated once in the constructor
+}
+
+void ToolpathRibbonScene::generate_ribbons() {
+    // Zig-zag infill on a 4x4 square, alternating direction per layer. Each line
+    // is cut into short segments, as sliced curves are.
+    const int segments_per_line = 20;
+    const float size = 4.0f;
+    const float layer_height = 0.1f;
+    const float half_width = 0.5f * size / lines_per_layer_;
+
+    auto push_vertex = [this](float x, float y, float z, float nx, float ny, float nz,
+                              const uint8_t* rgba) {
+        positions_.insert(positions_.end(), {x, y, z});
+        normals_.insert(normals_.end(), {nx, ny, nz});
+        colors_.insert(colors_.end(), rgba, rgba + 4);
+    };
+
+    for (int layer = 0; layer < layers_; layer++) {
+        layer_first_strip_.push_back(indices_.size() / 6);
+        float y = layer * layer_height - 2.0f;
+        uint8_t rgba[4] = {static_cast<uint8_t>(64 + (layer * 191) / std::max(layers_ - 1, 1)),
+                           static_cast<uint8_t>(200 - (layer * 150) / std::max(layers_ - 1, 1)),
+                           96, 255};
+
+        for (int line = 0; line < lines_per_layer_; line++) {
+            float across = -0.5f * size + (line + 0.5f) * size / lines_per_layer_;
+            // Tilt the ribbon normal slightly so lighting varies between lines
+            float tilt = (line & 1) ? 0.2f : -0.2f;
+            float nlen = sqrtf(1.0f + tilt * tilt);
+            float nx = (layer & 1) ? 0.0f : tilt / nlen;
+            float nz = (layer & 1) ? tilt / nlen : 0.0f;
+            float ny = 1.0f / nlen;
+
+            // Consecutive segments share their boundary vertex pair
+            auto line_base = static_cast<uint32_t>(positions_.size() / 3);
+            for (int seg = 0; seg <= segments_per_line; seg++) {
+                float along = -0.5f * size + seg * size / segments_per_line;
+                for (float side : {-half_width, half_width}) {
+                    float x = (layer & 1) ? across + side : along;
+                    float z = (layer & 1) ? along : across + side;
+                    push_vertex(x, y, z, nx, ny, nz, rgba);
+                }
+            }
+            for (int seg = 0; seg < segments_per_line; seg++) {
+                uint32_t base = line_base + 2 * static_cast<uint32_t>(seg);
+                indices_.insert(indices_.end(),
+                                {base, base + 1, base + 2, base + 2, base + 1, base + 3});
+            }
+        }
+    }
+    layer_first_strip_.push_back(indices_.size() / 6);
+}
+
+void ToolpathRibbonScene::render_immediate(size_t first_strip, size_t strip_count) {
+    for (size_t s = first_strip; s < first_strip + strip_count; s++) {
+        uint32_t base = indices_[s * 6];
+        glBegin(GL_TRIANGLE_STRIP);
+        for (uint32_t v = base; v < base + 4; v++) {
+            glNormal3f(normals_[v * 3], normals_[v * 3 + 1], normals_[v * 3 + 2]);
+            glColor4f(colors_[v * 4] / 255.0f, colors_[v * 4 + 1] / 255.0f,
+                      colors_[v * 4 + 2] / 255.0f, colors_[v * 4 + 3] / 255.0f);
+            glVertex3f(positions_[v * 3], positions_[v * 3 + 1], positions_[v * 3 + 2]);
+        }
+        glEnd();
+    }
+}
+
+void ToolpathRibbonScene::render() {
+    glPushMatrix();
+    glTranslatef(0.0f, 0.0f, -9.0f);
+    glRotatef(25.0f, 1.0f, 0.0f, 0.0f);
+    glRotatef(rotation_, 0.0f, 1.0f, 0.0f); // Orbit like the G-code viewer camera
+
+    if (use_vertex_arrays_) {
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_NORMAL_ARRAY);
+        glEnableClientState(GL_COLOR_ARRAY);
+        glVertexPointer(3, GL_FLOAT, 0, positions_.data());
+        glNormalPointer(GL_FLOAT, 0, normals_.data());
+        glColorPointer(4, GL_UNSIGNED_BYTE, 0, colors_.data());
+    }
+
+    for (int layer = 0; layer < layers_; layer++) {
+        size_t first = layer_first_strip_[layer];
+        size_t count = layer_first_strip_[layer + 1] - first;
+        if (use_vertex_arrays_) {
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(count * 6), GL_UNSIGNED_INT,
+                           indices_.data() + first * 6);
+        } else {
+            render_immediate(first, count);
+        }
+    }
+
+    if (use_vertex_arrays_) {
+        glDisableClientState(GL_VERTEX_ARRAY);
+        glDisableClientState(GL_NORMAL_ARRAY);
+        glDisableClientState(GL_COLOR_ARRAY);
+    }
+
+    glPopMatrix();
+    rotation_ += 2.0f; // For animated tests
+}
+
 // ============================================================================
 // Utility Functions Implementation
 // ============================================================================
@@ -48,6 +48,7 @@ struct SceneConfig {
     float ambient_intensity = 0.3f;
     float specular_intensity = 0.05f;
     float specular_shininess = 32.0f;
+    bool enable_phong_shading = false; // Overrides enable_smooth_shading
 };
 
 // Base class for test scenes
@@ -105,6 +106,9 @@ class TinyGLTestFramework {
     // Enable/disable Phong shading
     void set_phong_shading(bool enable);
 
+    // Fill triangles on this many threads (binned raster tiles); 1 = direct
+    void set_raster_threads(int threads);
+
   private:
     int width_;
     int height_;
@@ -207,6 +211,39 @@ class ColorBandingScene : public TestScene {
     void render_smooth_sphere();
 };
 
+// Sliced-print stand-in: one 4-vertex ribbon strip per extrusion segment, the
+// way GCodeTinyGLRenderer submits toolpaths. Renders either per-strip
+// glBegin/glEnd (immediate) or one glDrawElements per layer (vertex arrays).
+class ToolpathRibbonScene : public TestScene {
+  public:
+    ToolpathRibbonScene(int layers = 40, int lines_per_layer = 50, bool use_vertex_arrays = false);
+    void setup(const SceneConfig& config) override;
+    void render() override;
+    size_t get_vertex_count() const override {
+        return positions_.size() / 3;
+    }
+    size_t get_triangle_count() const override {
+        return indices_.size() / 3;
+    }
+    std::string get_name() const override {
+        return use_vertex_arrays_ ? "Toolpath Ribbons (arrays)" : "Toolpath Ribbons (immediate)";
+    }
+
+  private:
+    int layers_;
+    int lines_per_layer_;
+    bool use_vertex_arrays_;
+    float rotation_;
+    std::vector<float> positions_;
+    std::vector<float> normals_;
+    std::vector<uint8_t> colors_;   // RGBA
+    std::vector<uint32_t> indices_; // 6 per strip: {s0,s1,s2, s2,s1,s3}
+    std::vector<size_t> layer_first_strip_;
+
+    void generate_ribbons();
+    void render_immediate(size_t first_strip, size_t strip_count);
+};
+
 // Utility functions
 namespace utils {
 // Generate test G-code for rendering
@@ -0,0 +1,141 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "bed_mesh_geometry.h"
+#include "bed_mesh_internal.h"
+
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::mesh;
+
+namespace {
+
+/// Minimal 3x3 renderer state, enough for quad generation without LVGL drawing
+void load_mesh(bed_mesh_renderer_t& renderer) {
+    renderer.mesh = {{0.0, 0.1, 0.2}, {0.1, 0.2, 0.3}, {0.2, 0.3, 0.4}};
+    renderer.rows = 3;
+    renderer.cols = 3;
+    renderer.has_mesh_data = true;
+    renderer.mesh_min_z = 0.0;
+    renderer.mesh_max_z = 0.4;
+    renderer.cached_z_center = 0.2;
+    renderer.color_min_z = 0.0;
+    renderer.color_max_z = 0.4;
+    renderer.view_state.z_scale = BED_MESH_DEFAULT_Z_SCALE;
+    renderer.show_zero_plane = true;
+}
+
+bed_mesh_frame_key base_key() {
+    bed_mesh_frame_key key;
+    key.valid = true;
+    key.geometry_revision = 3;
+    key.color_revision = 1;
+    key.angle_x = 30.0;
+    key.angle_z = 45.0;
+    key.z_scale = 60.0;
+    key.fov_scale = 150.0;
+    key.canvas_width = 480;
+    key.canvas_height = 320;
+    return key;
+}
+
+} // namespace
+
+TEST_CASE("Bed Mesh Frame Cache: keys separate projection from surface inputs",
+          "[bed_mesh][cache]") {
+    bed_mesh_frame_key cached = base_key();
+
+    SECTION("Identical inputs reuse both") {
+        bed_mesh_frame_key key = base_key();
+        REQUIRE(key.same_projection(cached));
+        REQUIRE(key.same_surface(cached));
+    }
+
+    SECTION("Color or fill mode changes keep the projection") {
+        bed_mesh_frame_key recolored = base_key();
+        recolored.color_revision++;
+        REQUIRE(recolored.same_projection(cached));
+        REQUIRE_FALSE(recolored.same_surface(cached));
+
+        bed_mesh_frame_key dragging = base_key();
+        dragging.is_dragging = true;
+        REQUIRE(dragging.same_projection(cached));
+        REQUIRE_FALSE(dragging.same_surface(cached));
+    }
+
+    SECTION("View, geometry and canvas changes invalidate everything") {
+        bed_mesh_frame_key key = base_key();
+        key.angle_z += 0.5;
+        REQUIRE_FALSE(key.same_projection(cached));
+
+        key = base_key();
+        key.geometry_revision++;
+        REQUIRE_FALSE(key.same_projection(cached));
+
+        key = base_key();
+        key.layer_offset_y = 40;
+        REQUIRE_FALSE(key.same_projection(cached));
+
+        key = base_key();
+        key.canvas_width = 800;
+        REQUIRE_FALSE(key.same_surface(cached));
+    }
+
+    SECTION("An unset key never matches") {
+        bed_mesh_frame_key empty;
+        REQUIRE_FALSE(empty.same_projection(empty));
+        REQUIRE_FALSE(base_key().same_surface(empty));
+    }
+}
+
+TEST_CASE("Bed Mesh Frame Cache: recoloring keeps geometry and projections",
+          "[bed_mesh][cache]") {
+    bed_mesh_renderer_t renderer{};
+    load_mesh(renderer);
+
+    generate_mesh_quads(&renderer);
+    REQUIRE(renderer.quads.size() > 4); // 2x2 mesh quads plus zero plane
+    uint32_t geometry_revision = renderer.geometry_revision;
+    uint32_t color_revision = renderer.color_revision;
+
+    // Stand-in for a projection done by the previous frame
+    for (size_t i = 0; i < renderer.quads.size(); i++) {
+        renderer.quads[i].screen_x[0] = static_cast<int>(i) * 10;
+    }
+    lv_color_t mesh_before = renderer.quads[0].vertices[0].color;
+    lv_color_t plane_before = renderer.quads.back().center_color;
+
+    renderer.color_min_z = -1.0;
+    renderer.color_max_z = 1.0;
+    recolor_mesh_quads(&renderer);
+
+    REQUIRE(renderer.geometry_revision == geometry_revision);
+    REQUIRE(renderer.color_revision == color_revision + 1);
+    for (size_t i = 0; i < renderer.quads.size(); i++) {
+        REQUIRE(renderer.quads[i].screen_x[0] == static_cast<int>(i) * 10);
+    }
+
+    lv_color_t mesh_after = renderer.quads[0].vertices[0].color;
+    bool recolored = mesh_after.red != mesh_before.red || mesh_after.green != mesh_before.green ||
+                     mesh_after.blue != mesh_before.blue;
+    REQUIRE(recolored);
+
+    // Colors match a full regeneration with the same range
+    std::vector<bed_mesh_quad_3d_t> recolored_quads = renderer.quads;
+    generate_mesh_quads(&renderer);
+    REQUIRE(renderer.geometry_revision == geometry_revision + 1);
+    for (size_t i = 0; i < 4; i++) {
+        for (int v = 0; v < 4; v++) {
+            REQUIRE(renderer.quads[i].vertices[v].color.red ==
+                    recolored_quads[i].vertices[v].color.red);
+            REQUIRE(renderer.quads[i].vertices[v].color.blue ==
+                    recolored_quads[i].vertices[v].color.blue);
+        }
+        REQUIRE(renderer.quads[i].center_color.green == recolored_quads[i].center_color.green);
+    }
+
+    // The translucent zero plane keeps its fixed color
+    REQUIRE(renderer.quads.back().center_color.red == plane_before.red);
+}
@@ -0,0 +1,270 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "bed_mesh_rasterizer.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::mesh;
+using Vertex = MeshSpanRasterizer::Vertex;
+
+namespace {
+
+/// ARGB8888 test target (B, G, R, A bytes per pixel)
+struct Target {
+    int width;
+    int height;
+    std::vector<uint8_t> pixels;
+
+    Target(int w, int h) : width(w), height(h), pixels(static_cast<size_t>(w) * h * 4, 0) {}
+
+    const uint8_t* at(int x, int y) const {
+        return pixels.data() + (static_cast<size_t>(y) * width + x) * 4;
+    }
+
+    void begin(MeshSpanRasterizer& raster, int origin_x = 0, int origin_y = 0) {
+        raster.begin(pixels.data(), width, height, width * 4, origin_x, origin_y);
+    }
+
+    int covered() const {
+        int count = 0;
+        for (size_t i = 3; i < pixels.size(); i += 4) {
+            count += pixels[i] != 0 ? 1 : 0;
+        }
+        return count;
+    }
+};
+
+Vertex vtx(int x, int y, uint16_t depth, lv_color_t color = lv_color_make(0, 0, 0)) {
+    return Vertex{x, y, depth, color};
+}
+
+} // namespace
+
+TEST_CASE("MeshSpanRasterizer - Solid fill covers the triangle interior",
+          "[bed_mesh][rasterizer]") {
+    Target target(32, 32);
+    MeshSpanRasterizer raster;
+    target.begin(raster);
+
+    lv_color_t red = lv_color_make(255, 0, 0);
+    raster.fill_triangle_solid(vtx(0, 0, 100), vtx(20, 0, 100), vtx(0, 20, 100), red);
+
+    // Right triangle with legs of 20: half of 20x20, plus the diagonal's pixel centers
+    REQUIRE(target.covered() == 210);
+    REQUIRE(raster.pixels_drawn() == 210);
+
+    const uint8_t* inside = target.at(5, 5);
+    REQUIRE(inside[2] == 255);
+    REQUIRE(inside[1] == 0);
+    REQUIRE(inside[0] == 0);
+    REQUIRE(inside[3] == 255);
+    REQUIRE(target.at(15, 15)[3] == 0);
+}
+
+TEST_CASE("MeshSpanRasterizer - Shared edges are drawn exactly once",
+          "[bed_mesh][rasterizer]") {
+    Target target(64, 64);
+    MeshSpanRasterizer raster;
+    target.begin(raster);
+
+    // Quad split along a diagonal, as the renderer does. The second triangle is
+    // nearer so any pixel drawn by both would be counted twice.
+    Vertex bl = vtx(3, 50, 200), br = vtx(47, 57, 200), tl = vtx(9, 6, 200), tr = vtx(52, 11, 200);
+    raster.fill_triangle_solid(bl, br, tl, lv_color_make(255, 0, 0));
+    Vertex br2 = br, tl2 = tl, tr2 = tr;
+    br2.depth = tl2.depth = tr2.depth = 100;
+    raster.fill_triangle_solid(br2, tl2, tr2, lv_color_make(0, 0, 255));
+
+    REQUIRE(raster.pixels_drawn() == static_cast<size_t>(target.covered()));
+
+    // No holes between the two triangles inside the quad
+    for (int y = 12; y < 50; ++y) {
+        for (int x = 12; x < 45; ++x) {
+            INFO("pixel " << x << "," << y);
+            REQUIRE(target.at(x, y)[3] == 255);
+        }
+    }
+}
+
+TEST_CASE("MeshSpanRasterizer - Depth test is independent of draw order",
+          "[bed_mesh][rasterizer]") {
+    lv_color_t near_color = lv_color_make(0, 255, 0);
+    lv_color_t far_color = lv_color_make(0, 0, 255);
+
+    auto draw = [&](bool near_first) {
+        Target target(32, 32);
+        MeshSpanRasterizer raster;
+        target.begin(raster);
+        auto draw_near = [&] {
+            raster.fill_triangle_solid(vtx(0, 0, 10), vtx(30, 0, 10), vtx(0, 30, 10), near_color);
+        };
+        auto draw_far = [&] {
+            raster.fill_triangle_solid(vtx(2, 2, 500), vtx(32, 2, 500), vtx(2, 32, 500),
+                                       far_color);
+        };
+        if (near_first) {
+            draw_near();
+            draw_far();
+        } else {
+            draw_far();
+            draw_near();
+        }
+        return target;
+    };
+
+    Target a = draw(true);
+    Target b = draw(false);
+    REQUIRE(a.pixels == b.pixels);
+
+    // Overlap shows the near triangle
+    REQUIRE(a.at(5, 5)[1] == 255);
+    REQUIRE(a.at(5, 5)[0] == 0);
+}
+
+TEST_CASE("MeshSpanRasterizer - Gradient interpolates corner colors",
+          "[bed_mesh][rasterizer]") {
+    Target target(128, 128);
+    MeshSpanRasterizer raster;
+    target.begin(raster);
+
+    raster.fill_triangle_gradient(vtx(0, 0, 100, lv_color_make(255, 0, 0)),
+                                  vtx(120, 0, 100, lv_color_make(0, 255, 0)),
+                                  vtx(0, 120, 100, lv_color_make(0, 0, 255)));
+
+    // Near each corner the corner's color dominates
+    REQUIRE(target.at(1, 1)[2] >= 250);
+    REQUIRE(target.at(117, 1)[1] >= 245);
+    REQUIRE(target.at(1, 117)[0] >= 245);
+
+    // Midpoint of the top edge is half red, half green
+    const uint8_t* mid = target.at(60, 0);
+    REQUIRE(std::abs(mid[2] - 127) <= 2);
+    REQUIRE(std::abs(mid[1] - 127) <= 2);
+    REQUIRE(mid[0] <= 1);
+}
+
+TEST_CASE("MeshSpanRasterizer - Translucent triangles blend and keep depth",
+          "[bed_mesh][rasterizer]") {
+    Target target(32, 32);
+    MeshSpanRasterizer raster;
+    target.begin(raster);
+
+    lv_color_t white = lv_color_make(255, 255, 255);
+    lv_color_t black = lv_color_make(0, 0, 0);
+
+    // Opaque white in the left half, then a 50% black plane over everything
+    raster.fill_triangle_solid(vtx(0, 0, 100), vtx(16, 0, 100), vtx(0, 32, 100), white);
+    raster.fill_triangle_solid(vtx(16, 0, 100), vtx(16, 32, 100), vtx(0, 32, 100), white);
+    raster.fill_triangle_solid(vtx(0, 0, 50), vtx(32, 0, 50), vtx(0, 32, 50), black, LV_OPA_50);
+
+    SECTION("Over an opaque pixel the result is opaque and mixed") {
+        const uint8_t* px = target.at(4, 4);
+        REQUIRE(px[3] == 255);
+        REQUIRE(std::abs(px[0] - 128) <= 2);
+    }
+
+    SECTION("Over an empty pixel the plane keeps its own alpha") {
+        const uint8_t* px = target.at(20, 4);
+        REQUIRE(px[3] == LV_OPA_50);
+        REQUIRE(px[0] == 0);
+    }
+
+    SECTION("Translucent pixels do not occlude later opaque ones") {
+        raster.fill_triangle_solid(vtx(16, 0, 10), vtx(32, 0, 10), vtx(16, 16, 10), white);
+        REQUIRE(target.at(20, 4)[3] == 255);
+        REQUIRE(target.at(20, 4)[0] == 255);
+    }
+
+    SECTION("Translucent pixels behind opaque ones are hidden") {
+        const uint8_t before = target.at(4, 4)[0];
+        raster.fill_triangle_solid(vtx(0, 0, 900), vtx(32, 0, 900), vtx(0, 32, 900), black,
+                                   LV_OPA_50);
+        REQUIRE(target.at(4, 4)[0] == before);
+    }
+}
+
+TEST_CASE("MeshSpanRasterizer - Screen origin and clipping", "[bed_mesh][rasterizer]") {
+    Target target(16, 16);
+    MeshSpanRasterizer raster;
+    target.begin(raster, 100, 200);
+
+    // Screen-space triangle that extends well past the buffer on every side
+    raster.fill_triangle_solid(vtx(50, 150, 100), vtx(400, 150, 100), vtx(50, 500, 100),
+                               lv_color_make(255, 255, 255));
+    REQUIRE(target.covered() == 16 * 16);
+
+    // Fully off-buffer triangles draw nothing
+    Target other(16, 16);
+    other.begin(raster, 100, 200);
+    raster.fill_triangle_solid(vtx(0, 0, 100), vtx(50, 0, 100), vtx(0, 50, 100),
+                               lv_color_make(255, 255, 255));
+    REQUIRE(raster.pixels_drawn() == 0);
+}
+
+TEST_CASE("MeshSpanRasterizer - 20x20 mesh frame time", "[bed_mesh][rasterizer][.benchmark]") {
+    constexpr int W = 800;
+    constexpr int H = 480;
+    constexpr int N = 20;
+
+    // Tilted, perspective-ish grid filling most of the canvas
+    std::vector<Vertex> grid;
+    for (int r = 0; r <= N; ++r) {
+        for (int c = 0; c <= N; ++c) {
+            double t = static_cast<double>(r) / N;
+            double half_width = 250.0 + 120.0 * t;
+            int x = static_cast<int>(W / 2 + (c / static_cast<double>(N) - 0.5) * 2 * half_width);
+            int y = static_cast<int>(60 + t * 360 + 15.0 * std::sin(c * 0.7 + r * 0.3));
+            auto shade = static_cast<uint8_t>((r * 13 + c * 7) % 256);
+            grid.push_back(vtx(x, y, static_cast<uint16_t>(60000 - r * 2500),
+                               lv_color_make(shade, 255 - shade, 128)));
+        }
+    }
+
+    Target target(W, H);
+    MeshSpanRasterizer raster;
+    auto frame = [&](bool gradient) {
+        std::fill(target.pixels.begin(), target.pixels.end(), 0);
+        target.begin(raster);
+        for (int r = 0; r < N; ++r) {
+            for (int c = 0; c < N; ++c) {
+                const Vertex& bl = grid[(r + 1) * (N + 1) + c];
+                const Vertex& br = grid[(r + 1) * (N + 1) + c + 1];
+                const Vertex& tl = grid[r * (N + 1) + c];
+                const Vertex& tr = grid[r * (N + 1) + c + 1];
+                if (gradient) {
+                    raster.fill_triangle_gradient(bl, br, tl);
+                    raster.fill_triangle_gradient(br, tl, tr);
+                } else {
+                    raster.fill_triangle_solid(bl, br, tl, bl.color);
+                    raster.fill_triangle_solid(br, tl, tr, bl.color);
+                }
+            }
+        }
+    };
+
+    size_t gradient_pixels = 0;
+    for (bool gradient : {true, false}) {
+        constexpr int FRAMES = 50;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < FRAMES; ++i) {
+            frame(gradient);
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                              start)
+                        .count() /
+                    FRAMES;
+        WARN((gradient ? "Gradient" : "Solid") << " surface: " << ms << " ms/frame, "
+                                               << raster.pixels_drawn() << " px");
+        if (gradient) {
+            gradient_pixels = raster.pixels_drawn();
+        }
+    }
+    REQUIRE(raster.pixels_drawn() > static_cast<size_t>(W * H / 4));
+    REQUIRE(raster.pixels_drawn() == gradient_pixels); // Same coverage either way
+}
@@ -309,6 +309,18 @@ TEST_CASE_METHOD(ColorSensorTestFixture, "ColorSensorManager - state updates", "
 
         REQUIRE(mgr().has_sensors());
     }
+
+    SECTION("Routing interest covers device IDs only") {
+        REQUIRE(mgr().handles_status_object("TD1_DEVICE_001"));
+        REQUIRE(mgr().handles_status_object("E6625877D318C430"));
+        REQUIRE(mgr().handles_status_object("td1_lane0"));
+        REQUIRE(mgr().handles_status_object("td1_sensor default"));
+        REQUIRE_FALSE(mgr().handles_status_object("extruder"));
+        REQUIRE_FALSE(mgr().handles_status_object("print_stats"));
+        REQUIRE_FALSE(mgr().handles_status_object("temperature_sensor chamber"));
+        REQUIRE_FALSE(mgr().handles_status_object("gcode_macro START_PRINT"));
+        REQUIRE_FALSE(mgr().handles_status_object(""));
+    }
 }
 
 // ============================================================================
@@ -0,0 +1,268 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "file_metadata_cache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix;
+
+namespace {
+
+std::string make_temp_dir(const char* name) {
+    auto dir = std::filesystem::temp_directory_path() /
+               (std::string("helix_metadata_test_") + name + "_" + std::to_string(rand()));
+    std::filesystem::remove_all(dir);
+    return dir.string();
+}
+
+FileMetadata sample_metadata(const std::string& filename, double estimated_time = 3600.0) {
+    FileMetadata metadata;
+    metadata.filename = filename;
+    metadata.size = 123456;
+    metadata.modified = 1700000000.5;
+    metadata.slicer = "OrcaSlicer";
+    metadata.layer_count = 250;
+    metadata.object_height = 50.0;
+    metadata.estimated_time = estimated_time;
+    metadata.filament_weight_total = 12.5;
+    metadata.filament_type = "PLA";
+    metadata.layer_height = 0.2;
+    metadata.filament_colors = {"#ED1C24", "#00C1AE"};
+    metadata.uuid = "abc-123";
+    metadata.thumbnails = {{".thumbs/" + filename + "-32x32.png", 32, 32},
+                           {".thumbs/" + filename + "-300x300.png", 300, 300}};
+    return metadata;
+}
+
+FileInfo listed(const std::string& filename, double modified) {
+    FileInfo info;
+    info.filename = filename;
+    info.modified = modified;
+    return info;
+}
+
+// Fetcher that completes later, when the test releases it
+struct DeferredFetches {
+    std::vector<std::pair<std::string, FileMetadataCache::MetadataCallback>> pending;
+
+    FileMetadataCache::Fetcher fetcher(const std::string& path) {
+        return [this, path](FileMetadataCache::MetadataCallback on_success,
+                            FileMetadataCache::FailureCallback) {
+            pending.emplace_back(path, std::move(on_success));
+        };
+    }
+
+    void complete_first() {
+        auto [path, on_success] = std::move(pending.front());
+        pending.erase(pending.begin());
+        on_success(sample_metadata(path));
+    }
+};
+
+} // namespace
+
+TEST_CASE("FileMetadataCache - JSON round trip", "[file_metadata_cache]") {
+    FileMetadata original = sample_metadata("benchy.gcode");
+    FileMetadata copy = file_metadata_from_json(file_metadata_to_json(original));
+
+    REQUIRE(copy.filename == original.filename);
+    REQUIRE(copy.size == original.size);
+    REQUIRE(copy.modified == original.modified);
+    REQUIRE(copy.slicer == original.slicer);
+    REQUIRE(copy.layer_count == original.layer_count);
+    REQUIRE(copy.estimated_time == original.estimated_time);
+    REQUIRE(copy.filament_weight_total == original.filament_weight_total);
+    REQUIRE(copy.filament_type == original.filament_type);
+    REQUIRE(copy.filament_colors == original.filament_colors);
+    REQUIRE(copy.uuid == original.uuid);
+    REQUIRE(copy.thumbnails.size() == 2);
+    REQUIRE(copy.thumbnails[1].relative_path == original.thumbnails[1].relative_path);
+    REQUIRE(copy.thumbnails[1].width == 300);
+
+    SECTION("Missing or mistyped fields keep defaults") {
+        FileMetadata partial =
+            file_metadata_from_json({{"filename", "a.gcode"}, {"layer_count", "many"}});
+        REQUIRE(partial.filename == "a.gcode");
+        REQUIRE(partial.layer_count == 0);
+        REQUIRE(partial.thumbnails.empty());
+    }
+}
+
+TEST_CASE("FileMetadataCache - Keyed by path and modified time", "[file_metadata_cache]") {
+    FileMetadataCache cache("");
+    cache.store("dir/a.gcode", 1000.25, sample_metadata("a.gcode"));
+
+    REQUIRE(cache.lookup("dir/a.gcode", 1000.75).has_value()); // Same second
+    REQUIRE_FALSE(cache.lookup("dir/a.gcode", 1001.0).has_value());
+    REQUIRE_FALSE(cache.lookup("a.gcode", 1000.0).has_value());
+}
+
+TEST_CASE("FileMetadataCache - Persists across instances", "[file_metadata_cache]") {
+    std::string dir = make_temp_dir("persist");
+    {
+        FileMetadataCache cache(dir);
+        cache.store("a.gcode", 1000, sample_metadata("a.gcode"));
+        cache.store("sub/b.gcode", 2000, sample_metadata("b.gcode", 60.0));
+        REQUIRE(cache.flush());
+    }
+
+    FileMetadataCache reloaded(dir);
+    auto b = reloaded.lookup("sub/b.gcode", 2000);
+    REQUIRE(b.has_value());
+    REQUIRE(b->estimated_time == 60.0);
+    REQUIRE(b->thumbnails.size() == 2);
+    REQUIRE(reloaded.stats().entries == 2);
+
+    SECTION("Corrupt file is discarded") {
+        {
+            std::ofstream out(reloaded.file_path(), std::ios::trunc);
+            out << "{ not json";
+        }
+        FileMetadataCache corrupt(dir);
+        REQUIRE_FALSE(corrupt.lookup("a.gcode", 1000).has_value());
+    }
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("FileMetadataCache - Revalidate against listing", "[file_metadata_cache]") {
+    FileMetadataCache cache("");
+    cache.store("keep.gcode", 100, sample_metadata("keep.gcode"));
+    cache.store("changed.gcode", 100, sample_metadata("changed.gcode"));
+    cache.store("deleted.gcode", 100, sample_metadata("deleted.gcode"));
+    cache.store("sub/other.gcode", 100, sample_metadata("other.gcode"));
+
+    size_t removed =
+        cache.revalidate("", {listed("keep.gcode", 100.4), listed("changed.gcode", 200)});
+
+    REQUIRE(removed == 2);
+    REQUIRE(cache.lookup("keep.gcode", 100).has_value());
+    REQUIRE_FALSE(cache.lookup("changed.gcode", 100).has_value());
+    REQUIRE_FALSE(cache.lookup("deleted.gcode", 100).has_value());
+    REQUIRE(cache.lookup("sub/other.gcode", 100).has_value()); // Other directory untouched
+
+    SECTION("Subdirectory listing uses directory-relative names") {
+        REQUIRE(cache.revalidate("sub", {listed("other.gcode", 100)}) == 0);
+        REQUIRE(cache.revalidate("sub", {}) == 1);
+    }
+}
+
+TEST_CASE("FileMetadataCache - Request queue", "[file_metadata_cache]") {
+    FileMetadataCache cache("", 2);
+    DeferredFetches fetches;
+    std::vector<std::string> delivered;
+    auto on_success = [&delivered](const FileMetadata& m) { delivered.push_back(m.filename); };
+
+    SECTION("Misses respect the concurrency cap") {
+        for (int i = 0; i < 5; ++i) {
+            std::string path = "f" + std::to_string(i) + ".gcode";
+            REQUIRE_FALSE(cache.request(path, 10, fetches.fetcher(path), on_success, nullptr));
+        }
+        REQUIRE(fetches.pending.size() == 2);
+        REQUIRE(cache.stats().queued == 3);
+
+        while (!fetches.pending.empty()) {
+            REQUIRE(fetches.pending.size() <= 2);
+            fetches.complete_first();
+        }
+        REQUIRE(delivered.size() == 5);
+        REQUIRE(cache.stats().fetches == 5);
+        REQUIRE(cache.stats().in_flight == 0);
+
+        // Everything is cached now
+        REQUIRE(cache.request("f3.gcode", 10, fetches.fetcher("f3.gcode"), on_success, nullptr));
+        REQUIRE(fetches.pending.empty());
+    }
+
+    SECTION("Identical misses share one fetch") {
+        cache.request("a.gcode", 10, fetches.fetcher("a.gcode"), on_success, nullptr);
+        cache.request("a.gcode", 10, fetches.fetcher("a.gcode"), on_success, nullptr);
+        REQUIRE(fetches.pending.size() == 1);
+        REQUIRE(cache.stats().coalesced == 1);
+        fetches.complete_first();
+        REQUIRE(delivered.size() == 2);
+    }
+
+    SECTION("Failures reach the caller and are not cached") {
+        std::string error;
+        auto failing = [](FileMetadataCache::MetadataCallback,
+                          FileMetadataCache::FailureCallback on_error) { on_error("timeout"); };
+        cache.request("bad.gcode", 10, failing, on_success,
+                      [&error](const std::string& e) { error = e; });
+        REQUIRE(error == "timeout");
+        REQUIRE(cache.stats().failures == 1);
+        REQUIRE_FALSE(cache.lookup("bad.gcode", 10).has_value());
+    }
+}
+
+TEST_CASE("FileMetadataCache - Reopening an unchanged folder sends no requests",
+          "[file_metadata_cache]") {
+    std::string dir = make_temp_dir("folder");
+    constexpr int FILE_COUNT = 500;
+    size_t rpcs = 0;
+    auto synchronous = [&rpcs](const std::string& path) -> FileMetadataCache::Fetcher {
+        return [&rpcs, path](FileMetadataCache::MetadataCallback on_success,
+                             FileMetadataCache::FailureCallback) {
+            rpcs++;
+            on_success(sample_metadata(path));
+        };
+    };
+
+    std::vector<FileInfo> listing;
+    for (int i = 0; i < FILE_COUNT; ++i) {
+        listing.push_back(listed("part_" + std::to_string(i) + ".gcode", 1000 + i));
+    }
+
+    {
+        FileMetadataCache cache(dir);
+        for (const auto& file : listing) {
+            std::string path = "folder/" + file.filename;
+            cache.request(path, file.modified, synchronous(path), nullptr, nullptr);
+        }
+        REQUIRE(rpcs == FILE_COUNT);
+        REQUIRE(cache.stats().in_flight == 0);
+        // Saved when the queue drained; no explicit flush
+    }
+
+    // App restart: second visit renders every file from disk
+    FileMetadataCache cache(dir);
+    REQUIRE(cache.revalidate("folder", listing) == 0);
+    size_t served = 0;
+    for (const auto& file : listing) {
+        std::string path = "folder/" + file.filename;
+        served += cache.request(path, file.modified, synchronous(path),
+                                [](const FileMetadata&) {}, nullptr)
+                      ? 1
+                      : 0;
+    }
+    REQUIRE(served == FILE_COUNT);
+    REQUIRE(rpcs == FILE_COUNT);
+
+    // Re-uploading one file refetches only that file
+    listing[7].modified += 60;
+    REQUIRE(cache.revalidate("folder", listing) == 1);
+    std::string path = "folder/" + listing[7].filename;
+    REQUIRE_FALSE(cache.request(path, listing[7].modified, synchronous(path), nullptr, nullptr));
+    REQUIRE(rpcs == FILE_COUNT + 1);
+
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("FileMetadataCache - Entry cap drops least recently used", "[file_metadata_cache]") {
+    FileMetadataCache cache("", FileMetadataCache::DEFAULT_MAX_IN_FLIGHT, 3);
+    cache.store("a.gcode", 1, sample_metadata("a.gcode"));
+    cache.store("b.gcode", 1, sample_metadata("b.gcode"));
+    cache.store("c.gcode", 1, sample_metadata("c.gcode"));
+    REQUIRE(cache.lookup("a.gcode", 1).has_value()); // a is now most recent
+    cache.store("d.gcode", 1, sample_metadata("d.gcode"));
+
+    REQUIRE(cache.stats().entries == 3);
+    REQUIRE(cache.lookup("a.gcode", 1).has_value());
+    REQUIRE_FALSE(cache.lookup("b.gcode", 1).has_value());
+}
@@ -3,7 +3,11 @@
 
 #include "gcode_data_source.h"
 
+#include <filesystem>
 #include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "../catch_amalgamated.hpp"
 
@@ -151,6 +155,127 @@ TEST_CASE("FileDataSource move semantics", "[gcode][datasource]") {
     REQUIRE(data.size() == 10);
 }
 
+TEST_CASE("FileDataSource memory mapping", "[gcode][datasource]") {
+    TempFile temp(SAMPLE_GCODE);
+
+    SECTION("maps by default and views without copying") {
+        FileDataSource source(temp.path());
+        REQUIRE(source.is_memory_mapped());
+        REQUIRE(source.view_range(0, 1000) == SAMPLE_GCODE);
+        REQUIRE(source.view_range(10, 15) == SAMPLE_GCODE.substr(10, 15));
+        REQUIRE(source.view_range(SAMPLE_GCODE.size(), 10).empty());
+
+        // Views stay put; read_range copies the same bytes
+        REQUIRE(source.view_range(0, 5).data() == source.view_range(0, 5).data());
+        auto data = source.read_range(10, 15);
+        REQUIRE(std::string(data.begin(), data.end()) == SAMPLE_GCODE.substr(10, 15));
+    }
+
+    SECTION("access hints keep reads working") {
+        FileDataSource source(temp.path());
+        source.advise(GCodeDataSource::AccessPattern::Sequential);
+        source.advise(GCodeDataSource::AccessPattern::Random);
+        REQUIRE(source.view_range(0, 20) == SAMPLE_GCODE.substr(0, 20));
+    }
+
+    SECTION("fread fallback") {
+        FileDataSource source(temp.path(), false);
+        REQUIRE(source.is_valid());
+        REQUIRE_FALSE(source.is_memory_mapped());
+        REQUIRE(source.view_range(0, 20).empty());
+        auto data = source.read_range(0, 20);
+        REQUIRE(std::string(data.begin(), data.end()) == SAMPLE_GCODE.substr(0, 20));
+    }
+
+    SECTION("mapping moves with the source") {
+        FileDataSource source1(temp.path());
+        FileDataSource source2(std::move(source1));
+        REQUIRE_FALSE(source1.is_memory_mapped()); // NOLINT - testing moved-from state
+        REQUIRE(source2.view_range(0, 20) == SAMPLE_GCODE.substr(0, 20));
+    }
+
+    SECTION("truncated file falls back to positional reads") {
+        TempFile shrinking(SAMPLE_GCODE);
+        FileDataSource source(shrinking.path());
+        REQUIRE(source.is_memory_mapped());
+
+        std::filesystem::resize_file(shrinking.path(), 20);
+        REQUIRE(source.view_range(0, 20).empty()); // Pages past the new end would SIGBUS
+        REQUIRE_FALSE(source.is_memory_mapped());
+
+        auto head = source.read_range(10, 15);
+        REQUIRE(std::string(head.begin(), head.end()) == SAMPLE_GCODE.substr(10, 10));
+        REQUIRE(source.read_range(40, 10).empty());
+    }
+
+    SECTION("replaced file keeps serving the original contents") {
+        TempFile replaced(SAMPLE_GCODE);
+        FileDataSource source(replaced.path());
+        TempFile other("G28\n");
+        std::filesystem::rename(other.path(), replaced.path());
+
+        REQUIRE(source.is_memory_mapped());
+        REQUIRE(source.view_range(0, 1000) == SAMPLE_GCODE);
+    }
+
+    SECTION("empty file is valid but not mapped") {
+        TempFile empty("");
+        FileDataSource source(empty.path());
+        REQUIRE(source.is_valid());
+        REQUIRE_FALSE(source.is_memory_mapped());
+        REQUIRE(source.view_range(0, 10).empty());
+    }
+}
+
+TEST_CASE("GCodeDataSource read_line_blocks", "[gcode][datasource]") {
+    TempFile temp(SAMPLE_GCODE);
+    FileDataSource mapped(temp.path());
+    FileDataSource unmapped(temp.path(), false);
+    MemoryDataSource memory(SAMPLE_GCODE);
+
+    SECTION("blocks end on lines and cover the source") {
+        for (GCodeDataSource* source :
+             std::vector<GCodeDataSource*>{&mapped, &unmapped, &memory}) {
+            INFO("Zero-copy views: " << !source->view_range(0, 1).empty());
+
+            // Block size smaller than most lines forces blocks to grow to a whole line
+            for (uint32_t block_size : {4u, 16u, 64u, 4096u}) {
+                std::string joined;
+                size_t blocks = 0;
+                REQUIRE(source->read_line_blocks(block_size, [&](std::string_view block) {
+                    REQUIRE(block.back() == '\n');
+                    joined.append(block.data(), block.size());
+                    blocks++;
+                    return true;
+                }));
+                REQUIRE(joined == SAMPLE_GCODE);
+                if (block_size == 4096u) {
+                    REQUIRE(blocks == 1);
+                }
+            }
+        }
+    }
+
+    SECTION("stops when the visitor returns false") {
+        size_t blocks = 0;
+        REQUIRE(mapped.read_line_blocks(8, [&](std::string_view) {
+            blocks++;
+            return false;
+        }));
+        REQUIRE(blocks == 1);
+    }
+
+    SECTION("unterminated last line is its own block end") {
+        MemoryDataSource tail("G28\nG1 X1");
+        std::vector<std::string> blocks;
+        REQUIRE(tail.read_line_blocks(4, [&](std::string_view block) {
+            blocks.emplace_back(block);
+            return true;
+        }));
+        REQUIRE(blocks == std::vector<std::string>{"G28\n", "G1 X1"});
+    }
+}
+
 TEST_CASE("MemoryDataSource from string", "[gcode][datasource]") {
     MemoryDataSource source(SAMPLE_GCODE, "test-gcode");
 
@@ -184,6 +309,13 @@ TEST_CASE("MemoryDataSource from string", "[gcode][datasource]") {
     }
 }
 
+TEST_CASE("MemoryDataSource view_range", "[gcode][datasource]") {
+    MemoryDataSource source(SAMPLE_GCODE);
+    REQUIRE(source.view_range(0, 1000) == SAMPLE_GCODE);
+    REQUIRE(source.view_range(5, 10) == SAMPLE_GCODE.substr(5, 10));
+    REQUIRE(source.view_range(SAMPLE_GCODE.size(), 1).empty());
+}
+
 TEST_CASE("MemoryDataSource from vector", "[gcode][datasource]") {
     std::vector<char> bytes = {'H', 'e', 'l', 'l', 'o'};
     MemoryDataSource source(bytes);
@@ -222,6 +354,42 @@ TEST_CASE("MemoryDataSource empty content", "[gcode][datasource]") {
     }
 }
 
+TEST_CASE("MoonrakerDataSource parses metadata responses", "[gcode][datasource]") {
+    uint64_t size = 0;
+    double modified = 0.0;
+
+    SECTION("reads the result's size and mtime, not a thumbnail's") {
+        const std::string body = R"({"result": {"thumbnails": [{"width": 32, "size": 1234}],
+            "filename": "part.gcode", "modified": 1700000000.25, "size": 5242880}})";
+        REQUIRE(MoonrakerDataSource::parse_metadata_response(body, size, modified));
+        REQUIRE(size == 5242880);
+        REQUIRE(modified == 1700000000.25);
+    }
+
+    SECTION("modified is optional") {
+        REQUIRE(MoonrakerDataSource::parse_metadata_response(R"({"result": {"size": 42}})", size,
+                                                             modified));
+        REQUIRE(size == 42);
+        REQUIRE(modified == 0.0);
+    }
+
+    SECTION("rejects bodies without a usable size") {
+        const char* bodies[] = {
+            "",
+            "not json",
+            R"({"error": {"code": 404, "message": "Metadata not available"}})",
+            R"({"result": {"size": 0}})",
+            R"({"result": {"size": "123"}})",
+            R"({"result": [1, 2]})",
+            R"({"size": 123})",
+        };
+        for (const char* body : bodies) {
+            INFO(body);
+            REQUIRE_FALSE(MoonrakerDataSource::parse_metadata_response(body, size, modified));
+        }
+    }
+}
+
 // MoonrakerDataSource tests would require mocking HTTP
 // or an actual Moonraker instance. We test the interface contract.
 TEST_CASE("MoonrakerDataSource construction", "[gcode][datasource][.network]") {
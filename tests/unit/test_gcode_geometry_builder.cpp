@@ -6,6 +6,10 @@
 
 #include "../catch_amalgamated.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
 using namespace helix::gcode;
 using Catch::Approx;
 
@@ -883,3 +887,268 @@ TEST_CASE("Geometry Builder: BuildStats - statistics tracking", "[gcode][geometr
     REQUIRE(stats.simplification_ratio >= 0.0f);
     REQUIRE(stats.simplification_ratio <= 1.0f);
 }
+
+// ============================================================================
+// RibbonDrawArrays Tests
+// ============================================================================
+
+TEST_CASE("Geometry Builder: RibbonDrawArrays - strips become indexed triangle pairs",
+          "[gcode][geometry][arrays]") {
+    GeometryBuilder builder;
+
+    ParsedGCodeFile gcode;
+    gcode.global_bounding_box.min = glm::vec3(0, 0, 0);
+    gcode.global_bounding_box.max = glm::vec3(100, 100, 10);
+
+    Layer layer;
+    layer.z_height = 0.2f;
+    for (int i = 0; i < 3; i++) {
+        ToolpathSegment seg;
+        seg.start = glm::vec3(i * 10.0f, i * 5.0f, 0.2f);
+        seg.end = glm::vec3((i + 1) * 10.0f, (i % 2) * 5.0f, 0.2f);
+        seg.is_extrusion = true;
+        seg.extrusion_amount = 1.0f;
+        seg.width = 0.4f;
+        layer.segments.push_back(seg);
+    }
+    gcode.layers.push_back(layer);
+
+    RibbonGeometry geometry = builder.build(gcode, SimplificationOptions{});
+    REQUIRE_FALSE(geometry.strips.empty());
+
+    RibbonDrawArrays arrays = build_draw_arrays(geometry);
+    REQUIRE(arrays.positions.size() == geometry.vertices.size() * 3);
+    REQUIRE(arrays.normals.size() == geometry.vertices.size() * 3);
+    REQUIRE(arrays.colors.size() == geometry.vertices.size() * 4);
+    REQUIRE(arrays.indices.size() ==
+            geometry.strips.size() * RibbonDrawArrays::INDICES_PER_STRIP);
+    REQUIRE(arrays.memory_usage() <= RibbonDrawArrays::estimate_bytes(
+                                         geometry.vertices.size(), geometry.strips.size()) +
+                                         64);
+
+    // Same winding as GL_TRIANGLE_STRIP: (v0,v1,v2) then (v2,v1,v3)
+    for (size_t s = 0; s < geometry.strips.size(); ++s) {
+        const auto& strip = geometry.strips[s];
+        const uint32_t* tri = &arrays.indices[s * RibbonDrawArrays::INDICES_PER_STRIP];
+        CHECK(tri[0] == strip[0]);
+        CHECK(tri[1] == strip[1]);
+        CHECK(tri[2] == strip[2]);
+        CHECK(tri[3] == strip[2]);
+        CHECK(tri[4] == strip[1]);
+        CHECK(tri[5] == strip[3]);
+    }
+
+    // Positions and colors match the quantized vertices and palette
+    const auto& v = geometry.vertices.front();
+    glm::vec3 pos = geometry.quantization.dequantize_vec3(v.position);
+    REQUIRE(arrays.positions[0] == Approx(pos.x));
+    REQUIRE(arrays.positions[1] == Approx(pos.y));
+    REQUIRE(arrays.positions[2] == Approx(pos.z));
+    uint32_t rgb = geometry.color_palette[v.color_index];
+    REQUIRE(arrays.colors[0] == ((rgb >> 16) & 0xFF));
+    REQUIRE(arrays.colors[1] == ((rgb >> 8) & 0xFF));
+    REQUIRE(arrays.colors[2] == (rgb & 0xFF));
+    REQUIRE(arrays.colors[3] == 255);
+}
+
+TEST_CASE("Geometry Builder: RibbonDrawArrays - dimmed colors", "[gcode][geometry][arrays]") {
+    RibbonDrawArrays arrays;
+    arrays.colors = {200, 100, 50, 255, 10, 20, 30, 255};
+
+    // Full brightness returns the base colors without copying
+    REQUIRE(arrays.colors_for(1.0f) == arrays.colors.data());
+
+    const uint8_t* dimmed = arrays.colors_for(0.5f);
+    REQUIRE(dimmed != arrays.colors.data());
+    CHECK(dimmed[0] == 100);
+    CHECK(dimmed[1] == 50);
+    CHECK(dimmed[2] == 25);
+    CHECK(dimmed[3] == 255); // Alpha is not dimmed
+    CHECK(dimmed[4] == 5);
+
+    // Same factor reuses the cached copy
+    REQUIRE(arrays.colors_for(0.5f) == dimmed);
+}
+
+// ============================================================================
+// Parallel Build Tests
+// ============================================================================
+
+namespace {
+
+// Zigzag infill with a travel between layers; no two consecutive moves are collinear
+ParsedGCodeFile make_zigzag_gcode(int layer_count, int moves_per_layer) {
+    ParsedGCodeFile gcode;
+    gcode.global_bounding_box.min = glm::vec3(0, 0, 0);
+    gcode.global_bounding_box.max = glm::vec3(200, 200, layer_count * 0.2f);
+
+    for (int l = 0; l < layer_count; ++l) {
+        Layer layer;
+        layer.z_height = (l + 1) * 0.2f;
+        glm::vec3 pos(0.0f, 0.0f, layer.z_height);
+        for (int m = 0; m < moves_per_layer; ++m) {
+            ToolpathSegment seg;
+            seg.start = pos;
+            seg.end = pos + glm::vec3(1.0f + (m % 7) * 0.5f, (m % 2 == 0) ? 3.0f : -3.0f, 0.0f);
+            // Every 50th move is a travel, so chunks also start after travels
+            seg.is_extrusion = (m % 50) != 49;
+            seg.extrusion_amount = seg.is_extrusion ? 0.1f : 0.0f;
+            seg.width = 0.45f;
+            layer.segments.push_back(seg);
+            pos = seg.end;
+        }
+        gcode.layers.push_back(layer);
+    }
+    return gcode;
+}
+
+// Field-by-field comparison of two geometries
+void require_same_geometry(const RibbonGeometry& expected, const RibbonGeometry& actual) {
+    REQUIRE(actual.vertices.size() == expected.vertices.size());
+    REQUIRE(actual.strips.size() == expected.strips.size());
+    REQUIRE(actual.normal_palette.size() == expected.normal_palette.size());
+    REQUIRE(actual.color_palette == expected.color_palette);
+
+    for (size_t i = 0; i < expected.normal_palette.size(); ++i) {
+        REQUIRE(actual.normal_palette[i] == expected.normal_palette[i]);
+    }
+    for (size_t i = 0; i < expected.vertices.size(); ++i) {
+        const auto& a = expected.vertices[i];
+        const auto& b = actual.vertices[i];
+        REQUIRE(a.position.x == b.position.x);
+        REQUIRE(a.position.y == b.position.y);
+        REQUIRE(a.position.z == b.position.z);
+        REQUIRE(a.normal_index == b.normal_index);
+        REQUIRE(a.color_index == b.color_index);
+    }
+    REQUIRE(actual.strips == expected.strips);
+    REQUIRE(actual.strip_layer_index == expected.strip_layer_index);
+    REQUIRE(actual.layer_strip_ranges == expected.layer_strip_ranges);
+    REQUIRE(actual.max_layer_index == expected.max_layer_index);
+    REQUIRE(actual.extrusion_triangle_count == expected.extrusion_triangle_count);
+
+    REQUIRE(actual.layer_bboxes.size() == expected.layer_bboxes.size());
+    for (size_t l = 0; l < expected.layer_bboxes.size(); ++l) {
+        REQUIRE(actual.layer_bboxes[l].min == expected.layer_bboxes[l].min);
+        REQUIRE(actual.layer_bboxes[l].max == expected.layer_bboxes[l].max);
+    }
+
+    // Every strip of a layer lies inside that layer's range
+    for (size_t s = 0; s < actual.strips.size(); ++s) {
+        const auto& [first, count] = actual.layer_strip_ranges[actual.strip_layer_index[s]];
+        REQUIRE(s >= first);
+        REQUIRE(s < first + count);
+    }
+}
+
+} // namespace
+
+TEST_CASE("Geometry Builder: Parallel build matches single-threaded build",
+          "[gcode][geometry][parallel]") {
+    ParsedGCodeFile gcode = make_zigzag_gcode(30, 200);
+
+    GeometryBuilder serial_builder;
+    serial_builder.set_worker_count(1);
+    RibbonGeometry serial = serial_builder.build(gcode, SimplificationOptions{});
+
+    GeometryBuilder parallel_builder;
+    parallel_builder.set_worker_count(4);
+    RibbonGeometry parallel = parallel_builder.build(gcode, SimplificationOptions{});
+
+    REQUIRE(serial.strips.size() > 0);
+    require_same_geometry(serial, parallel);
+}
+
+TEST_CASE("Geometry Builder: Layer-by-layer build matches full build",
+          "[gcode][geometry][streaming]") {
+    ParsedGCodeFile gcode = make_zigzag_gcode(12, 150);
+
+    GeometryBuilder full_builder;
+    full_builder.set_worker_count(1);
+    RibbonGeometry full = full_builder.build(gcode, SimplificationOptions{});
+
+    GeometryBuilder layer_builder;
+    RibbonGeometry streamed =
+        layer_builder.begin_layers(gcode.global_bounding_box, gcode.layers.size(), nullptr);
+
+    // Draw arrays built early and then extended must match arrays built at the end
+    RibbonDrawArrays extended;
+    for (size_t l = 0; l < gcode.layers.size(); ++l) {
+        auto layer = layer_builder.build_layer(l, gcode.layers[l].segments, {});
+        GeometryBuilder::append_layer(streamed, std::move(layer));
+        if (l % 5 == 0) {
+            extend_draw_arrays(extended, streamed);
+        }
+    }
+    extend_draw_arrays(extended, streamed);
+
+    REQUIRE(full.strips.size() > 0);
+    require_same_geometry(full, streamed);
+
+    RibbonDrawArrays rebuilt = build_draw_arrays(streamed);
+    REQUIRE(extended.positions == rebuilt.positions);
+    REQUIRE(extended.normals == rebuilt.normals);
+    REQUIRE(extended.colors == rebuilt.colors);
+    REQUIRE(extended.indices == rebuilt.indices);
+}
+
+TEST_CASE("Geometry Builder: LOD pyramid levels get coarser", "[gcode][geometry][lod]") {
+    ParsedGCodeFile gcode = make_zigzag_gcode(12, 150);
+
+    GeometryBuilder full_builder;
+    RibbonGeometry full = full_builder.build(gcode, SimplificationOptions{});
+
+    size_t previous_strips = full.strips.size();
+    float previous_error = full.lod_error_mm;
+    for (size_t level = 1; level <= GeometryBuilder::LOD_LEVEL_COUNT; ++level) {
+        SimplificationOptions options = GeometryBuilder::lod_level_options(level);
+        GeometryBuilder builder;
+        RibbonGeometry geometry = builder.build(gcode, options);
+
+        REQUIRE(geometry.strips.size() > 0);
+        REQUIRE(geometry.strips.size() <= previous_strips);
+        REQUIRE(geometry.lod_error_mm > previous_error);
+        REQUIRE(geometry.layer_strip_ranges.size() == gcode.layers.size());
+        REQUIRE(geometry.layer_height_mm == Approx(full.layer_height_mm));
+
+        // Merged layers keep only the top layer of each group, drawn taller
+        for (size_t l = 0; l < gcode.layers.size(); ++l) {
+            bool kept = (l + 1) % options.layer_merge == 0;
+            REQUIRE((geometry.layer_strip_ranges[l].second > 0) == kept);
+        }
+        float min_z = std::numeric_limits<float>::max();
+        for (const auto& vertex : geometry.vertices) {
+            min_z = std::min(min_z, geometry.quantization.dequantize_vec3(vertex.position).z);
+        }
+        float bottom = gcode.layers[options.layer_merge - 1].z_height -
+                       geometry.layer_height_mm * static_cast<float>(options.layer_merge);
+        REQUIRE(min_z < bottom + geometry.layer_height_mm * 0.5f);
+
+        previous_strips = geometry.strips.size();
+        previous_error = geometry.lod_error_mm;
+    }
+}
+
+TEST_CASE("Geometry Builder: Parallel build scaling", "[gcode][geometry][.benchmark]") {
+    ParsedGCodeFile gcode = make_zigzag_gcode(200, 500);
+
+    double single_ms = 0.0;
+    size_t single_strips = 0;
+    for (size_t workers : {1, 2, 4}) {
+        GeometryBuilder builder;
+        builder.set_worker_count(workers);
+        auto start = std::chrono::steady_clock::now();
+        RibbonGeometry geometry = builder.build(gcode, SimplificationOptions{});
+        double ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                .count();
+        if (workers == 1) {
+            single_ms = ms;
+            single_strips = geometry.strips.size();
+        }
+        WARN(workers << " worker(s): " << ms << " ms (" << single_ms / ms << "x), "
+                     << geometry.strips.size() << " strips");
+        REQUIRE(geometry.strips.size() > 0);
+        REQUIRE(geometry.strips.size() == single_strips);
+    }
+}
@@ -0,0 +1,365 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_index_cache.h"
+#include "gcode_layer_index.h"
+#include "gcode_streaming_controller.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+using Catch::Approx;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+// Fresh cache directory per test, removed afterwards
+class TempCacheDir {
+  public:
+    TempCacheDir() {
+        path_ = (fs::temp_directory_path() / ("test_index_cache_" + std::to_string(rand())))
+                    .string();
+        fs::create_directories(path_);
+    }
+
+    ~TempCacheDir() {
+        std::error_code ec;
+        fs::remove_all(path_, ec);
+    }
+
+    const std::string& path() const {
+        return path_;
+    }
+
+  private:
+    std::string path_;
+};
+
+class TempGCodeFile {
+  public:
+    explicit TempGCodeFile(const std::string& content) {
+        path_ = "/tmp/test_index_cache_" + std::to_string(rand()) + ".gcode";
+        std::ofstream file(path_);
+        file << content;
+    }
+
+    ~TempGCodeFile() {
+        std::remove(path_.c_str());
+    }
+
+    const std::string& path() const {
+        return path_;
+    }
+
+  private:
+    std::string path_;
+};
+
+// Objects straddle layer starts so snapshots carry object ids
+const std::string OBJECT_GCODE = R"(
+; filament_colour = #FF8800
+EXCLUDE_OBJECT_DEFINE NAME=cube_a CENTER=10,10
+EXCLUDE_OBJECT_DEFINE NAME=cube_b CENTER=30,30
+G90
+M83
+G1 Z0.2 F1000
+EXCLUDE_OBJECT_START NAME=cube_a
+G1 X10 Y10 E0.5
+G1 X20 Y10 E0.5
+G1 Z0.4
+G1 X20 Y20 E0.5
+EXCLUDE_OBJECT_END NAME=cube_a
+EXCLUDE_OBJECT_START NAME=cube_b
+G1 X30 Y30 E0.5
+G1 Z0.6
+G1 X40 Y30 E0.5
+EXCLUDE_OBJECT_END NAME=cube_b
+G1 Z0.8
+G1 X50 Y50
+)";
+
+} // namespace
+
+TEST_CASE("GCodeLayerIndex - Cache file round trip", "[gcode][layer_index][index_cache]") {
+    TempGCodeFile file(OBJECT_GCODE);
+    TempCacheDir dir;
+    std::string cache_path = dir.path() + "/index.lidx";
+
+    auto built_names = std::make_shared<ObjectNameTable>();
+    GCodeLayerIndex built;
+    REQUIRE(built.build_from_file(file.path(), built_names));
+    REQUIRE(built.save_to_cache_file(cache_path, "key-1"));
+
+    // Pre-populate the target table so ids differ and must be remapped by name
+    auto loaded_names = std::make_shared<ObjectNameTable>();
+    loaded_names->intern("unrelated");
+    GCodeLayerIndex loaded;
+    REQUIRE(loaded.load_from_cache_file(cache_path, "key-1", file.path(), loaded_names));
+
+    REQUIRE(loaded.get_layer_count() == built.get_layer_count());
+    REQUIRE(loaded.get_source_path() == file.path());
+
+    bool saw_object = false;
+    for (size_t i = 0; i < built.get_layer_count(); ++i) {
+        auto a = built.get_entry(i);
+        auto b = loaded.get_entry(i);
+        REQUIRE(b.file_offset == a.file_offset);
+        REQUIRE(b.byte_length == a.byte_length);
+        REQUIRE(b.z_height == a.z_height);
+        REQUIRE(b.line_count == a.line_count);
+        REQUIRE(b.flags == a.flags);
+
+        const auto& sa = built.get_start_state(i);
+        const auto& sb = loaded.get_start_state(i);
+        REQUIRE(sb.position.x == sa.position.x);
+        REQUIRE(sb.position.y == sa.position.y);
+        REQUIRE(sb.position.z == sa.position.z);
+        REQUIRE(sb.e == sa.e);
+        REQUIRE(sb.layer_z == sa.layer_z);
+        REQUIRE(sb.tool_index == sa.tool_index);
+        REQUIRE(sb.flags == sa.flags);
+        REQUIRE(loaded_names->name(sb.object_id) == built_names->name(sa.object_id));
+        saw_object = saw_object || sa.object_id != NO_OBJECT_ID;
+    }
+    REQUIRE(saw_object);
+
+    const auto& sa = built.get_stats();
+    const auto& sb = loaded.get_stats();
+    REQUIRE(sb.total_layers == sa.total_layers);
+    REQUIRE(sb.total_lines == sa.total_lines);
+    REQUIRE(sb.total_bytes == sa.total_bytes);
+    REQUIRE(sb.min_z == Approx(sa.min_z));
+    REQUIRE(sb.max_z == Approx(sa.max_z));
+    REQUIRE(sb.extrusion_moves == sa.extrusion_moves);
+    REQUIRE(sb.travel_moves == sa.travel_moves);
+    REQUIRE(sb.filament_color == sa.filament_color);
+}
+
+TEST_CASE("GCodeLayerIndex - Cache file rejection", "[gcode][layer_index][index_cache]") {
+    TempGCodeFile file(OBJECT_GCODE);
+    TempCacheDir dir;
+    std::string cache_path = dir.path() + "/index.lidx";
+
+    GCodeLayerIndex built;
+    REQUIRE(built.build_from_file(file.path()));
+    REQUIRE(built.save_to_cache_file(cache_path, "key-1"));
+
+    GCodeLayerIndex loaded;
+
+    SECTION("Key mismatch") {
+        REQUIRE_FALSE(loaded.load_from_cache_file(cache_path, "key-2", file.path()));
+    }
+
+    SECTION("Version mismatch") {
+        std::fstream f(cache_path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(4);
+        uint32_t version = GCodeLayerIndex::CACHE_FORMAT_VERSION + 1;
+        f.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        f.close();
+        REQUIRE_FALSE(loaded.load_from_cache_file(cache_path, "key-1", file.path()));
+    }
+
+    SECTION("Corrupt payload") {
+        std::fstream f(cache_path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(-3, std::ios::end);
+        f.put('\x5a');
+        f.close();
+        REQUIRE_FALSE(loaded.load_from_cache_file(cache_path, "key-1", file.path()));
+    }
+
+    SECTION("Truncated file") {
+        fs::resize_file(cache_path, fs::file_size(cache_path) / 2);
+        REQUIRE_FALSE(loaded.load_from_cache_file(cache_path, "key-1", file.path()));
+    }
+
+    SECTION("Missing file") {
+        REQUIRE_FALSE(loaded.load_from_cache_file(dir.path() + "/none.lidx", "key-1", file.path()));
+    }
+
+    // A rejected load leaves the index untouched
+    REQUIRE_FALSE(loaded.is_valid());
+}
+
+TEST_CASE("GCodeIndexCache - Store and load by key", "[gcode][index_cache]") {
+    TempGCodeFile file(OBJECT_GCODE);
+    TempCacheDir dir;
+    GCodeIndexCache cache(dir.path());
+
+    GCodeLayerIndex built;
+    REQUIRE(built.build_from_file(file.path()));
+
+    GCodeLayerIndex loaded;
+    REQUIRE_FALSE(cache.load("file-a", file.path(), loaded, nullptr));
+    REQUIRE(cache.store("file-a", built));
+    REQUIRE(cache.load("file-a", file.path(), loaded, nullptr));
+    REQUIRE(loaded.get_layer_count() == built.get_layer_count());
+
+    GCodeLayerIndex other;
+    REQUIRE_FALSE(cache.load("file-b", file.path(), other, nullptr));
+
+    SECTION("Empty key is never cached") {
+        REQUIRE(cache.path_for("").empty());
+        REQUIRE_FALSE(cache.store("", built));
+    }
+
+    SECTION("Clear removes entries") {
+        cache.clear();
+        GCodeLayerIndex after_clear;
+        REQUIRE_FALSE(cache.load("file-a", file.path(), after_clear, nullptr));
+    }
+}
+
+TEST_CASE("GCodeIndexCache - LRU size cap", "[gcode][index_cache]") {
+    TempGCodeFile file(OBJECT_GCODE);
+    TempCacheDir dir;
+
+    GCodeLayerIndex built;
+    REQUIRE(built.build_from_file(file.path()));
+
+    // Measure one entry, then allow room for two
+    size_t entry_size = 0;
+    {
+        GCodeIndexCache probe(dir.path());
+        REQUIRE(probe.store("probe", built));
+        entry_size = fs::file_size(probe.path_for("probe"));
+        probe.clear();
+    }
+    GCodeIndexCache cache(dir.path(), entry_size * 2 + entry_size / 2);
+
+    // Explicit mtimes keep the LRU order independent of filesystem timestamp resolution
+    auto now = fs::file_time_type::clock::now();
+    REQUIRE(cache.store("a", built));
+    fs::last_write_time(cache.path_for("a"), now - std::chrono::hours(3));
+    REQUIRE(cache.store("b", built));
+    fs::last_write_time(cache.path_for("b"), now - std::chrono::hours(2));
+
+    // Loading "a" makes it most recently used, so "b" is evicted by "c"
+    GCodeLayerIndex loaded;
+    REQUIRE(cache.load("a", file.path(), loaded, nullptr));
+    REQUIRE(cache.store("c", built));
+
+    REQUIRE(fs::exists(cache.path_for("a")));
+    REQUIRE_FALSE(fs::exists(cache.path_for("b")));
+    REQUIRE(fs::exists(cache.path_for("c")));
+}
+
+TEST_CASE("GCodeStreamingController - Reopen uses index cache", "[gcode][index_cache]") {
+    TempGCodeFile file(OBJECT_GCODE);
+    TempCacheDir dir;
+
+    GCodeStreamingController controller;
+    controller.set_index_cache(std::make_shared<GCodeIndexCache>(dir.path()));
+
+    REQUIRE(controller.open_file(file.path()));
+    REQUIRE_FALSE(controller.is_index_from_cache());
+    size_t layer_count = controller.get_layer_count();
+    auto first = controller.get_layer_segments(1);
+    REQUIRE(first);
+    std::vector<ToolpathSegment> expected = *first;
+
+    controller.close();
+    REQUIRE(controller.open_file(file.path()));
+    REQUIRE(controller.is_index_from_cache());
+    REQUIRE(controller.get_layer_count() == layer_count);
+
+    auto second = controller.get_layer_segments(1);
+    REQUIRE(second);
+    REQUIRE(second->size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        REQUIRE((*second)[i].start.x == expected[i].start.x);
+        REQUIRE((*second)[i].end.y == expected[i].end.y);
+        REQUIRE((*second)[i].is_extrusion == expected[i].is_extrusion);
+    }
+
+    SECTION("Modified file is rescanned") {
+        controller.close();
+        {
+            std::ofstream out(file.path(), std::ios::app);
+            out << "G1 Z1.0\nG1 X60 Y60 E0.5\n";
+        }
+        REQUIRE(controller.open_file(file.path()));
+        REQUIRE_FALSE(controller.is_index_from_cache());
+        REQUIRE(controller.get_layer_count() == layer_count + 1);
+    }
+
+    SECTION("Disabled cache always rescans") {
+        controller.close();
+        controller.set_index_cache(nullptr);
+        REQUIRE(controller.open_file(file.path()));
+        REQUIRE_FALSE(controller.is_index_from_cache());
+    }
+
+    SECTION("Cache file of another format version is rebuilt") {
+        controller.close();
+        fs::path cache_file;
+        for (const auto& entry : fs::directory_iterator(dir.path())) {
+            cache_file = entry.path();
+        }
+        REQUIRE_FALSE(cache_file.empty());
+        {
+            std::fstream f(cache_file, std::ios::in | std::ios::out | std::ios::binary);
+            f.seekp(4); // Version follows the magic
+            uint32_t version = GCodeLayerIndex::CACHE_FORMAT_VERSION - 1;
+            f.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        }
+
+        REQUIRE(controller.open_file(file.path()));
+        REQUIRE_FALSE(controller.is_index_from_cache());
+        REQUIRE(controller.get_layer_count() == layer_count);
+
+        // The rescan replaced the stale file
+        controller.close();
+        REQUIRE(controller.open_file(file.path()));
+        REQUIRE(controller.is_index_from_cache());
+    }
+}
+
+TEST_CASE("GCodeStreamingController - Index cache is off by default", "[gcode][index_cache]") {
+    TempGCodeFile file(OBJECT_GCODE);
+    GCodeStreamingController controller;
+
+    REQUIRE(controller.open_file(file.path()));
+    controller.close();
+    REQUIRE(controller.open_file(file.path()));
+    REQUIRE_FALSE(controller.is_index_from_cache());
+}
+
+TEST_CASE("GCodeIndexCache - Reopen performance", "[gcode][index_cache][.benchmark]") {
+    // 20k layers, ~20MB of G-code
+    TempGCodeFile file([] {
+        std::string gcode;
+        gcode.reserve(60 * 1024 * 1024);
+        for (int layer = 0; layer < 20000; ++layer) {
+            gcode += "G1 Z" + std::to_string(0.2 + layer * 0.2) + "\n";
+            for (int i = 0; i < 60; ++i) {
+                gcode += "G1 X" + std::to_string(i) + " Y" + std::to_string(layer % 200) +
+                         " E0.05\n";
+            }
+        }
+        return gcode;
+    }());
+    TempCacheDir dir;
+
+    GCodeStreamingController controller;
+    controller.set_index_cache(std::make_shared<GCodeIndexCache>(dir.path()));
+
+    auto t0 = std::chrono::steady_clock::now();
+    REQUIRE(controller.open_file(file.path()));
+    auto t1 = std::chrono::steady_clock::now();
+    controller.close();
+    REQUIRE(controller.open_file(file.path()));
+    auto t2 = std::chrono::steady_clock::now();
+    REQUIRE(controller.is_index_from_cache());
+
+    auto ms = [](auto d) { return std::chrono::duration<double, std::milli>(d).count(); };
+    WARN("Index scan: " << ms(t1 - t0) << "ms, cached reopen: " << ms(t2 - t1) << "ms ("
+                        << controller.get_layer_count() << " layers, "
+                        << fs::file_size(file.path()) / (1024 * 1024) << "MB)");
+    REQUIRE(controller.get_layer_count() == 20000);
+    REQUIRE(ms(t2 - t1) < ms(t1 - t0));
+}
@@ -3,8 +3,11 @@
 
 #include "gcode_layer_cache.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <future>
+#include <mutex>
 #include <thread>
 
 #include "../catch_amalgamated.hpp"
@@ -90,8 +93,8 @@ TEST_CASE("GCodeLayerCache basic operations", "[gcode][cache]") {
 }
 
 TEST_CASE("GCodeLayerCache LRU eviction", "[gcode][cache]") {
-    // Budget that fits ~2 layers of 50 segments each
-    // 50 segments * 80 bytes = 4KB per layer + overhead
+    // Budget that fits ~2 layers of 120 segments each
+    // 120 segments * 36 bytes = ~4.2KB per layer + overhead
     // Budget of 10KB should fit ~2 layers
     GCodeLayerCache cache(10 * 1024);
 
@@ -99,9 +102,9 @@ TEST_CASE("GCodeLayerCache LRU eviction", "[gcode][cache]") {
 
     SECTION("evicts oldest layer when over budget") {
         // Load layers 0, 1, 2 - should evict 0 to make room for 2
-        cache.get_or_load(0, tracking_loader(loaded, 50));
-        cache.get_or_load(1, tracking_loader(loaded, 50));
-        cache.get_or_load(2, tracking_loader(loaded, 50));
+        cache.get_or_load(0, tracking_loader(loaded, 120));
+        cache.get_or_load(1, tracking_loader(loaded, 120));
+        cache.get_or_load(2, tracking_loader(loaded, 120));
 
         // Layer 0 should have been evicted
         REQUIRE_FALSE(cache.is_cached(0));
@@ -111,14 +114,14 @@ TEST_CASE("GCodeLayerCache LRU eviction", "[gcode][cache]") {
     }
 
     SECTION("touching a layer prevents eviction") {
-        cache.get_or_load(0, tracking_loader(loaded, 50));
-        cache.get_or_load(1, tracking_loader(loaded, 50));
+        cache.get_or_load(0, tracking_loader(loaded, 120));
+        cache.get_or_load(1, tracking_loader(loaded, 120));
 
         // Touch layer 0 (makes it most recent)
-        cache.get_or_load(0, tracking_loader(loaded, 50));
+        cache.get_or_load(0, tracking_loader(loaded, 120));
 
         // Now add layer 2 - should evict 1, not 0
-        cache.get_or_load(2, tracking_loader(loaded, 50));
+        cache.get_or_load(2, tracking_loader(loaded, 120));
 
         REQUIRE(cache.is_cached(0));       // Was touched, kept
         REQUIRE_FALSE(cache.is_cached(1)); // Oldest, evicted
@@ -126,7 +129,7 @@ TEST_CASE("GCodeLayerCache LRU eviction", "[gcode][cache]") {
     }
 
     SECTION("explicit eviction works") {
-        cache.get_or_load(0, tracking_loader(loaded, 50));
+        cache.get_or_load(0, tracking_loader(loaded, 120));
         REQUIRE(cache.is_cached(0));
 
         bool evicted = cache.evict(0);
@@ -246,6 +249,166 @@ TEST_CASE("GCodeLayerCache prefetch", "[gcode][cache]") {
     }
 }
 
+TEST_CASE("GCodeLayerCache async prefetch", "[gcode][cache][thread]") {
+    GCodeLayerCache cache(100 * 1024);
+
+    // Records load order from the prefetch threads
+    std::mutex loaded_mutex;
+    std::vector<size_t> loaded;
+    auto recording_loader = [&](size_t layer_index) {
+        std::lock_guard<std::mutex> lock(loaded_mutex);
+        loaded.push_back(layer_index);
+        return make_test_segments(20);
+    };
+
+    // Layer 5 blocks until the gate opens, so tests can act while it loads
+    std::promise<void> gate;
+    std::shared_future<void> gate_open = gate.get_future().share();
+    std::promise<void> started;
+    auto gated_loader = [&, gate_open](size_t layer_index) {
+        if (layer_index == 5) {
+            started.set_value();
+            gate_open.wait();
+        }
+        return recording_loader(layer_index);
+    };
+
+    SECTION("loads the window in the background") {
+        cache.prefetch_async(5, 2, recording_loader, 100);
+        cache.wait_for_prefetch();
+
+        for (size_t i = 3; i <= 7; ++i) {
+            REQUIRE(cache.is_cached(i));
+        }
+        REQUIRE(cache.prefetch_stats().completed == 5);
+        REQUIRE(cache.hit_stats() == std::make_pair(size_t(0), size_t(0)));
+    }
+
+    SECTION("center first, then nearest in the direction of motion") {
+        cache.set_prefetch_concurrency(1);
+        cache.prefetch_async(5, 2, recording_loader, 100);
+        cache.wait_for_prefetch();
+        REQUIRE(loaded == std::vector<size_t>{5, 6, 4, 7, 3});
+
+        // Moving up: ahead of the center before behind it; cached layers are skipped
+        loaded.clear();
+        cache.prefetch_async(8, 2, recording_loader, 100);
+        cache.wait_for_prefetch();
+        REQUIRE(loaded == std::vector<size_t>{8, 9, 10});
+
+        // Moving down, clamped at layer 0
+        loaded.clear();
+        cache.prefetch_async(1, 2, recording_loader, 100);
+        cache.wait_for_prefetch();
+        REQUIRE(loaded == std::vector<size_t>{1, 0, 2});
+    }
+
+    SECTION("moving the center cancels stale requests") {
+        cache.set_prefetch_concurrency(1);
+        cache.prefetch_async(5, 2, gated_loader, 100);
+        started.get_future().wait(); // Layer 5 is loading, 6 4 7 3 are queued
+
+        cache.prefetch_async(50, 1, gated_loader, 100);
+        gate.set_value();
+        cache.wait_for_prefetch();
+
+        std::sort(loaded.begin(), loaded.end());
+        REQUIRE(loaded == std::vector<size_t>{5, 49, 50, 51});
+        REQUIRE(cache.prefetch_stats().cancelled == 4);
+        REQUIRE(cache.is_cached(5)); // Running load still lands
+    }
+
+    SECTION("bounded number of loads in flight") {
+        std::atomic<int> active{0};
+        std::atomic<int> max_active{0};
+        auto slow_loader = [&](size_t) {
+            int now = ++active;
+            int seen = max_active.load();
+            while (now > seen && !max_active.compare_exchange_weak(seen, now)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            --active;
+            return make_test_segments(10);
+        };
+
+        cache.set_prefetch_concurrency(2);
+        cache.prefetch_async(20, 6, slow_loader, 100);
+        cache.wait_for_prefetch();
+
+        REQUIRE(cache.cached_layer_count() == 13);
+        REQUIRE(max_active.load() <= 2);
+    }
+
+    SECTION("hits and misses count prefetched layers") {
+        cache.prefetch_async(5, 1, recording_loader, 100);
+        cache.wait_for_prefetch();
+
+        REQUIRE(cache.get_or_load(6, recording_loader).was_hit);
+        REQUIRE(cache.get_or_load(6, recording_loader).was_hit); // Counted once
+
+        auto stats = cache.prefetch_stats();
+        REQUIRE(stats.hits == 1);
+        REQUIRE(stats.misses == 0);
+        REQUIRE(stats.completed == 3);
+        REQUIRE(stats.avg_queue_latency_ms >= 0.0);
+        REQUIRE(stats.max_queue_latency_ms >= stats.avg_queue_latency_ms);
+
+        cache.reset_stats();
+        REQUIRE(cache.prefetch_stats().completed == 0);
+    }
+
+    SECTION("demand load of a queued or loading layer is a miss") {
+        cache.set_prefetch_concurrency(1);
+        cache.prefetch_async(5, 2, gated_loader, 100);
+        started.get_future().wait();
+
+        // Layer 7 is still queued: loaded on this thread, not twice
+        REQUIRE(cache.get_or_load(7, recording_loader).segments != nullptr);
+
+        // Layer 5 is loading: wait for the prefetch thread instead of loading again
+        std::thread opener([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            gate.set_value();
+        });
+        auto result = cache.get_or_load(5, recording_loader);
+        opener.join();
+        REQUIRE(result.segments != nullptr);
+        REQUIRE_FALSE(result.was_hit);
+
+        cache.wait_for_prefetch();
+        REQUIRE(std::count(loaded.begin(), loaded.end(), 5) == 1);
+        REQUIRE(std::count(loaded.begin(), loaded.end(), 7) == 1);
+        REQUIRE(cache.prefetch_stats().misses == 2);
+    }
+
+    SECTION("clear drops loads in flight") {
+        cache.prefetch_async(5, 0, gated_loader, 100);
+        started.get_future().wait();
+
+        cache.clear();
+        gate.set_value();
+        cache.wait_for_prefetch();
+
+        REQUIRE_FALSE(cache.is_cached(5));
+    }
+
+    SECTION("cancel_prefetch waits for running loads") {
+        cache.set_prefetch_concurrency(1);
+        cache.prefetch_async(5, 3, gated_loader, 100);
+        started.get_future().wait();
+
+        std::thread opener([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            gate.set_value();
+        });
+        cache.cancel_prefetch();
+        opener.join();
+
+        REQUIRE(loaded == std::vector<size_t>{5});
+        REQUIRE(cache.prefetch_stats().cancelled == 6);
+    }
+}
+
 TEST_CASE("GCodeLayerCache adaptive mode", "[gcode][cache]") {
     GCodeLayerCache cache(100 * 1024);
 
@@ -0,0 +1,203 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_layer_index.h"
+#include "gcode_line_scanner.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+
+namespace {
+
+void require_same_lines(const std::vector<ScannedLine>& a, const std::vector<ScannedLine>& b) {
+    REQUIRE(a.size() == b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        INFO("line " << i);
+        REQUIRE(a[i].offset == b[i].offset);
+        REQUIRE(a[i].length == b[i].length);
+        REQUIRE(a[i].flags == b[i].flags);
+    }
+}
+
+// Scan in batches of max_lines, as GCodeLayerIndex does
+std::vector<ScannedLine> scan_all(std::string_view text, size_t max_lines, bool simd) {
+    std::vector<ScannedLine> all;
+    std::vector<ScannedLine> batch;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        batch.clear();
+        std::string_view rest = text.substr(pos);
+        size_t consumed = simd ? scan_lines(rest, batch, max_lines)
+                               : scan_lines_scalar(rest, batch, max_lines);
+        REQUIRE(consumed > 0);
+        for (auto line : batch) {
+            line.offset += static_cast<uint32_t>(pos);
+            all.push_back(line);
+        }
+        pos += consumed;
+    }
+    return all;
+}
+
+std::string synthetic_gcode(size_t layers, size_t moves_per_layer) {
+    std::string gcode = "; generated by test\n; filament_colour = #FF0000\nG90\nM83\n";
+    char buf[96];
+    for (size_t layer = 0; layer < layers; ++layer) {
+        gcode += ";LAYER_CHANGE\n";
+        std::snprintf(buf, sizeof(buf), "G1 Z%.2f F600\n", 0.2 + layer * 0.2);
+        gcode += buf;
+        for (size_t i = 0; i < moves_per_layer; ++i) {
+            std::snprintf(buf, sizeof(buf), "G1 X%.3f Y%.3f E%.5f\n", 10 + (i % 97) * 0.731,
+                          20 + (i % 53) * 0.419, 0.03 + (i % 7) * 0.001);
+            gcode += buf;
+            if (i % 25 == 0) {
+                gcode += "G0 F9000 X50 Y50\n";
+            }
+        }
+    }
+    return gcode;
+}
+
+} // namespace
+
+TEST_CASE("Line scanner - Splits lines and flags candidates", "[gcode][line_scanner]") {
+    std::string text = "G1 X10 Y10\n"
+                       "G1 Z0.4\n"
+                       "G1 x1 e0.5\n"
+                       ";LAYER_CHANGE\n"
+                       "\n"
+                       "M104 S200\r\n"
+                       "no newline at end Z";
+    std::vector<ScannedLine> lines;
+    size_t consumed = scan_lines(text, lines, 100);
+
+    REQUIRE(consumed == text.size());
+    REQUIRE(lines.size() == 7);
+    REQUIRE(lines[0].offset == 0);
+    REQUIRE(lines[0].length == 10);
+    REQUIRE(lines[0].flags == 0);
+    REQUIRE(lines[1].flags == LINE_HAS_Z);
+    REQUIRE(lines[2].flags == LINE_HAS_E);
+    REQUIRE(lines[3].flags == (LINE_HAS_E | LINE_HAS_UNDERSCORE)); // "CHANGE" has an E
+    REQUIRE(lines[4].length == 0);
+    REQUIRE(text.substr(lines[5].offset, lines[5].length) == "M104 S200\r");
+    REQUIRE(text.substr(lines[6].offset, lines[6].length) == "no newline at end Z");
+    REQUIRE(lines[6].flags == (LINE_HAS_Z | LINE_HAS_E));
+
+    require_same_lines(scan_all(text, 100, false), lines);
+}
+
+TEST_CASE("Line scanner - Batches stop at whole lines", "[gcode][line_scanner]") {
+    std::string text = synthetic_gcode(3, 40);
+    auto reference = scan_all(text, 1u << 30, false);
+
+    for (size_t batch : {1u, 2u, 3u, 7u, 64u}) {
+        INFO("batch " << batch);
+        require_same_lines(scan_all(text, batch, true), reference);
+        require_same_lines(scan_all(text, batch, false), reference);
+    }
+
+    std::vector<ScannedLine> lines;
+    REQUIRE(scan_lines(text, lines, 0) == 0);
+    REQUIRE(lines.empty());
+}
+
+TEST_CASE("Line scanner - SIMD matches scalar on random input", "[gcode][line_scanner]") {
+    // Dense in the characters the scanner looks at, with lines of every length
+    // relative to the 16-byte chunk boundary
+    const char alphabet[] = "\n\nzZeE_ _G1X.0;\r\t\x80\xff";
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<size_t> pick(0, sizeof(alphabet) - 2);
+
+    for (size_t len : {0u, 1u, 15u, 16u, 17u, 31u, 32u, 33u, 1000u, 4099u}) {
+        std::string text;
+        for (size_t i = 0; i < len; ++i) {
+            text += alphabet[pick(rng)];
+        }
+        INFO("length " << len);
+        std::vector<ScannedLine> simd;
+        std::vector<ScannedLine> scalar;
+        REQUIRE(scan_lines(text, simd, 1u << 30) == scan_lines_scalar(text, scalar, 1u << 30));
+        require_same_lines(simd, scalar);
+    }
+}
+
+TEST_CASE("Line scanner - Throughput", "[gcode][line_scanner][.benchmark]") {
+    std::string text = synthetic_gcode(400, 2000);
+    const double mb = static_cast<double>(text.size()) / (1024.0 * 1024.0);
+    constexpr int ROUNDS = 5;
+
+    auto best_ms = [&](auto&& fn) {
+        double best = 1e30;
+        for (int r = 0; r < ROUNDS; ++r) {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            best = std::min(best, std::chrono::duration<double, std::milli>(
+                                      std::chrono::steady_clock::now() - start)
+                                      .count());
+        }
+        return best;
+    };
+
+    // Previous indexer front end: memchr per line, then byte loops over every line
+    size_t sink = 0;
+    size_t memchr_lines = 0;
+    double memchr_ms = best_ms([&] {
+        memchr_lines = 0;
+        const char* p = text.data();
+        const char* end = p + text.size();
+        while (p < end) {
+            const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+            const char* line_end = nl ? nl : end;
+            for (const char* c = p; c < line_end; ++c) {
+                sink += (*c == 'Z' || *c == 'z') + (*c == 'E' || *c == 'e') + (*c == '_');
+            }
+            p = nl ? nl + 1 : end;
+            ++memchr_lines;
+        }
+    });
+
+    std::vector<ScannedLine> lines;
+    lines.reserve(4096);
+    size_t scanned_lines[2] = {0, 0};
+    auto run = [&](bool simd) {
+        size_t pos = 0;
+        scanned_lines[simd] = 0;
+        while (pos < text.size()) {
+            lines.clear();
+            std::string_view rest = std::string_view(text).substr(pos);
+            pos += simd ? scan_lines(rest, lines, 4096) : scan_lines_scalar(rest, lines, 4096);
+            scanned_lines[simd] += lines.size();
+        }
+    };
+    double scalar_ms = best_ms([&] { run(false); });
+    double simd_ms = best_ms([&] { run(true); });
+
+    // Whole index build (scanner + state parser)
+    std::string path = "/tmp/test_line_scanner_" + std::to_string(rand()) + ".gcode";
+    {
+        std::ofstream file(path);
+        file << text;
+    }
+    double index_ms = best_ms([&] {
+        GCodeLayerIndex index;
+        REQUIRE(index.build_from_file(path));
+    });
+    std::remove(path.c_str());
+
+    WARN("Line scan over " << mb << " MB (" << line_scanner_isa() << "): memchr+bytes "
+                           << mb * 1000.0 / memchr_ms << " MB/s, scalar "
+                           << mb * 1000.0 / scalar_ms << " MB/s, simd " << mb * 1000.0 / simd_ms
+                           << " MB/s; index build " << mb * 1000.0 / index_ms << " MB/s"
+                           << (sink == 0 ? " " : ""));
+    REQUIRE(scanned_lines[0] == memchr_lines);
+    REQUIRE(scanned_lines[1] == memchr_lines);
+}
@@ -0,0 +1,525 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_data_source.h"
+#include "gcode_layer_index.h"
+#include "gcode_parallel_parser.h"
+#include "gcode_parser.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+
+namespace {
+
+class TempGCodeFile {
+  public:
+    explicit TempGCodeFile(const std::string& content) {
+        path_ = "/tmp/test_parallel_parser_" + std::to_string(rand()) + ".gcode";
+        std::ofstream file(path_);
+        file << content;
+    }
+
+    ~TempGCodeFile() {
+        std::remove(path_.c_str());
+    }
+
+    const std::string& path() const {
+        return path_;
+    }
+
+  private:
+    std::string path_;
+};
+
+ParsedGCodeFile parse_sequential(const std::string& path) {
+    GCodeParser parser;
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        parser.parse_line(line);
+    }
+    return parser.finalize();
+}
+
+void require_same_bounds(const AABB& a, const AABB& b) {
+    REQUIRE(a.is_empty() == b.is_empty());
+    if (!a.is_empty()) {
+        REQUIRE(a.min == b.min);
+        REQUIRE(a.max == b.max);
+    }
+}
+
+// Exact comparison: the parallel parse must reproduce the sequential one bit for bit
+void require_identical(const ParsedGCodeFile& seq, const ParsedGCodeFile& par) {
+    REQUIRE(par.layers.size() == seq.layers.size());
+    REQUIRE(par.total_segments == seq.total_segments);
+    require_same_bounds(seq.global_bounding_box, par.global_bounding_box);
+
+    for (size_t i = 0; i < seq.layers.size(); ++i) {
+        const Layer& a = seq.layers[i];
+        const Layer& b = par.layers[i];
+        INFO("Layer " << i);
+        REQUIRE(b.z_height == a.z_height);
+        REQUIRE(b.segments.size() == a.segments.size());
+        REQUIRE(b.segment_count_extrusion == a.segment_count_extrusion);
+        REQUIRE(b.segment_count_travel == a.segment_count_travel);
+        require_same_bounds(a.bounding_box, b.bounding_box);
+
+        for (size_t s = 0; s < a.segments.size(); ++s) {
+            const ToolpathSegment& sa = a.segments[s];
+            const ToolpathSegment& sb = b.segments[s];
+            INFO("Segment " << s);
+            REQUIRE(sb.start == sa.start);
+            REQUIRE(sb.end == sa.end);
+            REQUIRE(sb.extrusion_amount == sa.extrusion_amount);
+            REQUIRE(sb.width == sa.width);
+            REQUIRE(sb.tool_index == sa.tool_index);
+            REQUIRE(sb.is_extrusion == sa.is_extrusion);
+            REQUIRE(sb.is_support == sa.is_support);
+            REQUIRE(par.object_name(sb) == seq.object_name(sa));
+        }
+    }
+
+    REQUIRE(par.objects.size() == seq.objects.size());
+    for (const auto& [name, obj] : seq.objects) {
+        INFO("Object " << name);
+        auto it = par.objects.find(name);
+        REQUIRE(it != par.objects.end());
+        REQUIRE(it->second.center == obj.center);
+        REQUIRE(it->second.polygon.size() == obj.polygon.size());
+        require_same_bounds(obj.bounding_box, it->second.bounding_box);
+    }
+
+    REQUIRE(par.slicer_name == seq.slicer_name);
+    REQUIRE(par.filament_type == seq.filament_type);
+    REQUIRE(par.estimated_print_time_minutes == seq.estimated_print_time_minutes);
+    REQUIRE(par.total_filament_mm == seq.total_filament_mm);
+    REQUIRE(par.total_layer_count == seq.total_layer_count);
+    REQUIRE(par.tool_color_palette == seq.tool_color_palette);
+}
+
+// Modal state that crosses layer boundaries: relative E, relative XY,
+// tool changes, an object spanning layers, z-hops and a wipe tower block
+const char* STATEFUL_GCODE = R"(; generated by PrusaSlicer 2.6.0
+; extruder_colour = #FF0000;#00FF00
+EXCLUDE_OBJECT_DEFINE NAME=cube CENTER=10,10 POLYGON=[[5,5],[15,5],[15,15],[5,15]]
+EXCLUDE_OBJECT_DEFINE NAME=support_1 CENTER=30,30
+M83
+G1 X5 Y5 F3000
+;LAYER_CHANGE
+G1 Z0.2
+EXCLUDE_OBJECT_START NAME=cube
+G1 X15 Y5 E0.5
+G1 X15 Y15 E0.5
+T1
+G1 X5 Y15 E0.5
+;LAYER_CHANGE
+G1 Z0.4
+G1 X5 Y5 E0.5
+G1 Z0.8
+G1 X6 Y6
+G1 Z0.4
+G91
+G1 X2 Y0 E0.1
+G90
+M82
+G92 E0
+G1 X9 Y6 E0.4
+M83
+EXCLUDE_OBJECT_END NAME=cube
+; WIPE_TOWER_START
+;LAYER_CHANGE
+G1 Z0.6
+G1 X40 Y40 E0.3
+; WIPE_TOWER_END
+EXCLUDE_OBJECT_START NAME=support_1
+T0
+G1 X30 Y31 E0.2
+EXCLUDE_OBJECT_END NAME=support_1
+;LAYER_CHANGE
+G1 Z0.8
+EXCLUDE_OBJECT_START NAME=cube
+G1 X15 Y5 E0.5
+)";
+
+bool same_state(const ParserStateSnapshot& a, const ParserStateSnapshot& b) {
+    return a.position == b.position && a.e == b.e && a.layer_z == b.layer_z &&
+           a.object_id == b.object_id && a.tool_index == b.tool_index && a.flags == b.flags;
+}
+
+void require_same_state(const ParserStateSnapshot& a, const ParserStateSnapshot& b) {
+    REQUIRE(b.position == a.position);
+    REQUIRE(b.e == a.e);
+    REQUIRE(b.layer_z == a.layer_z);
+    REQUIRE(b.object_id == a.object_id);
+    REQUIRE(b.tool_index == a.tool_index);
+    REQUIRE(static_cast<int>(b.flags) == static_cast<int>(a.flags));
+}
+
+// Feed lines to a parser and a tracker side by side; their states must never diverge
+void require_tracker_matches_parser(std::istream& in) {
+    auto names = std::make_shared<ObjectNameTable>();
+    GCodeParser parser(names);
+    parser.set_state_only(true);
+    GCodeStateTracker tracker(names);
+
+    std::string line;
+    size_t line_number = 0;
+    while (std::getline(in, line)) {
+        ++line_number;
+        parser.parse_line(line);
+        tracker.parse_line(line);
+        if (!same_state(parser.snapshot_state(), tracker.snapshot())) {
+            INFO("Line " << line_number << ": " << line);
+            require_same_state(parser.snapshot_state(), tracker.snapshot());
+        }
+    }
+    REQUIRE(tracker.defined_objects() == parser.defined_objects());
+}
+
+} // namespace
+
+TEST_CASE("GCodeParser - G92 sets axis positions", "[gcode][parser]") {
+    GCodeParser parser;
+    parser.parse_line("M82");
+    parser.parse_line("G1 X10 Y0 E5");
+    parser.parse_line("G92 E0 ; reset extruder");
+    parser.parse_line("G1 X20 E1");
+    parser.parse_line("G92 X0");
+    parser.parse_line("G1 X5");
+    parser.parse_line("G92");
+    parser.parse_line("G1 Y3 E0.5");
+    auto file = parser.finalize();
+
+    REQUIRE(file.layers.size() == 1);
+    const auto& segments = file.layers[0].segments;
+    REQUIRE(segments.size() == 4);
+    REQUIRE(segments[1].is_extrusion); // E1 after G92 E0 is +1, not -4
+    REQUIRE(segments[1].extrusion_amount == 1.0f);
+    REQUIRE(segments[2].start.x == 0.0f); // G92 X0 moved the origin
+    REQUIRE(segments[2].end.x == 5.0f);
+    REQUIRE(segments[3].start == glm::vec3(0.0f, 0.0f, 0.0f)); // Bare G92 zeroes everything
+    REQUIRE(segments[3].is_extrusion);
+}
+
+TEST_CASE("GCodeStateTracker - Matches parser state after every line",
+          "[gcode][parser][parallel]") {
+    SECTION("Modal state sample") {
+        std::istringstream in(STATEFUL_GCODE);
+        require_tracker_matches_parser(in);
+    }
+
+    SECTION("Edge cases") {
+        std::istringstream in("T\nT3 ; tool\nT4X\nG90 ; comment keeps G90 from matching\n"
+                              "G1X5\nG1 Z0.2\nG1 Z0.2005\nG1 X1 Y1 Z0.3 E-1\n"
+                              "G920 X5\nG92.1\n  G1 X2 Y2  \n; layer:3\nG1 Z0.31\n"
+                              "G1 Z0.5\n;WIPE_TOWER_BRIM_START\nEXCLUDE_OBJECT_START\n"
+                              "EXCLUDE_OBJECT_START NAME=a\nEXCLUDE_OBJECT_END NAME=b\n"
+                              "EXCLUDE_OBJECT_DEFINE NAME=a\nEXCLUDE_OBJECT_DEFINE NAME=a\n"
+                              ";WIPE_TOWER_END\nG91\nG1 X1 Z0.2\n");
+        require_tracker_matches_parser(in);
+    }
+
+    SECTION("Real files") {
+        const char* files[] = {
+            "assets/test_gcodes/3DBenchy.gcode",
+            "assets/test_gcodes/calicat_calico.gcode",
+            "assets/test_gcodes/exclude_object_test.gcode",
+        };
+        for (const char* path : files) {
+            std::ifstream in(path);
+            if (!in.good()) {
+                SKIP("Test G-code file not found (run from project root)");
+            }
+            INFO("File: " << path);
+            require_tracker_matches_parser(in);
+        }
+    }
+}
+
+TEST_CASE("GCodeParser - State snapshot round trip", "[gcode][parser][parallel]") {
+    auto names = std::make_shared<ObjectNameTable>();
+    GCodeParser parser(names);
+    parser.parse_line("EXCLUDE_OBJECT_DEFINE NAME=part_a");
+    parser.parse_line("M83");
+    parser.parse_line("G91");
+    parser.parse_line("T2");
+    parser.parse_line("G1 Z0.2");
+    parser.parse_line("EXCLUDE_OBJECT_START NAME=part_a");
+    parser.parse_line("G1 X10 Y5 E1");
+
+    ParserStateSnapshot state = parser.snapshot_state();
+    REQUIRE(state.position == glm::vec3(10.0f, 5.0f, 0.2f));
+    REQUIRE(state.tool_index == 2);
+    REQUIRE(parser.defined_objects().size() == 1);
+    REQUIRE(names->name(state.object_id) == "part_a");
+    REQUIRE_FALSE(state.has(ParserStateSnapshot::ABSOLUTE_POSITIONING));
+    REQUIRE_FALSE(state.has(ParserStateSnapshot::ABSOLUTE_EXTRUSION));
+    REQUIRE(state.has(ParserStateSnapshot::HAS_LAYER));
+    REQUIRE(state.has(ParserStateSnapshot::HAS_SEGMENTS));
+    REQUIRE(state.layer_z == 0.2f);
+
+    // Resumed parser continues the same layer with the same modes
+    GCodeParser resumed(names);
+    resumed.restore_state(state);
+    resumed.declare_objects(parser.defined_objects());
+    resumed.parse_line("G1 X1 E0.5");
+    auto file = resumed.finalize();
+
+    REQUIRE(file.layers.size() == 1);
+    REQUIRE(file.layers[0].z_height == 0.2f);
+    REQUIRE(file.layers[0].segments.size() == 1);
+    const auto& seg = file.layers[0].segments[0];
+    REQUIRE(seg.start == glm::vec3(10.0f, 5.0f, 0.2f));
+    REQUIRE(seg.end == glm::vec3(11.0f, 5.0f, 0.2f)); // G91 still active
+    REQUIRE(seg.extrusion_amount == 0.5f);             // M83 still active
+    REQUIRE(seg.tool_index == 2);
+    REQUIRE(file.object_name(seg) == "part_a");
+    REQUIRE_FALSE(file.objects.at("part_a").bounding_box.is_empty());
+}
+
+TEST_CASE("GCodeLayerIndex - Layer start snapshots", "[gcode][layer_index][parallel]") {
+    TempGCodeFile file(STATEFUL_GCODE);
+    auto names = std::make_shared<ObjectNameTable>();
+    GCodeLayerIndex index;
+    REQUIRE(index.build_from_file(file.path(), names));
+    REQUIRE(index.get_layer_count() == 4);
+
+    // Layer 1 starts inside the cube object, on tool 1, with relative E
+    ParserStateSnapshot state = index.get_start_state(1);
+    REQUIRE(names->name(state.object_id) == "cube");
+    REQUIRE(state.tool_index == 1);
+    REQUIRE_FALSE(state.has(ParserStateSnapshot::ABSOLUTE_EXTRUSION));
+
+    // Layer 2 starts inside the wipe tower
+    REQUIRE(index.get_start_state(2).has(ParserStateSnapshot::IN_WIPE_TOWER));
+
+    // Out-of-range layers get the power-on state
+    ParserStateSnapshot fresh = index.get_start_state(99);
+    REQUIRE(fresh.has(ParserStateSnapshot::ABSOLUTE_POSITIONING));
+    REQUIRE_FALSE(fresh.has(ParserStateSnapshot::HAS_LAYER));
+}
+
+TEST_CASE("Parallel parser - Matches sequential parse", "[gcode][parser][parallel]") {
+    SECTION("Modal state across layer boundaries") {
+        TempGCodeFile file(STATEFUL_GCODE);
+        ParsedGCodeFile parallel;
+        REQUIRE(parse_gcode_file_parallel(file.path(), parallel, 4));
+        require_identical(parse_sequential(file.path()), parallel);
+    }
+
+    SECTION("Z-based layers without markers") {
+        std::string gcode = "G28\nM82\n";
+        for (int layer = 0; layer < 30; ++layer) {
+            gcode += "G1 Z" + std::to_string(0.2f * (layer + 1)) + "\n";
+            gcode += "G1 X" + std::to_string(layer) + " Y10 E" + std::to_string(layer + 1) + "\n";
+            gcode += "G1 X" + std::to_string(layer) + " Y20\n";
+        }
+        TempGCodeFile file(gcode);
+        ParsedGCodeFile parallel;
+        REQUIRE(parse_gcode_file_parallel(file.path(), parallel, 3));
+        require_identical(parse_sequential(file.path()), parallel);
+    }
+
+    SECTION("Modal state across chunk boundaries") {
+        // Several PARSE_CHUNK_BYTES blocks, so chunks resume mid-layer and mid-object
+        std::string gcode = "EXCLUDE_OBJECT_DEFINE NAME=left\nM83\n";
+        for (int layer = 0; gcode.size() < 3 * PARSE_CHUNK_BYTES; ++layer) {
+            gcode += ";LAYER_CHANGE\nG1 Z" + std::to_string(0.2f * (layer + 1)) + "\n";
+            gcode += "T" + std::to_string(layer % 2) + "\n";
+            if (layer == 5) {
+                gcode += "EXCLUDE_OBJECT_DEFINE NAME=right\n";
+            }
+            gcode += layer % 3 == 0 ? "G91\n" : "G90\n";
+            gcode += "EXCLUDE_OBJECT_START NAME=";
+            gcode += layer > 5 && layer % 2 ? "right\n" : "left\n";
+            for (int i = 0; i < 400; ++i) {
+                gcode += "G1 X" + std::to_string(i % 7) + " Y" + std::to_string(i % 5) + " E0.0" +
+                         std::to_string(i % 9) + "\n";
+            }
+            gcode += "EXCLUDE_OBJECT_END\n";
+        }
+        TempGCodeFile file(gcode);
+        ParsedGCodeFile parallel;
+        REQUIRE(parse_gcode_file_parallel(file.path(), parallel, 4));
+        require_identical(parse_sequential(file.path()), parallel);
+        REQUIRE(parallel.objects.size() == 2);
+    }
+
+    SECTION("No layers") {
+        TempGCodeFile file("G1 X10 Y10 E1\nG1 X20 Y10 E2\n");
+        ParsedGCodeFile parallel;
+        REQUIRE(parse_gcode_file_parallel(file.path(), parallel, 4));
+        require_identical(parse_sequential(file.path()), parallel);
+    }
+
+    SECTION("Missing file") {
+        ParsedGCodeFile parallel;
+        REQUIRE_FALSE(parse_gcode_file_parallel("/nonexistent/file.gcode", parallel, 4));
+    }
+}
+
+TEST_CASE("Parallel parser - Read-ahead stays bounded without mmap", "[gcode][parser][parallel]") {
+    // The state pass outruns decoding; every queued fread block is a copy
+    std::string gcode = "M83\n";
+    for (int layer = 0; gcode.size() < 16 * PARSE_CHUNK_BYTES; ++layer) {
+        gcode += ";LAYER_CHANGE\nG1 Z" + std::to_string(0.2f * (layer + 1)) + "\n";
+        for (int i = 0; i < 400; ++i) {
+            gcode += "G1 X" + std::to_string(i % 7) + " Y" + std::to_string(i % 5) + " E0.0" +
+                     std::to_string(i % 9) + "\n";
+        }
+    }
+    TempGCodeFile file(gcode);
+    constexpr size_t WORKERS = 2;
+
+    FileDataSource source(file.path(), false);
+    REQUIRE_FALSE(source.is_memory_mapped());
+    ParsedGCodeFile parallel;
+    ParallelParseStats stats;
+    REQUIRE(parse_gcode_file_parallel(source, parallel, WORKERS, &stats));
+
+    REQUIRE(stats.chunks >= 16);
+    REQUIRE(stats.max_queued_chunks >= 1);
+    REQUIRE(stats.max_queued_chunks <= PARSE_QUEUE_CHUNKS_PER_WORKER * WORKERS);
+    require_identical(parse_sequential(file.path()), parallel);
+    REQUIRE(parallel.filename == file.path());
+}
+
+TEST_CASE("Parallel parser - Real files match sequential parse",
+          "[gcode][parser][parallel][integration]") {
+    const char* files[] = {
+        "assets/test_gcodes/3DBenchy.gcode",
+        "assets/test_gcodes/calicat_calico.gcode",
+        "assets/test_gcodes/exclude_object_test.gcode",
+        "assets/test_gcodes/stand_s.gcode",
+        "assets/test_gcodes/xyz-10mm-calibration-cube.gcode",
+    };
+
+    for (const char* path : files) {
+        std::ifstream check(path);
+        if (!check.good()) {
+            SKIP("Test G-code file not found (run from project root)");
+        }
+        INFO("File: " << path);
+
+        ParsedGCodeFile parallel;
+        REQUIRE(parse_gcode_file_parallel(path, parallel, 4));
+        require_identical(parse_sequential(path), parallel);
+    }
+}
+
+TEST_CASE("Parallel parser - Worker pool runs every task once", "[gcode][parallel]") {
+    constexpr size_t kTasks = 257;
+    std::vector<std::atomic<int>> runs(kTasks);
+    std::atomic<size_t> max_slot{0};
+
+    run_parse_workers(kTasks, 4, [&](size_t task, size_t worker) {
+        runs[task].fetch_add(1);
+        size_t seen = max_slot.load();
+        while (worker > seen && !max_slot.compare_exchange_weak(seen, worker)) {
+        }
+    });
+
+    for (size_t i = 0; i < kTasks; ++i) {
+        REQUIRE(runs[i].load() == 1);
+    }
+    REQUIRE(max_slot.load() < 4);
+    REQUIRE(default_parse_worker_count() >= 1);
+    REQUIRE(default_parse_worker_count() <= MAX_PARSE_WORKERS);
+}
+
+TEST_CASE("Layer index - State pass throughput", "[gcode][layer_index][.benchmark]") {
+    const char* path = "assets/test_gcodes/exclude_object_test.gcode";
+    std::ifstream in(path, std::ios::binary);
+    if (!in.good()) {
+        SKIP("Test G-code file not found");
+    }
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    auto names = std::make_shared<ObjectNameTable>();
+
+    auto best_ms = [](auto&& fn) {
+        double best = 1e9;
+        for (int i = 0; i < 3; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            best = std::min(best, std::chrono::duration<double, std::milli>(
+                                      std::chrono::steady_clock::now() - start)
+                                      .count());
+        }
+        return best;
+    };
+
+    ParserStateSnapshot parser_end;
+    double parser_ms = best_ms([&] {
+        GCodeParser parser(names);
+        parser.set_state_only(true);
+        parse_gcode_buffer(parser, text.data(), text.size());
+        parser_end = parser.snapshot_state();
+    });
+
+    ParserStateSnapshot tracker_end;
+    double tracker_ms = best_ms([&] {
+        GCodeStateTracker tracker(names);
+        size_t pos = 0;
+        while (pos < text.size()) {
+            size_t nl = std::min(text.find('\n', pos), text.size());
+            tracker.parse_line(std::string_view(text).substr(pos, nl - pos));
+            pos = nl + 1;
+        }
+        tracker_end = tracker.snapshot();
+    });
+
+    double index_ms = best_ms([&] {
+        GCodeLayerIndex index;
+        REQUIRE(index.build_from_file(path, names));
+    });
+
+    double mb = text.size() / (1024.0 * 1024.0);
+    WARN("State pass over " << mb << " MB: GCodeParser " << mb * 1000.0 / parser_ms
+                            << " MB/s, GCodeStateTracker " << mb * 1000.0 / tracker_ms
+                            << " MB/s; full index build " << mb * 1000.0 / index_ms << " MB/s");
+    REQUIRE(same_state(parser_end, tracker_end));
+    REQUIRE(tracker_ms < parser_ms);
+}
+
+TEST_CASE("Parallel parser - Load time by worker count",
+          "[gcode][parser][parallel][.benchmark]") {
+    const char* path = "assets/test_gcodes/exclude_object_test.gcode";
+    std::ifstream check(path);
+    if (!check.good()) {
+        SKIP("Test G-code file not found");
+    }
+
+    ParsedGCodeFile reference = parse_sequential(path);
+    double single_ms = 0.0;
+    for (size_t workers = 1; workers <= MAX_PARSE_WORKERS; ++workers) {
+        double best = 1e9;
+        for (int i = 0; i < 3; ++i) {
+            ParsedGCodeFile file;
+            auto start = std::chrono::steady_clock::now();
+            REQUIRE(parse_gcode_file_parallel(path, file, workers));
+            best = std::min(best, std::chrono::duration<double, std::milli>(
+                                      std::chrono::steady_clock::now() - start)
+                                      .count());
+            REQUIRE(file.total_segments == reference.total_segments);
+            REQUIRE(file.layers.size() == reference.layers.size());
+        }
+        if (workers == 1) {
+            single_ms = best;
+        }
+        WARN(workers << " worker(s): " << best << " ms, " << single_ms / best << "x vs 1 ("
+                     << std::thread::hardware_concurrency() << " cores available)");
+    }
+}
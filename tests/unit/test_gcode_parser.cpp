@@ -3,6 +3,8 @@
 
 #include "gcode_parser.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <fstream>
 #include <iostream>
@@ -158,9 +160,75 @@ TEST_CASE("GCodeParser - EXCLUDE_OBJECT commands", "[gcode][parser]") {
         auto file = parser.finalize();
 
         REQUIRE(file.total_segments == 3);
-        REQUIRE(file.layers[0].segments[0].object_name == "part1");
-        REQUIRE(file.layers[0].segments[1].object_name == "part1");
-        REQUIRE(file.layers[0].segments[2].object_name == "");
+        REQUIRE(file.object_name(file.layers[0].segments[0]) == "part1");
+        REQUIRE(file.object_name(file.layers[0].segments[1]) == "part1");
+        REQUIRE(file.object_name(file.layers[0].segments[2]) == "");
+        REQUIRE(file.layers[0].segments[0].object_id == file.layers[0].segments[1].object_id);
+        REQUIRE(file.layers[0].segments[2].object_id == NO_OBJECT_ID);
+    }
+
+    SECTION("Support objects are flagged at parse time") {
+        parser.parse_line("EXCLUDE_OBJECT_START NAME=Support_Tree_1");
+        parser.parse_line("G1 X10 Y10 Z0.2 E1");
+        parser.parse_line("EXCLUDE_OBJECT_END NAME=Support_Tree_1");
+        parser.parse_line("EXCLUDE_OBJECT_START NAME=cube");
+        parser.parse_line("G1 X20 Y10 E2");
+        parser.parse_line("EXCLUDE_OBJECT_END NAME=cube");
+
+        auto file = parser.finalize();
+
+        REQUIRE(file.layers[0].segments[0].is_support);
+        REQUIRE_FALSE(file.layers[0].segments[1].is_support);
+    }
+}
+
+TEST_CASE("GCodeParser - Object name interning", "[gcode][parser]") {
+    SECTION("Table assigns stable ids") {
+        ObjectNameTable table;
+        ObjectId a = table.intern("part_a");
+        ObjectId b = table.intern("part_b");
+
+        REQUIRE(a != NO_OBJECT_ID);
+        REQUIRE(b != a);
+        REQUIRE(table.intern("part_a") == a);
+        REQUIRE(table.find("part_b") == b);
+        REQUIRE(table.find("missing") == NO_OBJECT_ID);
+        REQUIRE(table.intern("") == NO_OBJECT_ID);
+        REQUIRE(table.name(a) == "part_a");
+        REQUIRE(table.name(NO_OBJECT_ID).empty());
+    }
+
+    SECTION("ObjectIdSet resolves names") {
+        ObjectNameTable table;
+        ObjectId a = table.intern("part_a");
+        ObjectIdSet set;
+        set.assign({"part_a", "later_part"}, table);
+
+        REQUIRE(set.contains(a));
+        REQUIRE(set.contains(table.find("later_part")));
+        REQUIRE_FALSE(set.contains(NO_OBJECT_ID));
+        REQUIRE_FALSE(set.contains(table.intern("part_b")));
+    }
+
+    SECTION("Shared table keeps ids consistent across parsers") {
+        auto table = std::make_shared<ObjectNameTable>();
+        GCodeParser first(table);
+        GCodeParser second(table);
+
+        first.parse_line("EXCLUDE_OBJECT_START NAME=part1");
+        first.parse_line("G1 X10 Y10 Z0.2 E1");
+        second.parse_line("EXCLUDE_OBJECT_START NAME=part1");
+        second.parse_line("G1 X10 Y10 Z0.4 E1");
+
+        auto a = first.finalize();
+        auto b = second.finalize();
+
+        REQUIRE(a.object_names == b.object_names);
+        REQUIRE(a.layers[0].segments[0].object_id == b.layers[0].segments[0].object_id);
+    }
+
+    SECTION("Segments stay compact") {
+        REQUIRE(sizeof(ToolpathSegment) <= 36);
     }
 }
 
@@ -1178,3 +1246,112 @@ TEST_CASE("GCodeParser - Real 3DBenchy layer count", "[gcode][parser][layers][in
         }
     }
 }
+
+// ============================================================================
+// Tokenizer Tests
+// ============================================================================
+
+TEST_CASE("scan_gcode_float - numeric literals", "[gcode][parser][tokenizer]") {
+    auto scan = [](const std::string& text, float& value) {
+        return scan_gcode_float(text.data(), text.data() + text.size(), value);
+    };
+    float value = 0.0f;
+
+    SECTION("Plain and signed values") {
+        REQUIRE(scan("123.456", value) == 7);
+        REQUIRE(value == Approx(123.456f));
+        REQUIRE(scan("-0.25", value) == 5);
+        REQUIRE(value == Approx(-0.25f));
+        REQUIRE(scan("+7", value) == 2);
+        REQUIRE(value == Approx(7.0f));
+    }
+
+    SECTION("Leading or trailing decimal point") {
+        REQUIRE(scan(".5", value) == 2);
+        REQUIRE(value == Approx(0.5f));
+        REQUIRE(scan("10.", value) == 3);
+        REQUIRE(value == Approx(10.0f));
+    }
+
+    SECTION("Stops at first non-numeric character") {
+        REQUIRE(scan("0.45mm", value) == 4);
+        REQUIRE(value == Approx(0.45f));
+        REQUIRE(scan("12 Y3", value) == 2);
+        REQUIRE(value == Approx(12.0f));
+    }
+
+    SECTION("Rejects input without digits") {
+        value = 99.0f;
+        REQUIRE(scan("-", value) == 0);
+        REQUIRE(scan("abc", value) == 0);
+        REQUIRE(scan("", value) == 0);
+        REQUIRE(value == 99.0f);
+    }
+
+    SECTION("Matches std::stof for typical slicer output") {
+        for (const char* text : {"0.2", "117.993", "-1.2", "0.03218", "150.0001", "3.14159265"}) {
+            REQUIRE(scan(text, value) > 0);
+            REQUIRE(value == std::stof(text));
+        }
+    }
+}
+
+TEST_CASE("GCodeParser - string_view input", "[gcode][parser][tokenizer]") {
+    GCodeParser parser;
+
+    SECTION("Parses lines borrowed from a larger buffer") {
+        std::string buffer = "G1 X10 Y20 Z0.2 E1.5\nG1 X30 Y20 E2.5 ; outer wall\n";
+        std::string_view view(buffer);
+        size_t nl = view.find('\n');
+        parser.parse_line(view.substr(0, nl));
+        parser.parse_line(view.substr(nl + 1, view.size() - nl - 2));
+        auto file = parser.finalize();
+
+        REQUIRE(file.total_segments == 2);
+        REQUIRE(file.layers[0].segments[1].end.x == Approx(30.0f));
+        REQUIRE(file.layers[0].segments[1].is_extrusion);
+    }
+
+    SECTION("Tab separated parameters and parameter order") {
+        parser.parse_line("G1\tZ0.2\tY5 X3");
+        parser.parse_line("G1 E1 Y5 X6");
+        auto file = parser.finalize();
+
+        REQUIRE(file.total_segments == 2);
+        REQUIRE(file.layers[0].segments[0].end.x == Approx(3.0f));
+        REQUIRE(file.layers[0].segments[0].end.y == Approx(5.0f));
+        REQUIRE(file.layers[0].segments[1].end.x == Approx(6.0f));
+        REQUIRE(file.layers[0].segments[1].is_extrusion);
+    }
+}
+
+TEST_CASE("GCodeParser - Parse throughput", "[gcode][parser][.benchmark]") {
+    std::ifstream file_stream("assets/test_gcodes/3DBenchy.gcode");
+    if (!file_stream.good()) {
+        SKIP("Test G-code file not found");
+    }
+
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(file_stream, line)) {
+        lines.push_back(line);
+    }
+
+    constexpr int kIterations = 5;
+    double best_seconds = 1e9;
+    for (int i = 0; i < kIterations; ++i) {
+        GCodeParser parser;
+        auto start = std::chrono::steady_clock::now();
+        for (const auto& l : lines) {
+            parser.parse_line(l);
+        }
+        auto file = parser.finalize();
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+        best_seconds = std::min(best_seconds, elapsed.count());
+        REQUIRE(file.total_segments > 0);
+    }
+
+    WARN("Parsed " << lines.size() << " lines at "
+                   << static_cast<long>(static_cast<double>(lines.size()) / best_seconds)
+                   << " lines/sec");
+}
@@ -0,0 +1,261 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_file_modifier.h"
+#include "gcode_stream_modifier.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+
+namespace {
+
+// Feed text in fixed-size chunks, as a download callback would
+std::string run_stream(GCodeStreamModifier& stream, const std::string& text, size_t chunk_size) {
+    std::string output;
+    auto sink = [&output](const char* data, size_t size) {
+        output.append(data, size);
+        return true;
+    };
+    for (size_t pos = 0; pos < text.size(); pos += chunk_size) {
+        REQUIRE(stream.feed(text.data() + pos, std::min(chunk_size, text.size() - pos), sink));
+    }
+    REQUIRE(stream.finish(sink));
+    REQUIRE(stream.result().success);
+    REQUIRE(stream.result().original_size == text.size());
+    REQUIRE(stream.result().modified_size == output.size());
+    return output;
+}
+
+std::string run_stream(std::vector<Modification> mods, const std::string& text,
+                       size_t chunk_size) {
+    GCodeStreamModifier stream(std::move(mods));
+    return run_stream(stream, text, chunk_size);
+}
+
+std::string numbered_lines(size_t count) {
+    std::string text;
+    for (size_t i = 1; i <= count; ++i) {
+        text += "G1 X" + std::to_string(i) + " E0.1\n";
+    }
+    return text;
+}
+
+} // namespace
+
+TEST_CASE("GCodeStreamModifier - Matches buffered modifier", "[gcode][modifier][stream]") {
+    // No trailing newline so apply_to_content (which drops it) is directly comparable
+    std::string text = "; header\nG28\nBED_MESH_CALIBRATE\n; already a comment\n"
+                       "PRINT_START BED=60\nG1 X0 Y0\nG1 X10 Y10 E1\nM84";
+    std::vector<Modification> mods = {
+        Modification::comment_out(3, "Disabled bed mesh"),
+        Modification::comment_out(4),
+        Modification::replace(5, "PRINT_START BED=60 SKIP_BED_MESH=1"),
+        Modification::inject_before(2, "; before G28\nM117 Homing"),
+        Modification::inject_after(7, "; after move"),
+        {ModificationType::DELETE, 6, 0, "", ""},
+    };
+
+    GCodeFileModifier buffered;
+    for (const auto& mod : mods) {
+        buffered.add_modification(mod);
+    }
+    std::string expected = buffered.apply_to_content(text);
+
+    for (size_t chunk : {1u, 2u, 7u, 64u, 4096u}) {
+        INFO("chunk " << chunk);
+        REQUIRE(run_stream(mods, text, chunk) == expected);
+    }
+}
+
+TEST_CASE("GCodeStreamModifier - Preserves line endings", "[gcode][modifier][stream]") {
+    SECTION("Trailing newline is kept") {
+        REQUIRE(run_stream({Modification::comment_out(1)}, "G28\nG1 X0\n", 3) == "; G28\nG1 X0\n");
+    }
+
+    SECTION("Missing final newline stays missing") {
+        REQUIRE(run_stream({Modification::comment_out(2)}, "G28\nG1 X0", 3) == "G28\n; G1 X0");
+        REQUIRE(run_stream({Modification::inject_after(2, "M84")}, "G28\nG1 X0", 5) ==
+                "G28\nG1 X0\nM84");
+    }
+
+    SECTION("CRLF lines keep CRLF, including injected ones") {
+        std::string out = run_stream(
+            {Modification::comment_out(1, "x"), Modification::inject_before(2, "M117 A\nM117 B")},
+            "G28\r\nG1 X0\r\n", 4);
+        REQUIRE(out == "; G28  ; [HelixScreen: x]\r\nM117 A\r\nM117 B\r\nG1 X0\r\n");
+    }
+
+    SECTION("No modifications is a byte-exact copy") {
+        std::string text = "G28\r\n\n;x\nG1 X0";
+        GCodeStreamModifier stream({});
+        REQUIRE(run_stream(stream, text, 3) == text);
+        REQUIRE(stream.lines_processed() == 0);
+    }
+}
+
+TEST_CASE("GCodeStreamModifier - Ranges", "[gcode][modifier][stream]") {
+    std::string text = "L1\nL2\nL3\nL4\nL5\n";
+
+    SECTION("Comment out range") {
+        REQUIRE(run_stream({Modification::comment_out_range(2, 4)}, text, 2) ==
+                "L1\n; L2\n; L3\n; L4\nL5\n");
+    }
+
+    SECTION("Delete range") {
+        GCodeStreamModifier stream({{ModificationType::DELETE, 2, 3, "", ""}});
+        REQUIRE(run_stream(stream, text, 2) == "L1\nL4\nL5\n");
+        REQUIRE(stream.result().lines_removed == 2);
+    }
+
+    SECTION("Replace range writes the replacement once") {
+        REQUIRE(run_stream({{ModificationType::REPLACE, 2, 4, "NEW", ""}}, text, 2) ==
+                "L1\nNEW\nL5\n");
+    }
+
+    SECTION("Line past the end of the file is ignored") {
+        REQUIRE(run_stream({Modification::comment_out(99)}, text, 2) == text);
+    }
+}
+
+TEST_CASE("GCodeStreamModifier - Header fast path", "[gcode][modifier][stream]") {
+    std::string text = numbered_lines(5000);
+    GCodeStreamModifier stream(
+        {Modification::comment_out(3), Modification::inject_after(10, "M117 hi")});
+    std::string out = run_stream(stream, text, 1000);
+
+    REQUIRE(stream.passthrough_line() == 10);
+    REQUIRE(stream.in_passthrough());
+    REQUIRE(stream.lines_processed() == 10); // Nothing after line 10 was split
+
+    std::string expected = text;
+    size_t line3 = expected.find("G1 X3 ");
+    expected.insert(line3, "; ");
+    size_t line11 = expected.find("G1 X11 ");
+    expected.insert(line11, "M117 hi\n");
+    REQUIRE(out == expected);
+}
+
+TEST_CASE("GCodeStreamModifier - Errors", "[gcode][modifier][stream]") {
+    SECTION("Sink failure aborts the stream") {
+        GCodeStreamModifier stream({Modification::comment_out(1)});
+        auto sink = [](const char*, size_t) { return false; };
+        std::string text = numbered_lines(10);
+        REQUIRE_FALSE(stream.feed(text.data(), text.size(), sink));
+        REQUIRE_FALSE(stream.finish(sink));
+        REQUIRE_FALSE(stream.result().success);
+        REQUIRE_FALSE(stream.result().error_message.empty());
+    }
+
+    SECTION("Overlong line before the last modification fails") {
+        GCodeStreamModifier stream({Modification::comment_out(2)});
+        auto sink = [](const char*, size_t) { return true; };
+        std::string junk(64 * 1024, 'x');
+        bool ok = true;
+        for (size_t sent = 0; ok && sent <= GCodeStreamModifier::MAX_LINE_LENGTH;
+             sent += junk.size()) {
+            ok = stream.feed(junk.data(), junk.size(), sink);
+        }
+        REQUIRE_FALSE(ok);
+        REQUIRE_FALSE(stream.finish(sink));
+    }
+}
+
+TEST_CASE("GCodeFileModifier - Streaming preserves file bytes", "[gcode][modifier][streaming]") {
+    std::string test_path = "/tmp/helix_stream_test_exact.gcode";
+    std::string text = "G28\r\nBED_MESH_CALIBRATE\r\n" + numbered_lines(2000) + "M84";
+    {
+        std::ofstream out(test_path, std::ios::binary);
+        out << text;
+    }
+
+    GCodeFileModifier modifier;
+    modifier.add_modification(Modification::comment_out(2));
+    auto result = modifier.apply(test_path); // Header fast path
+
+    REQUIRE(result.success);
+    REQUIRE(result.lines_modified == 1);
+    std::ifstream in(result.modified_path, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    REQUIRE(content == "G28\r\n; BED_MESH_CALIBRATE\r\n" + numbered_lines(2000) + "M84");
+    REQUIRE(result.modified_size == content.size());
+
+    std::filesystem::remove(test_path);
+    std::filesystem::remove(result.modified_path);
+}
+
+TEST_CASE("GCodeStreamModifier - Throughput", "[gcode][modifier][stream][.benchmark]") {
+    std::string text = numbered_lines(2500000); // ~40MB
+    const double mb = static_cast<double>(text.size()) / (1024.0 * 1024.0);
+    std::string path = "/tmp/test_stream_modifier_" + std::to_string(rand()) + ".gcode";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << text;
+    }
+
+    auto time_ms = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+    };
+
+    // Previous streaming mode: getline + per-line lookup + per-line write for the whole file
+    std::string old_out = path + ".old";
+    double getline_ms = time_ms([&] {
+        std::ifstream in(path);
+        std::ofstream out(old_out);
+        std::string line;
+        size_t n = 0;
+        while (std::getline(in, line)) {
+            if (++n > 1) {
+                out << '\n';
+            }
+            out << (n == 2 ? "; " + line : line);
+        }
+    });
+    std::remove(old_out.c_str());
+
+    GCodeFileModifier header_mod;
+    header_mod.add_modification(Modification::comment_out(2));
+    ModificationResult header_result;
+    double header_ms = time_ms([&] { header_result = header_mod.apply_streaming(path); });
+    REQUIRE(header_result.success);
+    std::remove(header_result.modified_path.c_str());
+
+    // Worst case: a modification on the last line keeps every line going through the splitter
+    GCodeFileModifier tail_mod;
+    tail_mod.add_modification(Modification::comment_out(2500000));
+    ModificationResult tail_result;
+    double tail_ms = time_ms([&] { tail_result = tail_mod.apply_streaming(path); });
+    REQUIRE(tail_result.success);
+    std::remove(tail_result.modified_path.c_str());
+
+    // In-memory pipe (download chunks -> upload chunks), header edit
+    size_t piped = 0;
+    double pipe_ms = time_ms([&] {
+        GCodeStreamModifier stream({Modification::comment_out(2)});
+        auto sink = [&piped](const char*, size_t size) {
+            piped += size;
+            return true;
+        };
+        for (size_t pos = 0; pos < text.size(); pos += 16 * 1024) {
+            stream.feed(text.data() + pos, std::min<size_t>(16 * 1024, text.size() - pos), sink);
+        }
+        stream.finish(sink);
+    });
+    std::remove(path.c_str());
+
+    WARN("Modify " << mb << " MB: getline " << mb * 1000.0 / getline_ms << " MB/s, header edit "
+                   << mb * 1000.0 / header_ms << " MB/s, last-line edit "
+                   << mb * 1000.0 / tail_ms << " MB/s, piped header edit "
+                   << mb * 1000.0 / pipe_ms << " MB/s (" << piped << " bytes)");
+    REQUIRE(piped == text.size() + 2); // "; " before line 2
+    REQUIRE(header_ms < getline_ms);
+}
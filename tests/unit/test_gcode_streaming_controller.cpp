@@ -177,6 +177,57 @@ TEST_CASE("GCodeStreamingController layer access", "[gcode][streaming]") {
     }
 }
 
+TEST_CASE("GCodeStreamingController layers resume parser state", "[gcode][streaming]") {
+    // Relative E, the active tool and the open object all carry across layer boundaries
+    TempGCodeFile temp_file(R"(M83
+T1
+EXCLUDE_OBJECT_DEFINE NAME=part
+G1 Z0.2
+EXCLUDE_OBJECT_START NAME=part
+G1 X10 Y10 E1
+G1 X20 Y10 E1
+G1 Z0.4
+G1 X20 Y20 E0.5
+EXCLUDE_OBJECT_END NAME=part
+G1 X30 Y20
+G1 Z0.6
+G1 X30 Y30 E0.5
+)");
+    GCodeStreamingController controller;
+    REQUIRE(controller.open_file(temp_file.path()));
+    REQUIRE(controller.get_layer_count() == 3);
+
+    // Load out of order - each layer must be independent of what was parsed before
+    auto layer1 = controller.get_layer_segments(1);
+    REQUIRE(layer1 != nullptr);
+    REQUIRE(layer1->size() == 2);
+
+    const auto& first = (*layer1)[0];
+    REQUIRE(first.start.x == Catch::Approx(20.0f)); // Position from previous layer
+    REQUIRE(first.start.y == Catch::Approx(10.0f));
+    REQUIRE(first.is_extrusion);
+    REQUIRE(first.extrusion_amount == Catch::Approx(0.5f)); // M83 still active
+    REQUIRE(first.tool_index == 1);
+    REQUIRE(controller.get_object_names()->name(first.object_id) == "part");
+
+    const auto& travel = (*layer1)[1];
+    REQUIRE_FALSE(travel.is_extrusion);
+    REQUIRE(travel.object_id == NO_OBJECT_ID);
+
+    SECTION("prefetch decodes the same segments") {
+        controller.clear_cache();
+        controller.prefetch_around(1, 1);
+        controller.wait_for_prefetch();
+        REQUIRE(controller.is_layer_cached(0));
+        REQUIRE(controller.is_layer_cached(2));
+
+        auto again = controller.get_layer_segments(1);
+        REQUIRE(again->size() == layer1->size());
+        REQUIRE((*again)[0].start == first.start);
+        REQUIRE((*again)[0].extrusion_amount == first.extrusion_amount);
+    }
+}
+
 TEST_CASE("GCodeStreamingController cache management", "[gcode][streaming]") {
     TempGCodeFile temp_file(SIMPLE_3_LAYER_GCODE);
 
@@ -245,6 +296,7 @@ TEST_CASE("GCodeStreamingController prefetch", "[gcode][streaming]") {
 
         // Access layer 10, which should prefetch layers 7-13
         controller.get_layer_segments(10);
+        controller.wait_for_prefetch();
 
         // Nearby layers should be cached
         REQUIRE(controller.is_layer_cached(10));
@@ -259,6 +311,7 @@ TEST_CASE("GCodeStreamingController prefetch", "[gcode][streaming]") {
     SECTION("explicit prefetch works") {
         controller.clear_cache();
         controller.prefetch_around(5, 2);
+        controller.wait_for_prefetch();
 
         // Layers 3-7 should be cached
         for (size_t i = 3; i <= 7; ++i) {
@@ -267,6 +320,47 @@ TEST_CASE("GCodeStreamingController prefetch", "[gcode][streaming]") {
     }
 }
 
+TEST_CASE("GCodeStreamingController background prefetch", "[gcode][streaming]") {
+    std::string large_gcode = "; Test file\nG28\n";
+    for (int layer = 0; layer < 20; ++layer) {
+        float z = 0.2f + layer * 0.2f;
+        large_gcode += "G1 Z" + std::to_string(z) + " F1000\n";
+        large_gcode +=
+            "G1 X" + std::to_string(10 + layer) + " Y10 E" + std::to_string(layer + 1) + " F1500\n";
+    }
+
+    TempGCodeFile temp_file(large_gcode);
+    GCodeStreamingController controller;
+    REQUIRE(controller.open_file(temp_file.path()));
+    controller.clear_cache();
+
+    SECTION("request_layer loads in the background") {
+        controller.request_layer(4);
+        controller.wait_for_prefetch();
+        REQUIRE(controller.is_layer_cached(4));
+        REQUIRE(controller.is_layer_cached(5));
+    }
+
+    SECTION("prefetched layers count as prefetch hits") {
+        controller.get_layer_segments(10);
+        controller.wait_for_prefetch();
+        controller.get_layer_segments(11);
+        controller.get_layer_segments(12);
+
+        auto stats = controller.get_prefetch_stats();
+        REQUIRE(stats.hits == 2);
+        REQUIRE(stats.completed >= 6);
+        REQUIRE(stats.max_queue_latency_ms >= stats.avg_queue_latency_ms);
+        REQUIRE(stats.hit_rate() > 0.0f);
+    }
+
+    SECTION("close waits for running loads") {
+        controller.prefetch_around(15, 4);
+        controller.close();
+        REQUIRE_FALSE(controller.is_layer_cached(15));
+    }
+}
+
 TEST_CASE("GCodeStreamingController index stats", "[gcode][streaming]") {
     TempGCodeFile temp_file(SIMPLE_3_LAYER_GCODE);
     GCodeStreamingController controller;
@@ -266,6 +266,7 @@ TEST_CASE("Streaming controller prefetch integration", "[gcode][streaming]") {
         auto info = renderer.get_layer_info();
         renderer.set_current_layer(10);
         info = renderer.get_layer_info();
+        controller.wait_for_prefetch();
 
         // Nearby layers should be cached
         REQUIRE(controller.is_layer_cached(10));
@@ -0,0 +1,339 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "gcode_index_cache.h"
+#include "gcode_streaming_controller.h"
+#include "gcode_toolpath_cache.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+using Catch::Approx;
+
+namespace {
+
+namespace fs = std::filesystem;
+
+class TempCacheDir {
+  public:
+    TempCacheDir() {
+        path_ = (fs::temp_directory_path() / ("test_toolpath_cache_" + std::to_string(rand())))
+                    .string();
+        fs::create_directories(path_);
+    }
+
+    ~TempCacheDir() {
+        std::error_code ec;
+        fs::remove_all(path_, ec);
+    }
+
+    const std::string& path() const {
+        return path_;
+    }
+
+  private:
+    std::string path_;
+};
+
+class TempGCodeFile {
+  public:
+    explicit TempGCodeFile(const std::string& content) {
+        path_ = "/tmp/test_toolpath_cache_" + std::to_string(rand()) + ".gcode";
+        std::ofstream file(path_);
+        file << content;
+    }
+
+    ~TempGCodeFile() {
+        std::remove(path_.c_str());
+    }
+
+    const std::string& path() const {
+        return path_;
+    }
+
+  private:
+    std::string path_;
+};
+
+ToolpathSegment make_segment(glm::vec3 start, glm::vec3 end, float e, ObjectId object = 0,
+                             uint8_t tool = 0, float width = 0.0f) {
+    ToolpathSegment seg;
+    seg.start = start;
+    seg.end = end;
+    seg.extrusion_amount = e;
+    seg.is_extrusion = e > 0.0f;
+    seg.object_id = object;
+    seg.tool_index = tool;
+    seg.width = width;
+    return seg;
+}
+
+void require_same_segments(const std::vector<ToolpathSegment>& actual,
+                           const std::vector<ToolpathSegment>& expected) {
+    REQUIRE(actual.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const auto& a = actual[i];
+        const auto& b = expected[i];
+        REQUIRE(a.start.x == Approx(b.start.x).margin(0.0006));
+        REQUIRE(a.start.y == Approx(b.start.y).margin(0.0006));
+        REQUIRE(a.start.z == Approx(b.start.z).margin(0.0006));
+        REQUIRE(a.end.x == Approx(b.end.x).margin(0.0006));
+        REQUIRE(a.end.y == Approx(b.end.y).margin(0.0006));
+        REQUIRE(a.end.z == Approx(b.end.z).margin(0.0006));
+        REQUIRE(a.extrusion_amount == Approx(b.extrusion_amount).margin(0.00001));
+        REQUIRE(a.width == Approx(b.width).margin(0.0001));
+        REQUIRE(a.tool_index == b.tool_index);
+        REQUIRE(a.is_extrusion == b.is_extrusion);
+        REQUIRE(a.is_support == b.is_support);
+    }
+}
+
+std::string make_multi_layer_gcode(int layers, int moves_per_layer) {
+    std::string gcode = "EXCLUDE_OBJECT_DEFINE NAME=part_1\nG90\nM83\n"
+                        "EXCLUDE_OBJECT_START NAME=part_1\n";
+    for (int layer = 0; layer < layers; ++layer) {
+        gcode += "G1 Z" + std::to_string(0.2 + layer * 0.2) + " F1200\n";
+        for (int i = 0; i < moves_per_layer; ++i) {
+            gcode += "G1 X" + std::to_string(10 + (i % 40) * 0.37) + " Y" +
+                     std::to_string(20 + (i / 40) * 0.41) + " E0.0312\n";
+        }
+        gcode += "G1 X5 Y5\n";
+    }
+    gcode += "EXCLUDE_OBJECT_END NAME=part_1\n";
+    return gcode;
+}
+
+} // namespace
+
+TEST_CASE("Toolpath codec - Layer round trip", "[gcode][toolpath_cache]") {
+    std::vector<ToolpathSegment> segments = {
+        make_segment({10.0f, 10.0f, 0.2f}, {20.125f, 10.0f, 0.2f}, 0.4123f, 1, 0, 0.45f),
+        make_segment({20.125f, 10.0f, 0.2f}, {20.125f, 30.5f, 0.2f}, 0.8f, 1, 0, 0.45f),
+        make_segment({20.125f, 30.5f, 0.2f}, {100.0f, 200.0f, 0.6f}, 0.0f, 2, 0),
+        make_segment({150.0f, 5.0f, 0.6f}, {149.999f, 5.001f, 0.6f}, 0.002f, 2, 3, 0.4f),
+        make_segment({-5.0f, -2.5f, 0.6f}, {0.0f, 0.0f, 0.6f}, -0.8f, 0, 1),
+    };
+    segments[2].is_support = true;
+
+    std::vector<uint8_t> blob;
+    encode_toolpath_layer(segments, blob);
+
+    // Continuous moves only store an end delta, so this stays well below 36 bytes/segment
+    REQUIRE(blob.size() < segments.size() * 16);
+
+    std::vector<ToolpathSegment> decoded;
+    REQUIRE(decode_toolpath_layer(blob.data(), blob.size(), {}, decoded));
+    require_same_segments(decoded, segments);
+    for (size_t i = 0; i < segments.size(); ++i) {
+        REQUIRE(decoded[i].object_id == segments[i].object_id);
+    }
+
+    SECTION("Object ids are remapped") {
+        std::vector<ObjectId> remap = {NO_OBJECT_ID, 7, 9};
+        REQUIRE(decode_toolpath_layer(blob.data(), blob.size(), remap, decoded));
+        REQUIRE(decoded[0].object_id == 7);
+        REQUIRE(decoded[2].object_id == 9);
+        REQUIRE(decoded[4].object_id == NO_OBJECT_ID);
+    }
+
+    SECTION("Empty layer") {
+        std::vector<uint8_t> empty_blob;
+        encode_toolpath_layer({}, empty_blob);
+        REQUIRE(decode_toolpath_layer(empty_blob.data(), empty_blob.size(), {}, decoded));
+        REQUIRE(decoded.empty());
+    }
+
+    SECTION("Truncated blob is rejected") {
+        REQUIRE_FALSE(decode_toolpath_layer(blob.data(), blob.size() - 2, {}, decoded));
+        REQUIRE(decoded.empty());
+    }
+}
+
+TEST_CASE("Toolpath cache file - Write and read", "[gcode][toolpath_cache]") {
+    TempCacheDir dir;
+    std::string path = dir.path() + "/file.ltp";
+
+    auto names = std::make_shared<ObjectNameTable>();
+    ObjectId part = names->intern("part_a");
+    std::vector<std::vector<ToolpathSegment>> layers = {
+        {make_segment({0, 0, 0.2f}, {10, 0, 0.2f}, 0.5f, part)},
+        {},
+        {make_segment({0, 0, 0.4f}, {0, 10, 0.4f}, 0.5f),
+         make_segment({0, 10, 0.4f}, {10, 10, 0.4f}, 0.5f, part, 1)},
+    };
+
+    ToolpathCacheWriter writer;
+    REQUIRE(writer.open(path, "key-1", names));
+    for (const auto& layer : layers) {
+        REQUIRE(writer.add_layer(layer));
+    }
+    REQUIRE_FALSE(fs::exists(path)); // Only visible once finished
+    REQUIRE(writer.finish());
+    REQUIRE(fs::exists(path));
+
+    auto reader_names = std::make_shared<ObjectNameTable>();
+    reader_names->intern("something_else");
+    ToolpathCacheReader reader;
+    REQUIRE(reader.open(path, "key-1", reader_names));
+    REQUIRE(reader.layer_count() == layers.size());
+
+    std::vector<ToolpathSegment> decoded;
+    for (size_t i = 0; i < layers.size(); ++i) {
+        REQUIRE(reader.read_layer(i, decoded));
+        require_same_segments(decoded, layers[i]);
+    }
+    REQUIRE(reader_names->name(decoded[1].object_id) == "part_a");
+    REQUIRE_FALSE(reader.read_layer(layers.size(), decoded));
+
+    SECTION("Other source key is rejected") {
+        ToolpathCacheReader other;
+        REQUIRE_FALSE(other.open(path, "key-2", nullptr));
+    }
+
+    SECTION("Corrupt layer fails its checksum") {
+        {
+            std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+            f.seekp(17);
+            f.put('\x7f');
+        }
+        ToolpathCacheReader corrupt;
+        REQUIRE(corrupt.open(path, "key-1", nullptr));
+        REQUIRE_FALSE(corrupt.read_layer(0, decoded));
+        REQUIRE(corrupt.read_layer(2, decoded));
+    }
+
+    SECTION("Aborted write leaves nothing behind") {
+        ToolpathCacheWriter partial;
+        std::string partial_path = dir.path() + "/partial.ltp";
+        REQUIRE(partial.open(partial_path, "key-3", names));
+        REQUIRE(partial.add_layer(layers[0]));
+        partial.abort();
+        REQUIRE_FALSE(fs::exists(partial_path));
+        REQUIRE_FALSE(fs::exists(partial_path + ".tmp"));
+    }
+}
+
+TEST_CASE("GCodeStreamingController - Toolpath cache", "[gcode][toolpath_cache]") {
+    TempGCodeFile file(make_multi_layer_gcode(12, 50));
+    TempCacheDir dir;
+
+    // Reference segments straight from the G-code
+    std::vector<std::vector<ToolpathSegment>> expected;
+    {
+        GCodeStreamingController plain;
+        plain.set_index_cache(nullptr);
+        REQUIRE(plain.open_file(file.path()));
+        for (size_t i = 0; i < plain.get_layer_count(); ++i) {
+            expected.push_back(*plain.get_layer_segments(i));
+        }
+        REQUIRE_FALSE(plain.is_toolpath_cache_ready());
+    }
+
+    GCodeStreamingController controller;
+    controller.set_index_cache(nullptr);
+    controller.set_toolpath_cache_dir(dir.path());
+
+    REQUIRE(controller.open_file(file.path()));
+    controller.wait_for_toolpath_cache();
+    REQUIRE(controller.is_toolpath_cache_ready());
+
+    size_t cache_files = 0;
+    for (const auto& entry : fs::directory_iterator(dir.path())) {
+        cache_files += entry.path().extension() == TOOLPATH_CACHE_EXTENSION;
+    }
+    REQUIRE(cache_files == 1);
+
+    controller.clear_cache();
+    for (size_t i = 0; i < expected.size(); ++i) {
+        require_same_segments(*controller.get_layer_segments(i), expected[i]);
+    }
+
+    SECTION("Reopen reads the existing file") {
+        controller.close();
+        REQUIRE_FALSE(controller.is_toolpath_cache_ready());
+        REQUIRE(controller.open_file(file.path()));
+        REQUIRE(controller.is_toolpath_cache_ready());
+
+        auto names = controller.get_object_names();
+        auto segments = controller.get_layer_segments(3);
+        REQUIRE(segments);
+        REQUIRE(names->name(segments->front().object_id) == "part_1");
+        require_same_segments(*segments, expected[3]);
+    }
+
+    SECTION("Disabled cache writes nothing") {
+        controller.close();
+        for (const auto& entry : fs::directory_iterator(dir.path())) {
+            fs::remove(entry.path());
+        }
+        controller.set_toolpath_cache_dir("");
+        REQUIRE(controller.open_file(file.path()));
+        controller.wait_for_toolpath_cache();
+        REQUIRE_FALSE(controller.is_toolpath_cache_ready());
+        REQUIRE(fs::is_empty(dir.path()));
+    }
+}
+
+TEST_CASE("GCodeStreamingController - Close cancels toolpath cache write",
+          "[gcode][toolpath_cache]") {
+    TempGCodeFile file(make_multi_layer_gcode(400, 40));
+    TempCacheDir dir;
+
+    GCodeStreamingController controller;
+    controller.set_index_cache(nullptr);
+    controller.set_toolpath_cache_dir(dir.path());
+    REQUIRE(controller.open_file(file.path()));
+    controller.close();
+
+    // Either the write finished first or the partial file was discarded
+    for (const auto& entry : fs::directory_iterator(dir.path())) {
+        REQUIRE(entry.path().extension() == TOOLPATH_CACHE_EXTENSION);
+    }
+}
+
+TEST_CASE("Toolpath cache - Layer load performance", "[gcode][toolpath_cache][.benchmark]") {
+    TempGCodeFile file(make_multi_layer_gcode(300, 2000));
+    TempCacheDir dir;
+
+    GCodeStreamingController controller(64 * 1024 * 1024);
+    controller.set_index_cache(nullptr);
+    controller.set_toolpath_cache_dir(dir.path());
+    REQUIRE(controller.open_file(file.path()));
+
+    auto load_all = [&]() {
+        controller.clear_cache();
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < controller.get_layer_count(); ++i) {
+            controller.get_layer_segments(i);
+        }
+        controller.wait_for_prefetch();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                         start)
+            .count();
+    };
+
+    controller.wait_for_toolpath_cache();
+    REQUIRE(controller.is_toolpath_cache_ready());
+    double cached_ms = load_all();
+
+    controller.set_toolpath_cache_dir("");
+    controller.close();
+    REQUIRE(controller.open_file(file.path()));
+    double parsed_ms = load_all();
+
+    uintmax_t cache_bytes = 0;
+    for (const auto& entry : fs::directory_iterator(dir.path())) {
+        cache_bytes += fs::file_size(entry.path());
+    }
+    WARN("G-code " << fs::file_size(file.path()) / 1024 << " KB -> toolpath cache "
+                   << cache_bytes / 1024 << " KB (" << cache_bytes / controller.get_layer_count()
+                   << " bytes/layer). Load all layers: parse " << parsed_ms << "ms, cached "
+                   << cached_ms << "ms");
+    REQUIRE(cache_bytes > 0);
+    REQUIRE(cached_ms < parsed_ms);
+}
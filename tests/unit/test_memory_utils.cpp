@@ -108,7 +108,7 @@ TEST_CASE("2D streaming: layer index scales with file size", "[memory][streaming
 
 TEST_CASE("2D streaming: exact boundary calculation", "[memory][streaming][edge]") {
     // Calculate exact memory needed and verify boundary behavior
-    // Formula: (file_size / 500 * 24) / 1024 + 1024 + (w * h * 4) / 1024 + 3072
+    // Formula: (file_size / 500 * 48) / 1024 + 1024 + (w * h * 4) / 1024 + 3072
 
     size_t file_size = 10 * 1024 * 1024; // 10MB
     int display_width = 800;
@@ -116,7 +116,7 @@ TEST_CASE("2D streaming: exact boundary calculation", "[memory][streaming][edge]
 
     // Calculate expected requirement
     size_t estimated_layers = file_size / 500;
-    size_t layer_index_kb = (estimated_layers * 24) / 1024;
+    size_t layer_index_kb = (estimated_layers * 48) / 1024;
     size_t lru_cache_kb = 1024;
     size_t ghost_buffer_kb = (800 * 480 * 4) / 1024;
     size_t safety_margin_kb = 3 * 1024;
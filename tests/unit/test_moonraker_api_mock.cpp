@@ -13,6 +13,7 @@
  * TDD: These tests are written BEFORE the implementation is complete.
  */
 
+#include "gcode_stream_modifier.h"
 #include "moonraker_api_mock.h"
 #include "moonraker_client_mock.h"
 #include "printer_state.h"
@@ -407,6 +408,66 @@ TEST_CASE_METHOD(MoonrakerAPIMockTestFixture,
     std::remove(dest_path.c_str());
 }
 
+// ============================================================================
+// transform_file Tests (Piped Download -> Transform -> Upload)
+// ============================================================================
+
+TEST_CASE_METHOD(MoonrakerAPIMockTestFixture,
+                 "MoonrakerAPIMock transform_file pipes content through the modifier",
+                 "[mock][api][transform][streaming]") {
+    std::string original_content;
+    api_->download_file(
+        "gcodes", "3DBenchy.gcode", [&](const std::string& content) { original_content = content; },
+        [](const MoonrakerError&) {});
+    REQUIRE(original_content.size() > 100);
+
+    auto stream = std::make_shared<helix::gcode::GCodeStreamModifier>(
+        std::vector<helix::gcode::Modification>{helix::gcode::Modification::comment_out(1)});
+    std::atomic<bool> success_called{false};
+    size_t last_progress = 0;
+
+    api_->transform_file(
+        "gcodes", "3DBenchy.gcode", ".helix_temp/modified_3DBenchy.gcode",
+        [stream](const char* data, size_t size, const MoonrakerAPI::ChunkSink& sink) {
+            return size > 0 ? stream->feed(data, size, sink) : stream->finish(sink);
+        },
+        [&]() { success_called.store(true); }, [](const MoonrakerError&) {},
+        [&](size_t received, size_t) { last_progress = received; });
+
+    REQUIRE(success_called.load());
+    REQUIRE(last_progress == original_content.size());
+    REQUIRE(stream->lines_processed() == 1); // Rest of the file passed through untouched
+    std::string expected = original_content;
+    if (expected[0] != ';') {
+        expected.insert(0, "; ");
+    }
+    REQUIRE(api_->last_transform_output() == expected);
+}
+
+TEST_CASE_METHOD(MoonrakerAPIMockTestFixture,
+                 "MoonrakerAPIMock transform_file reports missing file and failed transform",
+                 "[mock][api][transform][streaming]") {
+    MoonrakerError captured_error;
+    bool success_called = false;
+    auto pass = [](const char* data, size_t size, const MoonrakerAPI::ChunkSink& sink) {
+        return sink(data, size);
+    };
+
+    api_->transform_file(
+        "gcodes", "nonexistent_file_xyz123.gcode", "out.gcode", pass,
+        [&]() { success_called = true; }, [&](const MoonrakerError& err) { captured_error = err; });
+    REQUIRE_FALSE(success_called);
+    REQUIRE(captured_error.type == MoonrakerErrorType::FILE_NOT_FOUND);
+    REQUIRE(captured_error.method == "transform_file");
+
+    api_->transform_file(
+        "gcodes", "3DBenchy.gcode", "out.gcode",
+        [](const char*, size_t, const MoonrakerAPI::ChunkSink&) { return false; },
+        [&]() { success_called = true; }, [&](const MoonrakerError& err) { captured_error = err; });
+    REQUIRE_FALSE(success_called);
+    REQUIRE(captured_error.type == MoonrakerErrorType::UNKNOWN);
+}
+
 // ============================================================================
 // Edge Cases
 // ============================================================================
@@ -474,6 +474,75 @@ TEST_CASE_METHOD(MoonrakerRobustnessFixture,
     }
 }
 
+TEST_CASE_METHOD(MoonrakerRobustnessFixture,
+                 "MoonrakerClient tracks 1000 concurrent requests through one timeout tick",
+                 "[connection][edge][timeout][concurrent][priority3][eventloop][slow]") {
+    // Metadata storm: half the requests are answered, the server never answers the rest
+    constexpr int NUM_THREADS = 10;
+    constexpr int REQUESTS_PER_THREAD = 100;
+    constexpr int TOTAL_REQUESTS = NUM_THREADS * REQUESTS_PER_THREAD;
+    constexpr uint32_t TIMEOUT_MS = 300;
+
+    server_->ignore_method("server.files.metadata");
+    client_->set_default_request_timeout(TIMEOUT_MS);
+
+    std::atomic<bool> connected{false};
+    client_->connect(
+        server_url().c_str(), [&connected]() { connected = true; }, []() {});
+    for (int i = 0; i < 50 && !connected; i++) {
+        std::this_thread::sleep_for(milliseconds(100));
+    }
+    REQUIRE(connected);
+
+    std::atomic<int> success_count{0};
+    std::atomic<int> timeout_count{0};
+    std::atomic<int> other_errors{0};
+
+    auto send_requests = [&]() {
+        for (int i = 0; i < REQUESTS_PER_THREAD; i++) {
+            const char* method = (i % 2 == 0) ? "printer.info" : "server.files.metadata";
+            client_->send_jsonrpc(
+                method, json{{"filename", "part.gcode"}},
+                [&success_count](json) { success_count++; },
+                [&timeout_count, &other_errors](const MoonrakerError& err) {
+                    if (err.type == MoonrakerErrorType::TIMEOUT) {
+                        timeout_count++;
+                    } else {
+                        other_errors++;
+                    }
+                });
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_THREADS; i++) {
+        threads.emplace_back(send_requests);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < 100 && success_count < TOTAL_REQUESTS / 2; i++) {
+        std::this_thread::sleep_for(milliseconds(50));
+    }
+    REQUIRE(success_count == TOTAL_REQUESTS / 2);
+
+    // Responses no longer expire anything; only the tick does
+    REQUIRE(client_->pending_request_count() == TOTAL_REQUESTS / 2);
+    REQUIRE(timeout_count == 0);
+
+    std::this_thread::sleep_for(milliseconds(TIMEOUT_MS + 100));
+    client_->process_timeouts();
+    REQUIRE(timeout_count == TOTAL_REQUESTS / 2);
+    REQUIRE(client_->pending_request_count() == 0);
+
+    // Nothing left to expire, and no callback ran twice
+    client_->process_timeouts();
+    REQUIRE(timeout_count == TOTAL_REQUESTS / 2);
+    REQUIRE(success_count == TOTAL_REQUESTS / 2);
+    REQUIRE(other_errors == 0);
+}
+
 // ============================================================================
 // Priority 4: Connection State Transitions
 // ============================================================================
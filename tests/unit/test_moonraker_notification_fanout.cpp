@@ -0,0 +1,146 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_moonraker_notification_fanout.cpp
+ * @brief Unit tests for shared (zero-copy) notification dispatch in MoonrakerClient
+ *
+ * A notification is parsed once and every subscriber sees the same object.
+ * The 10 Hz benchmark drives MoonrakerClientMock's status simulation.
+ */
+
+#include "../../include/moonraker_client.h"
+#include "../../include/moonraker_client_mock.h"
+
+#include <chrono>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+namespace {
+
+/// Exposes the protected dispatch entry points used by the WebSocket handler
+class FanoutClient : public MoonrakerClient {
+  public:
+    using MoonrakerClient::dispatch_notification;
+    using MoonrakerClient::dispatch_status_update;
+    using MoonrakerClient::MoonrakerClient;
+};
+
+/// Status object with `count` printer objects, shaped like a 10 Hz update
+json make_status(int count) {
+    json status = json::object();
+    for (int i = 0; i < count; ++i) {
+        status["temperature_sensor sensor_" + std::to_string(i)] = {
+            {"temperature", 20.0 + i}, {"measured_min_temp", 18.5}, {"measured_max_temp", 61.25}};
+    }
+    return status;
+}
+
+JsonMessage make_notification(int objects) {
+    return std::make_shared<const json>(json{
+        {"method", "notify_status_update"}, {"params", json::array({make_status(objects), 1.0})}});
+}
+
+} // namespace
+
+TEST_CASE("MoonrakerClient shares one notification with every subscriber",
+          "[moonraker][notifications]") {
+    auto loop = std::make_shared<hv::EventLoop>();
+    FanoutClient client(loop);
+
+    std::set<const json*> seen;
+    for (int i = 0; i < 4; ++i) {
+        client.register_notify_update([&seen](const json& msg) { seen.insert(&msg); });
+    }
+    std::vector<JsonMessage> queued;
+    client.register_notify_message([&queued](const JsonMessage& msg) { queued.push_back(msg); });
+    client.register_method_callback("notify_status_update", "test",
+                                    [&seen](const json& msg) { seen.insert(&msg); });
+
+    client.reset_notification_stats();
+    JsonMessage message = make_notification(30);
+    client.dispatch_notification("notify_status_update", message, 4096);
+
+    // All views point at the original object, and the queue holds that same message
+    REQUIRE(seen.size() == 1);
+    REQUIRE(*seen.begin() == message.get());
+    REQUIRE(queued.size() == 1);
+    REQUIRE(queued[0] == message);
+
+    NotificationStats stats = client.get_notification_stats();
+    REQUIRE(stats.messages == 1);
+    REQUIRE(stats.deliveries == 6);
+    REQUIRE(stats.payload_bytes == 4096);
+}
+
+TEST_CASE("MoonrakerClient dispatches moved and borrowed status objects",
+          "[moonraker][notifications]") {
+    auto loop = std::make_shared<hv::EventLoop>();
+    FanoutClient client(loop);
+
+    json received;
+    client.register_notify_update([&received](const json& msg) { received = msg; });
+    client.reset_notification_stats();
+
+    SECTION("Moved status") {
+        client.dispatch_status_update(make_status(3));
+        REQUIRE(client.get_notification_stats().deliveries == 1);
+    }
+
+    SECTION("Borrowed status is left intact") {
+        client.register_notify_update([](const json&) {});
+        json status = make_status(3);
+        client.dispatch_status_update(status);
+        REQUIRE(client.get_notification_stats().deliveries == 2);
+        REQUIRE(status.size() == 3); // Caller's object untouched
+    }
+
+    REQUIRE(received["method"] == "notify_status_update");
+    REQUIRE(received["params"][0].size() == 3);
+}
+
+TEST_CASE("MoonrakerClientMock notification fan-out at 10 Hz x 30 objects",
+          "[moonraker][notifications][.benchmark]") {
+    constexpr int RATE_HZ = 10;
+    constexpr int OBJECTS = 30;
+    constexpr int SECONDS = 5;
+    constexpr int SUBSCRIBERS = 8; // Manager, 3 AMS backends, bed mesh, plugins, collector
+
+    MoonrakerClientMock client(MoonrakerClientMock::PrinterType::VORON_24);
+    std::vector<std::string> sensors;
+    for (int i = 0; i < OBJECTS; ++i) {
+        sensors.push_back("temperature_sensor sensor_" + std::to_string(i));
+    }
+    client.set_sensors(sensors);
+    client.set_status_update_interval(std::chrono::milliseconds(1000 / RATE_HZ));
+
+    // Subscribers run on the simulation thread; read only after disconnect() joins it
+    std::vector<std::vector<const json*>> seen(SUBSCRIBERS);
+    for (auto& views : seen) {
+        client.register_notify_update([&views](const json& msg) { views.push_back(&msg); });
+    }
+
+    client.connect("ws://mock/websocket", []() {}, []() {});
+    client.reset_notification_stats();
+    std::this_thread::sleep_for(std::chrono::seconds(SECONDS));
+    NotificationStats stats = client.get_notification_stats();
+    client.disconnect();
+
+    WARN(stats.messages / stats.elapsed_sec
+         << " notifications/s, " << stats.payload_bytes_per_sec() << " B/s dispatched to "
+         << SUBSCRIBERS << " subscribers (" << stats.payload_bytes_per_sec() * SUBSCRIBERS
+         << " B/s if each got a copy)");
+    REQUIRE(stats.messages >= static_cast<uint64_t>(RATE_HZ * SECONDS / 2));
+    REQUIRE(stats.deliveries >= stats.messages * SUBSCRIBERS);
+    REQUIRE(stats.payload_bytes > stats.messages * OBJECTS * 20); // Every sensor in every update
+
+    // Each notification reached every subscriber as the same object
+    REQUIRE(seen[0].size() >= stats.messages);
+    for (const auto& views : seen) {
+        REQUIRE(views == seen[0]);
+    }
+}
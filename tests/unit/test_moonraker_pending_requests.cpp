@@ -0,0 +1,182 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_moonraker_pending_requests.cpp
+ * @brief Unit tests for PendingRequestMap deadline tracking
+ *
+ * Requests expire in deadline order, answered or cancelled requests never
+ * expire, and stale heap entries do not accumulate.
+ */
+
+#include "../../include/moonraker_request.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace std::chrono;
+
+namespace {
+
+PendingRequest make_request(uint64_t id, steady_clock::time_point sent, uint32_t timeout_ms) {
+    PendingRequest request;
+    request.id = id;
+    request.method = "server.files.metadata";
+    request.timestamp = sent;
+    request.timeout_ms = timeout_ms;
+    return request;
+}
+
+std::vector<uint64_t> ids(const std::vector<PendingRequest>& requests) {
+    std::vector<uint64_t> out;
+    for (const auto& request : requests) {
+        out.push_back(request.id);
+    }
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("PendingRequestMap expires only due requests, in deadline order",
+          "[moonraker][timeout]") {
+    PendingRequestMap pending;
+    auto t0 = steady_clock::now();
+
+    REQUIRE(pending.insert(make_request(1, t0, 300)));
+    REQUIRE(pending.insert(make_request(2, t0, 100)));
+    REQUIRE(pending.insert(make_request(3, t0 + milliseconds(50), 100)));
+    REQUIRE(pending.insert(make_request(4, t0, 5000)));
+    REQUIRE_FALSE(pending.insert(make_request(2, t0, 10))); // Duplicate id
+    REQUIRE(pending.size() == 4);
+
+    // A deadline exactly at "now" has not passed yet
+    REQUIRE(pending.take_expired(t0 + milliseconds(100)).empty());
+
+    REQUIRE(ids(pending.take_expired(t0 + milliseconds(200))) == std::vector<uint64_t>{2, 3});
+    REQUIRE(pending.find(2) == pending.end());
+    REQUIRE(pending.size() == 2);
+
+    REQUIRE(ids(pending.take_expired(t0 + milliseconds(400))) == std::vector<uint64_t>{1});
+    REQUIRE(pending.take_expired(t0 + milliseconds(400)).empty()); // Idempotent
+    REQUIRE(pending.find(4) != pending.end());
+}
+
+TEST_CASE("PendingRequestMap skips answered and cancelled requests", "[moonraker][timeout]") {
+    PendingRequestMap pending;
+    auto t0 = steady_clock::now();
+
+    for (uint64_t id = 1; id <= 10; ++id) {
+        pending.insert(make_request(id, t0, 100));
+    }
+    pending.erase(pending.find(3)); // Response arrived
+    REQUIRE(pending.erase(7) == 1); // cancel_request()
+    REQUIRE(pending.erase(7) == 0);
+
+    auto expired = pending.take_expired(t0 + seconds(1));
+    REQUIRE(expired.size() == 8);
+    for (const auto& request : expired) {
+        REQUIRE(request.id != 3);
+        REQUIRE(request.id != 7);
+        REQUIRE(request.method == "server.files.metadata"); // Moved out intact
+    }
+    REQUIRE(pending.empty());
+    REQUIRE(pending.deadline_count() == 0);
+
+    pending.insert(make_request(11, t0, 100));
+    pending.clear();
+    REQUIRE(pending.take_expired(t0 + seconds(1)).empty());
+}
+
+TEST_CASE("PendingRequestMap does not accumulate deadlines of fast responses",
+          "[moonraker][timeout]") {
+    // A metadata storm: every request is answered well before its 30 s deadline
+    PendingRequestMap pending;
+    auto t0 = steady_clock::now();
+    for (uint64_t id = 1; id <= 5000; ++id) {
+        pending.insert(make_request(id, t0, 30000));
+        if (id > 8) {
+            pending.erase(id - 8); // ~8 in flight at any time
+        }
+    }
+    REQUIRE(pending.size() == 8);
+    REQUIRE(pending.deadline_count() <= 2 * pending.size() + 65);
+
+    std::vector<uint64_t> expired = ids(pending.take_expired(t0 + seconds(31)));
+    std::sort(expired.begin(), expired.end());
+    REQUIRE(expired == std::vector<uint64_t>{4993, 4994, 4995, 4996, 4997, 4998, 4999, 5000});
+}
+
+TEST_CASE("PendingRequestMap counts requests with a stream decoder", "[moonraker][timeout]") {
+    PendingRequestMap pending;
+    auto t0 = steady_clock::now();
+    auto decoder = [](const std::string&) -> std::function<void()> { return nullptr; };
+
+    for (uint64_t id = 1; id <= 6; ++id) {
+        PendingRequest request = make_request(id, t0, id <= 3 ? 100 : 5000);
+        if (id % 2 == 0) {
+            request.stream_decoder = decoder;
+        }
+        pending.insert(std::move(request));
+    }
+    REQUIRE(pending.stream_decoder_count() == 3); // 2, 4, 6
+
+    REQUIRE(pending.set_stream_decoder(5, decoder));
+    REQUIRE(pending.set_stream_decoder(5, decoder)); // Replacing keeps the count
+    REQUIRE_FALSE(pending.set_stream_decoder(99, decoder));
+    REQUIRE(pending.stream_decoder_count() == 4);
+
+    REQUIRE(pending.take_expired(t0 + milliseconds(200)).size() == 3); // 1, 2, 3
+    REQUIRE(pending.stream_decoder_count() == 3);
+
+    pending.erase(pending.find(4));
+    REQUIRE(pending.erase(5) == 1);
+    REQUIRE(pending.erase(5) == 0);
+    REQUIRE(pending.stream_decoder_count() == 1);
+
+    REQUIRE(pending.set_stream_decoder(6, nullptr)); // Detached
+    REQUIRE(pending.stream_decoder_count() == 0);
+
+    pending.set_stream_decoder(6, decoder);
+    pending.clear();
+    REQUIRE(pending.stream_decoder_count() == 0);
+}
+
+TEST_CASE("Timeout check cost with 1000 requests in flight", "[moonraker][timeout][.benchmark]") {
+    constexpr int IN_FLIGHT = 1000;
+    constexpr int TICKS = 20000;
+    auto t0 = steady_clock::now();
+
+    std::map<uint64_t, PendingRequest> scanned;
+    PendingRequestMap heap;
+    for (uint64_t id = 1; id <= IN_FLIGHT; ++id) {
+        scanned.emplace(id, make_request(id, t0, 30000));
+        heap.insert(make_request(id, t0, 30000));
+    }
+
+    size_t due = 0;
+    auto start = steady_clock::now();
+    for (int t = 0; t < TICKS; ++t) {
+        for (auto& [id, request] : scanned) {
+            due += request.is_timed_out() ? 1 : 0;
+        }
+    }
+    double scan_us = duration<double, std::micro>(steady_clock::now() - start).count() / TICKS;
+
+    start = steady_clock::now();
+    for (int t = 0; t < TICKS; ++t) {
+        due += heap.take_expired(steady_clock::now()).size();
+    }
+    double heap_us = duration<double, std::micro>(steady_clock::now() - start).count() / TICKS;
+
+    WARN(IN_FLIGHT << " in flight, none due: map scan " << scan_us << " us/check, deadline heap "
+                   << heap_us << " us/check");
+    REQUIRE(due == 0);
+    REQUIRE(heap.size() == IN_FLIGHT);
+    REQUIRE(heap_us < scan_us);
+}
@@ -0,0 +1,357 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/**
+ * @file test_moonraker_stream_decoder.cpp
+ * @brief Unit tests for the SAX decoders used for large Moonraker responses
+ *
+ * Each decoder must produce the same structs as the json-based parsers it
+ * replaces for large messages, and decline error or malformed responses so
+ * the json path can report them.
+ */
+
+#include "memory_utils.h"
+#include "moonraker_stream_decoder.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+#if defined(__linux__)
+#include <fstream>
+#include <sys/wait.h>
+#include <unistd.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#endif
+
+using helix::FileListDecoder;
+using helix::GcodeStoreDecoder;
+using helix::HistoryListDecoder;
+using helix::JsonRpcEnvelope;
+
+namespace {
+
+/// One job shaped like Moonraker's server.history.list output (metadata trimmed to typical keys)
+json make_history_job(int i) {
+    std::string base = "benchy_" + std::to_string(i);
+    return {{"job_id", "0000" + std::to_string(1000 + i)},
+            {"user", "_TRUSTED_USER_"},
+            {"filename", "projects/" + base + ".gcode"},
+            {"exists", i % 7 != 0},
+            {"end_time", i % 50 == 0 ? json(nullptr) : json(1735689600.0 + i * 3600 + 2400)},
+            {"filament_used", 1234.5 + i},
+            {"metadata",
+             {{"size", 4200000 + i},
+              {"modified", 1735689000.25 + i},
+              {"uuid", "a1b2c3d4-0000-4000-8000-" + std::to_string(100000000000 + i)},
+              {"slicer", "OrcaSlicer"},
+              {"slicer_version", "2.2.0"},
+              {"gcode_start_byte", 45871},
+              {"gcode_end_byte", 4179952},
+              {"layer_count", 120 + i % 80},
+              {"object_height", 48.0},
+              {"estimated_time", 5123},
+              {"nozzle_diameter", 0.4},
+              {"layer_height", 0.2},
+              {"first_layer_height", 0.2},
+              {"first_layer_extr_temp", 215.0},
+              {"first_layer_bed_temp", 60},
+              {"chamber_temp", 0.0},
+              {"filament_name", "Generic PLA"},
+              {"filament_type", i % 3 == 0 ? "PETG" : "PLA"},
+              {"filament_total", 5231.77},
+              {"filament_weight_total", 15.6},
+              {"thumbnails",
+               {{{"width", 32},
+                 {"height", 32},
+                 {"size", 2301},
+                 {"relative_path", ".thumbs/" + base + "-32x32.png"}},
+                {{"width", 300},
+                 {"height", 300},
+                 {"size", 39111},
+                 {"relative_path", ".thumbs/" + base + "-300x300.png"}}}},
+              {"print_start_time", nullptr},
+              {"job_id", nullptr}}},
+            {"print_duration", 3100.5 + i},
+            {"status", i % 10 == 0 ? "cancelled" : "completed"},
+            {"start_time", 1735689600.0 + i * 3600},
+            {"total_duration", 3300.25 + i},
+            {"auxiliary_data", json::array({{{"provider", "spoolman"},
+                                             {"name", "spool_ids"},
+                                             {"value", json::array({3})},
+                                             {"description", "Spool IDs used"},
+                                             {"units", nullptr}}})}};
+}
+
+std::string make_history_response(int jobs, uint64_t id = 42) {
+    json list = json::array();
+    for (int i = 0; i < jobs; ++i) {
+        list.push_back(make_history_job(i));
+    }
+    return json{{"jsonrpc", "2.0"}, {"result", {{"count", jobs * 2}, {"jobs", list}}}, {"id", id}}
+        .dump();
+}
+
+/// Same structs the json path builds (field rules of parse_history_job())
+std::vector<PrintHistoryJob> dom_history_jobs(const json& response) {
+    std::vector<PrintHistoryJob> jobs;
+    for (const auto& j : response["result"]["jobs"]) {
+        PrintHistoryJob job;
+        job.job_id = j.value("job_id", "");
+        job.filename = j.value("filename", "");
+        job.status = parse_job_status(j.value("status", "unknown"));
+        job.start_time = j["start_time"].is_number() ? j["start_time"].get<double>() : 0.0;
+        job.end_time = j["end_time"].is_number() ? j["end_time"].get<double>() : 0.0;
+        job.print_duration = j["print_duration"].get<double>();
+        job.total_duration = j["total_duration"].get<double>();
+        job.filament_used = j["filament_used"].get<double>();
+        job.exists = j.value("exists", false);
+        const auto& meta = j["metadata"];
+        job.filament_type = meta.value("filament_type", "");
+        job.layer_count = meta["layer_count"].get<uint32_t>();
+        job.layer_height = meta["layer_height"].get<double>();
+        job.nozzle_temp = meta["first_layer_extr_temp"].get<double>();
+        job.bed_temp = meta["first_layer_bed_temp"].get<double>();
+        job.thumbnail_path = meta["thumbnails"][0].value("relative_path", "");
+        job.uuid = meta.value("uuid", "");
+        job.size_bytes = meta["size"].get<size_t>();
+        jobs.push_back(job);
+    }
+    return jobs;
+}
+
+} // namespace
+
+TEST_CASE("HistoryListDecoder builds the same jobs as the json path", "[moonraker][stream]") {
+    std::string message = make_history_response(60);
+    std::vector<PrintHistoryJob> expected = dom_history_jobs(json::parse(message));
+
+    HistoryListDecoder decoder;
+    REQUIRE(decoder.decode(message));
+    REQUIRE(decoder.total_count == 120);
+    REQUIRE(decoder.jobs.size() == expected.size());
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const auto& a = decoder.jobs[i];
+        const auto& b = expected[i];
+        INFO("job " << i);
+        REQUIRE(a.job_id == b.job_id);
+        REQUIRE(a.filename == b.filename);
+        REQUIRE(a.status == b.status);
+        REQUIRE(a.start_time == b.start_time);
+        REQUIRE(a.end_time == b.end_time);
+        REQUIRE(a.print_duration == b.print_duration);
+        REQUIRE(a.total_duration == b.total_duration);
+        REQUIRE(a.filament_used == b.filament_used);
+        REQUIRE(a.exists == b.exists);
+        REQUIRE(a.filament_type == b.filament_type);
+        REQUIRE(a.layer_count == b.layer_count);
+        REQUIRE(a.layer_height == b.layer_height);
+        REQUIRE(a.nozzle_temp == b.nozzle_temp);
+        REQUIRE(a.bed_temp == b.bed_temp);
+        REQUIRE(a.thumbnail_path == b.thumbnail_path); // First thumbnail, not the largest
+        REQUIRE(a.uuid == b.uuid);
+        REQUIRE(a.size_bytes == b.size_bytes);
+    }
+
+    // Nested "job_id": null in metadata must not clobber the job's id
+    REQUIRE(decoder.jobs[3].job_id == "00001003");
+    REQUIRE(decoder.jobs[50].end_time == 0.0); // null end_time keeps the default
+}
+
+TEST_CASE("FileListDecoder handles both Moonraker list formats", "[moonraker][stream]") {
+    SECTION("server.files.list flat array") {
+        FileListDecoder decoder;
+        REQUIRE(decoder.decode(R"({"jsonrpc":"2.0","result":[
+            {"path":"sub/dir/part.gcode","modified":1700000000.5,"size":1234,
+             "permissions":"rw","filename":"ignored.gcode"},
+            {"filename":"top.gcode","size":99,"modified":1700000001}],"id":7})"));
+        REQUIRE(decoder.files.size() == 2);
+        REQUIRE(decoder.files[0].path == "sub/dir/part.gcode");
+        REQUIRE(decoder.files[0].filename == "part.gcode"); // path wins over filename
+        REQUIRE(decoder.files[0].size == 1234);
+        REQUIRE(decoder.files[0].modified == 1700000000.5);
+        REQUIRE(decoder.files[0].permissions == "rw");
+        REQUIRE_FALSE(decoder.files[0].is_dir);
+        REQUIRE(decoder.files[1].filename == "top.gcode");
+        REQUIRE(decoder.files[1].path.empty());
+        REQUIRE(decoder.files[1].modified == 1700000001.0);
+    }
+
+    SECTION("server.files.get_directory lists directories first") {
+        FileListDecoder decoder;
+        REQUIRE(decoder.decode(R"({"jsonrpc":"2.0","id":8,"result":{
+            "files":[{"filename":"a.gcode","size":10,"modified":1.0,"permissions":"rw"}],
+            "disk_usage":{"total":100,"used":50,"free":50},
+            "dirs":[{"dirname":"parts","modified":2.0,"size":4096,"permissions":"rw"}]}})"));
+        REQUIRE(decoder.files.size() == 2);
+        REQUIRE(decoder.files[0].filename == "parts");
+        REQUIRE(decoder.files[0].is_dir);
+        REQUIRE(decoder.files[0].size == 0); // Directory sizes are not reported
+        REQUIRE(decoder.files[1].filename == "a.gcode");
+        REQUIRE(decoder.files[1].size == 10);
+        REQUIRE_FALSE(decoder.files[1].is_dir);
+    }
+}
+
+TEST_CASE("GcodeStoreDecoder reads console history", "[moonraker][stream]") {
+    GcodeStoreDecoder decoder;
+    REQUIRE(decoder.decode(R"({"jsonrpc":"2.0","result":{"gcode_store":[
+        {"message":"G28","time":1700000000.25,"type":"command"},
+        {"message":"// Homing done","time":1700000001}]},"id":3})"));
+    REQUIRE(decoder.entries.size() == 2);
+    REQUIRE(decoder.entries[0].message == "G28");
+    REQUIRE(decoder.entries[0].time == 1700000000.25);
+    REQUIRE(decoder.entries[0].type == "command");
+    REQUIRE(decoder.entries[1].type == "response"); // Default when missing
+    REQUIRE(decoder.entries[1].time == 1700000001.0);
+}
+
+TEST_CASE("Stream decoders decline errors and malformed messages", "[moonraker][stream]") {
+    HistoryListDecoder error_decoder;
+    REQUIRE_FALSE(error_decoder.decode(
+        R"({"jsonrpc":"2.0","error":{"code":-32601,"message":"Method not found"},"id":5})"));
+    REQUIRE(error_decoder.has_rpc_error());
+
+    HistoryListDecoder truncated;
+    REQUIRE_FALSE(truncated.decode(R"({"jsonrpc":"2.0","result":{"count":3,"jobs":[{"job_)"));
+    REQUIRE_FALSE(truncated.parse_error_message().empty());
+
+    // A decoder can be reused; state from the failed parse does not leak
+    REQUIRE(truncated.decode(R"({"result":{"count":0,"jobs":[]},"id":6})"));
+}
+
+TEST_CASE("JsonRpcEnvelope finds the response id", "[moonraker][stream]") {
+    JsonRpcEnvelope last;
+    REQUIRE(last.decode(make_history_response(3, 9001)));
+    REQUIRE(last.has_id);
+    REQUIRE(last.id == 9001);
+
+    // Stops at the id: the broken tail is never read
+    JsonRpcEnvelope first;
+    REQUIRE(first.decode(R"({"id":17,"result":{"jobs":[{"job_id":)"));
+    REQUIRE(first.has_id);
+    REQUIRE(first.id == 17);
+
+    JsonRpcEnvelope notification;
+    REQUIRE(notification.decode(R"({"jsonrpc":"2.0","method":"notify_proc_stat_update",
+                                    "params":[{"cpu_temp":45.0,"id":3}]})"));
+    REQUIRE_FALSE(notification.has_id); // Nested ids do not count
+}
+
+TEST_CASE("JsonRpcEnvelope reads Moonraker's trailing id without a parse", "[moonraker][stream]") {
+    // Moonraker's layout: id last. The broken head shows the body is never parsed.
+    JsonRpcEnvelope trailing;
+    REQUIRE(trailing.read(R"({"jsonrpc": "2.0", "result": {"jobs": [{"job_id": , "id": 9001 }
+)"));
+    REQUIRE(trailing.has_id);
+    REQUIRE(trailing.id == 9001);
+
+    JsonRpcEnvelope only;
+    REQUIRE(only.read(R"({"id":7})"));
+    REQUIRE(only.id == 7);
+
+    SECTION("Other layouts fall back to the SAX scan") {
+        JsonRpcEnvelope first;
+        REQUIRE(first.read(make_history_response(3, 17))); // json::dump() sorts "id" first
+        REQUIRE(first.has_id);
+        REQUIRE(first.id == 17);
+
+        JsonRpcEnvelope nested;
+        REQUIRE(nested.read(R"({"method":"notify_x","params":{"id":3}})"));
+        REQUIRE_FALSE(nested.has_id);
+
+        JsonRpcEnvelope quoted;
+        REQUIRE(quoted.read(R"({"id":6,"result":"x\"id\": 5}"})"));
+        REQUIRE(quoted.id == 6);
+
+        JsonRpcEnvelope escaped;
+        REQUIRE(escaped.read(R"({"result":{},"key\"id": 5})")); // Key is key"id
+        REQUIRE_FALSE(escaped.has_id);
+
+        JsonRpcEnvelope text_id;
+        REQUIRE(text_id.read(R"({"result":{},"id":"abc"})"));
+        REQUIRE_FALSE(text_id.has_id);
+    }
+}
+
+#if defined(__linux__)
+namespace {
+
+/**
+ * @brief Peak RSS growth (KB) of @p work, run in a forked child
+ *
+ * The child builds the message, returns freed heap to the OS, resets the
+ * high-water mark, and reports VmHWM minus the RSS before @p work.
+ */
+int64_t measure_peak_kb(int jobs, const std::function<size_t(const std::string&)>& work) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return -1;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        std::string message = make_history_response(jobs);
+#if defined(__GLIBC__)
+        malloc_trim(0);
+#endif
+        { std::ofstream("/proc/self/clear_refs") << "5"; }
+        int64_t before_kb = 0, hwm_kb = 0, rss_kb = 0;
+        helix::read_memory_stats(before_kb, hwm_kb);
+        size_t built = work(message);
+        helix::read_memory_stats(rss_kb, hwm_kb);
+        int64_t result = built == static_cast<size_t>(jobs) ? hwm_kb - before_kb : -1;
+        ssize_t written = write(fds[1], &result, sizeof(result));
+        _exit(written == sizeof(result) ? 0 : 1);
+    }
+    close(fds[1]);
+    int64_t result = -1;
+    if (read(fds[0], &result, sizeof(result)) != sizeof(result)) {
+        result = -1;
+    }
+    close(fds[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Peak RSS of a 500-job history fetch: json DOM vs stream decode",
+          "[moonraker][stream][.benchmark]") {
+    constexpr int JOBS = 500;
+    size_t message_kb = make_history_response(JOBS).size() / 1024;
+
+    // Before: parse, copy into the by-value success callback, build the structs
+    int64_t dom_kb = measure_peak_kb(JOBS, [](const std::string& message) {
+        json j = json::parse(message);
+        std::function<void(json)> success_cb;
+        size_t built = 0;
+        success_cb = [&built](json response) { built = dom_history_jobs(response).size(); };
+        success_cb(j);
+        return built;
+    });
+
+    // After: read the envelope, decode the jobs directly
+    int64_t stream_kb = measure_peak_kb(JOBS, [](const std::string& message) {
+        JsonRpcEnvelope envelope;
+        if (!envelope.decode(message) || !envelope.has_id) {
+            return size_t{0};
+        }
+        HistoryListDecoder decoder;
+        return decoder.decode(message) ? decoder.jobs.size() : 0;
+    });
+
+    WARN("500-job history message: " << message_kb << " KB; peak RSS growth: json DOM "
+                                     << dom_kb << " KB, stream decode " << stream_kb << " KB");
+    REQUIRE(dom_kb > 0);
+    REQUIRE(stream_kb > 0);
+    REQUIRE(stream_kb < dom_kb);
+}
+#endif
@@ -147,9 +147,9 @@ TEST_CASE("MultiColor - Wipe tower detection", "[gcode][multicolor][parser]") {
         auto result = parser.finalize();
 
         REQUIRE(result.layers[0].segments.size() >= 3);
-        REQUIRE(result.layers[0].segments[0].object_name != "__WIPE_TOWER__");
-        REQUIRE(result.layers[0].segments[1].object_name == "__WIPE_TOWER__");
-        REQUIRE(result.layers[0].segments[2].object_name != "__WIPE_TOWER__");
+        REQUIRE(result.object_name(result.layers[0].segments[0]) != "__WIPE_TOWER__");
+        REQUIRE(result.object_name(result.layers[0].segments[1]) == "__WIPE_TOWER__");
+        REQUIRE(result.object_name(result.layers[0].segments[2]) != "__WIPE_TOWER__");
     }
 
     SECTION("Handle wipe tower brim markers") {
@@ -159,7 +159,7 @@ TEST_CASE("MultiColor - Wipe tower detection", "[gcode][multicolor][parser]") {
 
         auto result = parser.finalize();
 
-        REQUIRE(result.layers[0].segments[0].object_name == "__WIPE_TOWER__");
+        REQUIRE(result.object_name(result.layers[0].segments[0]) == "__WIPE_TOWER__");
     }
 }
 
@@ -0,0 +1,154 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "notification_coalescer.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using helix::NotificationCoalescer;
+using json = nlohmann::json;
+using Message = NotificationCoalescer::Message;
+
+namespace {
+
+Message status(json delta, double eventtime) {
+    return std::make_shared<const json>(
+        json{{"method", "notify_status_update"},
+             {"params", json::array({std::move(delta), eventtime})}});
+}
+
+Message method(const std::string& name) {
+    return std::make_shared<const json>(json{{"method", name}, {"params", json::array()}});
+}
+
+Message connection_state(int new_state) {
+    return std::make_shared<const json>(
+        json{{"_connection_state", true}, {"old_state", 0}, {"new_state", new_state}});
+}
+
+} // namespace
+
+TEST_CASE("NotificationCoalescer merges deltas per object and field", "[notifications][coalesce]") {
+    std::vector<Message> queue = {
+        status({{"extruder", {{"temperature", 200.1}, {"target", 210.0}}}}, 1.0),
+        status({{"extruder", {{"temperature", 201.4}}}, {"heater_bed", {{"temperature", 60.2}}}},
+               1.25),
+        status({{"print_stats", {{"state", "printing"}, {"info", {{"current_layer", 3}}}}}}, 1.5),
+        status({{"print_stats", {{"info", {{"total_layer", 120}}}}}, {"extruder", nullptr}}, 1.75),
+    };
+
+    NotificationCoalescer::Stats stats;
+    auto out = NotificationCoalescer::coalesce(queue, &stats);
+
+    REQUIRE(out.size() == 1);
+    REQUIRE(stats.messages_in == 4);
+    REQUIRE(stats.messages_out == 1);
+    REQUIRE(stats.status_in == 4);
+    REQUIRE(stats.status_merged == 3);
+
+    const json& merged = (*out[0])["params"][0];
+    REQUIRE(merged["heater_bed"]["temperature"] == 60.2);
+    REQUIRE(merged["print_stats"]["state"] == "printing");
+    // Field values are replaced whole, never merged deeper
+    REQUIRE(merged["print_stats"]["info"] == json{{"total_layer", 120}});
+    REQUIRE(merged["extruder"].is_null()); // Later non-object values replace, even null
+    REQUIRE((*out[0])["params"][1] == 1.75);
+
+    // Inputs are shared with other subscribers and must not be modified
+    REQUIRE((*queue[0])["params"][0]["extruder"]["temperature"] == 200.1);
+}
+
+TEST_CASE("NotificationCoalescer keeps keys a later delta removed from a field removed",
+          "[notifications][coalesce]") {
+    json mesh_a = {{"points", json::array({0.1, 0.2})}};
+    json mesh_b = {{"points", json::array({0.3, 0.4})}};
+    std::vector<Message> queue = {
+        status({{"bed_mesh", {{"profiles", {{"a", mesh_a}, {"b", mesh_b}}}}}}, 1.0),
+        status({{"bed_mesh", {{"profiles", {{"a", mesh_a}}}}}}, 1.25), // Profile b deleted
+    };
+
+    auto out = NotificationCoalescer::coalesce(queue);
+    REQUIRE(out.size() == 1);
+
+    // Same result as applying the deltas one after another
+    const json& profiles = (*out[0])["params"][0]["bed_mesh"]["profiles"];
+    REQUIRE(profiles == json{{"a", mesh_a}});
+    REQUIRE_FALSE(profiles.contains("b"));
+}
+
+TEST_CASE("NotificationCoalescer preserves order around non-status messages",
+          "[notifications][coalesce]") {
+    Message single = status({{"fan", {{"speed", 0.5}}}}, 3.0);
+    std::vector<Message> queue = {
+        status({{"toolhead", {{"position", {1, 2, 3, 4}}}}}, 1.0),
+        status({{"toolhead", {{"position", {5, 6, 7, 8}}}}}, 1.5),
+        connection_state(2),
+        method("notify_gcode_response"),
+        single,
+        method("notify_filelist_changed"),
+        status({{"fan", {{"speed", 0.75}}}}, 4.0),
+    };
+
+    NotificationCoalescer::Stats stats;
+    auto out = NotificationCoalescer::coalesce(queue, &stats);
+
+    REQUIRE(out.size() == 6);
+    REQUIRE(stats.status_merged == 1);
+    REQUIRE((*out[0])["params"][0]["toolhead"]["position"] == json({5, 6, 7, 8}));
+    REQUIRE(out[1]->contains("_connection_state"));
+    REQUIRE((*out[2])["method"] == "notify_gcode_response");
+    REQUIRE(out[3] == single); // Lone deltas pass through without a copy
+    REQUIRE((*out[4])["method"] == "notify_filelist_changed");
+    REQUIRE((*out[5])["params"][0]["fan"]["speed"] == 0.75);
+}
+
+TEST_CASE("NotificationCoalescer leaves malformed status messages alone",
+          "[notifications][coalesce]") {
+    auto bad = std::make_shared<const json>(
+        json{{"method", "notify_status_update"}, {"params", json::array({"not an object"})}});
+    std::vector<Message> queue = {status({{"a", {{"x", 1}}}}, 1.0), bad,
+                                  status({{"a", {{"y", 2}}}}, 2.0)};
+
+    auto out = NotificationCoalescer::coalesce(queue);
+    REQUIRE(out.size() == 3);
+    REQUIRE(out[1] == bad);
+}
+
+TEST_CASE("NotificationCoalescer 50-delta backlog", "[notifications][coalesce][.benchmark]") {
+    constexpr int BACKLOG = 50;
+    constexpr int OBJECTS = 30;
+
+    std::vector<Message> queue;
+    for (int i = 0; i < BACKLOG; ++i) {
+        json delta = json::object();
+        for (int o = 0; o < OBJECTS; ++o) {
+            delta["temperature_sensor s" + std::to_string(o)] = {{"temperature", 20.0 + i * 0.1},
+                                                                 {"measured_max_temp", 40.0}};
+        }
+        queue.push_back(status(std::move(delta), i * 0.1));
+    }
+
+    constexpr int RUNS = 200;
+    NotificationCoalescer::Stats stats;
+    std::vector<Message> out;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; ++r) {
+        out = NotificationCoalescer::coalesce(queue, &stats);
+    }
+    size_t passes = out.size();
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+                    .count() /
+                RUNS;
+
+    WARN("Backlog of " << BACKLOG << " deltas -> " << passes << " PrinterState pass(es), merge "
+                       << us << " us");
+    REQUIRE(passes == 1);
+    REQUIRE(stats.status_merged == BACKLOG - 1);
+    const json& merged = (*out[0])["params"][0];
+    REQUIRE(merged.size() == OBJECTS);
+    REQUIRE(merged["temperature_sensor s7"]["temperature"] == 20.0 + (BACKLOG - 1) * 0.1);
+}
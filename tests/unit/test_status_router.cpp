@@ -0,0 +1,223 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "status_router.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using helix::StatusObjects;
+using helix::StatusRouter;
+using json = nlohmann::json;
+
+namespace {
+
+StatusRouter::Matcher exact(std::vector<std::string> names) {
+    return [names = std::move(names)](const std::string& object) {
+        for (const auto& name : names) {
+            if (object == name) {
+                return true;
+            }
+        }
+        return false;
+    };
+}
+
+StatusRouter::Matcher prefix(std::string p) {
+    return [p = std::move(p)](const std::string& object) { return object.rfind(p, 0) == 0; };
+}
+
+} // namespace
+
+TEST_CASE("StatusRouter delivers only the objects each handler wants", "[status_router]") {
+    StatusRouter router;
+    std::vector<std::string> calls;
+    json temperature_seen;
+    std::vector<std::string> sensor_objects;
+
+    router.add_handler("temperature", exact({"extruder", "heater_bed"}),
+                       [&](const StatusObjects& objects) {
+                           calls.push_back("temperature");
+                           REQUIRE(objects.size() == 1);
+                           temperature_seen = *objects.find("extruder");
+                           REQUIRE(objects.find("heater_bed") == nullptr);
+                       });
+    router.add_handler("print", exact({"print_stats", "virtual_sdcard"}),
+                       [&](const StatusObjects&) { calls.push_back("print"); });
+    router.add_handler("sensors", prefix("temperature_sensor "),
+                       [&](const StatusObjects& objects) {
+                           calls.push_back("sensors");
+                           for (const auto& entry : objects) {
+                               sensor_objects.push_back(*entry.name);
+                           }
+                       });
+
+    router.build({"extruder", "heater_bed", "print_stats", "virtual_sdcard",
+                  "temperature_sensor chamber", "temperature_sensor mcu", "webhooks"});
+    REQUIRE(router.route_count() == 7);
+
+    json status = {{"extruder", {{"temperature", 210.5}}},
+                   {"temperature_sensor chamber", {{"temperature", 41.0}}},
+                   {"temperature_sensor mcu", {{"temperature", 38.0}}},
+                   {"webhooks", {{"state", "ready"}}}};
+    router.dispatch(status);
+
+    // Handlers without objects in this delta are not called at all
+    REQUIRE(calls == std::vector<std::string>{"temperature", "sensors"});
+    REQUIRE(temperature_seen["temperature"] == 210.5);
+    REQUIRE(sensor_objects.size() == 2);
+
+    const auto& stats = router.stats();
+    REQUIRE(stats.updates == 1);
+    REQUIRE(stats.objects == 4);
+    REQUIRE(stats.deliveries == 3); // webhooks has no handler
+    REQUIRE(stats.handler_calls == 2);
+    REQUIRE(stats.resolves == 7); // All from build(), none during dispatch
+}
+
+TEST_CASE("StatusRouter calls handlers in registration order", "[status_router]") {
+    StatusRouter router;
+    std::vector<std::string> calls;
+    router.add_handler("motion", exact({"toolhead"}),
+                       [&](const StatusObjects&) { calls.push_back("motion"); });
+    router.add_handler("print", exact({"print_stats"}),
+                       [&](const StatusObjects&) { calls.push_back("print"); });
+    router.add_handler("calibration", exact({"toolhead", "stepper_enable"}),
+                       [&](const StatusObjects& objects) {
+                           calls.push_back("calibration");
+                           REQUIRE(objects.size() == 2);
+                       });
+
+    // Key order in the delta does not matter
+    router.dispatch({{"stepper_enable", json::object()},
+                     {"print_stats", json::object()},
+                     {"toolhead", json::object()}});
+    REQUIRE(calls == std::vector<std::string>{"motion", "print", "calibration"});
+    REQUIRE(router.handlers_for("toolhead") == std::vector<std::string>{"motion", "calibration"});
+}
+
+TEST_CASE("StatusRouter resolves unlisted objects lazily and rebuilds on demand",
+          "[status_router]") {
+    StatusRouter router;
+    std::string tracked;
+    int led_calls = 0;
+    router.add_handler(
+        "led", [&tracked](const std::string& object) { return object == tracked; },
+        [&led_calls](const StatusObjects&) { led_calls++; });
+
+    router.build({"neopixel strip"});
+    json status = {{"neopixel strip", {{"color_data", json::array()}}}};
+    router.dispatch(status);
+    REQUIRE(led_calls == 0);
+
+    // Interest changed: cached route is stale until rebuilt
+    tracked = "neopixel strip";
+    router.dispatch(status);
+    REQUIRE(led_calls == 0);
+    router.rebuild();
+    router.dispatch(status);
+    REQUIRE(led_calls == 1);
+
+    // Objects missing from printer.objects.list still route after first sight
+    tracked = "led extra";
+    router.dispatch({{"led extra", json::object()}});
+    REQUIRE(led_calls == 2);
+    REQUIRE(router.route_count() == 2);
+}
+
+TEST_CASE("StatusRouter isolates handler exceptions", "[status_router]") {
+    StatusRouter router;
+    bool second_ran = false;
+    router.add_handler("bad", exact({"print_stats"}), [](const StatusObjects& objects) {
+        (*objects.find("print_stats"))["state"].get<std::string>(); // Throws: not a string
+    });
+    router.add_handler("good", exact({"print_stats"}),
+                       [&second_ran](const StatusObjects&) { second_ran = true; });
+
+    REQUIRE_NOTHROW(router.dispatch({{"print_stats", {{"state", 3}}}}));
+    REQUIRE(second_ran);
+
+    SECTION("Non-std exceptions too") {
+        int good_calls = 0;
+        router.add_handler("throws_int", exact({"webhooks"}),
+                           [](const StatusObjects&) { throw 42; });
+        router.add_handler("after", exact({"webhooks"}),
+                           [&good_calls](const StatusObjects&) { ++good_calls; });
+
+        REQUIRE_NOTHROW(router.dispatch({{"webhooks", {{"state", "ready"}}}}));
+        REQUIRE(good_calls == 1);
+    }
+}
+
+TEST_CASE("StatusObjects views a whole status for direct callers", "[status_router]") {
+    json status = {{"fan", {{"speed", 0.5}}}, {"heater_fan hotend", {{"speed", 1.0}}}};
+    StatusObjects objects(status);
+    REQUIRE(objects.size() == 2);
+    REQUIRE((*objects.find("fan"))["speed"] == 0.5);
+    REQUIRE(objects.find("toolhead") == nullptr);
+    REQUIRE(StatusObjects(json::array()).empty());
+}
+
+TEST_CASE("StatusRouter vs broadcast for a typical 10 Hz delta", "[status_router][.benchmark]") {
+    constexpr int HANDLERS = 16; // 6 sub-states, 2 PrinterState, 7 sensor managers, spare
+    constexpr int KEYS_PER_HANDLER = 4;
+    constexpr int RUNS = 20000;
+
+    std::vector<std::vector<std::string>> interests(HANDLERS);
+    std::vector<std::string> objects;
+    for (int h = 0; h < HANDLERS; ++h) {
+        for (int k = 0; k < KEYS_PER_HANDLER; ++k) {
+            interests[h].push_back("object_" + std::to_string(h) + "_" + std::to_string(k));
+            objects.push_back(interests[h].back());
+        }
+    }
+    // Typical delta: extruder temperature and print duration
+    json delta = {{"object_0_0", {{"temperature", 210.1}}},
+                  {"object_2_0", {{"print_duration", 812.4}}}};
+
+    size_t hits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; ++r) {
+        for (const auto& keys : interests) {
+            for (const auto& key : keys) {
+                if (delta.contains(key)) {
+                    hits += delta[key].size();
+                }
+            }
+        }
+    }
+    double broadcast_us =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+            .count() /
+        RUNS;
+
+    StatusRouter router;
+    size_t routed_hits = 0;
+    for (int h = 0; h < HANDLERS; ++h) {
+        router.add_handler("h" + std::to_string(h), exact(interests[h]),
+                           [&routed_hits](const StatusObjects& o) {
+                               for (const auto& entry : o) {
+                                   routed_hits += entry.value->size();
+                               }
+                           });
+    }
+    router.build(objects);
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < RUNS; ++r) {
+        router.dispatch(delta);
+    }
+    double routed_us =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+            .count() /
+        RUNS;
+
+    WARN("Broadcast: " << broadcast_us << " us/update (" << HANDLERS * KEYS_PER_HANDLER
+                       << " lookups); routed: " << routed_us << " us/update ("
+                       << router.stats().handler_calls / RUNS << " handler calls)");
+    REQUIRE(hits == routed_hits);
+    REQUIRE(router.stats().handler_calls == static_cast<uint64_t>(2 * RUNS));
+    REQUIRE(routed_us < broadcast_us);
+}
@@ -215,3 +215,125 @@ TEST_CASE("ThumbnailProcessor handles invalid input", "[assets][processor][scali
         CHECK_FALSE(result.success);
     }
 }
+
+// ============================================================================
+// Native color formats and single-decode multi-target output
+// ============================================================================
+
+TEST_CASE("ThumbnailProcessor converts pixels to RGB565", "[assets][processor][format]") {
+    ThumbnailTarget target;
+    target.color_format = helix::THUMBNAIL_FORMAT_RGB565;
+
+    // Red, green, blue, white (R,G,B,A)
+    // clang-format off
+    const std::vector<uint8_t> opaque = {
+        255, 0,   0,   255,
+        0,   255, 0,   255,
+        0,   0,   255, 255,
+        255, 255, 255, 255};
+    // clang-format on
+
+    SECTION("Opaque pixels pack little-endian RGB565 without an alpha plane") {
+        uint8_t cf = 0;
+        auto out = ThumbnailProcessor::convert_pixels(opaque.data(), 2, 2, target, cf);
+        REQUIRE(cf == helix::THUMBNAIL_FORMAT_RGB565);
+        REQUIRE(out.size() == 4 * 2);
+        CHECK((out[0] | out[1] << 8) == 0xF800);
+        CHECK((out[2] | out[3] << 8) == 0x07E0);
+        CHECK((out[4] | out[5] << 8) == 0x001F);
+        CHECK((out[6] | out[7] << 8) == 0xFFFF);
+        CHECK(ThumbnailProcessor::get_stride(cf, 2) == 4);
+    }
+
+    SECTION("Any translucent pixel promotes the output to RGB565A8") {
+        std::vector<uint8_t> translucent = opaque;
+        translucent[7] = 0x80;
+        uint8_t cf = 0;
+        auto out = ThumbnailProcessor::convert_pixels(translucent.data(), 2, 2, target, cf);
+        REQUIRE(cf == helix::THUMBNAIL_FORMAT_RGB565A8);
+        REQUIRE(out.size() == 4 * 3);
+        CHECK(out[8] == 255);
+        CHECK(out[9] == 0x80);
+        CHECK(ThumbnailProcessor::get_stride(cf, 2) == 4);
+    }
+
+    SECTION("Dithering keeps black and white exact") {
+        target.dither = true;
+        std::vector<uint8_t> bw(16 * 4, 0);
+        for (size_t i = 0; i < bw.size(); i += 8) {
+            bw[i] = bw[i + 1] = bw[i + 2] = 255;
+            bw[i + 3] = bw[i + 7] = 255;
+        }
+        uint8_t cf = 0;
+        auto out = ThumbnailProcessor::convert_pixels(bw.data(), 4, 4, target, cf);
+        for (size_t p = 0; p < 16; ++p) {
+            CHECK((out[p * 2] | out[p * 2 + 1] << 8) == (p % 2 == 0 ? 0xFFFF : 0x0000));
+        }
+    }
+
+    SECTION("Dithered flat gray keeps its mean") {
+        target.dither = true;
+        const int gray = GENERATE(37, 101, 130, 203, 246);
+        std::vector<uint8_t> flat(16 * 4, static_cast<uint8_t>(gray));
+        uint8_t cf = 0;
+        auto out = ThumbnailProcessor::convert_pixels(flat.data(), 4, 4, target, cf);
+
+        // Over one 4x4 Bayer tile, the quantized levels average back to the input exactly
+        int r_sum = 0, g_sum = 0, b_sum = 0;
+        for (size_t p = 0; p < 16; ++p) {
+            const int rgb565 = out[p * 2] | out[p * 2 + 1] << 8;
+            r_sum += (rgb565 >> 11) * 8;
+            g_sum += ((rgb565 >> 5) & 0x3F) * 4;
+            b_sum += (rgb565 & 0x1F) * 8;
+        }
+        INFO("gray " << gray);
+        CHECK(r_sum == 16 * gray);
+        CHECK(g_sum == 16 * gray);
+        CHECK(b_sum == 16 * gray);
+    }
+
+    SECTION("ARGB8888 swaps to B,G,R,A") {
+        target.color_format = helix::THUMBNAIL_FORMAT_ARGB8888;
+        uint8_t cf = 0;
+        auto out = ThumbnailProcessor::convert_pixels(opaque.data(), 2, 2, target, cf);
+        REQUIRE(cf == helix::THUMBNAIL_FORMAT_ARGB8888);
+        CHECK(out[0] == 0);
+        CHECK(out[2] == 255);
+        CHECK(out[3] == 255);
+    }
+}
+
+TEST_CASE("ThumbnailProcessor writes several targets from one decode",
+          "[assets][processor][format]") {
+    auto& processor = ThumbnailProcessor::instance();
+    if (processor.get_cache_dir().empty()) {
+        processor.set_cache_dir("/tmp/helix_thumb_test_scaling");
+    }
+
+    ThumbnailTarget card;
+    card.width = 120;
+    card.height = 120;
+    card.color_format = helix::THUMBNAIL_FORMAT_RGB565;
+    ThumbnailTarget detail = card;
+    detail.width = 200;
+    detail.height = 200;
+
+    auto results = processor.process_sync(png_40x20, "test_multi_target.png", {card, detail});
+    REQUIRE(results.size() == 2);
+    REQUIRE(results[0].success);
+    REQUIRE(results[1].success);
+    CHECK(results[0].output_width == 120);
+    CHECK(results[1].output_width == 200);
+
+    // Opaque source: half the footprint of ARGB8888
+    CHECK(results[1].output_format == helix::THUMBNAIL_FORMAT_RGB565);
+    CHECK(results[1].output_bytes ==
+          static_cast<size_t>(results[1].output_width) * results[1].output_height * 2);
+
+    // Both sizes are cached, and distinct from ARGB8888 / dithered entries
+    CHECK(processor.get_if_processed("test_multi_target.png", card) == results[0].output_path);
+    CHECK(processor.get_if_processed("test_multi_target.png", detail) == results[1].output_path);
+    ThumbnailTarget dithered = card;
+    dithered.dither = true;
+    CHECK(processor.get_if_processed("test_multi_target.png", dithered).empty());
+}
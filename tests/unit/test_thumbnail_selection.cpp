@@ -242,7 +242,7 @@ TEST_CASE("ThumbnailProcessor breakpoint selection", "[assets][processor]") {
     }
 }
 
-TEST_CASE("ThumbnailProcessor color format is always ARGB8888", "[assets][processor]") {
+TEST_CASE("ThumbnailProcessor resolution targets default to ARGB8888", "[assets][processor]") {
     SECTION("Card size is ARGB8888 (0x10)") {
         auto target = ThumbnailProcessor::get_target_for_resolution(800, 480);
         REQUIRE(target.color_format == 0x10);
@@ -0,0 +1,419 @@
+// Copyright (C) 2025-2026 356C LLC
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "toolpath_rasterizer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "../catch_amalgamated.hpp"
+
+using namespace helix::gcode;
+
+namespace {
+
+// ARGB8888 canvas with row padding so stride handling is exercised
+struct Canvas {
+    int width;
+    int height;
+    int stride;
+    std::vector<uint8_t> bytes;
+
+    Canvas(int w, int h, int padding_pixels = 3)
+        : width(w), height(h), stride((w + padding_pixels) * 4),
+          bytes(static_cast<size_t>(stride) * h, 0) {}
+
+    RasterTarget target() {
+        return RasterTarget{bytes.data(), width, height, stride};
+    }
+
+    uint32_t at(int x, int y) const {
+        const uint8_t* p = bytes.data() + static_cast<size_t>(y) * stride + x * 4;
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    int alpha(int x, int y) const {
+        return static_cast<int>(at(x, y) >> 24);
+    }
+
+    size_t count_nonzero() const {
+        size_t n = 0;
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                n += at(x, y) != 0;
+        return n;
+    }
+
+    bool padding_clean() const {
+        for (int y = 0; y < height; ++y)
+            for (int i = width * 4; i < stride; ++i)
+                if (bytes[static_cast<size_t>(y) * stride + i] != 0)
+                    return false;
+        return true;
+    }
+};
+
+constexpr uint32_t RED = 0xFFFF0000u;
+
+} // namespace
+
+TEST_CASE("ToolpathRasterizer - Aliased lines match Bresenham", "[gcode][rasterizer]") {
+    Canvas canvas(64, 48);
+    ToolpathRasterizer raster(canvas.target());
+
+    const int lines[][4] = {{2, 3, 60, 20}, {60, 45, 5, 1}, {10, 40, 12, 2}, {30, 30, 30, 30}};
+    for (const auto& l : lines) {
+        raster.draw_line(l[0], l[1], l[2], l[3], RED);
+    }
+
+    Canvas expected(64, 48);
+    for (const auto& l : lines) {
+        bresenham_line(l[0], l[1], l[2], l[3], [&](int x, int y) {
+            auto* p = expected.bytes.data() + static_cast<size_t>(y) * expected.stride + x * 4;
+            p[0] = 0x00;
+            p[1] = 0x00;
+            p[2] = 0xFF;
+            p[3] = 0xFF;
+        });
+    }
+    REQUIRE(canvas.bytes == expected.bytes);
+    REQUIRE(canvas.padding_clean());
+}
+
+TEST_CASE("ToolpathRasterizer - Clipping", "[gcode][rasterizer]") {
+    Canvas canvas(32, 16);
+    ToolpathRasterizer raster(canvas.target());
+
+    SECTION("Fully outside draws nothing") {
+        raster.draw_line(-50, -5, -1, 40, RED);
+        raster.draw_line(40, 2, 90, 2, RED);
+        raster.draw_line(-1000000, 20, 1000000, 20, RED);
+        REQUIRE(canvas.count_nonzero() == 0);
+    }
+
+    SECTION("Crossing lines are cut at the edges") {
+        raster.draw_line(-100, 5, 100, 5, RED);
+        raster.draw_line(7, -1000000, 7, 1000000, RED);
+        for (int x = 0; x < 32; ++x) {
+            REQUIRE(canvas.at(x, 5) == RED);
+        }
+        for (int y = 0; y < 16; ++y) {
+            REQUIRE(canvas.at(7, y) == RED);
+        }
+        REQUIRE(canvas.count_nonzero() == 32 + 16 - 1);
+        REQUIRE(canvas.padding_clean());
+    }
+
+    SECTION("Steep diagonal through a corner stays in bounds") {
+        raster.set_antialias(GENERATE(false, true));
+        raster.draw_line(-20, -3, 40, 30, RED, 3);
+        REQUIRE(canvas.count_nonzero() > 0);
+        REQUIRE(canvas.padding_clean());
+    }
+
+    SECTION("Clipped lines keep the pixels of the whole line") {
+        // The same lines on a canvas big enough to hold them, offset by (OX, OY)
+        constexpr int OX = 90;
+        constexpr int OY = 100;
+        Canvas whole(240, 240);
+        ToolpathRasterizer whole_raster(whole.target());
+
+        std::mt19937 rng(11);
+        std::uniform_int_distribution<int> coord(-OX, 120);
+        std::uniform_int_distribution<int> width(1, 4);
+        for (int i = 0; i < 400; ++i) {
+            int x0 = coord(rng), y0 = coord(rng), x1 = coord(rng), y1 = coord(rng);
+            int w = width(rng);
+            uint32_t color = (i % 2 == 0 ? 0xFF000000u : 0x80000000u) | (i * 0x010203u);
+            raster.draw_line(x0, y0, x1, y1, color, w);
+            whole_raster.draw_line(x0 + OX, y0 + OY, x1 + OX, y1 + OY, color, w);
+        }
+
+        for (int y = 0; y < canvas.height; ++y) {
+            for (int x = 0; x < canvas.width; ++x) {
+                INFO("pixel " << x << "," << y);
+                REQUIRE(canvas.at(x, y) == whole.at(x + OX, y + OY));
+            }
+        }
+        REQUIRE(canvas.count_nonzero() > 0);
+        REQUIRE(canvas.padding_clean());
+    }
+}
+
+TEST_CASE("ToolpathRasterizer - Width is perpendicular", "[gcode][rasterizer]") {
+    Canvas canvas(40, 40);
+    ToolpathRasterizer raster(canvas.target());
+
+    SECTION("Horizontal width 3 covers three rows") {
+        raster.draw_line(5, 20, 30, 20, RED, 3);
+        REQUIRE(canvas.at(10, 19) == RED);
+        REQUIRE(canvas.at(10, 20) == RED);
+        REQUIRE(canvas.at(10, 21) == RED);
+        REQUIRE(canvas.at(10, 18) == 0);
+        REQUIRE(canvas.at(10, 22) == 0);
+        REQUIRE(canvas.count_nonzero() == 26 * 3);
+    }
+
+    SECTION("45 degree width 2 uses a longer run") {
+        raster.draw_line(5, 5, 25, 25, RED, 2);
+        // run = round(2 * sqrt(2)) = 3 rows per column
+        REQUIRE(canvas.count_nonzero() == 21 * 3);
+    }
+}
+
+TEST_CASE("ToolpathRasterizer - Alpha blending", "[gcode][rasterizer]") {
+    Canvas canvas(8, 8);
+    ToolpathRasterizer raster(canvas.target());
+
+    raster.draw_line(0, 1, 7, 1, 0x800000FFu); // 50% blue over transparent
+    REQUIRE(canvas.at(3, 1) == 0x800000FFu);
+
+    raster.draw_line(0, 2, 7, 2, 0xFFFFFFFFu);
+    raster.draw_line(0, 2, 7, 2, 0x80000000u); // 50% black over opaque white
+    uint32_t mixed = canvas.at(3, 2);
+    REQUIRE((mixed >> 24) == 0xFF);
+    REQUIRE(std::abs(static_cast<int>((mixed >> 16) & 0xFF) - 127) <= 1);
+
+    raster.draw_line(0, 3, 7, 3, 0x80FF0000u);
+    raster.draw_line(0, 3, 7, 3, 0x8000FF00u); // Translucent over translucent
+    uint32_t both = canvas.at(3, 3);
+    REQUIRE((both >> 24) > 0x80);
+    REQUIRE(((both >> 8) & 0xFF) > ((both >> 16) & 0xFF)); // Top color dominates
+
+    raster.draw_line(0, 4, 7, 4, 0x00FF0000u); // Fully transparent is a no-op
+    REQUIRE(canvas.at(3, 4) == 0);
+}
+
+TEST_CASE("ToolpathRasterizer - Antialiasing", "[gcode][rasterizer]") {
+    Canvas canvas(64, 64);
+    ToolpathRasterizer raster(canvas.target());
+    raster.set_antialias(true);
+
+    SECTION("Axis-aligned width 1 is a single opaque row") {
+        raster.draw_line(4, 10, 40, 10, RED);
+        REQUIRE(canvas.at(20, 10) == RED);
+        REQUIRE(canvas.at(20, 9) == 0);
+        REQUIRE(canvas.at(20, 11) == 0);
+    }
+
+    SECTION("Sloped lines get partial coverage with the right total") {
+        raster.draw_line(2, 5, 60, 30, RED, 2);
+        double coverage = 0.0;
+        bool partial = false;
+        for (int y = 0; y < 64; ++y) {
+            for (int x = 0; x < 64; ++x) {
+                int a = canvas.alpha(x, y);
+                coverage += a / 255.0;
+                partial |= a > 0 && a < 255;
+            }
+        }
+        double length = std::sqrt(58.0 * 58.0 + 25.0 * 25.0);
+        REQUIRE(partial);
+        REQUIRE(coverage == Catch::Approx(length * 2.0).epsilon(0.1));
+    }
+}
+
+TEST_CASE("ToolpathRasterizer - Tiled rendering matches a single pass", "[gcode][rasterizer]") {
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> coord(-40, 300);
+    std::uniform_int_distribution<int> width(1, 4);
+    std::uniform_int_distribution<uint32_t> alpha(40, 255);
+    std::uniform_int_distribution<uint32_t> rgb(0, 0xFFFFFF);
+
+    std::vector<RasterLine> lines;
+    for (int i = 0; i < 3000; ++i) {
+        // Mostly short moves, like a toolpath, with some long ones across tiles
+        int x0 = coord(rng);
+        int y0 = coord(rng);
+        int x1 = i % 10 == 0 ? coord(rng) : x0 + coord(rng) / 20;
+        int y1 = i % 10 == 0 ? coord(rng) : y0 + coord(rng) / 20;
+        lines.push_back({x0, y0, x1, y1, (alpha(rng) << 24) | rgb(rng), width(rng)});
+    }
+
+    const bool antialias = GENERATE(false, true);
+    Canvas single(256, 200);
+    ToolpathRasterizer raster(single.target());
+    raster.set_antialias(antialias);
+    for (const auto& l : lines) {
+        raster.draw_line(l.x0, l.y0, l.x1, l.y1, l.color, l.width);
+    }
+
+    RasterWorkerPool pool(4);
+    REQUIRE(pool.worker_count() == 4);
+    Canvas tiled(256, 200);
+    size_t touched = rasterize_tiled(tiled.target(), lines, antialias, &pool);
+
+    REQUIRE(tiled.bytes == single.bytes);
+    REQUIRE(touched == raster.pixels_touched());
+
+    SECTION("Inline fallback gives the same image") {
+        Canvas inline_canvas(256, 200);
+        rasterize_tiled(inline_canvas.target(), lines, antialias, nullptr);
+        REQUIRE(inline_canvas.bytes == single.bytes);
+    }
+}
+
+TEST_CASE("ToolpathRasterizer - Worker pool runs every task once", "[gcode][rasterizer]") {
+    RasterWorkerPool pool(3);
+    for (int round = 0; round < 50; ++round) {
+        std::vector<std::atomic<int>> runs(37);
+        pool.run(runs.size(), [&runs](size_t task) { runs[task].fetch_add(1); });
+        for (const auto& r : runs) {
+            REQUIRE(r.load() == 1);
+        }
+    }
+
+    SECTION("A second caller runs inline instead of waiting") {
+        std::atomic<int> nested{0};
+        pool.run(4, [&](size_t) {
+            pool.run(2, [&](size_t) { nested.fetch_add(1); });
+        });
+        REQUIRE(nested.load() == 8);
+    }
+}
+
+TEST_CASE("ToolpathRasterizer - Dense layer frame rate", "[gcode][rasterizer][.benchmark]") {
+    constexpr int W = 800;
+    constexpr int H = 480;
+
+    // Dense layer: four objects of short diagonal infill moves, ~200k segments
+    struct Seg {
+        float x0, y0, x1, y1;
+        std::string object;
+    };
+    std::vector<Seg> segs;
+    const float pitch = 0.2f;
+    for (int obj = 0; obj < 4; ++obj) {
+        float ox = 10.0f + obj * 55.0f;
+        std::string name = "part_" + std::to_string(obj);
+        for (float y = 10.0f; y < 110.0f; y += pitch) {
+            for (float x = ox; x < ox + 50.0f; x += 0.5f) {
+                segs.push_back({x, y, x + 0.5f, y + pitch * 0.5f, name});
+            }
+        }
+    }
+    std::unordered_set<std::string> excluded = {"part_1"};
+    std::unordered_set<std::string> highlighted = {"part_2"};
+    std::vector<uint8_t> flags = {0, 0, OBJECT_EXCLUDED, OBJECT_HIGHLIGHTED, 0};
+    std::vector<uint8_t> object_ids;
+    for (const auto& s : segs) {
+        object_ids.push_back(static_cast<uint8_t>(1 + (s.object.back() - '0')));
+    }
+
+    std::vector<uint8_t> buffer(static_cast<size_t>(W) * H * 4);
+    auto fps = [&](float zoom, auto&& frame) {
+        const float scale = zoom * W / 230.0f;
+        auto project = [&](float x, float y) {
+            return std::pair<int, int>{static_cast<int>((x - 115.0f) * scale + W / 2),
+                                       static_cast<int>((y - 60.0f) * scale + H / 2)};
+        };
+        int frames = 0;
+        auto start = std::chrono::steady_clock::now();
+        double elapsed = 0.0;
+        while (elapsed < 0.5 || frames < 3) {
+            std::fill(buffer.begin(), buffer.end(), 0);
+            frame(buffer.data(), project);
+            ++frames;
+            elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                          .count();
+        }
+        return frames / elapsed;
+    };
+
+    // Previous per-segment path: string set lookups and bounds checks on every pixel
+    auto legacy = [&](uint8_t* data, auto&& project) {
+        for (const auto& s : segs) {
+            uint32_t color = 0xFF26A69Au;
+            if (excluded.count(s.object)) {
+                color = 0x99FF6B35u;
+            } else if (highlighted.count(s.object)) {
+                color = 0xFF42A5F5u;
+            }
+            auto [x0, y0] = project(s.x0, s.y0);
+            auto [x1, y1] = project(s.x1, s.y1);
+            if (x0 == x1 && y0 == y1)
+                continue;
+            bresenham_line(x0, y0, x1, y1, [&](int x, int y) {
+                if (x < 0 || x >= W || y < 0 || y >= H)
+                    return;
+                uint8_t* p = data + static_cast<size_t>(y) * W * 4 + x * 4;
+                p[0] = color & 0xFF;
+                p[1] = (color >> 8) & 0xFF;
+                p[2] = (color >> 16) & 0xFF;
+                p[3] = color >> 24;
+            });
+        }
+    };
+
+    auto direct = [&](bool antialias, int width) {
+        return [&, antialias, width](uint8_t* data, auto&& project) {
+            ToolpathRasterizer raster(RasterTarget{data, W, H, W * 4});
+            raster.set_antialias(antialias);
+            const uint32_t colors[] = {0xFF26A69Au, 0x99FF6B35u, 0xFF42A5F5u};
+            for (size_t i = 0; i < segs.size(); ++i) {
+                const auto& s = segs[i];
+                auto [x0, y0] = project(s.x0, s.y0);
+                auto [x1, y1] = project(s.x1, s.y1);
+                if (x0 == x1 && y0 == y1)
+                    continue;
+                uint8_t f = flags[object_ids[i]];
+                uint32_t color = (f & OBJECT_EXCLUDED)      ? colors[1]
+                                 : (f & OBJECT_HIGHLIGHTED) ? colors[2]
+                                                            : colors[0];
+                raster.draw_line(x0, y0, x1, y1, color, width);
+            }
+        };
+    };
+
+    // Lines projected once, then drawn in row tiles on a pool
+    RasterWorkerPool pool;
+    auto tiled = [&](bool antialias, int width) {
+        return [&, antialias, width](uint8_t* data, auto&& project) {
+            std::vector<RasterLine> lines;
+            lines.reserve(segs.size());
+            const uint32_t colors[] = {0xFF26A69Au, 0x99FF6B35u, 0xFF42A5F5u};
+            for (size_t i = 0; i < segs.size(); ++i) {
+                const auto& s = segs[i];
+                auto [x0, y0] = project(s.x0, s.y0);
+                auto [x1, y1] = project(s.x1, s.y1);
+                if (x0 == x1 && y0 == y1)
+                    continue;
+                uint8_t f = flags[object_ids[i]];
+                uint32_t color = (f & OBJECT_EXCLUDED)      ? colors[1]
+                                 : (f & OBJECT_HIGHLIGHTED) ? colors[2]
+                                                            : colors[0];
+                lines.push_back({x0, y0, x1, y1, color, width});
+            }
+            rasterize_tiled(RasterTarget{data, W, H, W * 4}, lines, antialias, &pool);
+        };
+    };
+
+    for (float zoom : {1.0f, 8.0f}) {
+        double legacy_fps = fps(zoom, legacy);
+        double aliased_fps = fps(zoom, direct(false, 1));
+        std::vector<uint8_t> aliased_frame = buffer;
+        double aa_fps = fps(zoom, direct(true, 2));
+        std::vector<uint8_t> aa_frame = buffer;
+        double tiled_fps = fps(zoom, tiled(false, 1));
+        REQUIRE(buffer == aliased_frame);
+        double tiled_aa_fps = fps(zoom, tiled(true, 2));
+        REQUIRE(buffer == aa_frame);
+        WARN("Dense layer " << segs.size() << " segments, zoom " << zoom << "x: legacy "
+                            << legacy_fps << " fps, direct " << aliased_fps
+                            << " fps, direct AA width 2 " << aa_fps << " fps; "
+                            << pool.worker_count() << " workers: tiled " << tiled_fps
+                            << " fps, tiled AA width 2 " << tiled_aa_fps << " fps");
+        REQUIRE(aliased_fps > 0.0);
+        if (zoom > 1.0f) {
+            // Zoomed in, most legacy pixels are walked only to fail the bounds check
+            REQUIRE(aliased_fps > legacy_fps);
+        }
+    }
+}